@@ -184,6 +184,13 @@ typedef void * lv_anim_user_data_t;
 /* 1: Use image zoom and rotation*/
 #define LV_USE_IMG_TRANSFORM    1
 
+/* Memory budget (in bytes) of the object layers.
+ * The objects with `lv_obj_set_layer_cache(obj, true)` are rendered together with their children
+ * into an ARGB layer once which is drawn as an image until the object or a child is invalidated.
+ * The scales of the gauges are also drawn from layers if they fit into the free memory.
+ * The least recently used layers are freed to stay within the budget. 0: disable the layer cache*/
+#define LV_LAYER_CACHE_MEM      0
+
 /* 1: Enable object groups (for keyboard/encoder navigation) */
 #define LV_USE_GROUP            1
 #if LV_USE_GROUP
@@ -245,6 +252,40 @@ typedef void * lv_fs_drv_user_data_t;
  * Set it to 0 to disable caching */
 #define LV_IMG_CACHE_DEF_SIZE       1
 
+/* Limit the total size (in bytes) of the decoded images kept in the image cache.
+ * Only the images decoded to RAM count (e.g. PNG or JPG), not the built-in images drawn from flash.
+ * The least valuable images are closed if the limit is exceeded.
+ * 0: no limit, only the number of entries (LV_IMG_CACHE_DEF_SIZE) limits the cache*/
+#define LV_IMG_CACHE_DEF_MEM_LIMIT  0
+
+/* Convert the small indexed and alpha images to true color (with alpha byte only if required)
+ * when they are opened in the image cache. It saves the palette lookup and the bit unpacking on every draw.
+ * LV_IMG_CACHE_CONVERT_MAX_SIZE: maximal size (in bytes) of one converted image
+ * LV_IMG_CACHE_CONVERT_MEM_LIMIT: total size (in bytes) of the converted images. 0: don't convert
+ * Requires LV_IMG_CACHE_DEF_SIZE > 0*/
+#define LV_IMG_CACHE_CONVERT_MAX_SIZE   8192
+#define LV_IMG_CACHE_CONVERT_MEM_LIMIT  0
+
+/* 1: Enable decoding images in the background (e.g. on a worker thread).
+ * The decoders marked with `lv_img_decoder_set_async()` open their images asynchronously
+ * and a placeholder is drawn until the image is ready. Requires LV_IMG_CACHE_DEF_SIZE > 0.
+ * See `lv_img_async_drv_register()` */
+#define LV_USE_IMG_ASYNC    0
+
+/* Size of the read ahead buffer (in bytes) of the built-in decoder for image files.
+ * The lines are read from this buffer instead of a seek and a read for each line.
+ * Also the number of lines read at once from the image decoders while drawing is
+ * limited to fit into this size.
+ * 0: read line by line without buffering */
+#define LV_IMG_READ_BUF_SIZE    2048
+
+/* Memory budget (in bytes) of the transformed image snapshots.
+ * The images with `lv_img_set_transform_cache(img, true)` are rotated/zoomed once into
+ * an ARGB snapshot which is redrawn while the angle, zoom, pivot and source are unchanged.
+ * The least recently used snapshots are freed to stay within the budget.
+ * Requires LV_USE_IMG_TRANSFORM. 0: disable the snapshot cache*/
+#define LV_IMG_TRANSFORM_CACHE_MEM  0
+
 /*Declare the type of the user data of image decoder (can be e.g. `void *`, `int`, `struct`)*/
 typedef void * lv_img_decoder_user_data_t;
 
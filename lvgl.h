@@ -78,6 +78,9 @@ extern "C" {
 #include "src/lv_widgets/lv_spinbox.h"
 
 #include "src/lv_draw/lv_img_cache.h"
+#include "src/lv_draw/lv_img_async.h"
+#include "src/lv_draw/lv_img_trans_cache.h"
+#include "src/lv_core/lv_layer_cache.h"
 
 #include "src/lv_api_map.h"
 
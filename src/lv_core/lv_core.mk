@@ -3,6 +3,7 @@ CSRCS += lv_indev.c
 CSRCS += lv_disp.c
 CSRCS += lv_obj.c
 CSRCS += lv_refr.c
+CSRCS += lv_layer_cache.c
 CSRCS += lv_style.c
 
 DEPPATH += --dep-path $(LVGL_DIR)/$(LVGL_DIR_NAME)/src/lv_core
@@ -45,6 +45,7 @@ static void indev_drag_throw(lv_indev_proc_t * proc);
 static lv_obj_t * get_dragged_obj(lv_obj_t * obj);
 static void indev_gesture(lv_indev_proc_t * proc);
 static bool indev_reset_check(lv_indev_proc_t * proc);
+static bool indev_is_in_use(lv_indev_t * indev);
 
 /**********************
  *  STATIC VARIABLES
@@ -86,7 +87,10 @@ void _lv_indev_read_task(lv_task_t * task)
     /*Handle reset query before processing the point*/
     indev_proc_reset_query_handler(indev_act);
 
-    if(indev_act->proc.disabled) return;
+    if(indev_act->proc.disabled) {
+        if(indev_act->driver.read_on_event) lv_task_set_prio(task, LV_TASK_PRIO_OFF);
+        return;
+    }
     bool more_to_read;
     do {
         /*Read the data*/
@@ -122,6 +126,11 @@ void _lv_indev_read_task(lv_task_t * task)
         indev_proc_reset_query_handler(indev_act);
     } while(more_to_read);
 
+    /*Without a new event the device needs to be read only to follow the pressing and drag throw*/
+    if(indev_act->driver.read_on_event && indev_is_in_use(indev_act) == false) {
+        lv_task_set_prio(task, LV_TASK_PRIO_OFF);
+    }
+
     /*End of indev processing, so no act indev*/
     indev_act     = NULL;
     indev_obj_act = NULL;
@@ -402,6 +411,20 @@ lv_task_t * lv_indev_get_read_task(lv_disp_t * indev)
     return indev->refr_task;
 }
 
+/**
+ * Read an input device in the next `lv_task_handler` call.
+ * With `read_on_event` drivers it should be called when the device has new data (e.g. on touch interrupt).
+ * It's not interrupt safe so it needs to be called from the same context as `lv_task_handler`.
+ * @param indev pointer to an input device
+ */
+void lv_indev_read_event(lv_indev_t * indev)
+{
+    if(indev == NULL || indev->driver.read_task == NULL) return;
+
+    lv_task_set_prio(indev->driver.read_task, LV_TASK_PRIO_HIGH);
+    lv_task_ready(indev->driver.read_task);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -1581,3 +1604,21 @@ static bool indev_reset_check(lv_indev_proc_t * proc)
 
     return proc->reset_query ? true : false;
 }
+
+/**
+ * Tell whether an input device needs to be read even without new event.
+ * @param indev pointer to an input device
+ * @return true: it's pressed or a drag throw is in progress
+ */
+static bool indev_is_in_use(lv_indev_t * indev)
+{
+    if(indev->proc.state == LV_INDEV_STATE_PR) return true;
+
+    if(indev->driver.type == LV_INDEV_TYPE_POINTER || indev->driver.type == LV_INDEV_TYPE_BUTTON) {
+        if(indev->proc.types.pointer.drag_in_prog) return true;
+        if(indev->proc.types.pointer.drag_throw_vect.x != 0) return true;
+        if(indev->proc.types.pointer.drag_throw_vect.y != 0) return true;
+    }
+
+    return false;
+}
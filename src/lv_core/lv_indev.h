@@ -172,6 +172,14 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point);
  */
 lv_task_t * lv_indev_get_read_task(lv_disp_t * indev);
 
+/**
+ * Read an input device in the next `lv_task_handler` call.
+ * With `read_on_event` drivers it should be called when the device has new data (e.g. on touch interrupt).
+ * It's not interrupt safe so it needs to be called from the same context as `lv_task_handler`.
+ * @param indev pointer to an input device
+ */
+void lv_indev_read_event(lv_indev_t * indev);
+
 /**********************
  *      MACROS
  **********************/
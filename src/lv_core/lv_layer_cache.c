@@ -0,0 +1,378 @@
+/**
+ * @file lv_layer_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_layer_cache.h"
+#if LV_LAYER_CACHE_MEM
+
+#include "lv_refr.h"
+#include "lv_disp.h"
+#include "../lv_draw/lv_draw_img.h"
+#include "../lv_draw/lv_draw_mask.h"
+#include "../lv_draw/lv_img_cache.h"
+#include "../lv_misc/lv_debug.h"
+#include "../lv_misc/lv_math.h"
+#include "../lv_misc/lv_mem.h"
+#include "../lv_misc/lv_gc.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const lv_obj_t * obj;
+    lv_img_dsc_t * layer;       /*The object and its children rendered to ARGB image*/
+    uint32_t size;              /*Memory used by the layer*/
+    uint8_t bg : 1;             /*1: only the static parts of the object drawn by a `draw_cb`*/
+} lv_layer_cache_entry_t;
+
+/*A dummy display to make the lv_draw functions draw to a layer*/
+typedef struct {
+    lv_disp_t disp;
+    lv_disp_buf_t disp_buf;
+} layer_disp_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool draw_layer(lv_obj_t * obj, const lv_area_t * mask, lv_layer_cache_draw_cb_t draw_cb);
+static lv_layer_cache_entry_t * find_entry(const lv_obj_t * obj, bool bg);
+static lv_layer_cache_entry_t * add_entry(lv_obj_t * obj, const lv_area_t * area, lv_layer_cache_draw_cb_t draw_cb,
+                                          bool * changed);
+static lv_img_dsc_t * render_layer(lv_obj_t * obj, const lv_area_t * area, lv_layer_cache_draw_cb_t draw_cb,
+                                   bool * changed);
+static void get_layer_area(const lv_obj_t * obj, lv_area_t * area);
+static void entry_free(lv_layer_cache_entry_t * e);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_layer_cache_stat_t stat;
+static const lv_obj_t * rendering;  /*The object being rendered to its layer*/
+static bool rendering_changed;      /*The object being rendered was invalidated meanwhile*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Initialize the layer cache
+ */
+void _lv_layer_cache_init(void)
+{
+    _lv_ll_init(&LV_GC_ROOT(_lv_layer_cache_ll), sizeof(lv_layer_cache_entry_t));
+    _lv_memset_00(&stat, sizeof(stat));
+    rendering = NULL;
+    rendering_changed = false;
+}
+
+/**
+ * Draw an object and its children from their layer.
+ * On the first call the object is rendered with its children into an ARGB layer
+ * which is reused until the object or one of its children is invalidated.
+ * @param obj pointer to an object with enabled layer cache
+ * @param mask the object will be drawn only in this area
+ * @return true: the object is drawn; false: no layer can be created, draw the object normally
+ */
+bool _lv_layer_cache_draw(lv_obj_t * obj, const lv_area_t * mask)
+{
+    /*Draw normally while rendering the layer*/
+    if(obj == rendering) return false;
+
+    return draw_layer(obj, mask, NULL);
+}
+
+/**
+ * Draw the static parts of an object (without its children) from a background layer.
+ * On the first call the layer is rendered with `draw_cb` and it's reused until the whole object
+ * is invalidated with `lv_obj_invalidate` or the size of the object changes.
+ * `lv_obj_invalidate_area` keeps the layer so the dynamic parts (e.g. the needle of a gauge)
+ * can be redrawn above it.
+ * @param obj pointer to an object
+ * @param clip_area the object will be drawn only in this area
+ * @param draw_cb function to draw the static parts of the object
+ * @return true: the background is drawn; false: no layer can be created, call `draw_cb` directly
+ */
+bool _lv_layer_cache_draw_bg(lv_obj_t * obj, const lv_area_t * clip_area, lv_layer_cache_draw_cb_t draw_cb)
+{
+    return draw_layer(obj, clip_area, draw_cb);
+}
+
+/**
+ * Free the layers of an object and its parents because the object is changed
+ * @param obj pointer to an invalidated object
+ */
+void _lv_layer_cache_invalidate(const lv_obj_t * obj)
+{
+    while(obj) {
+        if(obj->layer_cache) {
+            if(obj == rendering) rendering_changed = true;
+            else _lv_layer_cache_remove(obj);
+        }
+        obj = obj->parent;
+    }
+}
+
+/**
+ * Free the layer of an object (e.g. when it's deleted)
+ * @param obj pointer to an object
+ */
+void _lv_layer_cache_remove(const lv_obj_t * obj)
+{
+    lv_layer_cache_entry_t * e = find_entry(obj, false);
+    if(e) {
+        entry_free(e);
+        stat.evict_cnt++;
+    }
+}
+
+/**
+ * Free the background layer of an object because its static parts are changed
+ * @param obj pointer to an object
+ */
+void _lv_layer_cache_remove_bg(const lv_obj_t * obj)
+{
+    lv_layer_cache_entry_t * e = find_entry(obj, true);
+    if(e) {
+        entry_free(e);
+        stat.evict_cnt++;
+    }
+}
+
+/**
+ * Get the statistics of the layer cache.
+ * @param stat_p pointer to a `lv_layer_cache_stat_t` variable to store the result
+ */
+void lv_layer_cache_get_stat(lv_layer_cache_stat_t * stat_p)
+{
+    *stat_p = stat;
+}
+
+/**
+ * Reset the hit, miss and eviction counters of the layer cache.
+ */
+void lv_layer_cache_reset_stat(void)
+{
+    stat.hit_cnt = 0;
+    stat.miss_cnt = 0;
+    stat.evict_cnt = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Draw an object from its layer or background layer. Render the layer if it doesn't exist yet.
+ * @param obj pointer to an object
+ * @param mask the object will be drawn only in this area
+ * @param draw_cb NULL: use the layer of the object with its children;
+ *                else use the background layer drawn by this function
+ * @return true: the object is drawn; false: no layer can be created
+ */
+static bool draw_layer(lv_obj_t * obj, const lv_area_t * mask, lv_layer_cache_draw_cb_t draw_cb)
+{
+    lv_area_t area;
+    get_layer_area(obj, &area);
+
+    lv_area_t clip;
+    if(_lv_area_intersect(&clip, mask, &area) == false) return true;
+
+    lv_layer_cache_entry_t * e = find_entry(obj, draw_cb != NULL);
+
+    /*The layer moves with the object but a new size needs a new layer*/
+    if(e && (e->layer->header.w != lv_area_get_width(&area) || e->layer->header.h != lv_area_get_height(&area))) {
+        entry_free(e);
+        stat.evict_cnt++;
+        e = NULL;
+    }
+
+    bool changed = false;
+    if(e) {
+        /*Keep the most recently used layers at the head*/
+        lv_layer_cache_entry_t * head = _lv_ll_get_head(&LV_GC_ROOT(_lv_layer_cache_ll));
+        if(e != head) _lv_ll_move_before(&LV_GC_ROOT(_lv_layer_cache_ll), e, head);
+        stat.hit_cnt++;
+    }
+    else {
+        e = add_entry(obj, &area, draw_cb, &changed);
+        if(e == NULL) return false;
+    }
+
+    lv_draw_img_dsc_t img_dsc;
+    lv_draw_img_dsc_init(&img_dsc);
+    lv_draw_img(&area, &clip, e->layer, &img_dsc);
+
+    /*The object was invalidated while it was rendered so the layer might be outdated*/
+    if(changed) {
+        entry_free(e);
+        stat.evict_cnt++;
+    }
+
+    return true;
+}
+
+static lv_layer_cache_entry_t * find_entry(const lv_obj_t * obj, bool bg)
+{
+    lv_layer_cache_entry_t * e;
+    _LV_LL_READ(LV_GC_ROOT(_lv_layer_cache_ll), e) {
+        if(e->obj == obj && e->bg == (bg ? 1 : 0)) return e;
+    }
+
+    return NULL;
+}
+
+static lv_layer_cache_entry_t * add_entry(lv_obj_t * obj, const lv_area_t * area, lv_layer_cache_draw_cb_t draw_cb,
+                                          bool * changed)
+{
+    uint32_t size = lv_img_buf_get_img_size(lv_area_get_width(area), lv_area_get_height(area),
+                                            LV_IMG_CF_TRUE_COLOR_ALPHA) + sizeof(lv_img_dsc_t);
+    if(size > LV_LAYER_CACHE_MEM) return NULL;
+
+    /* The background layers are redrawn in every frame (e.g. many gauges with moving needles)
+     * so evicting each other would render them again and again. Use only the free memory for them.*/
+    if(draw_cb && stat.used_size + size > LV_LAYER_CACHE_MEM) return NULL;
+
+    /*Free the least recently used layers to fit into the budget*/
+    while(stat.used_size + size > LV_LAYER_CACHE_MEM) {
+        lv_layer_cache_entry_t * tail = _lv_ll_get_tail(&LV_GC_ROOT(_lv_layer_cache_ll));
+        if(tail == NULL) break;
+        entry_free(tail);
+        stat.evict_cnt++;
+    }
+
+    lv_img_dsc_t * layer = render_layer(obj, area, draw_cb, changed);
+    if(layer == NULL) return NULL;
+
+    lv_layer_cache_entry_t * e = _lv_ll_ins_head(&LV_GC_ROOT(_lv_layer_cache_ll));
+    LV_ASSERT_MEM(e);
+    if(e == NULL) {
+        lv_img_buf_free(layer);
+        return NULL;
+    }
+
+    e->obj = obj;
+    e->layer = layer;
+    e->size = size;
+    e->bg = draw_cb ? 1 : 0;
+    stat.used_size += size;
+    stat.entry_cnt++;
+    stat.miss_cnt++;
+
+    return e;
+}
+
+/**
+ * Render an object and its children into a new `LV_IMG_CF_TRUE_COLOR_ALPHA` image
+ * @param obj pointer to an object
+ * @param area the area of the layer (absolute coordinates)
+ * @param draw_cb NULL: render the object with its children; else render only with this function
+ * @param changed store here if the object was invalidated while it was rendered
+ * @return the layer allocated with `lv_img_buf_alloc` or NULL on error
+ */
+static lv_img_dsc_t * render_layer(lv_obj_t * obj, const lv_area_t * area, lv_layer_cache_draw_cb_t draw_cb,
+                                   bool * changed)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t h = lv_area_get_height(area);
+    lv_img_dsc_t * layer = lv_img_buf_alloc(w, h, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    if(layer == NULL) return NULL;
+
+    layer_disp_t * ld = lv_mem_alloc(sizeof(layer_disp_t));
+    LV_ASSERT_MEM(ld);
+    if(ld == NULL) {
+        lv_img_buf_free(layer);
+        return NULL;
+    }
+
+    /* Create a dummy display to fool the lv_draw functions.
+     * They will think they draw to the area of the layer on the real screen. */
+    lv_disp_t * disp_refr = _lv_refr_get_disp_refreshing();
+    _lv_memset_00(&ld->disp, sizeof(lv_disp_t));
+
+    lv_disp_buf_init(&ld->disp_buf, (void *)layer->data, NULL, w * h);
+    lv_area_copy(&ld->disp_buf.area, area);
+
+    lv_disp_drv_init(&ld->disp.driver);
+
+    /*The draw functions might allocate lines of `hor_res` width*/
+    ld->disp.driver.buffer  = &ld->disp_buf;
+    ld->disp.driver.hor_res = LV_MATH_MAX(w, lv_disp_get_hor_res(disp_refr));
+    ld->disp.driver.ver_res = LV_MATH_MAX(h, lv_disp_get_ver_res(disp_refr));
+    ld->disp.driver.dpi     = disp_refr->driver.dpi;
+    ld->disp.driver.buf_cf  = LV_IMG_CF_TRUE_COLOR_ALPHA;
+#if LV_ANTIALIAS
+    ld->disp.driver.antialiasing = disp_refr->driver.antialiasing;
+#endif
+
+    /*The masks of the parents (e.g. clip corner) would be rendered into the layer*/
+    _lv_draw_mask_saved_arr_t masks;
+    _lv_draw_mask_save_all(masks);
+    _lv_refr_set_disp_refreshing(&ld->disp);
+
+    if(draw_cb) {
+        /*The background layer is freed only with `lv_obj_invalidate` which can't happen while drawing*/
+        draw_cb(obj, area);
+        *changed = false;
+    }
+    else {
+        /*Layers might be nested*/
+        const lv_obj_t * rendering_prev = rendering;
+        bool rendering_changed_prev = rendering_changed;
+        rendering = obj;
+        rendering_changed = false;
+
+        _lv_refr_obj(obj, area);
+
+        *changed = rendering_changed;
+        rendering = rendering_prev;
+        rendering_changed = rendering_changed_prev;
+    }
+
+    _lv_refr_set_disp_refreshing(disp_refr);
+    _lv_draw_mask_restore_all(masks);
+
+    lv_mem_free(ld);
+
+    return layer;
+}
+
+/**
+ * Get the area of the layer: the object with its extra draw size
+ * @param obj pointer to an object
+ * @param area store the result area here (absolute coordinates)
+ */
+static void get_layer_area(const lv_obj_t * obj, lv_area_t * area)
+{
+    lv_coord_t ext_size = obj->ext_draw_pad;
+    lv_obj_get_coords(obj, area);
+    area->x1 -= ext_size;
+    area->y1 -= ext_size;
+    area->x2 += ext_size;
+    area->y2 += ext_size;
+}
+
+static void entry_free(lv_layer_cache_entry_t * e)
+{
+    /*The layer is drawn as an image so it might be opened in the image cache*/
+    lv_img_cache_invalidate_src(e->layer);
+    lv_img_buf_free(e->layer);
+
+    stat.used_size -= e->size;
+    stat.entry_cnt--;
+    _lv_ll_remove(&LV_GC_ROOT(_lv_layer_cache_ll), e);
+    lv_mem_free(e);
+}
+
+#endif /*LV_LAYER_CACHE_MEM*/
@@ -0,0 +1,117 @@
+/**
+ * @file lv_layer_cache.h
+ *
+ */
+
+#ifndef LV_LAYER_CACHE_H
+#define LV_LAYER_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_LAYER_CACHE_MEM
+
+#include "lv_obj.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Draw the static parts of an object into its background layer
+ */
+typedef void (*lv_layer_cache_draw_cb_t)(lv_obj_t * obj, const lv_area_t * clip_area);
+
+/**
+ * Statistics of the layer cache
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of draws served from a layer*/
+    uint32_t miss_cnt;      /**< Number of layers rendered*/
+    uint32_t evict_cnt;     /**< Number of layers freed to make room or invalidated*/
+    uint32_t used_size;     /**< Memory used by the layers in bytes*/
+    uint32_t entry_cnt;     /**< Number of cached layers*/
+} lv_layer_cache_stat_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the layer cache
+ */
+void _lv_layer_cache_init(void);
+
+/**
+ * Draw an object and its children from their layer.
+ * On the first call the object is rendered with its children into an ARGB layer
+ * which is reused until the object or one of its children is invalidated.
+ * @param obj pointer to an object with enabled layer cache
+ * @param mask the object will be drawn only in this area
+ * @return true: the object is drawn; false: no layer can be created, draw the object normally
+ */
+bool _lv_layer_cache_draw(lv_obj_t * obj, const lv_area_t * mask);
+
+/**
+ * Free the layers of an object and its parents because the object is changed
+ * @param obj pointer to an invalidated object
+ */
+void _lv_layer_cache_invalidate(const lv_obj_t * obj);
+
+/**
+ * Free the layer of an object (e.g. when it's deleted)
+ * @param obj pointer to an object
+ */
+void _lv_layer_cache_remove(const lv_obj_t * obj);
+
+/**
+ * Draw the static parts of an object (without its children) from a background layer.
+ * On the first call the layer is rendered with `draw_cb` and it's reused until the whole object
+ * is invalidated with `lv_obj_invalidate` or the size of the object changes.
+ * `lv_obj_invalidate_area` keeps the layer so the dynamic parts (e.g. the needle of a gauge)
+ * can be redrawn above it.
+ * @param obj pointer to an object
+ * @param clip_area the object will be drawn only in this area
+ * @param draw_cb function to draw the static parts of the object
+ * @return true: the background is drawn; false: no layer can be created, call `draw_cb` directly
+ */
+bool _lv_layer_cache_draw_bg(lv_obj_t * obj, const lv_area_t * clip_area, lv_layer_cache_draw_cb_t draw_cb);
+
+/**
+ * Free the background layer of an object because its static parts are changed
+ * @param obj pointer to an object
+ */
+void _lv_layer_cache_remove_bg(const lv_obj_t * obj);
+
+/**
+ * Get the statistics of the layer cache.
+ * @param stat_p pointer to a `lv_layer_cache_stat_t` variable to store the result
+ */
+void lv_layer_cache_get_stat(lv_layer_cache_stat_t * stat_p);
+
+/**
+ * Reset the hit, miss and eviction counters of the layer cache.
+ */
+void lv_layer_cache_reset_stat(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_LAYER_CACHE_MEM*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_LAYER_CACHE_H*/
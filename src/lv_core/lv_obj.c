@@ -11,9 +11,12 @@
 #include "lv_refr.h"
 #include "lv_group.h"
 #include "lv_disp.h"
+#include "lv_layer_cache.h"
 #include "../lv_misc/lv_debug.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_draw/lv_draw.h"
+#include "../lv_draw/lv_img_async.h"
+#include "../lv_draw/lv_img_trans_cache.h"
 #include "../lv_misc/lv_anim.h"
 #include "../lv_misc/lv_task.h"
 #include "../lv_misc/lv_async.h"
@@ -57,9 +60,7 @@ typedef struct _lv_event_temp_data {
 } lv_event_temp_data_t;
 
 typedef struct {
-    lv_obj_t * obj;
     lv_style_property_t prop;
-    uint8_t part;
     union {
         lv_color_t _color;
         lv_style_int_t _int;
@@ -72,6 +73,14 @@ typedef struct {
         lv_opa_t _opa;
         const void * _ptr;
     } end_value;
+} lv_style_trans_prop_t;
+
+/*All the properties of an object's part which are transitioned together by one animation*/
+typedef struct {
+    lv_obj_t * obj;
+    uint8_t part;
+    uint8_t prop_cnt;
+    lv_style_trans_prop_t props[LV_STYLE_TRANS_NUM_MAX];
 } lv_style_trans_t;
 
 typedef struct {
@@ -124,8 +133,8 @@ static void obj_align_core(lv_obj_t * obj, const lv_obj_t * base, lv_align_t ali
 static void obj_align_mid_core(lv_obj_t * obj, const lv_obj_t * base, lv_align_t align,  bool x_set, bool y_set,
                                lv_coord_t x_ofs, lv_coord_t y_ofs);
 #if LV_USE_ANIMATION
-static lv_style_trans_t * trans_create(lv_obj_t * obj, lv_style_property_t prop, uint8_t part, lv_state_t prev_state,
-                                       lv_state_t new_state);
+static bool trans_create(lv_obj_t * obj, lv_style_property_t prop, uint8_t part, lv_state_t prev_state,
+                         lv_state_t new_state, lv_style_trans_prop_t * tr_prop);
 static void trans_del(lv_obj_t * obj, uint8_t part, lv_style_property_t prop, lv_style_trans_t * tr_limit);
 static void trans_anim_cb(lv_style_trans_t * tr, lv_anim_value_t v);
 static void trans_anim_start_cb(lv_anim_t * a);
@@ -140,6 +149,8 @@ static void obj_del_core(lv_obj_t * obj);
 static void update_style_cache(lv_obj_t * obj, uint8_t part, uint16_t prop);
 static void update_style_cache_children(lv_obj_t * obj);
 static void invalidate_style_cache(lv_obj_t * obj, uint8_t part, lv_style_property_t prop);
+static bool style_prop_is_cacheble(lv_style_property_t prop);
+static bool style_prop_needs_refr(lv_style_property_t prop);
 static void style_snapshot(lv_obj_t * obj, uint8_t part, style_snapshot_t * shot);
 static style_snapshot_res_t style_snapshot_compare(style_snapshot_t * shot1, style_snapshot_t * shot2);
 
@@ -218,6 +229,15 @@ void lv_init(void)
     _lv_img_decoder_init();
 #if LV_IMG_CACHE_DEF_SIZE
     lv_img_cache_set_size(LV_IMG_CACHE_DEF_SIZE);
+#endif
+#if LV_USE_IMG_ASYNC
+    _lv_img_async_init();
+#endif
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_MEM
+    _lv_img_trans_cache_init();
+#endif
+#if LV_LAYER_CACHE_MEM
+    _lv_layer_cache_init();
 #endif
     /*Test if the IDE has UTF-8 encoding*/
     char * txt = "Á";
@@ -367,6 +387,10 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const lv_obj_t * copy)
 
     /*Set attributes*/
     new_obj->adv_hittest  = 0;
+#if LV_LAYER_CACHE_MEM
+    new_obj->layer_cache  = 0;
+#endif
+    new_obj->scroll_blit  = 0;
     new_obj->click        = 1;
     new_obj->drag         = 0;
     new_obj->drag_throw   = 0;
@@ -424,6 +448,10 @@ lv_obj_t * lv_obj_create(lv_obj_t * parent, const lv_obj_t * copy)
 
         /*Copy attributes*/
         new_obj->adv_hittest  = copy->adv_hittest;
+#if LV_LAYER_CACHE_MEM
+        new_obj->layer_cache  = copy->layer_cache;
+#endif
+        new_obj->scroll_blit  = copy->scroll_blit;
         new_obj->click        = copy->click;
         new_obj->drag         = copy->drag;
         new_obj->drag_dir     = copy->drag_dir;
@@ -544,6 +572,11 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
 
+#if LV_LAYER_CACHE_MEM
+    /*The layers need to be rendered again even if the object is not visible now*/
+    _lv_layer_cache_invalidate(obj);
+#endif
+
     lv_area_t area_tmp;
     lv_area_copy(&area_tmp, area);
     bool visible = lv_obj_area_is_visible(obj, &area_tmp);
@@ -568,6 +601,11 @@ void lv_obj_invalidate(const lv_obj_t * obj)
     obj_coords.x2 += ext_size;
     obj_coords.y2 += ext_size;
 
+#if LV_LAYER_CACHE_MEM
+    /*The whole object has changed so its static parts need to be rendered again too*/
+    _lv_layer_cache_remove_bg(obj);
+#endif
+
     lv_obj_invalidate_area(obj, &obj_coords);
 
 }
@@ -781,8 +819,18 @@ void lv_obj_set_pos(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
      * occur without position change*/
     if(diff.x == 0 && diff.y == 0) return;
 
+    /*Try to move the already rendered content instead of redrawing the object*/
+    bool blit = obj->scroll_blit && _lv_inv_scroll(obj, diff.x, diff.y);
+
     /*Invalidate the original area*/
-    lv_obj_invalidate(obj);
+    if(blit) {
+#if LV_LAYER_CACHE_MEM
+        _lv_layer_cache_invalidate(obj);
+#endif
+    }
+    else {
+        lv_obj_invalidate(obj);
+    }
 
     /*Save the original coordinates*/
     lv_area_t ori;
@@ -802,7 +850,7 @@ void lv_obj_set_pos(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
     if(par) par->signal_cb(par, LV_SIGNAL_CHILD_CHG, obj);
 
     /*Invalidate the new area*/
-    lv_obj_invalidate(obj);
+    if(blit == false) lv_obj_invalidate(obj);
 }
 
 /**
@@ -1176,7 +1224,7 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, lv_coord_t left, lv_coord_t right
  * E.g. `LV_OBJ_PART_MAIN`, `LV_BTN_PART_MAIN`, `LV_SLIDER_PART_KNOB`
  * @param style pointer to a style to add (Only its pointer will be saved)
  */
-void lv_obj_add_style(lv_obj_t * obj, uint8_t part, lv_style_t * style)
+void lv_obj_add_style(lv_obj_t * obj, uint8_t part, const lv_style_t * style)
 {
     if(style == NULL) return;
 
@@ -1200,7 +1248,7 @@ void lv_obj_add_style(lv_obj_t * obj, uint8_t part, lv_style_t * style)
  * E.g. `LV_OBJ_PART_MAIN`, `LV_BTN_PART_MAIN`, `LV_SLIDER_PART_KNOB`
  * @param style pointer to a style to remove
  */
-void lv_obj_remove_style(lv_obj_t * obj, uint8_t part, lv_style_t * style)
+void lv_obj_remove_style(lv_obj_t * obj, uint8_t part, const lv_style_t * style)
 {
     if(style == NULL) return;
 
@@ -1374,49 +1422,7 @@ void lv_obj_refresh_style(lv_obj_t * obj, uint8_t part, lv_style_property_t prop
     invalidate_style_cache(obj, part, prop);
 
     /*If a real style refresh is required*/
-    bool real_refr = false;
-    switch(prop) {
-        case LV_STYLE_PROP_ALL:
-        case LV_STYLE_CLIP_CORNER:
-        case LV_STYLE_SIZE:
-        case LV_STYLE_TRANSFORM_WIDTH:
-        case LV_STYLE_TRANSFORM_HEIGHT:
-        case LV_STYLE_TRANSFORM_ANGLE:
-        case LV_STYLE_TRANSFORM_ZOOM:
-        case LV_STYLE_PAD_TOP:
-        case LV_STYLE_PAD_BOTTOM:
-        case LV_STYLE_PAD_LEFT:
-        case LV_STYLE_PAD_RIGHT:
-        case LV_STYLE_PAD_INNER:
-        case LV_STYLE_MARGIN_TOP:
-        case LV_STYLE_MARGIN_BOTTOM:
-        case LV_STYLE_MARGIN_LEFT:
-        case LV_STYLE_MARGIN_RIGHT:
-        case LV_STYLE_OUTLINE_WIDTH:
-        case LV_STYLE_OUTLINE_PAD:
-        case LV_STYLE_OUTLINE_OPA:
-        case LV_STYLE_SHADOW_WIDTH:
-        case LV_STYLE_SHADOW_OPA:
-        case LV_STYLE_SHADOW_OFS_X:
-        case LV_STYLE_SHADOW_OFS_Y:
-        case LV_STYLE_SHADOW_SPREAD:
-        case LV_STYLE_VALUE_LETTER_SPACE:
-        case LV_STYLE_VALUE_LINE_SPACE:
-        case LV_STYLE_VALUE_OFS_X:
-        case LV_STYLE_VALUE_OFS_Y:
-        case LV_STYLE_VALUE_ALIGN:
-        case LV_STYLE_VALUE_STR:
-        case LV_STYLE_VALUE_FONT:
-        case LV_STYLE_VALUE_OPA:
-        case LV_STYLE_TEXT_LETTER_SPACE:
-        case LV_STYLE_TEXT_LINE_SPACE:
-        case LV_STYLE_TEXT_FONT:
-        case LV_STYLE_LINE_WIDTH:
-            real_refr = true;
-            break;
-        default:
-            real_refr = false;
-    }
+    bool real_refr = style_prop_needs_refr(prop);
 
     if(real_refr) {
         lv_obj_invalidate(obj);
@@ -1515,6 +1521,25 @@ void lv_obj_set_adv_hittest(lv_obj_t * obj, bool en)
     obj->adv_hittest = en == false ? 0 : 1;
 }
 
+#if LV_LAYER_CACHE_MEM
+/**
+ * Render the object with its children into a cached ARGB layer and draw it from there
+ * until the object or one of its children is invalidated.
+ * Useful for complex but rarely changing objects which are redrawn often because of other objects.
+ * @param obj pointer to an object
+ * @param en true: enable the layer cache
+ */
+void lv_obj_set_layer_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
+
+    if(obj->layer_cache == (en ? 1 : 0)) return;
+
+    if(!en) _lv_layer_cache_remove(obj);
+    obj->layer_cache = en ? 1 : 0;
+}
+#endif
+
 /**
  * Enable or disable the clicking of an object
  * @param obj pointer to an object
@@ -1751,34 +1776,47 @@ void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
         props[4] = lv_obj_get_style_transition_prop_5(obj, part);
         props[5] = lv_obj_get_style_transition_prop_6(obj, part);
 
+        /*Collect all the changed properties of the part into one transition
+         *to update them with a single animation and refresh*/
+        lv_style_trans_t * tr = NULL;
         uint8_t i;
         for(i = 0; i < LV_STYLE_TRANS_NUM_MAX; i++) {
-            if(props[i] != 0) {
-                _lv_style_list_add_trans_style(style_list);
-
-                lv_style_trans_t * tr = trans_create(obj, props[i], part, prev_state, new_state);
-
-                /*If there is a pending anim for this property remove it*/
-                if(tr) {
-                    tr->obj = obj;
-                    tr->prop = props[i];
-                    tr->part = part;
-
-                    lv_anim_t a;
-                    lv_anim_init(&a);
-                    lv_anim_set_var(&a, tr);
-                    lv_anim_set_exec_cb(&a, (lv_anim_exec_xcb_t)trans_anim_cb);
-                    lv_anim_set_start_cb(&a, trans_anim_start_cb);
-                    lv_anim_set_ready_cb(&a, trans_anim_ready_cb);
-                    lv_anim_set_values(&a, 0x00, 0xFF);
-                    lv_anim_set_time(&a, time);
-                    lv_anim_set_delay(&a, delay);
-                    lv_anim_set_path(&a, path);
-                    a.early_apply = 0;
-                    lv_anim_start(&a);
-                }
+            if(props[i] == 0) continue;
+
+            _lv_style_list_add_trans_style(style_list);
 
+            if(tr == NULL) {
+                tr = _lv_ll_ins_head(&LV_GC_ROOT(_lv_obj_style_trans_ll));
+                LV_ASSERT_MEM(tr);
+                if(tr == NULL) break;
+                tr->obj = obj;
+                tr->part = part;
+                tr->prop_cnt = 0;
             }
+
+            if(trans_create(obj, props[i], part, prev_state, new_state, &tr->props[tr->prop_cnt])) {
+                tr->props[tr->prop_cnt].prop = props[i];
+                tr->prop_cnt++;
+            }
+        }
+
+        if(tr && tr->prop_cnt == 0) {
+            _lv_ll_remove(&LV_GC_ROOT(_lv_obj_style_trans_ll), tr);
+            lv_mem_free(tr);
+        }
+        else if(tr) {
+            lv_anim_t a;
+            lv_anim_init(&a);
+            lv_anim_set_var(&a, tr);
+            lv_anim_set_exec_cb(&a, (lv_anim_exec_xcb_t)trans_anim_cb);
+            lv_anim_set_start_cb(&a, trans_anim_start_cb);
+            lv_anim_set_ready_cb(&a, trans_anim_ready_cb);
+            lv_anim_set_values(&a, 0x00, 0xFF);
+            lv_anim_set_time(&a, time);
+            lv_anim_set_delay(&a, delay);
+            lv_anim_set_path(&a, path);
+            a.early_apply = 0;
+            lv_anim_start(&a);
         }
         if(cmp_res == STYLE_COMPARE_DIFF) lv_obj_refresh_style(obj, part, LV_STYLE_PROP_ALL);
 
@@ -2938,6 +2976,20 @@ bool lv_obj_get_adv_hittest(const lv_obj_t * obj)
     return obj->adv_hittest == 0 ? false : true;
 }
 
+#if LV_LAYER_CACHE_MEM
+/**
+ * Get whether the object is drawn from a cached layer
+ * @param obj pointer to an object
+ * @return true: the layer cache is enabled
+ */
+bool lv_obj_get_layer_cache(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, LV_OBJX_NAME);
+
+    return obj->layer_cache == 0 ? false : true;
+}
+#endif
+
 /**
  * Get the click enable attribute of an object
  * @param obj pointer to an object
@@ -3791,6 +3843,15 @@ static void obj_del_core(lv_obj_t * obj)
 
     lv_event_mark_deleted(obj);
 
+#if LV_LAYER_CACHE_MEM
+    if(obj->layer_cache) _lv_layer_cache_remove(obj);
+#endif
+
+#if LV_USE_IMG_ASYNC
+    /*Don't invalidate the object when its images are decoded*/
+    _lv_img_async_remove_waiter(obj, NULL);
+#endif
+
     /* Reset all input devices if the object to delete is used*/
     lv_indev_t * indev = lv_indev_get_next(NULL);
     while(indev) {
@@ -4271,19 +4332,19 @@ static void obj_align_mid_core(lv_obj_t * obj, const lv_obj_t * base, lv_align_t
 #if LV_USE_ANIMATION
 
 /**
- * Allocate and initialize a transition for a property of an object if the properties value is different in the new state.
- * It allocates `lv_style_trans_t` in `_lv_obj_style_trans_ll` and set only `start/end_values`. No animation will be created here.
+ * Initialize the transition of a property of an object if the properties value is different in the new state.
+ * It sets only `start/end_values` of `tr_prop`. No animation will be created here.
  * @param obj and object to add the transition
  * @param prop the property to apply the transaction
  * @param part the part of the object to apply the transaction
  * @param prev_state the previous state of the objects
  * @param new_state the new state of the object
- * @return pointer to the allocated `the transaction` variable or `NULL` if no transition created
+ * @param tr_prop store the start and end values here
+ * @return true: the property changes so a transition is required; false: the property is the same in both states
  */
-static lv_style_trans_t * trans_create(lv_obj_t * obj, lv_style_property_t prop, uint8_t part, lv_state_t prev_state,
-                                       lv_state_t new_state)
+static bool trans_create(lv_obj_t * obj, lv_style_property_t prop, uint8_t part, lv_state_t prev_state,
+                         lv_state_t new_state, lv_style_trans_prop_t * tr_prop)
 {
-    lv_style_trans_t * tr;
     lv_style_list_t * style_list = lv_obj_get_style_list(obj, part);
     lv_style_t * style_trans = _lv_style_list_get_transition_style(style_list);
 
@@ -4300,7 +4361,7 @@ static lv_style_trans_t * trans_create(lv_obj_t * obj, lv_style_property_t prop,
         style_list->skip_trans = 0;
         style_list->ignore_cache = cache_ori;
 
-        if(int1 == int2)  return NULL;
+        if(int1 == int2)  return false;
         obj->state = prev_state;
         int1 = _lv_obj_get_style_int(obj, part, prop);
         obj->state = new_state;
@@ -4315,11 +4376,8 @@ static lv_style_trans_t * trans_create(lv_obj_t * obj, lv_style_property_t prop,
             }
         }
 
-        tr = _lv_ll_ins_head(&LV_GC_ROOT(_lv_obj_style_trans_ll));
-        LV_ASSERT_MEM(tr);
-        if(tr == NULL) return NULL;
-        tr->start_value._int = int1;
-        tr->end_value._int = int2;
+        tr_prop->start_value._int = int1;
+        tr_prop->end_value._int = int2;
     }
     else if((prop & 0xF) < LV_STYLE_ID_OPA) { /*Color*/
         style_list->skip_trans = 1;
@@ -4331,17 +4389,14 @@ static lv_style_trans_t * trans_create(lv_obj_t * obj, lv_style_property_t prop,
         style_list->skip_trans = 0;
         style_list->ignore_cache = cache_ori;
 
-        if(c1.full == c2.full) return NULL;
+        if(c1.full == c2.full) return false;
         obj->state = prev_state;
         c1 = _lv_obj_get_style_color(obj, part, prop);
         obj->state = new_state;
         _lv_style_set_color(style_trans, prop, c1);    /*Be sure `trans_style` has a valid value */
 
-        tr = _lv_ll_ins_head(&LV_GC_ROOT(_lv_obj_style_trans_ll));
-        LV_ASSERT_MEM(tr);
-        if(tr == NULL) return NULL;
-        tr->start_value._color = c1;
-        tr->end_value._color = c2;
+        tr_prop->start_value._color = c1;
+        tr_prop->end_value._color = c2;
     }
     else if((prop & 0xF) < LV_STYLE_ID_PTR) { /*Opa*/
         style_list->skip_trans = 1;
@@ -4353,18 +4408,15 @@ static lv_style_trans_t * trans_create(lv_obj_t * obj, lv_style_property_t prop,
         style_list->skip_trans = 0;
         style_list->ignore_cache = cache_ori;
 
-        if(o1 == o2) return NULL;
+        if(o1 == o2) return false;
 
         obj->state = prev_state;
         o1 = _lv_obj_get_style_opa(obj, part, prop);
         obj->state = new_state;
         _lv_style_set_opa(style_trans, prop, o1);   /*Be sure `trans_style` has a valid value */
 
-        tr = _lv_ll_ins_head(&LV_GC_ROOT(_lv_obj_style_trans_ll));
-        LV_ASSERT_MEM(tr);
-        if(tr == NULL) return NULL;
-        tr->start_value._opa = o1;
-        tr->end_value._opa = o2;
+        tr_prop->start_value._opa = o1;
+        tr_prop->end_value._opa = o2;
     }
     else {      /*Ptr*/
         obj->state = prev_state;
@@ -4376,26 +4428,23 @@ static lv_style_trans_t * trans_create(lv_obj_t * obj, lv_style_property_t prop,
         style_list->skip_trans = 0;
         style_list->ignore_cache = cache_ori;
 
-        if(memcmp(&p1, &p2, sizeof(const void *)) == 0)  return NULL;
+        if(memcmp(&p1, &p2, sizeof(const void *)) == 0)  return false;
         obj->state = prev_state;
         p1 = _lv_obj_get_style_ptr(obj, part, prop);
         obj->state = new_state;
         _lv_style_set_ptr(style_trans, prop, p1);   /*Be sure `trans_style` has a valid value */
 
-        tr = _lv_ll_ins_head(&LV_GC_ROOT(_lv_obj_style_trans_ll));
-        LV_ASSERT_MEM(tr);
-        if(tr == NULL) return NULL;
-        tr->start_value._ptr = p1;
-        tr->end_value._ptr = p2;
+        tr_prop->start_value._ptr = p1;
+        tr_prop->end_value._ptr = p2;
     }
 
-    return tr;
+    return true;
 }
 
 /**
  * Remove the transition from object's part's property.
- * - Remove the transition from `_lv_obj_style_trans_ll` and free it
- * - Delete pending transitions
+ * - Remove the property from the transitions in `_lv_obj_style_trans_ll`
+ * - Delete the transitions (and their animation) which has no more properties
  * @param obj pointer to an object which transition(s) should be removed
  * @param part a part of object or 0xFF to remove from all parts
  * @param prop a property or 0xFF to remove all properties
@@ -4412,16 +4461,31 @@ static void trans_del(lv_obj_t * obj, uint8_t part, lv_style_property_t prop, lv
         /*'tr' might be deleted, so get the next object while 'tr' is valid*/
         tr_prev = _lv_ll_get_prev(&LV_GC_ROOT(_lv_obj_style_trans_ll), tr);
 
-        if(tr->obj == obj && (part == tr->part || part == 0xFF) && (prop == tr->prop || prop == 0xFF)) {
-            /* Remove the transitioned property from trans. style
-             * to allow changing it by normal styles*/
+        if(tr->obj == obj && (part == tr->part || part == 0xFF)) {
             lv_style_list_t * list = lv_obj_get_style_list(tr->obj, tr->part);
             lv_style_t * style_trans = _lv_style_list_get_transition_style(list);
-            lv_style_remove_prop(style_trans, tr->prop);
 
-            lv_anim_del(tr, NULL);
-            _lv_ll_remove(&LV_GC_ROOT(_lv_obj_style_trans_ll), tr);
-            lv_mem_free(tr);
+            uint8_t i = 0;
+            while(i < tr->prop_cnt) {
+                if(prop == tr->props[i].prop || prop == 0xFF) {
+                    /* Remove the transitioned property from trans. style
+                     * to allow changing it by normal styles*/
+                    lv_style_remove_prop(style_trans, tr->props[i].prop);
+
+                    /*Move the last property here to keep the array continuous*/
+                    tr->prop_cnt--;
+                    tr->props[i] = tr->props[tr->prop_cnt];
+                }
+                else {
+                    i++;
+                }
+            }
+
+            if(tr->prop_cnt == 0) {
+                lv_anim_del(tr, NULL);
+                _lv_ll_remove(&LV_GC_ROOT(_lv_obj_style_trans_ll), tr);
+                lv_mem_free(tr);
+            }
         }
         tr = tr_prev;
     }
@@ -4432,86 +4496,116 @@ static void trans_anim_cb(lv_style_trans_t * tr, lv_anim_value_t v)
     lv_style_list_t * list = lv_obj_get_style_list(tr->obj, tr->part);
     lv_style_t * style = _lv_style_list_get_transition_style(list);
 
-    if((tr->prop & 0xF) < LV_STYLE_ID_COLOR) { /*Value*/
-        lv_style_int_t x;
-        if(v == 0) x = tr->start_value._int;
-        else if(v == 255) x = tr->end_value._int;
-        else x = tr->start_value._int + ((int32_t)((int32_t)(tr->end_value._int - tr->start_value._int) * v) >> 8);
-        _lv_style_set_int(style, tr->prop, x);
-    }
-    else if((tr->prop & 0xF) < LV_STYLE_ID_OPA) { /*Color*/
-        lv_color_t x;
-        if(v <= 0) x = tr->start_value._color;
-        else if(v >= 255) x = tr->end_value._color;
-        else x = lv_color_mix(tr->end_value._color, tr->start_value._color, v);
-        _lv_style_set_color(style, tr->prop, x);
-    }
-    else if((tr->prop & 0xF) < LV_STYLE_ID_PTR) { /*Opa*/
-        lv_opa_t x;
-        if(v <= 0) x = tr->start_value._opa;
-        else if(v >= 255) x = tr->end_value._opa;
-        else x = tr->start_value._opa + (((tr->end_value._opa - tr->start_value._opa) * v) >> 8);
-        _lv_style_set_opa(style, tr->prop, x);
+    lv_style_property_t refr_prop = 0;
+    lv_style_property_t cache_prop = 0;
+    uint8_t refr_cnt = 0;
+
+    uint8_t i;
+    for(i = 0; i < tr->prop_cnt; i++) {
+        lv_style_trans_prop_t * tr_prop = &tr->props[i];
+        if((tr_prop->prop & 0xF) < LV_STYLE_ID_COLOR) { /*Value*/
+            lv_style_int_t x;
+            if(v == 0) x = tr_prop->start_value._int;
+            else if(v == 255) x = tr_prop->end_value._int;
+            else x = tr_prop->start_value._int + ((int32_t)((int32_t)(tr_prop->end_value._int - tr_prop->start_value._int) * v) >> 8);
+            _lv_style_set_int(style, tr_prop->prop, x);
+        }
+        else if((tr_prop->prop & 0xF) < LV_STYLE_ID_OPA) { /*Color*/
+            lv_color_t x;
+            if(v <= 0) x = tr_prop->start_value._color;
+            else if(v >= 255) x = tr_prop->end_value._color;
+            else x = lv_color_mix(tr_prop->end_value._color, tr_prop->start_value._color, v);
+            _lv_style_set_color(style, tr_prop->prop, x);
+        }
+        else if((tr_prop->prop & 0xF) < LV_STYLE_ID_PTR) { /*Opa*/
+            lv_opa_t x;
+            if(v <= 0) x = tr_prop->start_value._opa;
+            else if(v >= 255) x = tr_prop->end_value._opa;
+            else x = tr_prop->start_value._opa + (((tr_prop->end_value._opa - tr_prop->start_value._opa) * v) >> 8);
+            _lv_style_set_opa(style, tr_prop->prop, x);
+        }
+        else {
+            const void * x;
+            if(v < 128) x = tr_prop->start_value._ptr;
+            else x = tr_prop->end_value._ptr;
+            _lv_style_set_ptr(style, tr_prop->prop, x);
+        }
+
+        if(style_prop_needs_refr(tr_prop->prop)) {
+            refr_prop = tr_prop->prop;
+            refr_cnt++;
+        }
+        else if(style_prop_is_cacheble(tr_prop->prop)) {
+            cache_prop = tr_prop->prop;
+        }
+    }
+
+    /*Refresh the object only once for all the properties updated in this step*/
+    if(refr_cnt > 1) {
+        lv_obj_refresh_style(tr->obj, tr->part, LV_STYLE_PROP_ALL);
     }
     else {
-        const void * x;
-        if(v < 128) x = tr->start_value._ptr;
-        else x = tr->end_value._ptr;
-        _lv_style_set_ptr(style, tr->prop, x);
-    }
-    lv_obj_refresh_style(tr->obj, tr->part, tr->prop);
+        /*The cache is invalidated for every part so it's enough to do it once*/
+        if(cache_prop) invalidate_style_cache(tr->obj, tr->part, cache_prop);
 
+        if(refr_cnt == 1) lv_obj_refresh_style(tr->obj, tr->part, refr_prop);
+        else lv_obj_invalidate(tr->obj);
+    }
 }
 
 static void trans_anim_start_cb(lv_anim_t * a)
 {
     lv_style_trans_t * tr = a->var;
 
-    lv_style_property_t prop_tmp = tr->prop;
-
-    /*Start the animation from the current value*/
-    if((prop_tmp & 0xF) < LV_STYLE_ID_COLOR) { /*Int*/
-        tr->start_value._int = _lv_obj_get_style_int(tr->obj, tr->part, prop_tmp);
-    }
-    else if((prop_tmp & 0xF) < LV_STYLE_ID_OPA) { /*Color*/
-        tr->start_value._color = _lv_obj_get_style_color(tr->obj, tr->part, prop_tmp);
-    }
-    else if((prop_tmp & 0xF) < LV_STYLE_ID_PTR) { /*Opa*/
-        tr->start_value._opa = _lv_obj_get_style_opa(tr->obj, tr->part, prop_tmp);
-    }
-    else {      /*Ptr*/
-        tr->start_value._ptr = _lv_obj_get_style_ptr(tr->obj, tr->part, prop_tmp);
+    /*Start the animation from the current values*/
+    uint8_t i;
+    for(i = 0; i < tr->prop_cnt; i++) {
+        lv_style_trans_prop_t * tr_prop = &tr->props[i];
+        if((tr_prop->prop & 0xF) < LV_STYLE_ID_COLOR) { /*Int*/
+            tr_prop->start_value._int = _lv_obj_get_style_int(tr->obj, tr->part, tr_prop->prop);
+        }
+        else if((tr_prop->prop & 0xF) < LV_STYLE_ID_OPA) { /*Color*/
+            tr_prop->start_value._color = _lv_obj_get_style_color(tr->obj, tr->part, tr_prop->prop);
+        }
+        else if((tr_prop->prop & 0xF) < LV_STYLE_ID_PTR) { /*Opa*/
+            tr_prop->start_value._opa = _lv_obj_get_style_opa(tr->obj, tr->part, tr_prop->prop);
+        }
+        else {      /*Ptr*/
+            tr_prop->start_value._ptr = _lv_obj_get_style_ptr(tr->obj, tr->part, tr_prop->prop);
+        }
     }
 
-    /*Init prop to an invalid values to be sure `trans_del` won't delete this added `tr`*/
-    tr->prop = 0;
-    /*Delete the relate transition if any*/
-    trans_del(tr->obj, tr->part, prop_tmp, tr);
-
-    tr->prop = prop_tmp;
-
+    /*Delete the older transitions of the same properties.
+     *`tr` is used as limit so it won't be affected*/
+    for(i = 0; i < tr->prop_cnt; i++) {
+        trans_del(tr->obj, tr->part, tr->props[i].prop, tr);
+    }
 }
 
 static void trans_anim_ready_cb(lv_anim_t * a)
 {
     lv_style_trans_t * tr = a->var;
 
-    /* Remove the transitioned property from trans. style
-     * if there no more transitions for this property
-     * It allows changing it by normal styles*/
+    /* Remove the transitioned properties from trans. style
+     * if there no more transitions for them.
+     * It allows changing them by normal styles*/
+    lv_style_list_t * list = lv_obj_get_style_list(tr->obj, tr->part);
+    lv_style_t * style_trans = _lv_style_list_get_transition_style(list);
 
-    bool running = false;
-    lv_style_trans_t * tr_i;
-    _LV_LL_READ(LV_GC_ROOT(_lv_obj_style_trans_ll), tr_i) {
-        if(tr_i != tr && tr_i->obj == tr->obj && tr_i->part == tr->part && tr_i->prop == tr->prop) {
-            running = true;
+    uint8_t i;
+    for(i = 0; i < tr->prop_cnt; i++) {
+        bool running = false;
+        lv_style_trans_t * tr_i;
+        _LV_LL_READ(LV_GC_ROOT(_lv_obj_style_trans_ll), tr_i) {
+            if(tr_i == tr || tr_i->obj != tr->obj || tr_i->part != tr->part) continue;
+
+            uint8_t j;
+            for(j = 0; j < tr_i->prop_cnt; j++) {
+                if(tr_i->props[j].prop == tr->props[i].prop) running = true;
+            }
         }
-    }
 
-    if(!running) {
-        lv_style_list_t * list = lv_obj_get_style_list(tr->obj, tr->part);
-        lv_style_t * style_trans = _lv_style_list_get_transition_style(list);
-        lv_style_remove_prop(style_trans, tr->prop);
+        if(!running) lv_style_remove_prop(style_trans, tr->props[i].prop);
     }
 
     _lv_ll_remove(&LV_GC_ROOT(_lv_obj_style_trans_ll), tr);
@@ -4555,6 +4649,56 @@ static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_fin
     return false;
 }
 
+/**
+ * Tell whether changing a property requires more than a redraw (e.g. the size or layout might change)
+ * @param prop an `LV_STYLE_...` property or `LV_STYLE_PROP_ALL`
+ * @return true: `LV_SIGNAL_STYLE_CHG` needs to be sent on change
+ */
+static bool style_prop_needs_refr(lv_style_property_t prop)
+{
+    switch(prop) {
+        case LV_STYLE_PROP_ALL:
+        case LV_STYLE_CLIP_CORNER:
+        case LV_STYLE_SIZE:
+        case LV_STYLE_TRANSFORM_WIDTH:
+        case LV_STYLE_TRANSFORM_HEIGHT:
+        case LV_STYLE_TRANSFORM_ANGLE:
+        case LV_STYLE_TRANSFORM_ZOOM:
+        case LV_STYLE_PAD_TOP:
+        case LV_STYLE_PAD_BOTTOM:
+        case LV_STYLE_PAD_LEFT:
+        case LV_STYLE_PAD_RIGHT:
+        case LV_STYLE_PAD_INNER:
+        case LV_STYLE_MARGIN_TOP:
+        case LV_STYLE_MARGIN_BOTTOM:
+        case LV_STYLE_MARGIN_LEFT:
+        case LV_STYLE_MARGIN_RIGHT:
+        case LV_STYLE_OUTLINE_WIDTH:
+        case LV_STYLE_OUTLINE_PAD:
+        case LV_STYLE_OUTLINE_OPA:
+        case LV_STYLE_SHADOW_WIDTH:
+        case LV_STYLE_SHADOW_OPA:
+        case LV_STYLE_SHADOW_OFS_X:
+        case LV_STYLE_SHADOW_OFS_Y:
+        case LV_STYLE_SHADOW_SPREAD:
+        case LV_STYLE_VALUE_LETTER_SPACE:
+        case LV_STYLE_VALUE_LINE_SPACE:
+        case LV_STYLE_VALUE_OFS_X:
+        case LV_STYLE_VALUE_OFS_Y:
+        case LV_STYLE_VALUE_ALIGN:
+        case LV_STYLE_VALUE_STR:
+        case LV_STYLE_VALUE_FONT:
+        case LV_STYLE_VALUE_OPA:
+        case LV_STYLE_TEXT_LETTER_SPACE:
+        case LV_STYLE_TEXT_LINE_SPACE:
+        case LV_STYLE_TEXT_FONT:
+        case LV_STYLE_LINE_WIDTH:
+            return true;
+        default:
+            return false;
+    }
+}
+
 static bool style_prop_is_cacheble(lv_style_property_t prop)
 {
 
@@ -226,6 +226,10 @@ typedef struct _lv_obj_t {
     uint8_t adv_hittest     : 1; /**< 1: Use advanced hit-testing (slower) */
     uint8_t gesture_parent  : 1; /**< 1: Parent will be gesture instead*/
     uint8_t focus_parent    : 1; /**< 1: Parent will be focused instead*/
+    uint8_t scroll_blit     : 1; /**< 1: Move the rendered content in the frame buffer when the position changes*/
+#if LV_LAYER_CACHE_MEM
+    uint8_t layer_cache     : 1; /**< 1: Draw the object with its children from a cached layer*/
+#endif
 
     lv_drag_dir_t drag_dir  : 3; /**<  Which directions the object can be dragged in */
     lv_bidi_dir_t base_dir  : 2; /**< Base direction of texts related to this object */
@@ -562,7 +566,7 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, lv_coord_t left, lv_coord_t right
  * E.g. `LV_OBJ_PART_MAIN`, `LV_BTN_PART_MAIN`, `LV_SLIDER_PART_KNOB`
  * @param style pointer to a style to add (Only its pointer will be saved)
  */
-void lv_obj_add_style(lv_obj_t * obj, uint8_t part, lv_style_t * style);
+void lv_obj_add_style(lv_obj_t * obj, uint8_t part, const lv_style_t * style);
 
 /**
  * Remove a style from the style list of an object.
@@ -571,7 +575,7 @@ void lv_obj_add_style(lv_obj_t * obj, uint8_t part, lv_style_t * style);
  * E.g. `LV_OBJ_PART_MAIN`, `LV_BTN_PART_MAIN`, `LV_SLIDER_PART_KNOB`
  * @param style pointer to a style to remove
  */
-void lv_obj_remove_style(lv_obj_t * obj, uint8_t part, lv_style_t * style);
+void lv_obj_remove_style(lv_obj_t * obj, uint8_t part, const lv_style_t * style);
 
 /**
  * Reset a style to the default (empty) state.
@@ -701,6 +705,17 @@ void lv_obj_set_hidden(lv_obj_t * obj, bool en);
  */
 void lv_obj_set_adv_hittest(lv_obj_t * obj, bool en);
 
+#if LV_LAYER_CACHE_MEM
+/**
+ * Render the object with its children into a cached ARGB layer and draw it from there
+ * until the object or one of its children is invalidated.
+ * Useful for complex but rarely changing objects which are redrawn often because of other objects.
+ * @param obj pointer to an object
+ * @param en true: enable the layer cache
+ */
+void lv_obj_set_layer_cache(lv_obj_t * obj, bool en);
+#endif
+
 /**
  * Enable or disable the clicking of an object
  * @param obj pointer to an object
@@ -1225,6 +1240,15 @@ bool lv_obj_get_hidden(const lv_obj_t * obj);
  */
 bool lv_obj_get_adv_hittest(const lv_obj_t * obj);
 
+#if LV_LAYER_CACHE_MEM
+/**
+ * Get whether the object is drawn from a cached layer
+ * @param obj pointer to an object
+ * @return true: the layer cache is enabled
+ */
+bool lv_obj_get_layer_cache(const lv_obj_t * obj);
+#endif
+
 /**
  * Get the click enable attribute of an object
  * @param obj pointer to an object
@@ -9,6 +9,7 @@
 #include <stddef.h>
 #include "lv_refr.h"
 #include "lv_disp.h"
+#include "lv_layer_cache.h"
 #include "../lv_hal/lv_hal_tick.h"
 #include "../lv_hal/lv_hal_disp.h"
 #include "../lv_misc/lv_task.h"
@@ -44,12 +45,17 @@ static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p);
 static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p);
 static void lv_refr_vdb_flush(void);
+static bool lv_refr_scroll(lv_area_t * scroll_area);
+static void lv_refr_copy_area(uint8_t * buf_act, uint8_t * buf_ina, const lv_area_t * area, lv_color_t * copy_buf);
+static bool is_drawn_above(const lv_obj_t * obj, const lv_area_t * area);
+static bool is_obj_on_area(const lv_obj_t * obj, const lv_area_t * area);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static uint32_t px_num;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
+static lv_obj_t * obj_refr;   /*Object being drawn*/
 #if LV_USE_PERF_MONITOR
     static uint32_t fps_sum_cnt;
     static uint32_t fps_sum_all;
@@ -111,6 +117,7 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+        disp->scroll_pending = 0;
         return;
     }
 
@@ -148,6 +155,92 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     }
 }
 
+/**
+ * Move the already rendered content of an object in the frame buffer instead of invalidating it.
+ * It's possible only with true double buffering and if the object covers the same visible area
+ * before and after the move and no other object is drawn above this area.
+ * On the next refresh the content is shifted and only the exposed parts are redrawn.
+ * @param obj pointer to an object which is about to be moved
+ * @param dx horizontal movement
+ * @param dy vertical movement
+ * @return true: the move is recorded; false: the object should be invalidated normally
+ */
+bool _lv_inv_scroll(const lv_obj_t * obj, lv_coord_t dx, lv_coord_t dy)
+{
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    if(disp == NULL) return false;
+
+    /*Only the screen sized buffers keep the content of the previous frame*/
+    if(lv_disp_is_true_double_buf(disp) == false || disp->driver.set_px_cb) return false;
+#if LV_COLOR_SCREEN_TRANSP
+    /*The flushed buffer is cleared for the transparent screens*/
+    if(disp->driver.screen_transp) return false;
+#endif
+
+    /*During screen load animations two screens are drawn*/
+    if(lv_obj_get_screen(obj) != lv_disp_get_scr_act(disp) || disp->prev_scr) return false;
+    if(lv_obj_get_hidden(obj)) return false;
+
+    /*Get the area where the object can be seen*/
+    lv_area_t clip_area;
+    clip_area.x1 = 0;
+    clip_area.y1 = 0;
+    clip_area.x2 = lv_disp_get_hor_res(disp) - 1;
+    clip_area.y2 = lv_disp_get_ver_res(disp) - 1;
+
+    lv_obj_t * par = lv_obj_get_parent(obj);
+    while(par) {
+        if(lv_obj_get_hidden(par)) return false;
+        if(_lv_area_intersect(&clip_area, &clip_area, &par->coords) == false) return false;
+        par = lv_obj_get_parent(par);
+    }
+
+    /*The object should cover the same area before and after the move*/
+    lv_area_t area_ori;
+    lv_area_copy(&area_ori, &obj->coords);
+    area_ori.x1 -= obj->ext_draw_pad;
+    area_ori.y1 -= obj->ext_draw_pad;
+    area_ori.x2 += obj->ext_draw_pad;
+    area_ori.y2 += obj->ext_draw_pad;
+
+    lv_area_t area_new;
+    lv_area_copy(&area_new, &area_ori);
+    area_new.x1 += dx;
+    area_new.y1 += dy;
+    area_new.x2 += dx;
+    area_new.y2 += dy;
+
+    if(_lv_area_intersect(&area_ori, &area_ori, &clip_area) == false) return false;
+    if(_lv_area_intersect(&area_new, &area_new, &clip_area) == false) return false;
+    if(_lv_area_is_in(&area_ori, &area_new, 0) == false || _lv_area_is_in(&area_new, &area_ori, 0) == false) return false;
+
+    /*The pixels of the objects above the area would be moved too*/
+    if(is_drawn_above(obj, &area_ori)) return false;
+
+    if(disp->scroll_pending) {
+        /*Only one area can be moved in a refresh period*/
+        if(_lv_area_is_in(&area_ori, &disp->scroll_area, 0) == false ||
+           _lv_area_is_in(&disp->scroll_area, &area_ori, 0) == false) {
+            disp->scroll_pending = 0;
+            _lv_inv_area(disp, &disp->scroll_area);
+            return false;
+        }
+
+        disp->scroll_ofs.x += dx;
+        disp->scroll_ofs.y += dy;
+    }
+    else {
+        lv_area_copy(&disp->scroll_area, &area_ori);
+        disp->scroll_ofs.x = dx;
+        disp->scroll_ofs.y = dy;
+        disp->scroll_pending = 1;
+    }
+
+    lv_task_set_prio(disp->refr_task, LV_REFR_TASK_PRIO);
+
+    return true;
+}
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -168,6 +261,26 @@ void _lv_refr_set_disp_refreshing(lv_disp_t * disp)
     disp_refr = disp;
 }
 
+/**
+ * Get the object which is being drawn
+ * @return the object being drawn or NULL if no object is drawn now
+ */
+lv_obj_t * _lv_refr_get_obj_refreshing(void)
+{
+    return obj_refr;
+}
+
+/**
+ * Draw an object and its children to the display being refreshed.
+ * It shouldn't be used directly by the user. Used to render the layers of objects.
+ * @param obj pointer to an object to draw
+ * @param mask the object will be drawn only in this area
+ */
+void _lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask)
+{
+    lv_refr_obj(obj, mask);
+}
+
 /**
  * Called periodically to handle the refreshing
  * @param task pointer to the task itself
@@ -191,9 +304,14 @@ void _lv_disp_refr_task(lv_task_t * task)
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+        disp_refr->scroll_pending = 0;
         return;
     }
 
+    /*Move the content of the scrolled area first and redraw only the exposed parts*/
+    lv_area_t scroll_area;
+    bool scrolled = lv_refr_scroll(&scroll_area);
+
     lv_refr_join_area();
 
     lv_refr_areas();
@@ -227,33 +345,16 @@ void _lv_disp_refr_task(lv_task_t * task)
                 uint8_t * buf_act = (uint8_t *)vdb->buf_act;
                 uint8_t * buf_ina = (uint8_t *)vdb->buf_act == vdb->buf1 ? vdb->buf2 : vdb->buf1;
 
-                lv_coord_t hres = lv_disp_get_hor_res(disp_refr);
                 uint16_t a;
                 for(a = 0; a < disp_refr->inv_p; a++) {
                     if(disp_refr->inv_area_joined[a] == 0) {
-                        uint32_t start_offs =
-                            (hres * disp_refr->inv_areas[a].y1 + disp_refr->inv_areas[a].x1) * sizeof(lv_color_t);
-#if LV_USE_GPU_STM32_DMA2D
-                        lv_gpu_stm32_dma2d_copy((lv_color_t *)(buf_act + start_offs), disp_refr->driver.hor_res,
-                                                (lv_color_t *)(buf_ina + start_offs), disp_refr->driver.hor_res,
-                                                lv_area_get_width(&disp_refr->inv_areas[a]),
-                                                lv_area_get_height(&disp_refr->inv_areas[a]));
-#else
-
-                        lv_coord_t y;
-                        uint32_t line_length = lv_area_get_width(&disp_refr->inv_areas[a]) * sizeof(lv_color_t);
-
-                        for(y = disp_refr->inv_areas[a].y1; y <= disp_refr->inv_areas[a].y2; y++) {
-                            /* The frame buffer is probably in an external RAM where sequential access is much faster.
-                             * So first copy a line into a buffer and write it back the ext. RAM */
-                            _lv_memcpy(copy_buf, buf_ina + start_offs, line_length);
-                            _lv_memcpy(buf_act + start_offs, copy_buf, line_length);
-                            start_offs += hres * sizeof(lv_color_t);
-                        }
-#endif
+                        lv_refr_copy_area(buf_act, buf_ina, &disp_refr->inv_areas[a], copy_buf);
                     }
                 }
 
+                /*The moved content is not redrawn so copy it too*/
+                if(scrolled) lv_refr_copy_area(buf_act, buf_ina, &scroll_area, copy_buf);
+
                 if(copy_buf) _lv_mem_buf_release(copy_buf);
             }
         } /*End of true double buffer handling*/
@@ -332,6 +433,162 @@ uint32_t lv_refr_get_fps_avg(void)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Move the rendered content of the scrolled area in the frame buffer and
+ * invalidate the parts which can't be moved
+ * @param scroll_area the moved area is stored here
+ * @return true: the content of `scroll_area` is moved
+ */
+static bool lv_refr_scroll(lv_area_t * scroll_area)
+{
+    if(disp_refr->scroll_pending == 0) return false;
+    disp_refr->scroll_pending = 0;
+
+    lv_area_copy(scroll_area, &disp_refr->scroll_area);
+    lv_coord_t dx = disp_refr->scroll_ofs.x;
+    lv_coord_t dy = disp_refr->scroll_ofs.y;
+    if(dx == 0 && dy == 0) return false;
+
+    /*If everything is moved out of the area or the buffers have been changed redraw the whole area*/
+    if(LV_MATH_ABS(dx) >= lv_area_get_width(scroll_area) || LV_MATH_ABS(dy) >= lv_area_get_height(scroll_area) ||
+       lv_disp_is_true_double_buf(disp_refr) == false) {
+        _lv_inv_area(disp_refr, scroll_area);
+        return false;
+    }
+
+    /* The invalidated areas might have outdated content which would be moved too.
+     * So redraw them on their moved position too.*/
+    lv_area_t a;
+    uint16_t inv_p = disp_refr->inv_p;
+    uint16_t i;
+    for(i = 0; i < inv_p; i++) {
+        if(_lv_area_intersect(&a, &disp_refr->inv_areas[i], scroll_area) == false) continue;
+        a.x1 += dx;
+        a.y1 += dy;
+        a.x2 += dx;
+        a.y2 += dy;
+        if(_lv_area_intersect(&a, &a, scroll_area)) _lv_inv_area(disp_refr, &a);
+    }
+
+    /*Redraw the exposed parts*/
+    if(dy != 0) {
+        lv_area_copy(&a, scroll_area);
+        if(dy > 0) a.y2 = a.y1 + dy - 1;
+        else a.y1 = a.y2 + dy + 1;
+        _lv_inv_area(disp_refr, &a);
+    }
+
+    if(dx != 0) {
+        lv_area_copy(&a, scroll_area);
+        if(dx > 0) a.x2 = a.x1 + dx - 1;
+        else a.x1 = a.x2 + dx + 1;
+        _lv_inv_area(disp_refr, &a);
+    }
+
+    /*Move the rest line by line. Go against the movement to not overwrite the lines to move.*/
+    lv_area_t dest;
+    lv_area_copy(&dest, scroll_area);
+    dest.x1 += dx;
+    dest.y1 += dy;
+    dest.x2 += dx;
+    dest.y2 += dy;
+    _lv_area_intersect(&dest, &dest, scroll_area);
+
+    lv_disp_buf_t * vdb = lv_disp_get_buf(disp_refr);
+    lv_coord_t hres = lv_disp_get_hor_res(disp_refr);
+    uint32_t line_length = lv_area_get_width(&dest) * sizeof(lv_color_t);
+    lv_color_t * copy_buf = _lv_mem_buf_get(line_length);
+    lv_color_t * buf = vdb->buf_act;
+
+    lv_coord_t y;
+    for(i = 0; i < lv_area_get_height(&dest); i++) {
+        y = dy > 0 ? dest.y2 - i : dest.y1 + i;
+        _lv_memcpy(copy_buf, &buf[(int32_t)(y - dy) * hres + dest.x1 - dx], line_length);
+        _lv_memcpy(&buf[(int32_t)y * hres + dest.x1], copy_buf, line_length);
+    }
+
+    _lv_mem_buf_release(copy_buf);
+
+    return true;
+}
+
+/**
+ * Copy an area between the screen sized buffers of a true double buffered display
+ * @param buf_act the buffer to update
+ * @param buf_ina the buffer with the new content
+ * @param area the area to copy
+ * @param copy_buf a line sized buffer to use for copying
+ */
+static void lv_refr_copy_area(uint8_t * buf_act, uint8_t * buf_ina, const lv_area_t * area, lv_color_t * copy_buf)
+{
+    lv_coord_t hres = lv_disp_get_hor_res(disp_refr);
+    uint32_t start_offs = (hres * area->y1 + area->x1) * sizeof(lv_color_t);
+#if LV_USE_GPU_STM32_DMA2D
+    LV_UNUSED(copy_buf);
+    lv_gpu_stm32_dma2d_copy((lv_color_t *)(buf_act + start_offs), disp_refr->driver.hor_res,
+                            (lv_color_t *)(buf_ina + start_offs), disp_refr->driver.hor_res,
+                            lv_area_get_width(area), lv_area_get_height(area));
+#else
+    lv_coord_t y;
+    uint32_t line_length = lv_area_get_width(area) * sizeof(lv_color_t);
+
+    for(y = area->y1; y <= area->y2; y++) {
+        /* The frame buffer is probably in an external RAM where sequential access is much faster.
+         * So first copy a line into a buffer and write it back the ext. RAM */
+        _lv_memcpy(copy_buf, buf_ina + start_offs, line_length);
+        _lv_memcpy(buf_act + start_offs, copy_buf, line_length);
+        start_offs += hres * sizeof(lv_color_t);
+    }
+#endif
+}
+
+/**
+ * Tell whether an other object is drawn above an object on an area
+ * @param obj pointer to an object
+ * @param area the area to check
+ * @return true: an other object is drawn above `obj` on `area`
+ */
+static bool is_drawn_above(const lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_obj_t * child;
+    const lv_obj_t * cur = obj;
+    lv_obj_t * par = lv_obj_get_parent(cur);
+    while(par) {
+        /*The children are drawn from the tail so the ones before `cur` are drawn later*/
+        _LV_LL_READ(par->child_ll, child) {
+            if(child == cur) break;
+            if(is_obj_on_area(child, area)) return true;
+        }
+        cur = par;
+        par = lv_obj_get_parent(par);
+    }
+
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    _LV_LL_READ(lv_disp_get_layer_top(disp)->child_ll, child) {
+        if(is_obj_on_area(child, area)) return true;
+    }
+
+    _LV_LL_READ(lv_disp_get_layer_sys(disp)->child_ll, child) {
+        if(is_obj_on_area(child, area)) return true;
+    }
+
+    return false;
+}
+
+static bool is_obj_on_area(const lv_obj_t * obj, const lv_area_t * area)
+{
+    if(lv_obj_get_hidden(obj)) return false;
+
+    lv_area_t obj_area;
+    lv_area_copy(&obj_area, &obj->coords);
+    obj_area.x1 -= obj->ext_draw_pad;
+    obj_area.y1 -= obj->ext_draw_pad;
+    obj_area.x2 += obj->ext_draw_pad;
+    obj_area.y2 += obj->ext_draw_pad;
+
+    return _lv_area_is_on(&obj_area, area);
+}
+
 /**
  * Join the areas which has got common parts
  */
@@ -854,7 +1111,10 @@ static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p)
         }
 
         /*Call the post draw design function of the parents of the to object*/
+        lv_obj_t * obj_refr_prev = obj_refr;
+        obj_refr = par;
         if(par->design_cb) par->design_cb(par, mask_p, LV_DESIGN_DRAW_POST);
+        obj_refr = obj_refr_prev;
 
         /*The new border will be there last parents,
          *so the 'younger' brothers of parent will be refreshed*/
@@ -874,6 +1134,11 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
     /*Do not refresh hidden objects*/
     if(obj->hidden != 0) return;
 
+#if LV_LAYER_CACHE_MEM
+    /*Draw the object and its children from their layer*/
+    if(obj->layer_cache && _lv_layer_cache_draw(obj, mask_ori_p)) return;
+#endif
+
     bool union_ok; /* Store the return value of area_union */
     /* Truncate the original mask to the coordinates of the parent
      * because the parent and its children are visible only here */
@@ -890,6 +1155,9 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
 
     /*Draw the parent and its children only if they ore on 'mask_parent'*/
     if(union_ok != false) {
+        /*The children restore it when they are ready*/
+        lv_obj_t * obj_refr_prev = obj_refr;
+        obj_refr = obj;
 
         /* Redraw the object */
         if(obj->design_cb) obj->design_cb(obj, &obj_ext_mask, LV_DESIGN_DRAW_MAIN);
@@ -939,6 +1207,8 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
 
         /* If all the children are redrawn make 'post draw' design */
         if(obj->design_cb) obj->design_cb(obj, &obj_ext_mask, LV_DESIGN_DRAW_POST);
+
+        obj_refr = obj_refr_prev;
     }
 }
 
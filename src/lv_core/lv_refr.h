@@ -64,6 +64,18 @@ void lv_refr_now(lv_disp_t * disp);
  */
 void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p);
 
+/**
+ * Move the already rendered content of an object in the frame buffer instead of invalidating it.
+ * It's possible only with true double buffering and if the object covers the same visible area
+ * before and after the move and no other object is drawn above this area.
+ * On the next refresh the content is shifted and only the exposed parts are redrawn.
+ * @param obj pointer to an object which is about to be moved
+ * @param dx horizontal movement
+ * @param dy vertical movement
+ * @return true: the move is recorded; false: the object should be invalidated normally
+ */
+bool _lv_inv_scroll(const lv_obj_t * obj, lv_coord_t dx, lv_coord_t dy);
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -78,6 +90,20 @@ lv_disp_t * _lv_refr_get_disp_refreshing(void);
  */
 void _lv_refr_set_disp_refreshing(lv_disp_t * disp);
 
+/**
+ * Get the object which is being drawn
+ * @return the object being drawn or NULL if no object is drawn now
+ */
+lv_obj_t * _lv_refr_get_obj_refreshing(void);
+
+/**
+ * Draw an object and its children to the display being refreshed.
+ * It shouldn't be used directly by the user. Used to render the layers of objects.
+ * @param obj pointer to an object to draw
+ * @param mask the object will be drawn only in this area
+ */
+void _lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask);
+
 #if LV_USE_PERF_MONITOR
 /**
  * Get the average FPS since start up
@@ -21,6 +21,9 @@
  *  STATIC PROTOTYPES
  **********************/
 LV_ATTRIBUTE_FAST_MEM static inline int32_t get_property_index(const lv_style_t * style, lv_style_property_t prop);
+LV_ATTRIBUTE_FAST_MEM static inline const lv_style_const_prop_t * get_const_property(const lv_style_t * style,
+                                                                                    lv_style_property_t prop);
+static bool is_const_style_warn(const lv_style_t * style);
 static lv_style_t * get_alloc_local_style(lv_style_list_t * list);
 static inline bool style_resize(lv_style_t * style, size_t sz);
 static inline lv_style_property_t get_style_prop(const lv_style_t * style, size_t idx);
@@ -66,6 +69,21 @@ void lv_style_copy(lv_style_t * style_dest, const lv_style_t * style_src)
 {
     LV_ASSERT_STYLE(style_dest);
 
+    if(is_const_style_warn(style_dest)) return;
+
+    /*Constant styles have no map so add their properties one by one*/
+    if(style_src && style_src->const_props) {
+        const lv_style_const_prop_t * p;
+        for(p = style_src->const_props; (p->prop & 0xFF) != _LV_STYLE_CLOSING_PROP; p++) {
+            uint8_t id = p->prop & 0xF;
+            if(id < LV_STYLE_ID_COLOR) _lv_style_set_int(style_dest, p->prop, p->value.num);
+            else if(id < LV_STYLE_ID_OPA) _lv_style_set_color(style_dest, p->prop, p->value.color);
+            else if(id < LV_STYLE_ID_PTR) _lv_style_set_opa(style_dest, p->prop, p->value.opa);
+            else _lv_style_set_ptr(style_dest, p->prop, p->value.ptr);
+        }
+        return;
+    }
+
     uint16_t size = _lv_style_get_mem_size(style_src);
     if(size == 0) return;
 
@@ -83,6 +101,8 @@ void lv_style_copy(lv_style_t * style_dest, const lv_style_t * style_src)
  */
 bool lv_style_remove_prop(lv_style_t * style, lv_style_property_t prop)
 {
+    if(is_const_style_warn(style)) return false;
+
     int32_t id = get_property_index(style, prop);
     /*The property exists but not sure it's state is the same*/
     if(id >= 0) {
@@ -183,7 +203,7 @@ void lv_style_list_copy(lv_style_list_t * list_dest, const lv_style_list_t * lis
  * @param list pointer to a style list
  * @param style pointer to a style to add
  */
-void _lv_style_list_add_style(lv_style_list_t * list, lv_style_t * style)
+void _lv_style_list_add_style(lv_style_list_t * list, const lv_style_t * style)
 {
     LV_ASSERT_STYLE_LIST(list);
     LV_ASSERT_STYLE(style);
@@ -211,7 +231,8 @@ void _lv_style_list_add_style(lv_style_list_t * list, lv_style_t * style)
         new_styles[i] = new_styles[i - 1];
     }
 
-    new_styles[first_style] = style;
+    /*Constant styles are never modified through the list so it's safe to drop the qualifier*/
+    new_styles[first_style] = (lv_style_t *)style;
     list->style_cnt++;
     list->style_list = new_styles;
 }
@@ -221,7 +242,7 @@ void _lv_style_list_add_style(lv_style_list_t * list, lv_style_t * style)
  * @param style_list pointer to a style list
  * @param style pointer to a style to remove
  */
-void _lv_style_list_remove_style(lv_style_list_t * list, lv_style_t * style)
+void _lv_style_list_remove_style(lv_style_list_t * list, const lv_style_t * style)
 {
     LV_ASSERT_STYLE_LIST(list);
     LV_ASSERT_STYLE(style);
@@ -309,6 +330,8 @@ void _lv_style_list_reset(lv_style_list_t * list)
  */
 void lv_style_reset(lv_style_t * style)
 {
+    if(style->const_props) return;
+
     lv_mem_free(style->map);
     lv_style_init(style);
 }
@@ -345,6 +368,8 @@ uint16_t _lv_style_get_mem_size(const lv_style_t * style)
  */
 void _lv_style_set_int(lv_style_t * style, lv_style_property_t prop, lv_style_int_t value)
 {
+    if(is_const_style_warn(style)) return;
+
     int32_t id = get_property_index(style, prop);
     /*The property already exists but not sure it's state is the same*/
     if(id >= 0) {
@@ -388,6 +413,8 @@ void _lv_style_set_int(lv_style_t * style, lv_style_property_t prop, lv_style_in
  */
 void _lv_style_set_color(lv_style_t * style, lv_style_property_t prop, lv_color_t color)
 {
+    if(is_const_style_warn(style)) return;
+
     int32_t id = get_property_index(style, prop);
     /*The property already exists but not sure it's state is the same*/
     if(id >= 0) {
@@ -431,6 +458,8 @@ void _lv_style_set_color(lv_style_t * style, lv_style_property_t prop, lv_color_
  */
 void _lv_style_set_opa(lv_style_t * style, lv_style_property_t prop, lv_opa_t opa)
 {
+    if(is_const_style_warn(style)) return;
+
     int32_t id = get_property_index(style, prop);
     /*The property already exists but not sure it's state is the same*/
     if(id >= 0) {
@@ -474,6 +503,8 @@ void _lv_style_set_opa(lv_style_t * style, lv_style_property_t prop, lv_opa_t op
  */
 void _lv_style_set_ptr(lv_style_t * style, lv_style_property_t prop, const void * p)
 {
+    if(is_const_style_warn(style)) return;
+
     int32_t id = get_property_index(style, prop);
     /*The property already exists but not sure it's state is the same*/
     if(id >= 0) {
@@ -517,6 +548,13 @@ void _lv_style_set_ptr(lv_style_t * style, lv_style_property_t prop, const void
  */
 int16_t _lv_style_get_int(const lv_style_t * style, lv_style_property_t prop, lv_style_int_t * res)
 {
+    if(style && style->const_props) {
+        const lv_style_const_prop_t * p = get_const_property(style, prop);
+        if(p == NULL) return -1;
+        *res = p->value.num;
+        return LV_STYLE_ATTR_GET_STATE(p->prop >> 8);
+    }
+
     int32_t id = get_property_index(style, prop);
     if(id < 0) {
         return -1;
@@ -545,6 +583,13 @@ int16_t _lv_style_get_int(const lv_style_t * style, lv_style_property_t prop, lv
  */
 int16_t _lv_style_get_opa(const lv_style_t * style, lv_style_property_t prop, lv_opa_t * res)
 {
+    if(style && style->const_props) {
+        const lv_style_const_prop_t * p = get_const_property(style, prop);
+        if(p == NULL) return -1;
+        *res = p->value.opa;
+        return LV_STYLE_ATTR_GET_STATE(p->prop >> 8);
+    }
+
     int32_t id = get_property_index(style, prop);
     if(id < 0) {
         return -1;
@@ -573,6 +618,13 @@ int16_t _lv_style_get_opa(const lv_style_t * style, lv_style_property_t prop, lv
  */
 int16_t _lv_style_get_color(const lv_style_t * style, lv_style_property_t prop, lv_color_t * res)
 {
+    if(style && style->const_props) {
+        const lv_style_const_prop_t * p = get_const_property(style, prop);
+        if(p == NULL) return -1;
+        *res = p->value.color;
+        return LV_STYLE_ATTR_GET_STATE(p->prop >> 8);
+    }
+
     int32_t id = get_property_index(style, prop);
     if(id < 0) {
         return -1;
@@ -601,6 +653,13 @@ int16_t _lv_style_get_color(const lv_style_t * style, lv_style_property_t prop,
  */
 int16_t _lv_style_get_ptr(const lv_style_t * style, lv_style_property_t prop, const void ** res)
 {
+    if(style && style->const_props) {
+        const lv_style_const_prop_t * p = get_const_property(style, prop);
+        if(p == NULL) return -1;
+        *res = p->value.ptr;
+        return LV_STYLE_ATTR_GET_STATE(p->prop >> 8);
+    }
+
     int32_t id = get_property_index(style, prop);
     if(id < 0) {
         return -1;
@@ -1032,6 +1091,57 @@ LV_ATTRIBUTE_FAST_MEM static inline int32_t get_property_index(const lv_style_t
     return id_guess;
 }
 
+/**
+ * Get the best matching property from a constant style considering the state of `prop`.
+ * Works like `get_property_index` but on the aligned `const_props` array
+ * so the value can be read directly instead of copying it from an unaligned byte map.
+ * @param style pointer to a constant style
+ * @param prop a style property ORed with a state.
+ * E.g. `LV_STYLE_TEXT_FONT | (LV_STATE_PRESSED << LV_STYLE_STATE_POS)`
+ * @return pointer to the best matching property or `NULL` if not found
+ */
+LV_ATTRIBUTE_FAST_MEM static inline const lv_style_const_prop_t * get_const_property(const lv_style_t * style,
+                                                                                    lv_style_property_t prop)
+{
+    LV_ASSERT_STYLE(style);
+
+    uint8_t id_to_find = prop & 0xFF;
+    lv_style_attr_t state = LV_STYLE_ATTR_GET_STATE((prop >> 8) & 0xFF);
+
+    int16_t weight = -1;
+    const lv_style_const_prop_t * guess = NULL;
+
+    const lv_style_const_prop_t * p;
+    for(p = style->const_props; (p->prop & 0xFF) != _LV_STYLE_CLOSING_PROP; p++) {
+        if((p->prop & 0xFF) != id_to_find) continue;
+
+        lv_style_attr_t state_p = LV_STYLE_ATTR_GET_STATE((p->prop >> 8) & 0xFF);
+        /*If the state perfectly matches return this property*/
+        if(state_p == state) return p;
+        /*Else use it if it doesn't specify other states than the requested and describes it better*/
+        else if((state_p & (~state)) == 0 && state_p > weight) {
+            weight = state_p;
+            guess = p;
+        }
+    }
+
+    return guess;
+}
+
+/**
+ * Check if a style is constant and print a warning if so.
+ * Used by the functions which would modify the style.
+ * @param style pointer to a style
+ * @return true: the style is constant and mustn't be modified
+ */
+static bool is_const_style_warn(const lv_style_t * style)
+{
+    if(style == NULL || style->const_props == NULL) return false;
+
+    LV_LOG_WARN("Constant styles can't be modified");
+    return true;
+}
+
 /**
  * Get the local style from a style list. Allocate it if not exists yet.
  * @param list pointer to a style list
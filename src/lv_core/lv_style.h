@@ -208,15 +208,30 @@ typedef uint16_t lv_style_property_t;
 
 typedef uint16_t lv_style_state_t;
 
+typedef int16_t lv_style_int_t;
+
+/*Value of a property in a constant style*/
+typedef union {
+    lv_style_int_t num;
+    lv_opa_t opa;
+    lv_color_t color;
+    const void * ptr;
+} lv_style_value_t;
+
+/*A property of a constant style. See `LV_STYLE_CONST_INIT`*/
+typedef struct {
+    lv_style_property_t prop;
+    lv_style_value_t value;
+} lv_style_const_prop_t;
+
 typedef struct {
     uint8_t * map;
+    const lv_style_const_prop_t * const_props;  /*Not NULL for read-only styles created with `LV_STYLE_CONST_INIT`*/
 #if LV_USE_ASSERT_STYLE
     uint32_t sentinel;
 #endif
 } lv_style_t;
 
-typedef int16_t lv_style_int_t;
-
 typedef struct {
     lv_style_t ** style_list;
 #if LV_USE_ASSERT_STYLE
@@ -292,14 +307,14 @@ void lv_style_list_copy(lv_style_list_t * list_dest, const lv_style_list_t * lis
  * @param list pointer to a style list
  * @param style pointer to a style to add
  */
-void _lv_style_list_add_style(lv_style_list_t * list, lv_style_t * style);
+void _lv_style_list_add_style(lv_style_list_t * list, const lv_style_t * style);
 
 /**
  * Remove a style from a style list
  * @param style_list pointer to a style list
  * @param style pointer to a style to remove
  */
-void _lv_style_list_remove_style(lv_style_list_t * list, lv_style_t * style);
+void _lv_style_list_remove_style(lv_style_list_t * list, const lv_style_t * style);
 
 /**
  * Remove all styles added from style list, clear the local style, transition style and free all allocated memories.
@@ -318,13 +333,24 @@ static inline lv_style_t * lv_style_list_get_style(lv_style_list_t * list, uint8
 /**
  * Clear all properties from a style and all allocated memories.
  * @param style pointer to a style
+ * @note constant styles (created with `LV_STYLE_CONST_INIT`) are left untouched
  */
 void lv_style_reset(lv_style_t * style);
 
+/**
+ * Tell whether a style is a read-only style created with `LV_STYLE_CONST_INIT`
+ * @param style pointer to a style
+ * @return true: the style is constant
+ */
+static inline bool lv_style_is_const(const lv_style_t * style)
+{
+    return style->const_props != NULL;
+}
+
 /**
  * Get the size of the properties in a style in bytes
  * @param style pointer to a style
- * @return size of the properties in bytes
+ * @return size of the properties in bytes (0 for constant styles as they don't allocate memory)
  */
 uint16_t _lv_style_get_mem_size(const lv_style_t * style);
 
@@ -598,6 +624,38 @@ bool lv_debug_check_style_list(const lv_style_list_t * list);
  */
 #define LV_STYLE_CREATE(name, copy_p) static lv_style_t name; lv_style_init(&name); lv_style_copy(&name, copy_p)
 
+/**
+ * Create a read-only style from a constant property array.
+ * The style and its properties can be placed in ROM and added to objects like any other style,
+ * but they can't be modified at run time.
+ * Example:
+ *     static const lv_style_const_prop_t my_props[] = {
+ *         LV_STYLE_CONST_INT(LV_STYLE_RADIUS, 10),
+ *         LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+ *         LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, 0x2196f3),
+ *         LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | (LV_STATE_PRESSED << LV_STYLE_STATE_POS), 0x1976d2),
+ *         LV_STYLE_CONST_END
+ *     };
+ *     static LV_STYLE_CONST_INIT(my_style, my_props);
+ *     ...
+ *     lv_obj_add_style(btn, LV_BTN_PART_MAIN, &my_style);
+ */
+#define LV_STYLE_CONST_INIT(name, props) const lv_style_t name = LV_STYLE_CONST_INITIALIZER(props)
+
+/*Initializer of a read-only style, e.g. for a member of a constant struct of styles*/
+#if LV_USE_ASSERT_STYLE
+#define LV_STYLE_CONST_INITIALIZER(props) {NULL, props, LV_DEBUG_STYLE_SENTINEL_VALUE}
+#else
+#define LV_STYLE_CONST_INITIALIZER(props) {NULL, props}
+#endif
+
+#define LV_STYLE_CONST_INT(prop, v)             {(prop), {.num = (v)}}
+#define LV_STYLE_CONST_OPA(prop, v)             {(prop), {.opa = (v)}}
+#define LV_STYLE_CONST_PTR(prop, p)             {(prop), {.ptr = (p)}}
+#define LV_STYLE_CONST_COLOR(prop, r8, g8, b8)  {(prop), {.color = _LV_COLOR_INITIALIZER(r8, g8, b8)}}
+#define LV_STYLE_CONST_COLOR_HEX(prop, c)       LV_STYLE_CONST_COLOR(prop, (((c) >> 16) & 0xFF), (((c) >> 8) & 0xFF), ((c) & 0xFF))
+#define LV_STYLE_CONST_END                      {_LV_STYLE_CLOSING_PROP, {.num = 0}}
+
 #if LV_USE_DEBUG
 
 # ifndef LV_DEBUG_IS_STYLE
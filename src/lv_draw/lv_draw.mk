@@ -8,6 +8,8 @@ CSRCS += lv_draw_arc.c
 CSRCS += lv_draw_triangle.c
 CSRCS += lv_img_decoder.c
 CSRCS += lv_img_cache.c
+CSRCS += lv_img_async.c
+CSRCS += lv_img_trans_cache.c
 CSRCS += lv_img_buf.c
 
 DEPPATH += --dep-path $(LVGL_DIR)/$(LVGL_DIR_NAME)/src/lv_draw
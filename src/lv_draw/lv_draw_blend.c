@@ -37,6 +37,10 @@ static void fill_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  con
                         lv_color_t color, lv_opa_t opa,
                         const lv_opa_t * mask, lv_draw_mask_res_t mask_res);
 
+static void fill_alpha_buf(const lv_area_t * disp_area, uint8_t * disp_buf,  const lv_area_t * draw_area,
+                           lv_color_t color, lv_opa_t opa,
+                           const lv_opa_t * mask, lv_draw_mask_res_t mask_res, lv_img_cf_t cf);
+
 LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_color_t * disp_buf,
                                               const lv_area_t * draw_area,
                                               lv_color_t color, lv_opa_t opa,
@@ -52,6 +56,12 @@ static void map_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  cons
                        const lv_area_t * map_area, const lv_color_t * map_buf, lv_opa_t opa,
                        const lv_opa_t * mask, lv_draw_mask_res_t mask_res);
 
+static void map_alpha_buf(const lv_area_t * disp_area, uint8_t * disp_buf,  const lv_area_t * draw_area,
+                          const lv_area_t * map_area, const lv_color_t * map_buf, lv_opa_t opa,
+                          const lv_opa_t * mask, lv_draw_mask_res_t mask_res, lv_img_cf_t cf);
+
+static inline void alpha_buf_px_blend(uint8_t * px, lv_img_cf_t cf, lv_color_t color, lv_opa_t opa);
+
 LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_color_t * disp_buf,
                                              const lv_area_t * draw_area,
                                              const lv_area_t * map_area, const lv_color_t * map_buf, lv_opa_t opa,
@@ -168,7 +178,10 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill(const lv_area_t * clip_area, const lv_
         for(i = 0; i < mask_w; i++)  mask[i] = mask[i] > 128 ? LV_OPA_COVER : LV_OPA_TRANSP;
     }
 
-    if(disp->driver.set_px_cb) {
+    if(disp->driver.buf_cf == LV_IMG_CF_TRUE_COLOR_ALPHA || disp->driver.buf_cf == LV_IMG_CF_ALPHA_8BIT) {
+        fill_alpha_buf(disp_area, (uint8_t *)disp_buf, &draw_area, color, opa, mask, mask_res, disp->driver.buf_cf);
+    }
+    else if(disp->driver.set_px_cb) {
         fill_set_px(disp_area, disp_buf, &draw_area, color, opa, mask, mask_res);
     }
     else if(mode == LV_BLEND_MODE_NORMAL) {
@@ -235,7 +248,11 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_map(const lv_area_t * clip_area, const lv_a
         int32_t i;
         for(i = 0; i < mask_w; i++)  mask[i] = mask[i] > 128 ? LV_OPA_COVER : LV_OPA_TRANSP;
     }
-    if(disp->driver.set_px_cb) {
+    if(disp->driver.buf_cf == LV_IMG_CF_TRUE_COLOR_ALPHA || disp->driver.buf_cf == LV_IMG_CF_ALPHA_8BIT) {
+        map_alpha_buf(disp_area, (uint8_t *)disp_buf, &draw_area, map_area, map_buf, opa, mask, mask_res,
+                      disp->driver.buf_cf);
+    }
+    else if(disp->driver.set_px_cb) {
         map_set_px(disp_area, disp_buf, &draw_area, map_area, map_buf, opa, mask, mask_res);
     }
     else if(mode == LV_BLEND_MODE_NORMAL) {
@@ -293,6 +310,87 @@ static void fill_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  con
     }
 }
 
+/**
+ * Fill an area of a `LV_IMG_CF_TRUE_COLOR_ALPHA` or `LV_IMG_CF_ALPHA_8BIT` buffer with a color
+ * @param disp_area the current display area (destination area)
+ * @param disp_buf destination buffer
+ * @param draw_area fill this area (relative to `disp_area`)
+ * @param color fill color
+ * @param opa overall opacity in 0x00..0xff range
+ * @param mask a mask to apply on every pixel (uint8_t array with 0x00..0xff values).
+ *                It fits into draw_area.
+ * @param mask_res LV_MASK_RES_COVER: the mask has only 0xff values (no mask),
+ *                 LV_MASK_RES_TRANSP: the mask has only 0x00 values (full transparent),
+ *                 LV_MASK_RES_CHANGED: the mask has mixed values
+ * @param cf color format of `disp_buf`
+ */
+static void fill_alpha_buf(const lv_area_t * disp_area, uint8_t * disp_buf,  const lv_area_t * draw_area,
+                           lv_color_t color, lv_opa_t opa,
+                           const lv_opa_t * mask, lv_draw_mask_res_t mask_res, lv_img_cf_t cf)
+{
+    uint32_t px_size = cf == LV_IMG_CF_ALPHA_8BIT ? 1 : LV_IMG_PX_SIZE_ALPHA_BYTE;
+
+    /*Get the width of the `disp_area` it will be used to go to the next line*/
+    int32_t disp_w = lv_area_get_width(disp_area);
+
+    /*Get the width of the `draw_area` it will be used to go to the next line of the mask*/
+    int32_t draw_area_w = lv_area_get_width(draw_area);
+
+    uint8_t * disp_buf_first = disp_buf + (disp_w * draw_area->y1 + draw_area->x1) * px_size;
+
+    int32_t x;
+    int32_t y;
+
+    if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
+        /*Opaque fill: every pixel becomes the same*/
+        if(opa >= LV_OPA_MAX && cf == LV_IMG_CF_ALPHA_8BIT) {
+            uint8_t br = lv_color_brightness(color);
+            for(y = draw_area->y1; y <= draw_area->y2; y++) {
+                _lv_memset(disp_buf_first, br, draw_area_w);
+                disp_buf_first += disp_w;
+            }
+        }
+        else if(opa >= LV_OPA_MAX) {
+            uint8_t px[LV_IMG_PX_SIZE_ALPHA_BYTE];
+            _lv_memcpy_small(px, &color, LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+            px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = opa;
+
+            for(y = draw_area->y1; y <= draw_area->y2; y++) {
+                uint8_t * px_act = disp_buf_first;
+                for(x = 0; x < draw_area_w; x++) {
+                    _lv_memcpy_small(px_act, px, LV_IMG_PX_SIZE_ALPHA_BYTE);
+                    px_act += LV_IMG_PX_SIZE_ALPHA_BYTE;
+                }
+                disp_buf_first += disp_w * px_size;
+            }
+        }
+        else {
+            for(y = draw_area->y1; y <= draw_area->y2; y++) {
+                uint8_t * px_act = disp_buf_first;
+                for(x = 0; x < draw_area_w; x++) {
+                    alpha_buf_px_blend(px_act, cf, color, opa);
+                    px_act += px_size;
+                }
+                disp_buf_first += disp_w * px_size;
+            }
+        }
+    }
+    else {
+        for(y = draw_area->y1; y <= draw_area->y2; y++) {
+            uint8_t * px_act = disp_buf_first;
+            for(x = 0; x < draw_area_w; x++) {
+                if(mask[x]) {
+                    lv_opa_t opa_tmp = mask[x] >= LV_OPA_MAX ? opa : (uint32_t)((uint32_t)opa * mask[x]) >> 8;
+                    alpha_buf_px_blend(px_act, cf, color, opa_tmp);
+                }
+                px_act += px_size;
+            }
+            disp_buf_first += disp_w * px_size;
+            mask += draw_area_w;
+        }
+    }
+}
+
 /**
  * Fill an area with a color
  * @param disp_area the current display area (destination area)
@@ -692,6 +790,106 @@ static void map_set_px(const lv_area_t * disp_area, lv_color_t * disp_buf,  cons
     }
 }
 
+/**
+ * Copy an image to an area of a `LV_IMG_CF_TRUE_COLOR_ALPHA` or `LV_IMG_CF_ALPHA_8BIT` buffer
+ * @param disp_area the current display area (destination area)
+ * @param disp_buf destination buffer
+ * @param draw_area copy this area of the map (relative to `disp_area`)
+ * @param map_area coordinates of the map (image) to copy. (absolute coordinates)
+ * @param map_buf the pixel of the image
+ * @param opa overall opacity in 0x00..0xff range
+ * @param mask a mask to apply on every pixel (uint8_t array with 0x00..0xff values).
+ *                It fits into draw_area.
+ * @param mask_res LV_MASK_RES_COVER: the mask has only 0xff values (no mask),
+ *                 LV_MASK_RES_TRANSP: the mask has only 0x00 values (full transparent),
+ *                 LV_MASK_RES_CHANGED: the mask has mixed values
+ * @param cf color format of `disp_buf`
+ */
+static void map_alpha_buf(const lv_area_t * disp_area, uint8_t * disp_buf,  const lv_area_t * draw_area,
+                          const lv_area_t * map_area, const lv_color_t * map_buf, lv_opa_t opa,
+                          const lv_opa_t * mask, lv_draw_mask_res_t mask_res, lv_img_cf_t cf)
+{
+    uint32_t px_size = cf == LV_IMG_CF_ALPHA_8BIT ? 1 : LV_IMG_PX_SIZE_ALPHA_BYTE;
+
+    /*Get the width of the `disp_area` it will be used to go to the next line*/
+    int32_t disp_w = lv_area_get_width(disp_area);
+
+    /*Get the width of the `draw_area` it will be used to go to the next line of the mask*/
+    int32_t draw_area_w = lv_area_get_width(draw_area);
+
+    /*Get the width of the `mask_area` it will be used to go to the next line*/
+    int32_t map_w = lv_area_get_width(map_area);
+
+    /*Create a temp. map_buf which always point to the first pixel to draw in the current line*/
+    const lv_color_t * map_buf_first = map_buf + map_w * (draw_area->y1 - (map_area->y1 - disp_area->y1));
+    map_buf_first += (draw_area->x1 - (map_area->x1 - disp_area->x1));
+
+    uint8_t * disp_buf_first = disp_buf + (disp_w * draw_area->y1 + draw_area->x1) * px_size;
+
+    int32_t x;
+    int32_t y;
+
+    for(y = draw_area->y1; y <= draw_area->y2; y++) {
+        uint8_t * px_act = disp_buf_first;
+        if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
+            for(x = 0; x < draw_area_w; x++) {
+                alpha_buf_px_blend(px_act, cf, map_buf_first[x], opa);
+                px_act += px_size;
+            }
+        }
+        else {
+            for(x = 0; x < draw_area_w; x++) {
+                if(mask[x]) {
+                    lv_opa_t opa_tmp = mask[x] >= LV_OPA_MAX ? opa : (uint32_t)((uint32_t)opa * mask[x]) >> 8;
+                    alpha_buf_px_blend(px_act, cf, map_buf_first[x], opa_tmp);
+                }
+                px_act += px_size;
+            }
+            mask += draw_area_w;
+        }
+        disp_buf_first += disp_w * px_size;
+        map_buf_first += map_w;
+    }
+}
+
+/**
+ * Blend a color onto a pixel of a `LV_IMG_CF_TRUE_COLOR_ALPHA` or `LV_IMG_CF_ALPHA_8BIT` buffer
+ * @param px pointer to the pixel
+ * @param cf color format of the buffer
+ * @param color the color to blend
+ * @param opa opacity of `color`
+ */
+static inline void alpha_buf_px_blend(uint8_t * px, lv_img_cf_t cf, lv_color_t color, lv_opa_t opa)
+{
+    if(opa <= LV_OPA_MIN) return;
+
+    if(cf == LV_IMG_CF_ALPHA_8BIT) {
+        /*Alpha only buffers store the brightness of the color*/
+        uint8_t br = lv_color_brightness(color);
+        if(opa < LV_OPA_MAX) br = (uint16_t)((uint16_t)br * opa + (px[0] * (255 - opa))) >> 8;
+        px[0] = br;
+        return;
+    }
+
+    lv_color_t res_color;
+    lv_opa_t res_opa;
+    if(opa >= LV_OPA_MAX) {
+        res_color = color;
+        res_opa = opa;
+    }
+    else {
+        lv_color_t bg_color;
+        _lv_memcpy_small(&bg_color, px, sizeof(lv_color_t));
+#if LV_COLOR_DEPTH == 32
+        bg_color.ch.alpha = 0xFF;
+#endif
+        lv_color_mix_with_alpha(bg_color, px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1], color, opa, &res_color, &res_opa);
+    }
+
+    _lv_memcpy_small(px, &res_color, LV_IMG_PX_SIZE_ALPHA_BYTE - 1); /*-1 to not overwrite the alpha value*/
+    px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = res_opa;
+}
+
 /**
  * Copy an image to an area
  * @param disp_area the current display area (destination area)
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_draw_img.h"
 #include "lv_img_cache.h"
+#include "lv_img_async.h"
 #include "../lv_hal/lv_hal_disp.h"
 #include "../lv_misc/lv_log.h"
 #include "../lv_core/lv_refr.h"
@@ -238,7 +239,13 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
 
     lv_img_cache_entry_t * cdsc = _lv_img_cache_open(src, draw_dsc->recolor);
 
-    if(cdsc == NULL) return LV_RES_INV;
+    if(cdsc == NULL) {
+#if LV_USE_IMG_ASYNC
+        /*Being decoded in the background. It will be redrawn when it's ready.*/
+        if(_lv_img_async_wait(coords, clip_area, src, draw_dsc)) return LV_RES_OK;
+#endif
+        return LV_RES_INV;
+    }
 
     bool chroma_keyed = lv_img_cf_is_chroma_keyed(cdsc->dec_dsc.header.cf);
     bool alpha_byte   = lv_img_cf_has_alpha(cdsc->dec_dsc.header.cf);
@@ -289,22 +296,28 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
 
         int32_t width = lv_area_get_width(&mask_com);
 
-        uint8_t  * buf = _lv_mem_buf_get(lv_area_get_width(&mask_com) *
-                                         LV_IMG_PX_SIZE_ALPHA_BYTE);  /*+1 because of the possible alpha byte*/
+        /*Read and draw stripes of lines. The lines of a stripe are stored continuously in `buf`*/
+        uint32_t line_size = width * (alpha_byte ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t));
+        int32_t stripe_h = 1;
+#if LV_IMG_READ_BUF_SIZE
+        stripe_h = LV_IMG_READ_BUF_SIZE / line_size;
+        if(stripe_h < 1) stripe_h = 1;
+        if(stripe_h > lv_area_get_height(&mask_com)) stripe_h = lv_area_get_height(&mask_com);
+#endif
+
+        uint8_t  * buf = _lv_mem_buf_get(line_size * stripe_h);
 
-        lv_area_t line;
-        lv_area_copy(&line, &mask_com);
-        lv_area_set_height(&line, 1);
+        lv_area_t stripe;
+        lv_area_copy(&stripe, &mask_com);
         int32_t x = mask_com.x1 - coords->x1;
         int32_t y = mask_com.y1 - coords->y1;
-        int32_t row;
         lv_res_t read_res;
-        for(row = mask_com.y1; row <= mask_com.y2; row++) {
-            lv_area_t mask_line;
-            union_ok = _lv_area_intersect(&mask_line, clip_area, &line);
-            if(union_ok == false) continue;
+        while(stripe.y1 <= mask_com.y2) {
+            stripe.y2 = stripe.y1 + stripe_h - 1;
+            if(stripe.y2 > mask_com.y2) stripe.y2 = mask_com.y2;
+            int32_t lines = lv_area_get_height(&stripe);
 
-            read_res = lv_img_decoder_read_line(&cdsc->dec_dsc, x, y, width, buf);
+            read_res = lv_img_decoder_read_lines(&cdsc->dec_dsc, x, y, width, lines, buf);
             if(read_res != LV_RES_OK) {
                 lv_img_decoder_close(&cdsc->dec_dsc);
                 LV_LOG_WARN("Image draw can't read the line");
@@ -313,10 +326,10 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
                 return LV_RES_INV;
             }
 
-            lv_draw_map(&line, &mask_line, buf, draw_dsc, chroma_keyed, alpha_byte);
-            line.y1++;
-            line.y2++;
-            y++;
+            /*`mask_com` is already in `clip_area` so the stripe can be the mask too*/
+            lv_draw_map(&stripe, &stripe, buf, draw_dsc, chroma_keyed, alpha_byte);
+            stripe.y1 += lines;
+            y += lines;
         }
         _lv_mem_buf_release(buf);
     }
@@ -527,6 +540,18 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
 
 #if LV_USE_IMG_TRANSFORM
                 int32_t rot_x = disp_area->x1 + draw_area.x1 - map_area->x1;
+                if(transform && trans_dsc.tmp.line_kernel != LV_IMG_TRANSFORM_LINE_NONE) {
+                    /*Scaling and right angle rotation: transform the whole line at once*/
+                    _lv_img_buf_transform_line(&trans_dsc, rot_x, rot_y + y, draw_area_w, &map2[px_i], &mask_buf[px_i]);
+                    if(draw_dsc->recolor_opa != 0) {
+                        for(x = 0; x < draw_area_w; x++) {
+                            if(mask_buf[px_i + x] == LV_OPA_TRANSP) continue;
+                            map2[px_i + x] = lv_color_mix_premult(recolor_premult, map2[px_i + x], recolor_opa_inv);
+                        }
+                    }
+                    px_i += draw_area_w;
+                }
+                else
 #endif
                 for(x = 0; x < draw_area_w; x++, map_px += px_size_byte, px_i++) {
 
@@ -157,6 +157,25 @@ void * lv_draw_mask_remove_custom(void * custom_id)
     return p;
 }
 
+/**
+ * Save and remove all the added masks. Useful to draw to an other buffer while drawing an object.
+ * @param saved the masks are saved here. Restore them with `_lv_draw_mask_restore_all`
+ */
+void _lv_draw_mask_save_all(_lv_draw_mask_saved_arr_t saved)
+{
+    _lv_memcpy(saved, LV_GC_ROOT(_lv_draw_mask_list), sizeof(_lv_draw_mask_saved_arr_t));
+    _lv_memset_00(LV_GC_ROOT(_lv_draw_mask_list), sizeof(_lv_draw_mask_saved_arr_t));
+}
+
+/**
+ * Restore the masks saved by `_lv_draw_mask_save_all`
+ * @param saved the saved masks
+ */
+void _lv_draw_mask_restore_all(const _lv_draw_mask_saved_arr_t saved)
+{
+    _lv_memcpy(LV_GC_ROOT(_lv_draw_mask_list), saved, sizeof(_lv_draw_mask_saved_arr_t));
+}
+
 /**
  * Count the currently added masks
  * @return number of active masks
@@ -213,6 +213,18 @@ void * lv_draw_mask_remove_id(int16_t id);
  */
 void * lv_draw_mask_remove_custom(void * custom_id);
 
+/**
+ * Save and remove all the added masks. Useful to draw to an other buffer while drawing an object.
+ * @param saved the masks are saved here. Restore them with `_lv_draw_mask_restore_all`
+ */
+void _lv_draw_mask_save_all(_lv_draw_mask_saved_arr_t saved);
+
+/**
+ * Restore the masks saved by `_lv_draw_mask_save_all`
+ * @param saved the saved masks
+ */
+void _lv_draw_mask_restore_all(const _lv_draw_mask_saved_arr_t saved);
+
 //! @cond Doxygen_Suppress
 
 /**
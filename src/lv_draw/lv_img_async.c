@@ -0,0 +1,446 @@
+/**
+ * @file lv_img_async.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_img_async.h"
+#if LV_USE_IMG_ASYNC
+
+#include "lv_img_cache.h"
+#include "../lv_core/lv_obj.h"
+#include "../lv_core/lv_refr.h"
+#include "../lv_hal/lv_hal_tick.h"
+#include "../lv_misc/lv_debug.h"
+#include "../lv_misc/lv_task.h"
+#include "../lv_misc/lv_gc.h"
+
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    #error "LV_USE_IMG_ASYNC requires the image cache. Set LV_IMG_CACHE_DEF_SIZE > 0"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void poll_task_cb(lv_task_t * task);
+static lv_img_async_job_t * find_job(const void * src, lv_color_t color);
+static lv_img_decoder_t * find_decoder(const void * src);
+static void job_cancel(lv_img_async_job_t * job);
+static void job_free(lv_img_async_job_t * job);
+static lv_img_async_state_t job_get_state(lv_img_async_job_t * job);
+static void waiter_add(lv_img_async_job_t * job, lv_obj_t * obj);
+static void waiters_invalidate(lv_img_async_job_t * job);
+static bool src_match(const void * src1, const void * src2);
+static void job_lock(void);
+static void job_unlock(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_img_async_drv_t async_drv;
+static lv_task_t * poll_task;
+static uint32_t run_cnt;    /*Number of not finished jobs*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Initialize the asynchronous image decoding module
+ */
+void _lv_img_async_init(void)
+{
+    _lv_ll_init(&LV_GC_ROOT(_lv_img_async_ll), sizeof(lv_img_async_job_t));
+    _lv_memset_00(&async_drv, sizeof(async_drv));
+    poll_task = NULL;
+    run_cnt = 0;
+}
+
+/**
+ * Initialize an asynchronous decoding driver with default values.
+ * @param drv pointer to driver variable to initialize
+ */
+void lv_img_async_drv_init(lv_img_async_drv_t * drv)
+{
+    _lv_memset_00(drv, sizeof(lv_img_async_drv_t));
+    drv->poll_period = LV_DISP_DEF_REFR_PERIOD;
+}
+
+/**
+ * Register an asynchronous decoding driver. Images of the decoders marked with
+ * ::lv_img_decoder_set_async will be decoded in the background.
+ * The worker calls the decoders, so the decoders and `lv_mem_alloc` (if they use it) need to be thread safe.
+ * E.g. use `LV_MEM_CUSTOM 1` with a thread safe `malloc`.
+ * @param drv pointer to an initialized driver. Only its content is used, it can be a local variable.
+ */
+void lv_img_async_drv_register(const lv_img_async_drv_t * drv)
+{
+    async_drv = *drv;
+    if(async_drv.poll_period == 0) async_drv.poll_period = 1;
+    if(poll_task) lv_task_set_period(poll_task, async_drv.poll_period);
+}
+
+/**
+ * Decode an image. Call it from the worker (thread) with the jobs received in `submit_cb`.
+ * @param job pointer to a job
+ */
+void lv_img_async_run(lv_img_async_job_t * job)
+{
+    job_lock();
+    bool canceled = job->canceled ? true : false;
+    if(canceled) {
+        job->res = LV_RES_INV;
+        job->state = LV_IMG_ASYNC_STATE_DONE;
+    }
+    else {
+        job->state = LV_IMG_ASYNC_STATE_RUNNING;
+    }
+    job_unlock();
+
+    if(canceled) return;
+
+    uint32_t t_start = lv_tick_get();
+    lv_res_t res = lv_img_decoder_open(&job->dec_dsc, job->src, job->color);
+    if(res == LV_RES_OK && job->dec_dsc.time_to_open == 0) {
+        job->dec_dsc.time_to_open = lv_tick_elaps(t_start);
+    }
+
+    /*LVGL can use the job once it's done. The lock makes the decoded image visible to LVGL too.*/
+    job_lock();
+    job->res = res;
+    job->state = LV_IMG_ASYNC_STATE_DONE;
+    job_unlock();
+}
+
+/**
+ * Cancel the background decoding of an image source (with any color).
+ * The objects waiting for the image are invalidated to open it again.
+ * Called automatically when an image source is invalidated in the cache.
+ * @param src the image source or NULL to cancel all
+ */
+void lv_img_async_cancel(const void * src)
+{
+    lv_img_async_job_t * job = _lv_ll_get_head(&LV_GC_ROOT(_lv_img_async_ll));
+    while(job) {
+        lv_img_async_job_t * job_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_img_async_ll), job);
+        if(!job->canceled && (src == NULL || src_match(src, job->src))) {
+            waiters_invalidate(job);
+            job_cancel(job);
+        }
+        job = job_next;
+    }
+}
+
+/**
+ * Get the number of images which are being decoded (including the not yet collected canceled images)
+ * @return number of jobs
+ */
+uint32_t lv_img_async_get_job_cnt(void)
+{
+    return run_cnt;
+}
+
+/**
+ * Submit an image to decode in the background if its decoder is asynchronous.
+ * Used by the image cache on a cache miss.
+ * @param src the image source
+ * @param color the color of the image with `LV_IMG_CF_ALPHA_...`
+ * @return true: the image is being decoded in the background; false: open it synchronously
+ */
+bool _lv_img_async_request(const void * src, lv_color_t color)
+{
+    if(async_drv.submit_cb == NULL) return false;
+
+    lv_img_async_job_t * job = find_job(src, color);
+    if(job) {
+        /*Failed earlier. Open it synchronously to show the error*/
+        if(job_get_state(job) == LV_IMG_ASYNC_STATE_DONE && job->res != LV_RES_OK) return false;
+        else return true;
+    }
+
+    lv_img_decoder_t * decoder = find_decoder(src);
+    if(decoder == NULL || decoder->async == 0) return false;
+
+    job = _lv_ll_ins_tail(&LV_GC_ROOT(_lv_img_async_ll));
+    LV_ASSERT_MEM(job);
+    if(job == NULL) return false;
+
+    _lv_memset_00(job, sizeof(lv_img_async_job_t));
+    job->color = color;
+    job->state = LV_IMG_ASYNC_STATE_PENDING;
+
+    /*The image object might free its path meanwhile so save it*/
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_FILE) {
+        size_t len = strlen(src);
+        char * path = lv_mem_alloc(len + 1);
+        LV_ASSERT_MEM(path);
+        if(path == NULL) {
+            _lv_ll_remove(&LV_GC_ROOT(_lv_img_async_ll), job);
+            lv_mem_free(job);
+            return false;
+        }
+        _lv_memcpy(path, src, len + 1);
+        job->src = path;
+    }
+    else {
+        job->src = src;
+    }
+
+    if(poll_task == NULL) {
+        poll_task = lv_task_create(poll_task_cb, async_drv.poll_period, LV_TASK_PRIO_MID, NULL);
+        LV_ASSERT_MEM(poll_task);
+    }
+
+    run_cnt++;
+    LV_LOG_INFO("image draw: decode the image in the background");
+    async_drv.submit_cb(job);
+
+    return true;
+}
+
+/**
+ * Handle an image which is not opened yet because it's being decoded in the background.
+ * Draw the placeholder and mark the object being drawn to invalidate it when the image is ready.
+ * @param coords coordinates of the image
+ * @param clip_area the image will be drawn only in this area
+ * @param src the image source
+ * @param draw_dsc the draw descriptor of the image
+ * @return true: the image is being decoded; false: the image is not being decoded
+ */
+bool _lv_img_async_wait(const lv_area_t * coords, const lv_area_t * clip_area, const void * src,
+                        const lv_draw_img_dsc_t * draw_dsc)
+{
+    lv_img_async_job_t * job = find_job(src, draw_dsc->recolor);
+    if(job == NULL) return false;
+    if(job_get_state(job) == LV_IMG_ASYNC_STATE_DONE && job->res != LV_RES_OK) return false;
+
+    /* The image might be drawn to an other buffer (e.g. a canvas or a layer) whose coordinates
+     * and display are not valid later. So remember the object and invalidate it in the usual way.
+     * Nothing needs to be redrawn if no object is drawn (e.g. drawing directly to a canvas)*/
+    lv_obj_t * obj = _lv_refr_get_obj_refreshing();
+    if(obj) waiter_add(job, obj);
+
+    if(async_drv.placeholder_cb) async_drv.placeholder_cb(coords, clip_area, src);
+
+    return true;
+}
+
+/**
+ * An object doesn't wait for an image anymore (e.g. it's deleted or its source changed).
+ * The decoding is canceled if no other object waits for the image.
+ * @param obj pointer to an object
+ * @param src the image source or NULL to remove the object from all images
+ */
+void _lv_img_async_remove_waiter(lv_obj_t * obj, const void * src)
+{
+    lv_img_async_job_t * job = _lv_ll_get_head(&LV_GC_ROOT(_lv_img_async_ll));
+    while(job) {
+        lv_img_async_job_t * job_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_img_async_ll), job);
+        if(src == NULL || src_match(src, job->src)) {
+            uint16_t i;
+            for(i = 0; i < job->waiter_cnt; i++) {
+                if(job->waiters[i] != obj) continue;
+
+                job->waiter_cnt--;
+                job->waiters[i] = job->waiters[job->waiter_cnt];
+                if(job->waiter_cnt == 0) {
+                    lv_mem_free(job->waiters);
+                    job->waiters = NULL;
+                    job_cancel(job);
+                }
+                break;
+            }
+        }
+        job = job_next;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Collect the finished jobs: move the decoded images to the cache and invalidate their area
+ */
+static void poll_task_cb(lv_task_t * task)
+{
+    LV_UNUSED(task);
+
+    lv_img_async_job_t * job = _lv_ll_get_head(&LV_GC_ROOT(_lv_img_async_ll));
+    while(job) {
+        lv_img_async_job_t * job_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_img_async_ll), job);
+        if(!job->collected && job_get_state(job) == LV_IMG_ASYNC_STATE_DONE) {
+            run_cnt--;
+            job->collected = 1;
+
+            if(job->canceled) {
+                job_free(job);
+            }
+            else if(job->res == LV_RES_OK) {
+                _lv_img_cache_add(&job->dec_dsc);
+                waiters_invalidate(job);
+
+                /*The cache owns the decoder descriptor now*/
+                job->res = LV_RES_INV;
+                job_free(job);
+            }
+            else {
+                /*Keep the failed job to not retry it again and again. Redraw to show the error.*/
+                LV_LOG_WARN("Image can't be decoded in the background");
+                waiters_invalidate(job);
+            }
+        }
+        job = job_next;
+    }
+
+    if(run_cnt == 0 && poll_task) {
+        lv_task_del(poll_task);
+        poll_task = NULL;
+    }
+}
+
+static lv_img_async_job_t * find_job(const void * src, lv_color_t color)
+{
+    lv_img_async_job_t * job;
+    _LV_LL_READ(LV_GC_ROOT(_lv_img_async_ll), job) {
+        if(job->canceled) continue;
+        if(job->color.full == color.full && src_match(src, job->src)) return job;
+    }
+
+    return NULL;
+}
+
+/**
+ * Find the decoder which would open an image. Only the cheap `info_cb` is called.
+ */
+static lv_img_decoder_t * find_decoder(const void * src)
+{
+    lv_img_header_t header;
+    lv_img_decoder_t * d;
+    _LV_LL_READ(LV_GC_ROOT(_lv_img_defoder_ll), d) {
+        if(d->info_cb == NULL || d->open_cb == NULL) continue;
+        if(d->info_cb(d, src, &header) == LV_RES_OK) return d;
+    }
+
+    return NULL;
+}
+
+/**
+ * Cancel a job. The worker might still use the not finished jobs so `poll_task` will free them.
+ */
+static void job_cancel(lv_img_async_job_t * job)
+{
+    job_lock();
+    bool done = job->state == LV_IMG_ASYNC_STATE_DONE ? true : false;
+    if(!done) job->canceled = 1;
+    job_unlock();
+
+    if(done) job_free(job);
+}
+
+/**
+ * Free a finished or collected job. Close the image if it's still opened.
+ */
+static void job_free(lv_img_async_job_t * job)
+{
+    if(job->state == LV_IMG_ASYNC_STATE_DONE && job->res == LV_RES_OK) {
+        lv_img_decoder_close(&job->dec_dsc);
+    }
+
+    if(job->state == LV_IMG_ASYNC_STATE_DONE && !job->collected) {
+        /*Finished but not collected yet*/
+        run_cnt--;
+    }
+
+    if(lv_img_src_get_type(job->src) == LV_IMG_SRC_FILE) {
+        lv_mem_free((void *)job->src);
+    }
+
+    lv_mem_free(job->waiters);
+    _lv_ll_remove(&LV_GC_ROOT(_lv_img_async_ll), job);
+    lv_mem_free(job);
+}
+
+/**
+ * Read the state of a job written by the worker
+ */
+static lv_img_async_state_t job_get_state(lv_img_async_job_t * job)
+{
+    job_lock();
+    lv_img_async_state_t state = job->state;
+    job_unlock();
+
+    return state;
+}
+
+/**
+ * Remember an object to invalidate when the image is ready
+ */
+static void waiter_add(lv_img_async_job_t * job, lv_obj_t * obj)
+{
+    uint16_t i;
+    for(i = 0; i < job->waiter_cnt; i++) {
+        if(job->waiters[i] == obj) return;
+    }
+
+    lv_obj_t ** waiters = lv_mem_realloc(job->waiters, (job->waiter_cnt + 1) * sizeof(lv_obj_t *));
+    LV_ASSERT_MEM(waiters);
+    if(waiters == NULL) return;
+
+    job->waiters = waiters;
+    job->waiters[job->waiter_cnt] = obj;
+    job->waiter_cnt++;
+}
+
+/**
+ * Invalidate the objects waiting for the image and forget them
+ */
+static void waiters_invalidate(lv_img_async_job_t * job)
+{
+    uint16_t i;
+    for(i = 0; i < job->waiter_cnt; i++) {
+        lv_obj_invalidate(job->waiters[i]);
+    }
+
+    lv_mem_free(job->waiters);
+    job->waiters = NULL;
+    job->waiter_cnt = 0;
+}
+
+static bool src_match(const void * src1, const void * src2)
+{
+    lv_img_src_t src_type = lv_img_src_get_type(src1);
+    if(src_type == LV_IMG_SRC_VARIABLE)
+        return src1 == src2;
+    if(src_type != LV_IMG_SRC_FILE)
+        return false;
+    if(lv_img_src_get_type(src2) != LV_IMG_SRC_FILE)
+        return false;
+    return strcmp(src1, src2) == 0;
+}
+
+static void job_lock(void)
+{
+    if(async_drv.lock_cb) async_drv.lock_cb();
+}
+
+static void job_unlock(void)
+{
+    if(async_drv.unlock_cb) async_drv.unlock_cb();
+}
+
+#endif /*LV_USE_IMG_ASYNC*/
@@ -0,0 +1,162 @@
+/**
+ * @file lv_img_async.h
+ *
+ */
+
+#ifndef LV_IMG_ASYNC_H
+#define LV_IMG_ASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_USE_IMG_ASYNC
+
+#include "lv_img_decoder.h"
+#include "lv_draw_img.h"
+#include "../lv_misc/lv_area.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+enum {
+    LV_IMG_ASYNC_STATE_PENDING,     /**< Submitted, waiting for the worker*/
+    LV_IMG_ASYNC_STATE_RUNNING,     /**< The worker is decoding the image*/
+    LV_IMG_ASYNC_STATE_DONE,        /**< The worker finished (successfully or not)*/
+};
+typedef uint8_t lv_img_async_state_t;
+
+struct _lv_obj_t;
+
+/**
+ * An image decoded in the background.
+ * Created and freed by LVGL, the worker only needs to pass it to ::lv_img_async_run
+ */
+typedef struct {
+    lv_img_decoder_dsc_t dec_dsc;       /**< Opened by the worker*/
+    const void * src;                   /**< The image source (a copy of the path for files)*/
+    lv_color_t color;                   /**< The color of the image with `LV_IMG_CF_ALPHA_...`*/
+    struct _lv_obj_t ** waiters;        /**< The objects to invalidate when the image is ready*/
+    uint16_t waiter_cnt;                /**< Number of `waiters`. The job is canceled when the last one leaves*/
+    lv_res_t res;                       /**< Result of the decoding. Valid in the `DONE` state.
+                                             Failed jobs are kept to open the image synchronously and show the error*/
+    lv_img_async_state_t state;         /**< Written by the worker, read by LVGL. Accessed between `lock_cb` and `unlock_cb`*/
+    uint8_t canceled;                   /**< Written by LVGL, read by the worker. Accessed between `lock_cb` and `unlock_cb`*/
+    uint8_t collected;                  /**< The finished job is already handled by LVGL*/
+    void * user_data;                   /**< Free to use by the worker (e.g. queue link)*/
+} lv_img_async_job_t;
+
+/**
+ * Describes how the images are decoded in the background.
+ */
+typedef struct {
+    /**Hand a job to the worker (thread). Called from LVGL's context.
+     * Every submitted job must be passed to ::lv_img_async_run once, even if it was canceled meanwhile*/
+    void (*submit_cb)(lv_img_async_job_t * job);
+
+    /**Optional: draw something (e.g. a low resolution version) in place of an image which is being decoded*/
+    void (*placeholder_cb)(const lv_area_t * coords, const lv_area_t * clip_area, const void * src);
+
+    /**Check the finished jobs with this period [ms]*/
+    uint32_t poll_period;
+
+    /**Protect the fields of the jobs shared with the worker, e.g. take and give a mutex.
+     * Required if the worker runs in an other thread. The other callbacks are not called while it's taken.*/
+    void (*lock_cb)(void);
+    void (*unlock_cb)(void);
+} lv_img_async_drv_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the asynchronous image decoding module
+ */
+void _lv_img_async_init(void);
+
+/**
+ * Initialize an asynchronous decoding driver with default values.
+ * @param drv pointer to driver variable to initialize
+ */
+void lv_img_async_drv_init(lv_img_async_drv_t * drv);
+
+/**
+ * Register an asynchronous decoding driver. Images of the decoders marked with
+ * ::lv_img_decoder_set_async will be decoded in the background.
+ * The worker calls the decoders, so the decoders and `lv_mem_alloc` (if they use it) need to be thread safe.
+ * E.g. use `LV_MEM_CUSTOM 1` with a thread safe `malloc`.
+ * @param drv pointer to an initialized driver. Only its content is used, it can be a local variable.
+ */
+void lv_img_async_drv_register(const lv_img_async_drv_t * drv);
+
+/**
+ * Decode an image. Call it from the worker (thread) with the jobs received in `submit_cb`.
+ * @param job pointer to a job
+ */
+void lv_img_async_run(lv_img_async_job_t * job);
+
+/**
+ * Cancel the background decoding of an image source (with any color).
+ * The objects waiting for the image are invalidated to open it again.
+ * Called automatically when an image source is invalidated in the cache.
+ * @param src the image source or NULL to cancel all
+ */
+void lv_img_async_cancel(const void * src);
+
+/**
+ * Get the number of images which are being decoded (including the not yet collected canceled images)
+ * @return number of jobs
+ */
+uint32_t lv_img_async_get_job_cnt(void);
+
+/**
+ * Submit an image to decode in the background if its decoder is asynchronous.
+ * Used by the image cache on a cache miss.
+ * @param src the image source
+ * @param color the color of the image with `LV_IMG_CF_ALPHA_...`
+ * @return true: the image is being decoded in the background; false: open it synchronously
+ */
+bool _lv_img_async_request(const void * src, lv_color_t color);
+
+/**
+ * Handle an image which is not opened yet because it's being decoded in the background.
+ * Draw the placeholder and mark the object being drawn to invalidate it when the image is ready.
+ * @param coords coordinates of the image
+ * @param clip_area the image will be drawn only in this area
+ * @param src the image source
+ * @param draw_dsc the draw descriptor of the image
+ * @return true: the image is being decoded; false: the image is not being decoded
+ */
+bool _lv_img_async_wait(const lv_area_t * coords, const lv_area_t * clip_area, const void * src,
+                        const lv_draw_img_dsc_t * draw_dsc);
+
+/**
+ * An object doesn't wait for an image anymore (e.g. it's deleted or its source changed).
+ * The decoding is canceled if no other object waits for the image.
+ * @param obj pointer to an object
+ * @param src the image source or NULL to remove the object from all images
+ */
+void _lv_img_async_remove_waiter(struct _lv_obj_t * obj, const void * src);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMG_ASYNC*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_IMG_ASYNC_H*/
@@ -25,6 +25,22 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_USE_IMG_TRANSFORM
+static void transform_line_nearest(const lv_img_transform_dsc_t * dsc, int32_t xt, int32_t yt, lv_coord_t len,
+                                   lv_color_t * cbuf, lv_opa_t * abuf);
+static void transform_line_int_zoom(const lv_img_transform_dsc_t * dsc, int32_t xt, int32_t yt, lv_coord_t len,
+                                    lv_color_t * cbuf, lv_opa_t * abuf);
+static void transform_line_bilinear(const lv_img_transform_dsc_t * dsc, int32_t xt, int32_t yt, lv_coord_t len,
+                                    lv_color_t * cbuf, lv_opa_t * abuf);
+static void transform_line_rotate(const lv_img_transform_dsc_t * dsc, int32_t xs0, int32_t dxs, int32_t ys0,
+                                  int32_t dys, lv_coord_t len, lv_color_t * cbuf, lv_opa_t * abuf);
+static void clip_rotated_run(int32_t s0, int32_t ds, int32_t size, int32_t * i_start, int32_t * i_end);
+static void transform_line_affine(const lv_img_transform_dsc_t * dsc, int32_t xt, int32_t yt, lv_coord_t len,
+                                  lv_color_t * cbuf, lv_opa_t * abuf);
+static void clip_affine_run(int64_t s0, int32_t ds, int32_t size, int32_t * i_start, int32_t * i_end);
+static int64_t div_floor(int64_t a, int64_t b);
+static int64_t div_ceil(int64_t a, int64_t b);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -457,6 +473,23 @@ void _lv_img_buf_transform_init(lv_img_transform_dsc_t * dsc)
      *  + dsc->cfg.zoom / 2 for rounding*/
     dsc->tmp.zoom_inv = (((256 * 256) << _LV_ZOOM_INV_UPSCALE) + dsc->cfg.zoom / 2) / dsc->cfg.zoom;
 
+    /*Select a line kernel for the common special cases*/
+    dsc->tmp.line_kernel = LV_IMG_TRANSFORM_LINE_NONE;
+    if(dsc->tmp.native_color) {
+        if(dsc->cfg.angle == 0 && dsc->cfg.zoom != LV_IMG_ZOOM_NONE) {
+            dsc->tmp.line_kernel = LV_IMG_TRANSFORM_LINE_ZOOM;
+        }
+        else if(dsc->cfg.zoom == LV_IMG_ZOOM_NONE) {
+            if(dsc->cfg.angle == 900) dsc->tmp.line_kernel = LV_IMG_TRANSFORM_LINE_ROT90;
+            else if(dsc->cfg.angle == 1800) dsc->tmp.line_kernel = LV_IMG_TRANSFORM_LINE_ROT180;
+            else if(dsc->cfg.angle == 2700) dsc->tmp.line_kernel = LV_IMG_TRANSFORM_LINE_ROT270;
+        }
+
+        if(dsc->tmp.line_kernel == LV_IMG_TRANSFORM_LINE_NONE && dsc->cfg.angle != 0) {
+            dsc->tmp.line_kernel = LV_IMG_TRANSFORM_LINE_AFFINE;
+        }
+    }
+
     dsc->res.opa = LV_OPA_COVER;
     dsc->res.color = dsc->cfg.color;
 }
@@ -676,7 +709,524 @@ bool _lv_img_buf_transform_anti_alias(lv_img_transform_dsc_t * dsc)
 
     return true;
 }
+
+/**
+ * Transform a horizontal line of pixels with the kernel selected by `_lv_img_buf_transform_init`.
+ * Much faster than calling `_lv_img_buf_transform` for every pixel.
+ * @param dsc a descriptor initialized by `_lv_img_buf_transform_init`.
+ *            `dsc->tmp.line_kernel` must not be `LV_IMG_TRANSFORM_LINE_NONE`
+ * @param x the x coordinate of the first pixel of the line
+ * @param y the y coordinate of the line
+ * @param len number of pixels to transform
+ * @param cbuf store the colors here (`len` elements)
+ * @param abuf store the opacities here (`len` elements). `LV_OPA_TRANSP` where the pixel was out of the image
+ */
+void _lv_img_buf_transform_line(lv_img_transform_dsc_t * dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                                lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    int32_t xt = x - dsc->cfg.pivot_x;
+    int32_t yt = y - dsc->cfg.pivot_y;
+
+    switch(dsc->tmp.line_kernel) {
+        case LV_IMG_TRANSFORM_LINE_ZOOM:
+            if(dsc->cfg.antialias) transform_line_bilinear(dsc, xt, yt, len, cbuf, abuf);
+            else if((dsc->cfg.zoom & 0xFF) == 0) transform_line_int_zoom(dsc, xt, yt, len, cbuf, abuf);
+            else transform_line_nearest(dsc, xt, yt, len, cbuf, abuf);
+            break;
+        /*Source coordinates if the angle is exactly a right angle (see `_lv_img_buf_transform`):
+         * 90:  xs = pivot_x + yt, ys = pivot_y - xt
+         * 180: xs = pivot_x - xt, ys = pivot_y - yt
+         * 270: xs = pivot_x - yt, ys = pivot_y + xt*/
+        case LV_IMG_TRANSFORM_LINE_ROT90:
+            transform_line_rotate(dsc, dsc->cfg.pivot_x + yt, 0, dsc->cfg.pivot_y - xt, -1, len, cbuf, abuf);
+            break;
+        case LV_IMG_TRANSFORM_LINE_ROT180:
+            transform_line_rotate(dsc, dsc->cfg.pivot_x - xt, -1, dsc->cfg.pivot_y - yt, 0, len, cbuf, abuf);
+            break;
+        case LV_IMG_TRANSFORM_LINE_ROT270:
+            transform_line_rotate(dsc, dsc->cfg.pivot_x - yt, 0, dsc->cfg.pivot_y + xt, 1, len, cbuf, abuf);
+            break;
+        case LV_IMG_TRANSFORM_LINE_AFFINE:
+            transform_line_affine(dsc, xt, yt, len, cbuf, abuf);
+            break;
+        default:
+            _lv_memset_00(abuf, len);
+            break;
+    }
+}
 #endif
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_USE_IMG_TRANSFORM
+/**
+ * Read a native color from an image buffer
+ * @param p pointer to the pixel
+ * @return the color
+ */
+static inline lv_color_t read_native_color(const uint8_t * p)
+{
+    lv_color_t c;
+#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
+    c.full = p[0];
+#elif LV_COLOR_DEPTH == 16
+    c.full = p[0] + (p[1] << 8);
+#elif LV_COLOR_DEPTH == 32
+    c.full = p[0] + (p[1] << 8) + ((uint32_t)p[2] << 16);
+    c.ch.alpha = 0xFF;
+#endif
+    return c;
+}
+
+/**
+ * Read a color and an opacity from a native image buffer
+ * @param dsc pointer to the transformation descriptor
+ * @param p pointer to the pixel
+ * @param c store the color here
+ * @return the opacity of the pixel
+ */
+static inline lv_opa_t read_native_px(const lv_img_transform_dsc_t * dsc, const uint8_t * p, lv_color_t * c)
+{
+    *c = read_native_color(p);
+    if(dsc->tmp.has_alpha) return p[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+    if(dsc->tmp.chroma_keyed) {
+        lv_color_t ct = LV_COLOR_TRANSP;
+        if(c->full == ct.full) return LV_OPA_TRANSP;
+    }
+    return LV_OPA_COVER;
+}
+
+/**
+ * Get the pixel size of a natively colored source image
+ * @param dsc pointer to the transformation descriptor
+ * @return the size of a pixel in bytes
+ */
+static inline uint8_t get_native_px_size(const lv_img_transform_dsc_t * dsc)
+{
+    return dsc->tmp.has_alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : LV_COLOR_SIZE >> 3;
+}
+
+/**
+ * Get the source coordinate of a pivot relative coordinate when scaling.
+ * The same formula as in `_lv_img_buf_transform` to get the same result.
+ * @param dsc pointer to the transformation descriptor
+ * @param t coordinate relative to the pivot
+ * @param pivot_256 the pivot's coordinate multiplied by 256
+ * @return the source coordinate multiplied by 256
+ */
+static inline int32_t zoom_coord(const lv_img_transform_dsc_t * dsc, int32_t t, int32_t pivot_256)
+{
+    return ((int32_t)((int32_t)t * dsc->tmp.zoom_inv) >> _LV_ZOOM_INV_UPSCALE) + pivot_256;
+}
+
+/**
+ * Mix 4 neighboring colors with bilinear weights.
+ * With 16 and 32 bit colors the channels are mixed in parallel in one 32 bit integer (SIMD within a register)
+ * @param c00 top left color
+ * @param c01 top right color
+ * @param c10 bottom left color
+ * @param c11 bottom right color
+ * @param w01 weight of the top right color (0..256)
+ * @param w10 weight of the bottom left color (0..256)
+ * @param w11 weight of the bottom right color (0..256)
+ * @return the mixed color. The weight of `c00` is `256 - w01 - w10 - w11`
+ */
+static inline lv_color_t mix_bilinear(lv_color_t c00, lv_color_t c01, lv_color_t c10, lv_color_t c11,
+                                      uint32_t w01, uint32_t w10, uint32_t w11)
+{
+    uint32_t w00 = 256 - w01 - w10 - w11;
+    lv_color_t ret;
+#if LV_COLOR_DEPTH == 32
+    /*Red and blue are 16 bit apart so they can't overflow into each other*/
+    uint32_t rb = (c00.full & 0xFF00FF) * w00 + (c01.full & 0xFF00FF) * w01 +
+                  (c10.full & 0xFF00FF) * w10 + (c11.full & 0xFF00FF) * w11;
+    uint32_t g = (c00.full & 0x00FF00) * w00 + (c01.full & 0x00FF00) * w01 +
+                 (c10.full & 0x00FF00) * w10 + (c11.full & 0x00FF00) * w11;
+    ret.full = ((rb >> 8) & 0xFF00FF) | ((g >> 8) & 0x00FF00) | 0xFF000000;
+#elif LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
+    /*Spread RGB565 to 0b00000gggggg00000rrrrr000000bbbbb and use 5 bit weights*/
+    w01 >>= 3;
+    w10 >>= 3;
+    w11 >>= 3;
+    w00 = 32 - w01 - w10 - w11;
+    uint32_t e00 = (c00.full | ((uint32_t)c00.full << 16)) & 0x07E0F81F;
+    uint32_t e01 = (c01.full | ((uint32_t)c01.full << 16)) & 0x07E0F81F;
+    uint32_t e10 = (c10.full | ((uint32_t)c10.full << 16)) & 0x07E0F81F;
+    uint32_t e11 = (c11.full | ((uint32_t)c11.full << 16)) & 0x07E0F81F;
+    uint32_t e = ((e00 * w00 + e01 * w01 + e10 * w10 + e11 * w11) >> 5) & 0x07E0F81F;
+    ret.full = (uint16_t)(e | (e >> 16));
+#else
+    lv_color_t c0 = w01 + w00 ? lv_color_mix(c01, c00, (w01 * 255) / (w00 + w01)) : c00;
+    lv_color_t c1 = w11 + w10 ? lv_color_mix(c11, c10, (w11 * 255) / (w10 + w11)) : c10;
+    uint32_t w1 = w10 + w11;
+    ret = lv_color_mix(c1, c0, w1 > 255 ? 255 : w1);
+#endif
+    return ret;
+}
+
+/**
+ * Sample 4 neighboring native pixels with bilinear interpolation
+ * @param dsc pointer to the transformation descriptor
+ * @param p00 pointer to the top left pixel
+ * @param p01 pointer to the top right pixel
+ * @param p10 pointer to the bottom left pixel
+ * @param p11 pointer to the bottom right pixel
+ * @param fx horizontal fraction (0..255), the weight of the right pixels
+ * @param fy vertical fraction (0..255), the weight of the bottom pixels
+ * @param c store the color here
+ * @return the interpolated opacity
+ */
+static inline lv_opa_t sample_bilinear(const lv_img_transform_dsc_t * dsc, const uint8_t * p00, const uint8_t * p01,
+                                       const uint8_t * p10, const uint8_t * p11, uint32_t fx, uint32_t fy, lv_color_t * c)
+{
+    lv_color_t c00;
+    lv_color_t c01;
+    lv_color_t c10;
+    lv_color_t c11;
+    lv_opa_t a00 = read_native_px(dsc, p00, &c00);
+    lv_opa_t a01 = read_native_px(dsc, p01, &c01);
+    lv_opa_t a10 = read_native_px(dsc, p10, &c10);
+    lv_opa_t a11 = read_native_px(dsc, p11, &c11);
+
+    uint32_t w11 = (fx * fy) >> 8;
+    uint32_t w01 = fx - w11;
+    uint32_t w10 = fy - w11;
+
+    if(a00 <= LV_OPA_MIN || a01 <= LV_OPA_MIN || a10 <= LV_OPA_MIN || a11 <= LV_OPA_MIN) {
+        /*Don't let the color of the transparent pixels bleed in*/
+        lv_color_t ref;
+        if(a00 > LV_OPA_MIN) ref = c00;
+        else if(a01 > LV_OPA_MIN) ref = c01;
+        else if(a10 > LV_OPA_MIN) ref = c10;
+        else if(a11 > LV_OPA_MIN) ref = c11;
+        else return LV_OPA_TRANSP;
+
+        if(a00 <= LV_OPA_MIN) c00 = ref;
+        if(a01 <= LV_OPA_MIN) c01 = ref;
+        if(a10 <= LV_OPA_MIN) c10 = ref;
+        if(a11 <= LV_OPA_MIN) c11 = ref;
+    }
+
+    *c = mix_bilinear(c00, c01, c10, c11, w01, w10, w11);
+    return (a00 * (256 - w01 - w10 - w11) + a01 * w01 + a10 * w10 + a11 * w11) >> 8;
+}
+
+/**
+ * Transform a line with nearest neighbor scaling
+ * @param dsc pointer to the transformation descriptor
+ * @param xt x coordinate of the first pixel relative to the pivot
+ * @param yt y coordinate of the line relative to the pivot
+ * @param len number of pixels
+ * @param cbuf store the colors here
+ * @param abuf store the opacities here
+ */
+static void transform_line_nearest(const lv_img_transform_dsc_t * dsc, int32_t xt, int32_t yt, lv_coord_t len,
+                                   lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    int32_t ys_int = zoom_coord(dsc, yt, dsc->tmp.pivot_y_256) >> 8;
+    if(ys_int < 0 || ys_int >= dsc->cfg.src_h) {
+        _lv_memset_00(abuf, len);
+        return;
+    }
+
+    uint8_t px_size = get_native_px_size(dsc);
+    const uint8_t * src_row = (const uint8_t *)dsc->cfg.src + (uint32_t)dsc->cfg.src_w * ys_int * px_size;
+
+    /*`xt * zoom_inv` is stepped by additions. It gives the same result as the multiplication*/
+    int32_t acc = (int32_t)((int32_t)xt * dsc->tmp.zoom_inv);
+    lv_coord_t i;
+    for(i = 0; i < len; i++, acc += dsc->tmp.zoom_inv) {
+        int32_t xs_int = ((acc >> _LV_ZOOM_INV_UPSCALE) + dsc->tmp.pivot_x_256) >> 8;
+        if(xs_int < 0 || xs_int >= dsc->cfg.src_w) {
+            abuf[i] = LV_OPA_TRANSP;
+            continue;
+        }
+        abuf[i] = read_native_px(dsc, &src_row[xs_int * px_size], &cbuf[i]);
+    }
+}
+
+/**
+ * Transform a line with integer zoom (2x, 3x, ...) by repeating every source pixel
+ * @param dsc pointer to the transformation descriptor
+ * @param xt x coordinate of the first pixel relative to the pivot
+ * @param yt y coordinate of the line relative to the pivot
+ * @param len number of pixels
+ * @param cbuf store the colors here
+ * @param abuf store the opacities here
+ */
+static void transform_line_int_zoom(const lv_img_transform_dsc_t * dsc, int32_t xt, int32_t yt, lv_coord_t len,
+                                    lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    int32_t k = dsc->cfg.zoom >> 8;
+
+    /*Floor division to handle the negative coordinates left/above the pivot too*/
+    int32_t ys_int = dsc->cfg.pivot_y + (yt >= 0 ? yt / k : -((-yt + k - 1) / k));
+    if(ys_int < 0 || ys_int >= dsc->cfg.src_h) {
+        _lv_memset_00(abuf, len);
+        return;
+    }
+
+    int32_t xs_rel = xt >= 0 ? xt / k : -((-xt + k - 1) / k);
+    int32_t xs_int = dsc->cfg.pivot_x + xs_rel;
+    int32_t rep = k - (xt - xs_rel * k);     /*Remaining repetitions of the first source pixel*/
+
+    uint8_t px_size = get_native_px_size(dsc);
+    const uint8_t * src_row = (const uint8_t *)dsc->cfg.src + (uint32_t)dsc->cfg.src_w * ys_int * px_size;
+
+    lv_coord_t i = 0;
+    while(i < len) {
+        if(rep > len - i) rep = len - i;
+        if(xs_int < 0 || xs_int >= dsc->cfg.src_w) {
+            _lv_memset_00(&abuf[i], rep);
+            i += rep;
+        }
+        else {
+            lv_color_t c;
+            lv_opa_t a = read_native_px(dsc, &src_row[xs_int * px_size], &c);
+            lv_coord_t end = i + rep;
+            for(; i < end; i++) {
+                cbuf[i] = c;
+                abuf[i] = a;
+            }
+        }
+        xs_int++;
+        rep = k;
+    }
+}
+
+/**
+ * Transform a line with bilinear scaling. The source row pair and its weight is calculated once per line,
+ * the columns and their weights are stepped incrementally.
+ * @param dsc pointer to the transformation descriptor
+ * @param xt x coordinate of the first pixel relative to the pivot
+ * @param yt y coordinate of the line relative to the pivot
+ * @param len number of pixels
+ * @param cbuf store the colors here
+ * @param abuf store the opacities here
+ */
+static void transform_line_bilinear(const lv_img_transform_dsc_t * dsc, int32_t xt, int32_t yt, lv_coord_t len,
+                                    lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    int32_t ys = zoom_coord(dsc, yt, dsc->tmp.pivot_y_256);
+    if((ys >> 8) < 0 || (ys >> 8) >= dsc->cfg.src_h) {
+        _lv_memset_00(abuf, len);
+        return;
+    }
+
+    /*Pixel centers are at 0x80, so interpolate between the pixel above and below `ys - 0x80`*/
+    int32_t y0 = (ys - 0x80) >> 8;
+    uint32_t fy = (ys - 0x80) & 0xFF;
+    int32_t y1 = y0 + 1;
+    if(y0 < 0) y0 = 0;
+    if(y1 >= dsc->cfg.src_h) y1 = dsc->cfg.src_h - 1;
+
+    uint8_t px_size = get_native_px_size(dsc);
+    const uint8_t * row0 = (const uint8_t *)dsc->cfg.src + (uint32_t)dsc->cfg.src_w * y0 * px_size;
+    const uint8_t * row1 = (const uint8_t *)dsc->cfg.src + (uint32_t)dsc->cfg.src_w * y1 * px_size;
+    int32_t x_max = dsc->cfg.src_w - 1;
+
+    int32_t acc = (int32_t)((int32_t)xt * dsc->tmp.zoom_inv);
+    lv_coord_t i;
+    for(i = 0; i < len; i++, acc += dsc->tmp.zoom_inv) {
+        int32_t xs = (acc >> _LV_ZOOM_INV_UPSCALE) + dsc->tmp.pivot_x_256;
+        if((xs >> 8) < 0 || (xs >> 8) > x_max) {
+            abuf[i] = LV_OPA_TRANSP;
+            continue;
+        }
+
+        int32_t x0 = (xs - 0x80) >> 8;
+        uint32_t fx = (xs - 0x80) & 0xFF;
+        int32_t x1 = x0 + 1;
+        if(x0 < 0) x0 = 0;
+        if(x1 > x_max) x1 = x_max;
+
+        abuf[i] = sample_bilinear(dsc, &row0[x0 * px_size], &row0[x1 * px_size], &row1[x0 * px_size],
+                                  &row1[x1 * px_size], fx, fy, &cbuf[i]);
+    }
+}
+
+/**
+ * Transform a line with exact 90, 180 or 270 degree rotation.
+ * The source pixel of the line's `i`th pixel is (`xs0 + dxs * i`; `ys0 + dys * i`)
+ * @param dsc pointer to the transformation descriptor
+ * @param xs0 source x coordinate of the first pixel
+ * @param dxs step of the source x coordinate (-1, 0 or 1)
+ * @param ys0 source y coordinate of the first pixel
+ * @param dys step of the source y coordinate (-1, 0 or 1)
+ * @param len number of pixels
+ * @param cbuf store the colors here
+ * @param abuf store the opacities here
+ */
+static void transform_line_rotate(const lv_img_transform_dsc_t * dsc, int32_t xs0, int32_t dxs, int32_t ys0,
+                                  int32_t dys, lv_coord_t len, lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    /*Find the part of the line which is on the image*/
+    int32_t i_start = 0;
+    int32_t i_end = len - 1;
+    clip_rotated_run(xs0, dxs, dsc->cfg.src_w, &i_start, &i_end);
+    clip_rotated_run(ys0, dys, dsc->cfg.src_h, &i_start, &i_end);
+
+    if(i_start > i_end) {
+        _lv_memset_00(abuf, len);
+        return;
+    }
+
+    if(i_start > 0) _lv_memset_00(abuf, i_start);
+    if(i_end < len - 1) _lv_memset_00(&abuf[i_end + 1], len - 1 - i_end);
+
+    uint8_t px_size = get_native_px_size(dsc);
+    int32_t step = (dxs + dys * dsc->cfg.src_w) * px_size;
+    const uint8_t * src_px = (const uint8_t *)dsc->cfg.src;
+    src_px += ((ys0 + dys * i_start) * dsc->cfg.src_w + xs0 + dxs * i_start) * px_size;
+
+    int32_t i;
+    for(i = i_start; i <= i_end; i++, src_px += step) {
+        abuf[i] = read_native_px(dsc, src_px, &cbuf[i]);
+    }
+}
+
+/**
+ * Limit the range of `i` to keep `s0 + ds * i` in [0; size)
+ * @param s0 start coordinate
+ * @param ds step of the coordinate (-1, 0 or 1)
+ * @param size size of the image in the given direction
+ * @param i_start the first index. Might be increased.
+ * @param i_end the last index. Might be decreased.
+ */
+static void clip_rotated_run(int32_t s0, int32_t ds, int32_t size, int32_t * i_start, int32_t * i_end)
+{
+    int32_t first;
+    int32_t last;
+    if(ds == 0) {
+        if(s0 >= 0 && s0 < size) return;
+        first = 1;
+        last = 0;
+    }
+    else if(ds > 0) {
+        first = -s0;
+        last = size - 1 - s0;
+    }
+    else {
+        first = s0 - (size - 1);
+        last = s0;
+    }
+
+    if(*i_start < first) *i_start = first;
+    if(*i_end > last) *i_end = last;
+}
+
+/**
+ * Transform a line with any rotation and zoom.
+ * The source coordinates are stepped incrementally in 1/65536 pixel units
+ * and the part of the line which falls on the image is calculated up front.
+ * @param dsc pointer to the transformation descriptor
+ * @param xt x coordinate of the first pixel relative to the pivot
+ * @param yt y coordinate of the line relative to the pivot
+ * @param len number of pixels
+ * @param cbuf store the colors here
+ * @param abuf store the opacities here
+ */
+static void transform_line_affine(const lv_img_transform_dsc_t * dsc, int32_t xt, int32_t yt, lv_coord_t len,
+                                  lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    /*The same as `_lv_img_buf_transform` but with 16 fractional bits:
+     * xs = cos * xt - sin * yt, ys = sin * xt + cos * yt (with zoom included in sin and cos)*/
+    int32_t cos_step = (int32_t)(((int64_t)dsc->tmp.cosma * dsc->tmp.zoom_inv) >> (_LV_ZOOM_INV_UPSCALE + 2));
+    int32_t sin_step = (int32_t)(((int64_t)dsc->tmp.sinma * dsc->tmp.zoom_inv) >> (_LV_ZOOM_INV_UPSCALE + 2));
+    int64_t xs0 = (int64_t)cos_step * xt - (int64_t)sin_step * yt + ((int64_t)dsc->cfg.pivot_x << 16);
+    int64_t ys0 = (int64_t)sin_step * xt + (int64_t)cos_step * yt + ((int64_t)dsc->cfg.pivot_y << 16);
+
+    int32_t i_start = 0;
+    int32_t i_end = len - 1;
+    clip_affine_run(xs0, cos_step, dsc->cfg.src_w, &i_start, &i_end);
+    clip_affine_run(ys0, sin_step, dsc->cfg.src_h, &i_start, &i_end);
+
+    if(i_start > i_end) {
+        _lv_memset_00(abuf, len);
+        return;
+    }
+
+    if(i_start > 0) _lv_memset_00(abuf, i_start);
+    if(i_end < len - 1) _lv_memset_00(&abuf[i_end + 1], len - 1 - i_end);
+
+    /*In the clipped run the coordinates are on the image so they fit into 32 bit*/
+    int32_t xs = (int32_t)(xs0 + (int64_t)cos_step * i_start);
+    int32_t ys = (int32_t)(ys0 + (int64_t)sin_step * i_start);
+
+    const uint8_t * src = (const uint8_t *)dsc->cfg.src;
+    uint8_t px_size = get_native_px_size(dsc);
+    uint32_t stride = (uint32_t)dsc->cfg.src_w * px_size;
+    int32_t i;
+
+    if(dsc->cfg.antialias == false) {
+        for(i = i_start; i <= i_end; i++, xs += cos_step, ys += sin_step) {
+            abuf[i] = read_native_px(dsc, &src[(ys >> 16) * stride + (xs >> 16) * px_size], &cbuf[i]);
+        }
+        return;
+    }
+
+    int32_t x_max = dsc->cfg.src_w - 1;
+    int32_t y_max = dsc->cfg.src_h - 1;
+    for(i = i_start; i <= i_end; i++, xs += cos_step, ys += sin_step) {
+        /*Pixel centers are at 0x8000*/
+        int32_t x0 = (xs - 0x8000) >> 16;
+        int32_t y0 = (ys - 0x8000) >> 16;
+        uint32_t fx = ((xs - 0x8000) >> 8) & 0xFF;
+        uint32_t fy = ((ys - 0x8000) >> 8) & 0xFF;
+        int32_t x1 = x0 + 1;
+        int32_t y1 = y0 + 1;
+        if(x0 < 0) x0 = 0;
+        if(x1 > x_max) x1 = x_max;
+        if(y0 < 0) y0 = 0;
+        if(y1 > y_max) y1 = y_max;
+
+        const uint8_t * row0 = &src[y0 * stride];
+        const uint8_t * row1 = &src[y1 * stride];
+        abuf[i] = sample_bilinear(dsc, &row0[x0 * px_size], &row0[x1 * px_size], &row1[x0 * px_size],
+                                  &row1[x1 * px_size], fx, fy, &cbuf[i]);
+    }
+}
+
+/**
+ * Limit the range of `i` to keep `(s0 + ds * i) >> 16` in [0; size)
+ * @param s0 start coordinate in 1/65536 pixel units
+ * @param ds step of the coordinate in 1/65536 pixel units
+ * @param size size of the image in the given direction
+ * @param i_start the first index. Might be increased.
+ * @param i_end the last index. Might be decreased.
+ */
+static void clip_affine_run(int64_t s0, int32_t ds, int32_t size, int32_t * i_start, int32_t * i_end)
+{
+    int64_t lim = ((int64_t)size << 16) - 1;
+    int64_t first;
+    int64_t last;
+    if(ds == 0) {
+        if(s0 >= 0 && s0 <= lim) return;
+        first = 1;
+        last = 0;
+    }
+    else if(ds > 0) {
+        /*s0 + ds * i >= 0 and s0 + ds * i <= lim*/
+        first = div_ceil(-s0, ds);
+        last = div_floor(lim - s0, ds);
+    }
+    else {
+        first = div_ceil(s0 - lim, -ds);
+        last = div_floor(s0, -ds);
+    }
+
+    if(*i_start < first) *i_start = first > *i_end ? *i_end + 1 : (int32_t)first;
+    if(*i_end > last) *i_end = last < *i_start ? *i_start - 1 : (int32_t)last;
+}
+
+static int64_t div_floor(int64_t a, int64_t b)
+{
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+static int64_t div_ceil(int64_t a, int64_t b)
+{
+    return -div_floor(-a, b);
+}
+#endif
@@ -100,6 +100,17 @@ enum {
 };
 typedef uint8_t lv_img_cf_t;
 
+/*Line kernels used by `_lv_img_buf_transform_line`*/
+enum {
+    LV_IMG_TRANSFORM_LINE_NONE = 0,   /*No fast path, use `_lv_img_buf_transform` on every pixel*/
+    LV_IMG_TRANSFORM_LINE_ZOOM,       /*Axis-aligned scaling without rotation*/
+    LV_IMG_TRANSFORM_LINE_ROT90,      /*Exact 90 degree rotation without zoom*/
+    LV_IMG_TRANSFORM_LINE_ROT180,     /*Exact 180 degree rotation without zoom*/
+    LV_IMG_TRANSFORM_LINE_ROT270,     /*Exact 270 degree rotation without zoom*/
+    LV_IMG_TRANSFORM_LINE_AFFINE,     /*Any other rotation and zoom*/
+};
+typedef uint8_t lv_img_transform_line_t;
+
 /**
  * LVGL image header
  */
@@ -170,6 +181,7 @@ typedef struct {
         uint8_t chroma_keyed : 1;
         uint8_t has_alpha : 1;
         uint8_t native_color : 1;
+        uint8_t line_kernel : 3;    /*A `LV_IMG_TRANSFORM_LINE_...` value*/
 
         uint32_t zoom_inv;
 
@@ -278,6 +290,20 @@ void _lv_img_buf_transform_init(lv_img_transform_dsc_t * dsc);
  */
 bool _lv_img_buf_transform_anti_alias(lv_img_transform_dsc_t * dsc);
 
+/**
+ * Transform a horizontal line of pixels with the kernel selected by `_lv_img_buf_transform_init`.
+ * Much faster than calling `_lv_img_buf_transform` for every pixel.
+ * @param dsc a descriptor initialized by `_lv_img_buf_transform_init`.
+ *            `dsc->tmp.line_kernel` must not be `LV_IMG_TRANSFORM_LINE_NONE`
+ * @param x the x coordinate of the first pixel of the line
+ * @param y the y coordinate of the line
+ * @param len number of pixels to transform
+ * @param cbuf store the colors here (`len` elements)
+ * @param abuf store the opacities here (`len` elements). `LV_OPA_TRANSP` where the pixel was out of the image
+ */
+void _lv_img_buf_transform_line(lv_img_transform_dsc_t * dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                                lv_color_t * cbuf, lv_opa_t * abuf);
+
 /**
  * Get which color and opa would come to a pixel if it were rotated
  * @param dsc a descriptor initialized by `lv_img_buf_rotate_init`
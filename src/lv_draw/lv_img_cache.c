@@ -10,8 +10,10 @@
 #include "lv_img_cache.h"
 #include "lv_img_decoder.h"
 #include "lv_draw_img.h"
+#include "lv_img_buf.h"
 #include "../lv_hal/lv_hal_tick.h"
 #include "../lv_misc/lv_gc.h"
+#include "lv_img_async.h"
 
 /*********************
  *      DEFINES
@@ -26,6 +28,17 @@
  * "die" from very high values */
 #define LV_IMG_CACHE_LIFE_LIMIT 1000
 
+/*Don't let life to be smaller than this limit because the life relative to the clock
+ * would wrap around after 2^31 opens and an old entry would look very alive*/
+#define LV_IMG_CACHE_LIFE_FLOOR (-0x40000000)
+
+/*Clamp the life of all entries when the clock passes a multiple of this value.
+ * Keeps the unused entries far from the wraparound. Must be a power of 2*/
+#define LV_IMG_CACHE_REBASE_PERIOD 0x10000000
+
+/*Marks the end of a hash chain and an empty bucket*/
+#define LV_IMG_CACHE_NONE 0xFFFF
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +48,23 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static bool lv_img_cache_match(const void * src1, const void * src2);
+    static uint32_t src_hash(const void * src);
+    static uint16_t * get_buckets(void);
+    static void bucket_insert(uint16_t idx);
+    static void bucket_remove(uint16_t idx);
+    static void clock_tick(void);
+    static int32_t entry_get_life(lv_img_cache_entry_t * entry);
+    static lv_img_cache_entry_t * find_victim(const lv_img_cache_entry_t * keep, bool allow_empty);
+    static lv_img_cache_entry_t * entry_take(void);
+    static void entry_add(lv_img_cache_entry_t * entry, uint32_t hash);
+    static void entry_evict(lv_img_cache_entry_t * entry);
+    static void entry_close(lv_img_cache_entry_t * entry);
+    static uint32_t entry_get_size(const lv_img_cache_entry_t * entry);
+    static void enforce_mem_limit(const lv_img_cache_entry_t * keep);
+#endif
+
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_CONVERT_MEM_LIMIT
+    static void entry_convert(lv_img_cache_entry_t * entry);
 #endif
 
 #if LV_IMG_CACHE_DEF_SIZE == 0
@@ -46,6 +76,10 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static uint16_t entry_cnt;
+    static uint16_t bucket_mask;
+    static uint32_t cache_clock;    /*Incremented on every open. Ages all entries at once*/
+    static uint32_t mem_limit = LV_IMG_CACHE_DEF_MEM_LIMIT;
+    static lv_img_cache_stat_t stat;
 #endif
 
 /**********************
@@ -63,6 +97,7 @@
  * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
  * @param color color The color of the image with `LV_IMG_CF_ALPHA_...`
  * @return pointer to the cache entry or NULL if can open the image
+ *         or (with `LV_USE_IMG_ASYNC`) it's being decoded in the background
  */
 lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color)
 {
@@ -77,47 +112,39 @@ lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color)
 
     lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
 
-    /*Decrement all lifes. Make the entries older*/
-    uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(cache[i].life > INT32_MIN + LV_IMG_CACHE_AGING) {
-            cache[i].life -= LV_IMG_CACHE_AGING;
-        }
-    }
+    /* Make all entries older. `life` is stored relative to `cache_clock`
+     * so incrementing the clock ages every entry at once*/
+    clock_tick();
 
-    for(i = 0; i < entry_cnt; i++) {
-        if(color.full == cache[i].dec_dsc.color.full &&
+    uint32_t hash = src_hash(src);
+    uint16_t i = get_buckets()[hash & bucket_mask];
+    while(i != LV_IMG_CACHE_NONE) {
+        if(cache[i].hash == hash && color.full == cache[i].dec_dsc.color.full &&
            lv_img_cache_match(src, cache[i].dec_dsc.src)) {
             /* If opened increment its life.
              * Image difficult to open should live longer to keep avoid frequent their recaching.
              * Therefore increase `life` with `time_to_open`*/
             cached_src = &cache[i];
-            cached_src->life += cached_src->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
-            if(cached_src->life > LV_IMG_CACHE_LIFE_LIMIT) cached_src->life = LV_IMG_CACHE_LIFE_LIMIT;
+            int32_t life = entry_get_life(cached_src);
+            life += cached_src->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
+            if(life > LV_IMG_CACHE_LIFE_LIMIT) life = LV_IMG_CACHE_LIFE_LIMIT;
+            cached_src->life = cache_clock + life;
+            stat.hit_cnt++;
             LV_LOG_TRACE("image draw: image found in the cache");
-            break;
+            return cached_src;
         }
+        i = cache[i].next;
     }
 
     /*The image is not cached then cache it now*/
-    if(cached_src) return cached_src;
+    stat.miss_cnt++;
 
-    /*Find an entry to reuse. Select the entry with the least life*/
-    cached_src = &cache[0];
-    for(i = 1; i < entry_cnt; i++) {
-        if(cache[i].life < cached_src->life) {
-            cached_src = &cache[i];
-        }
-    }
+#if LV_USE_IMG_ASYNC
+    /*Let a slow decoder work in the background. The image will be added by `_lv_img_cache_add`*/
+    if(_lv_img_async_request(src, color)) return NULL;
+#endif
 
-    /*Close the decoder to reuse if it was opened (has a valid source)*/
-    if(cached_src->dec_dsc.src) {
-        lv_img_decoder_close(&cached_src->dec_dsc);
-        LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
-    }
-    else {
-        LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
-    }
+    cached_src = entry_take();
 #else
     cached_src = &cache_temp;
 #endif
@@ -127,12 +154,9 @@ lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color)
     if(open_res == LV_RES_INV) {
         LV_LOG_WARN("Image draw cannot open the image resource");
         _lv_memset_00(cached_src, sizeof(lv_img_cache_entry_t));
-        cached_src->life = INT32_MIN; /*Make the empty entry very "weak" to force its use  */
         return NULL;
     }
 
-    cached_src->life = 0;
-
     /*If `time_to_open` was not set in the open function set it here*/
     if(cached_src->dec_dsc.time_to_open == 0) {
         cached_src->dec_dsc.time_to_open = lv_tick_elaps(t_start);
@@ -140,9 +164,48 @@ lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color)
 
     if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
 
+#if LV_IMG_CACHE_DEF_SIZE
+#if LV_IMG_CACHE_CONVERT_MEM_LIMIT
+    entry_convert(cached_src);
+#endif
+    entry_add(cached_src, hash);
+#endif
+
     return cached_src;
 }
 
+/**
+ * Add an already opened image to the cache. E.g. an image decoded in the background.
+ * @param dec_dsc pointer to an opened decoder descriptor. The cache takes over the descriptor and
+ *                closes the image when the entry is reused. The image is closed immediately if it can't be cached.
+ * @return pointer to the cache entry or NULL if the image couldn't be cached
+ */
+lv_img_cache_entry_t * _lv_img_cache_add(const lv_img_decoder_dsc_t * dec_dsc)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    if(entry_cnt == 0) {
+        LV_LOG_WARN("lv_img_cache_add: the cache size is 0");
+        lv_img_decoder_close((lv_img_decoder_dsc_t *)dec_dsc);
+        return NULL;
+    }
+
+    clock_tick();
+
+    lv_img_cache_entry_t * cached_src = entry_take();
+    cached_src->dec_dsc = *dec_dsc;
+    if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
+
+#if LV_IMG_CACHE_CONVERT_MEM_LIMIT
+    entry_convert(cached_src);
+#endif
+    entry_add(cached_src, src_hash(dec_dsc->src));
+    return cached_src;
+#else
+    lv_img_decoder_close((lv_img_decoder_dsc_t *)dec_dsc);
+    return NULL;
+#endif
+}
+
 /**
  * Set the number of images to be cached.
  * More cached images mean more opened image at same time which might mean more memory usage.
@@ -161,17 +224,50 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
         lv_mem_free(LV_GC_ROOT(_lv_img_cache_array));
     }
 
-    /*Reallocate the cache*/
-    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(sizeof(lv_img_cache_entry_t) * new_entry_cnt);
+    /*`LV_IMG_CACHE_NONE` is reserved to mark the end of the hash chains*/
+    if(new_entry_cnt == LV_IMG_CACHE_NONE) new_entry_cnt--;
+
+    /*Use a power of 2 bucket count with at most 1 entry/bucket on average*/
+    uint32_t bucket_cnt = 1;
+    while(bucket_cnt < new_entry_cnt) bucket_cnt <<= 1;
+
+    /*Reallocate the cache. The hash buckets are stored after the entries*/
+    uint32_t entry_size = sizeof(lv_img_cache_entry_t) * new_entry_cnt;
+    uint32_t alloc_size = entry_size + sizeof(uint16_t) * bucket_cnt;
+    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(alloc_size);
     LV_ASSERT_MEM(LV_GC_ROOT(_lv_img_cache_array));
     if(LV_GC_ROOT(_lv_img_cache_array) == NULL) {
         entry_cnt = 0;
         return;
     }
     entry_cnt = new_entry_cnt;
+    bucket_mask = (uint16_t)(bucket_cnt - 1);
 
     /*Clean the cache*/
-    _lv_memset_00(LV_GC_ROOT(_lv_img_cache_array), entry_cnt * sizeof(lv_img_cache_entry_t));
+    _lv_memset_00(LV_GC_ROOT(_lv_img_cache_array), entry_size);
+    _lv_memset_ff(get_buckets(), sizeof(uint16_t) * bucket_cnt);
+
+    uint16_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        LV_GC_ROOT(_lv_img_cache_array)[i].next = LV_IMG_CACHE_NONE;
+    }
+#endif
+}
+
+/**
+ * Limit the total size of the decoded images kept in the cache.
+ * If the limit is exceeded the least valuable images are closed until the cached images fit.
+ * Images drawn directly from their source (e.g. built-in variables) don't count.
+ * @param limit the limit in bytes. 0: no limit, only the number of entries limits the cache
+ */
+void lv_img_cache_set_mem_limit(uint32_t limit)
+{
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    LV_UNUSED(limit);
+    LV_LOG_WARN("Can't set memory limit because the cache is disabled by LV_IMG_CACHE_DEF_SIZE = 0");
+#else
+    mem_limit = limit;
+    enforce_mem_limit(NULL);
 #endif
 }
 
@@ -182,19 +278,70 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
  */
 void lv_img_cache_invalidate_src(const void * src)
 {
+#if LV_USE_IMG_ASYNC
+    /*A background decoding would add the old image*/
+    lv_img_async_cancel(src);
+#endif
+
 #if LV_IMG_CACHE_DEF_SIZE
     lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
 
-    uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(src == NULL || lv_img_cache_match(src, cache[i].dec_dsc.src)) {
+    if(src == NULL) {
+        uint16_t i;
+        for(i = 0; i < entry_cnt; i++) {
             if(cache[i].dec_dsc.src != NULL) {
-                lv_img_decoder_close(&cache[i].dec_dsc);
+                entry_close(&cache[i]);
             }
 
             _lv_memset_00(&cache[i], sizeof(lv_img_cache_entry_t));
+            cache[i].next = LV_IMG_CACHE_NONE;
+        }
+
+        if(entry_cnt) _lv_memset_ff(get_buckets(), sizeof(uint16_t) * (bucket_mask + 1));
+        stat.used_size = 0;
+        stat.entry_cnt = 0;
+        return;
+    }
+
+    if(entry_cnt == 0) return;
+
+    /*All entries with the same source (but maybe with other color) are in the same chain*/
+    uint32_t hash = src_hash(src);
+    uint16_t i = get_buckets()[hash & bucket_mask];
+    while(i != LV_IMG_CACHE_NONE) {
+        uint16_t next = cache[i].next;
+        if(cache[i].hash == hash && lv_img_cache_match(src, cache[i].dec_dsc.src)) {
+            entry_evict(&cache[i]);
         }
+        i = next;
     }
+#else
+    LV_UNUSED(src);
+#endif
+}
+
+/**
+ * Get the statistics of the image cache.
+ * @param stat_p pointer to a `lv_img_cache_stat_t` variable to store the result
+ */
+void lv_img_cache_get_stat(lv_img_cache_stat_t * stat_p)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    *stat_p = stat;
+#else
+    _lv_memset_00(stat_p, sizeof(lv_img_cache_stat_t));
+#endif
+}
+
+/**
+ * Reset the hit, miss and eviction counters of the image cache.
+ */
+void lv_img_cache_reset_stat(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    stat.hit_cnt = 0;
+    stat.miss_cnt = 0;
+    stat.evict_cnt = 0;
 #endif
 }
 
@@ -214,4 +361,294 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
         return false;
     return strcmp(src1, src2) == 0;
 }
+
+/**
+ * Hash an image source. Variables are hashed by address, files by path (FNV-1a).
+ * The color is not hashed so all the colors of a source are in the same chain.
+ */
+static uint32_t src_hash(const void * src)
+{
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_FILE) {
+        const uint8_t * s = src;
+        uint32_t h = 2166136261u;
+        while(*s) {
+            h ^= *s;
+            h *= 16777619u;
+            s++;
+        }
+        return h;
+    }
+
+    uint32_t h = (uint32_t)((lv_uintptr_t)src >> 2);
+    h ^= h >> 16;
+    h *= 0x45d9f3bu;
+    h ^= h >> 16;
+    return h;
+}
+
+static uint16_t * get_buckets(void)
+{
+    return (uint16_t *)&LV_GC_ROOT(_lv_img_cache_array)[entry_cnt];
+}
+
+static void bucket_insert(uint16_t idx)
+{
+    lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t * bucket = &get_buckets()[cache[idx].hash & bucket_mask];
+    cache[idx].next = *bucket;
+    *bucket = idx;
+}
+
+static void bucket_remove(uint16_t idx)
+{
+    lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t * link = &get_buckets()[cache[idx].hash & bucket_mask];
+    while(*link != LV_IMG_CACHE_NONE) {
+        if(*link == idx) {
+            *link = cache[idx].next;
+            break;
+        }
+        link = &cache[*link].next;
+    }
+    cache[idx].next = LV_IMG_CACHE_NONE;
+}
+
+/**
+ * Advance the clock to age all entries and clamp their life regularly.
+ */
+static void clock_tick(void)
+{
+    cache_clock += LV_IMG_CACHE_AGING;
+
+    /*Clamp the unused entries long before their life could wrap around*/
+    if((cache_clock & (LV_IMG_CACHE_REBASE_PERIOD - 1)) < LV_IMG_CACHE_AGING) {
+        lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+        uint16_t i;
+        for(i = 0; i < entry_cnt; i++) {
+            if(cache[i].dec_dsc.src) entry_get_life(&cache[i]);
+        }
+    }
+}
+
+/**
+ * Get the life of an entry relative to the clock.
+ * The life is clamped to `LV_IMG_CACHE_LIFE_FLOOR` and saved if the entry wasn't used for very long.
+ * @param entry pointer to an opened entry
+ * @return the life of the entry
+ */
+static int32_t entry_get_life(lv_img_cache_entry_t * entry)
+{
+    int32_t life = (int32_t)(entry->life - cache_clock);
+
+    /*The life is never increased above the limit so a larger value means it has wrapped around*/
+    if(life < LV_IMG_CACHE_LIFE_FLOOR || life > LV_IMG_CACHE_LIFE_LIMIT) {
+        life = LV_IMG_CACHE_LIFE_FLOOR;
+        entry->life = cache_clock + (uint32_t)life;
+    }
+
+    return life;
+}
+
+/**
+ * Find an entry to reuse. Only scanned on cache miss when a decoder needs to be opened anyway.
+ * @param keep don't select this entry (can be NULL)
+ * @param allow_empty true: return the first empty entry if any; false: consider only the opened entries
+ * @return the selected entry or NULL if there is nothing to select
+ */
+static lv_img_cache_entry_t * find_victim(const lv_img_cache_entry_t * keep, bool allow_empty)
+{
+    lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    lv_img_cache_entry_t * victim = NULL;
+    int32_t victim_life = 0;
+
+    uint16_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        if(&cache[i] == keep) continue;
+        if(cache[i].dec_dsc.src == NULL) {
+            if(allow_empty) return &cache[i];
+            continue;
+        }
+
+        int32_t life = entry_get_life(&cache[i]);
+        if(victim == NULL || life < victim_life) {
+            victim = &cache[i];
+            victim_life = life;
+        }
+    }
+
+    return victim;
+}
+
+/**
+ * Get an empty entry or close the entry with the least life to reuse it.
+ */
+static lv_img_cache_entry_t * entry_take(void)
+{
+    lv_img_cache_entry_t * entry = find_victim(NULL, true);
+
+    /*Close the decoder to reuse if it was opened (has a valid source)*/
+    if(entry->dec_dsc.src) {
+        entry_evict(entry);
+        LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
+    }
+    else {
+        LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
+    }
+
+    return entry;
+}
+
+/**
+ * Add a freshly opened entry to the index and the memory usage.
+ */
+static void entry_add(lv_img_cache_entry_t * entry, uint32_t hash)
+{
+    lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+
+    entry->life = cache_clock;
+    entry->hash = hash;
+    entry->size = entry_get_size(entry);
+    stat.used_size += entry->size;
+    stat.entry_cnt++;
+    bucket_insert((uint16_t)(entry - cache));
+
+    /*Make room for the new image if the decoded images are larger than the limit*/
+    enforce_mem_limit(entry);
+}
+
+/**
+ * Close the image of an entry and remove it from the cache.
+ */
+static void entry_evict(lv_img_cache_entry_t * entry)
+{
+    lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+
+    bucket_remove((uint16_t)(entry - cache));
+    entry_close(entry);
+
+    stat.used_size -= entry->size;
+    stat.entry_cnt--;
+    stat.evict_cnt++;
+
+    _lv_memset_00(entry, sizeof(lv_img_cache_entry_t));
+    entry->next = LV_IMG_CACHE_NONE;
+}
+
+/**
+ * Free the converted image of an entry (if any) and close its decoder.
+ */
+static void entry_close(lv_img_cache_entry_t * entry)
+{
+#if LV_IMG_CACHE_CONVERT_MEM_LIMIT
+    lv_img_decoder_dsc_t * dsc = &entry->dec_dsc;
+    if(entry->orig_cf != LV_IMG_CF_UNKNOWN) {
+        stat.conv_size -= lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf);
+        lv_mem_free(dsc->img_data);
+        dsc->img_data = NULL;
+
+        /*Let the decoder see the image as it opened it*/
+        dsc->header.cf = entry->orig_cf;
+        entry->orig_cf = LV_IMG_CF_UNKNOWN;
+    }
+#endif
+
+    lv_img_decoder_close(&entry->dec_dsc);
+}
+
+/**
+ * Get the memory used by the decoded image of an entry.
+ * Only fully decoded images count which don't point to the original source data.
+ */
+static uint32_t entry_get_size(const lv_img_cache_entry_t * entry)
+{
+    const lv_img_decoder_dsc_t * dsc = &entry->dec_dsc;
+    if(dsc->img_data == NULL) return 0;
+
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = dsc->src;
+        if(dsc->img_data == img_dsc->data) return 0;
+    }
+
+    return lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf);
+}
+
+/**
+ * Evict entries until the decoded images fit into `mem_limit`.
+ * @param keep don't evict this entry, it's being used (can be NULL)
+ */
+static void enforce_mem_limit(const lv_img_cache_entry_t * keep)
+{
+    if(mem_limit == 0) return;
+
+    while(stat.used_size > mem_limit) {
+        lv_img_cache_entry_t * victim = find_victim(keep, false);
+        if(victim == NULL) break;
+        entry_evict(victim);
+    }
+}
+#endif
+
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_CONVERT_MEM_LIMIT
+/**
+ * Convert a small indexed or alpha image to true color (with alpha byte only if required)
+ * so the palette lookup and the bit unpacking are done only once and not on every draw.
+ * The decoder remains opened and sees the original color format when it's closed.
+ * Nothing happens if the image is too large or the converted images would exceed their memory limit.
+ */
+static void entry_convert(lv_img_cache_entry_t * entry)
+{
+    lv_img_decoder_dsc_t * dsc = &entry->dec_dsc;
+    lv_img_cf_t cf = dsc->header.cf;
+    if(dsc->img_data != NULL || dsc->error_msg != NULL) return;
+    if(cf < LV_IMG_CF_INDEXED_1BIT || cf > LV_IMG_CF_ALPHA_8BIT) return;
+
+    uint32_t px_cnt = (uint32_t)dsc->header.w * dsc->header.h;
+    uint32_t size = px_cnt * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    if(px_cnt == 0 || size > LV_IMG_CACHE_CONVERT_MAX_SIZE) return;
+    if(stat.conv_size + size > LV_IMG_CACHE_CONVERT_MEM_LIMIT) return;
+
+    /*Not an error if there is no memory. The image will be decoded line by line while drawing*/
+    uint8_t * buf = lv_mem_alloc(size);
+    if(buf == NULL) {
+        LV_LOG_WARN("img_cache: no memory to convert an image");
+        return;
+    }
+
+    /*The indexed and alpha images are read as true color pixels with alpha byte*/
+    if(lv_img_decoder_read_lines(dsc, 0, 0, dsc->header.w, dsc->header.h, buf) != LV_RES_OK) {
+        lv_mem_free(buf);
+        return;
+    }
+
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        if(buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE + LV_IMG_PX_SIZE_ALPHA_BYTE - 1] != LV_OPA_COVER) break;
+    }
+
+    /*All pixels are opaque (e.g. no transparent colors in the palette): drop the alpha bytes.
+     *It's faster to draw and smaller. The pixels are only moved down so it can be done in place.*/
+    lv_img_cf_t native_cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    if(i == px_cnt) {
+        native_cf = LV_IMG_CF_TRUE_COLOR;
+        if(sizeof(lv_color_t) != LV_IMG_PX_SIZE_ALPHA_BYTE) {
+            uint8_t * dst = buf;
+            const uint8_t * src = buf;
+            for(i = 0; i < px_cnt; i++) {
+                uint32_t b;
+                for(b = 0; b < sizeof(lv_color_t); b++) dst[b] = src[b];
+                dst += sizeof(lv_color_t);
+                src += LV_IMG_PX_SIZE_ALPHA_BYTE;
+            }
+
+            size = lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, native_cf);
+            uint8_t * buf_shrink = lv_mem_realloc(buf, size);
+            if(buf_shrink) buf = buf_shrink;
+        }
+    }
+
+    dsc->img_data = buf;
+    dsc->header.cf = native_cf;
+    entry->orig_cf = cf;
+    stat.conv_size += size;
+}
 #endif
@@ -32,11 +32,29 @@ typedef struct {
     lv_img_decoder_dsc_t dec_dsc; /**< Image information */
 
     /** Count the cache entries's life. Add `time_to_open` to `life` when the entry is used.
-     * Decrement all lifes by one every in every ::lv_img_cache_open.
-     * If life == 0 the entry can be reused */
-    int32_t life;
+     * All lifes are decremented by one in every ::lv_img_cache_open.
+     * It's stored relative to the cache's clock so aging doesn't need to touch every entry.
+     * The entry with the least life is reused first*/
+    uint32_t life;
+
+    uint32_t hash;      /**< Hash of the source to look up the entry*/
+    uint32_t size;      /**< Memory used by the decoded image in bytes*/
+    uint16_t next;      /**< Index of the next entry in the same hash bucket*/
+    uint8_t orig_cf;    /**< Original color format if the image was converted to a native format, else 0*/
 } lv_img_cache_entry_t;
 
+/**
+ * Statistics of the image cache
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of opens served from the cache*/
+    uint32_t miss_cnt;      /**< Number of opens which needed to open the image*/
+    uint32_t evict_cnt;     /**< Number of images closed to make room or invalidated*/
+    uint32_t used_size;     /**< Memory used by the cached decoded images in bytes*/
+    uint16_t entry_cnt;     /**< Number of opened images in the cache*/
+    uint32_t conv_size;     /**< Memory used by the images converted to a native format in bytes*/
+} lv_img_cache_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -48,9 +66,18 @@ typedef struct {
  * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
  * @param color The color of the image with `LV_IMG_CF_ALPHA_...`
  * @return pointer to the cache entry or NULL if can open the image
+ *         or (with `LV_USE_IMG_ASYNC`) it's being decoded in the background
  */
 lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color);
 
+/**
+ * Add an already opened image to the cache. E.g. an image decoded in the background.
+ * @param dec_dsc pointer to an opened decoder descriptor. The cache takes over the descriptor and
+ *                closes the image when the entry is reused. The image is closed immediately if it can't be cached.
+ * @return pointer to the cache entry or NULL if the image couldn't be cached
+ */
+lv_img_cache_entry_t * _lv_img_cache_add(const lv_img_decoder_dsc_t * dec_dsc);
+
 /**
  * Set the number of images to be cached.
  * More cached images mean more opened image at same time which might mean more memory usage.
@@ -59,6 +86,14 @@ lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color);
  */
 void lv_img_cache_set_size(uint16_t new_slot_num);
 
+/**
+ * Limit the total size of the decoded images kept in the cache.
+ * If the limit is exceeded the least valuable images are closed until the cached images fit.
+ * Images drawn directly from their source (e.g. built-in variables) don't count.
+ * @param limit the limit in bytes. 0: no limit, only the number of entries limits the cache
+ */
+void lv_img_cache_set_mem_limit(uint32_t limit);
+
 /**
  * Invalidate an image source in the cache.
  * Useful if the image source is updated therefore it needs to be cached again.
@@ -66,6 +101,17 @@ void lv_img_cache_set_size(uint16_t new_slot_num);
  */
 void lv_img_cache_invalidate_src(const void * src);
 
+/**
+ * Get the statistics of the image cache.
+ * @param stat_p pointer to a `lv_img_cache_stat_t` variable to store the result
+ */
+void lv_img_cache_get_stat(lv_img_cache_stat_t * stat_p);
+
+/**
+ * Reset the hit, miss and eviction counters of the image cache.
+ */
+void lv_img_cache_reset_stat(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -24,6 +24,11 @@
 typedef struct {
 #if LV_USE_FILESYSTEM
     lv_fs_file_t f;
+#if LV_IMG_READ_BUF_SIZE
+    uint8_t * rd_buf;   /*Read ahead buffer*/
+    uint32_t rd_pos;    /*File position of the first byte in `rd_buf`*/
+    uint32_t rd_len;    /*Number of valid bytes in `rd_buf`*/
+#endif
 #endif
     lv_color_t * palette;
     lv_opa_t * opa;
@@ -33,11 +38,15 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static lv_res_t lv_img_decoder_built_in_line_true_color(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
-                                                        lv_coord_t len, uint8_t * buf);
+                                                        uint32_t len, uint8_t * buf);
 static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
                                                    lv_coord_t len, uint8_t * buf);
 static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
                                                      lv_coord_t len, uint8_t * buf);
+static uint8_t get_line_px_size(lv_img_cf_t cf);
+#if LV_USE_FILESYSTEM
+    static lv_res_t file_read(lv_img_decoder_built_in_data_t * user_data, uint32_t pos, uint8_t * buf, uint32_t btr);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -71,6 +80,7 @@ void _lv_img_decoder_init(void)
     lv_img_decoder_set_info_cb(decoder, lv_img_decoder_built_in_info);
     lv_img_decoder_set_open_cb(decoder, lv_img_decoder_built_in_open);
     lv_img_decoder_set_read_line_cb(decoder, lv_img_decoder_built_in_read_line);
+    lv_img_decoder_set_read_lines_cb(decoder, lv_img_decoder_built_in_read_lines);
     lv_img_decoder_set_close_cb(decoder, lv_img_decoder_built_in_close);
 }
 
@@ -178,6 +188,34 @@ lv_res_t lv_img_decoder_read_line(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_c
     return res;
 }
 
+/**
+ * Read more lines from an opened image. Decoders without `read_lines_cb` are read line by line.
+ * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
+ * @param x start X coordinate (from left)
+ * @param y start Y coordinate (from top)
+ * @param len number of pixels to read in each line
+ * @param lines number of lines to read
+ * @param buf store the data here. The lines are stored continuously
+ *            in the same format as `lv_img_decoder_read_line` would store them.
+ * @return LV_RES_OK: success; LV_RES_INV: an error occurred
+ */
+lv_res_t lv_img_decoder_read_lines(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                                   lv_coord_t lines, uint8_t * buf)
+{
+    if(dsc->decoder->read_lines_cb) return dsc->decoder->read_lines_cb(dsc->decoder, dsc, x, y, len, lines, buf);
+    if(dsc->decoder->read_line_cb == NULL) return LV_RES_INV;
+
+    uint32_t line_size = len * get_line_px_size(dsc->header.cf);
+    lv_coord_t i;
+    for(i = 0; i < lines; i++) {
+        lv_res_t res = dsc->decoder->read_line_cb(dsc->decoder, dsc, x, y + i, len, buf);
+        if(res != LV_RES_OK) return res;
+        buf += line_size;
+    }
+
+    return LV_RES_OK;
+}
+
 /**
  * Close a decoding session
  * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
@@ -250,6 +288,16 @@ void lv_img_decoder_set_read_line_cb(lv_img_decoder_t * decoder, lv_img_decoder_
     decoder->read_line_cb = read_line_cb;
 }
 
+/**
+ * Set a callback to read more decoded lines of an image at once. Optional, `read_line_cb` is used if not set.
+ * @param decoder pointer to an image decoder
+ * @param read_lines_cb a function to read more lines of an image
+ */
+void lv_img_decoder_set_read_lines_cb(lv_img_decoder_t * decoder, lv_img_decoder_read_lines_f_t read_lines_cb)
+{
+    decoder->read_lines_cb = read_lines_cb;
+}
+
 /**
  * Set a callback to close a decoding session. E.g. close files and free other resources.
  * @param decoder pointer to an image decoder
@@ -260,6 +308,19 @@ void lv_img_decoder_set_close_cb(lv_img_decoder_t * decoder, lv_img_decoder_clos
     decoder->close_cb = close_cb;
 }
 
+#if LV_USE_IMG_ASYNC
+/**
+ * Open the images of a decoder in the background. Useful for slow decoders (e.g. PNG or JPG).
+ * Requires an asynchronous decoding driver registered with `lv_img_async_drv_register`.
+ * @param decoder pointer to an image decoder
+ * @param en true: open the images in the background; false: open them while drawing
+ */
+void lv_img_decoder_set_async(lv_img_decoder_t * decoder, bool en)
+{
+    decoder->async = en ? 1 : 0;
+}
+#endif
+
 /**
  * Get info about a built-in image
  * @param decoder the decoder where this function belongs
@@ -352,6 +413,15 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
 
         lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
         _lv_memcpy_small(&user_data->f, &f, sizeof(f));
+
+#if LV_IMG_READ_BUF_SIZE
+        /*Read the file in blocks instead of seeking and reading for each line.
+         *Not an error if there is no memory for it, just slower.*/
+        user_data->rd_buf = lv_mem_alloc(LV_IMG_READ_BUF_SIZE);
+        if(user_data->rd_buf == NULL) LV_LOG_WARN("img_decoder_built_in_open: no memory for the read buffer");
+        user_data->rd_pos = 0;
+        user_data->rd_len = 0;
+#endif
 #else
         LV_LOG_WARN("Image built-in decoder cannot read file because LV_USE_FILESYSTEM = 0");
         return LV_RES_INV;
@@ -410,16 +480,25 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
         if(dsc->src_type == LV_IMG_SRC_FILE) {
             /*Read the palette from file*/
 #if LV_USE_FILESYSTEM
-            lv_fs_seek(&user_data->f, 4); /*Skip the header*/
-            lv_color32_t cur_color;
+            /*Read the whole palette at once. +4 to skip the header*/
+            lv_color32_t * palette_p = _lv_mem_buf_get(palette_size * sizeof(lv_color32_t));
+            if(palette_p == NULL ||
+               file_read(user_data, 4, (uint8_t *)palette_p, palette_size * sizeof(lv_color32_t)) != LV_RES_OK) {
+                LV_LOG_WARN("Built-in image decoder can't read the palette");
+                if(palette_p) _lv_mem_buf_release(palette_p);
+                lv_img_decoder_built_in_close(decoder, dsc);
+                return LV_RES_INV;
+            }
+
             uint32_t i;
             for(i = 0; i < palette_size; i++) {
-                lv_fs_read(&user_data->f, &cur_color, sizeof(lv_color32_t), NULL);
-                user_data->palette[i] = lv_color_make(cur_color.ch.red, cur_color.ch.green, cur_color.ch.blue);
-                user_data->opa[i]     = cur_color.ch.alpha;
+                user_data->palette[i] = lv_color_make(palette_p[i].ch.red, palette_p[i].ch.green, palette_p[i].ch.blue);
+                user_data->opa[i]     = palette_p[i].ch.alpha;
             }
+            _lv_mem_buf_release(palette_p);
 #else
             LV_LOG_WARN("Image built-in decoder can read the palette because LV_USE_FILESYSTEM = 0");
+            lv_img_decoder_built_in_close(decoder, dsc);
             return LV_RES_INV;
 #endif
         }
@@ -504,6 +583,38 @@ lv_res_t lv_img_decoder_built_in_read_line(lv_img_decoder_t * decoder, lv_img_de
     return res;
 }
 
+/**
+ * Decode more lines. A full width stripe of a true color file is read at once, else line by line.
+ * @param decoder pointer to the decoder the function associated with
+ * @param dsc pointer to decoder descriptor
+ * @param x start x coordinate
+ * @param y start y coordinate
+ * @param len number of pixels to decode in each line
+ * @param lines number of lines to decode
+ * @param buf a buffer to store the decoded lines continuously
+ * @return LV_RES_OK: ok; LV_RES_INV: failed
+ */
+lv_res_t lv_img_decoder_built_in_read_lines(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x,
+                                            lv_coord_t y, lv_coord_t len, lv_coord_t lines, uint8_t * buf)
+{
+    if(dsc->src_type == LV_IMG_SRC_FILE && x == 0 && len == dsc->header.w &&
+       (dsc->header.cf == LV_IMG_CF_TRUE_COLOR || dsc->header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA ||
+        dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED)) {
+        /*The lines follow each other in the file. Count the pixels on 32 bit as they might not fit into `lv_coord_t`*/
+        return lv_img_decoder_built_in_line_true_color(dsc, 0, y, (uint32_t)len * lines, buf);
+    }
+
+    uint32_t line_size = len * get_line_px_size(dsc->header.cf);
+    lv_coord_t i;
+    for(i = 0; i < lines; i++) {
+        lv_res_t res = lv_img_decoder_built_in_read_line(decoder, dsc, x, y + i, len, buf);
+        if(res != LV_RES_OK) return res;
+        buf += line_size;
+    }
+
+    return LV_RES_OK;
+}
+
 /**
  * Close the pending decoding. Free resources etc.
  * @param decoder pointer to the decoder the function associated with
@@ -516,8 +627,12 @@ void lv_img_decoder_built_in_close(lv_img_decoder_t * decoder, lv_img_decoder_ds
     lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
     if(user_data) {
 #if LV_USE_FILESYSTEM
-        if(dsc->src_type == LV_IMG_SRC_FILE)
+        if(dsc->src_type == LV_IMG_SRC_FILE) {
             lv_fs_close(&user_data->f);
+#if LV_IMG_READ_BUF_SIZE
+            if(user_data->rd_buf) lv_mem_free(user_data->rd_buf);
+#endif
+        }
 #endif
         if(user_data->palette) lv_mem_free(user_data->palette);
         if(user_data->opa) lv_mem_free(user_data->opa);
@@ -532,29 +647,16 @@ void lv_img_decoder_built_in_close(lv_img_decoder_t * decoder, lv_img_decoder_ds
  **********************/
 
 static lv_res_t lv_img_decoder_built_in_line_true_color(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
-                                                        lv_coord_t len, uint8_t * buf)
+                                                        uint32_t len, uint8_t * buf)
 {
 #if LV_USE_FILESYSTEM
     lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
-    lv_fs_res_t res;
     uint8_t px_size = lv_img_cf_get_px_size(dsc->header.cf);
 
     uint32_t pos = ((y * dsc->header.w + x) * px_size) >> 3;
     pos += 4; /*Skip the header*/
-    res = lv_fs_seek(&user_data->f, pos);
-    if(res != LV_FS_RES_OK) {
-        LV_LOG_WARN("Built-in image decoder seek failed");
-        return LV_RES_INV;
-    }
     uint32_t btr = len * (px_size >> 3);
-    uint32_t br  = 0;
-    res = lv_fs_read(&user_data->f, buf, btr, &br);
-    if(res != LV_FS_RES_OK || btr != br) {
-        LV_LOG_WARN("Built-in image decoder read failed");
-        return LV_RES_INV;
-    }
-
-    return LV_RES_OK;
+    return file_read(user_data, pos, buf, btr);
 #else
     LV_UNUSED(dsc);
     LV_UNUSED(x);
@@ -640,8 +742,12 @@ static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, l
     }
     else {
 #if LV_USE_FILESYSTEM
-        lv_fs_seek(&user_data->f, ofs + 4); /*+4 to skip the header*/
-        lv_fs_read(&user_data->f, fs_buf, w, NULL);
+        /*Read only the bytes of the required pixels. +4 to skip the header*/
+        uint32_t btr = (((x + len) * px_size + 7) >> 3) - ((x * px_size) >> 3);
+        if(file_read(user_data, ofs + 4, fs_buf, btr) != LV_RES_OK) {
+            _lv_mem_buf_release(fs_buf);
+            return LV_RES_INV;
+        }
         data_tmp = fs_buf;
 #else
         LV_LOG_WARN("Image built-in alpha line reader can't read file because LV_USE_FILESYSTEM = 0");
@@ -722,8 +828,12 @@ static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc,
     }
     else {
 #if LV_USE_FILESYSTEM
-        lv_fs_seek(&user_data->f, ofs + 4); /*+4 to skip the header*/
-        lv_fs_read(&user_data->f, fs_buf, w, NULL);
+        /*Read only the bytes of the required pixels. +4 to skip the header*/
+        uint32_t btr = (((x + len) * px_size + 7) >> 3) - ((x * px_size) >> 3);
+        if(file_read(user_data, ofs + 4, fs_buf, btr) != LV_RES_OK) {
+            _lv_mem_buf_release(fs_buf);
+            return LV_RES_INV;
+        }
         data_tmp = fs_buf;
 #else
         LV_LOG_WARN("Image built-in indexed line reader can't read file because LV_USE_FILESYSTEM = 0");
@@ -765,3 +875,69 @@ static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc,
     return LV_RES_INV;
 #endif
 }
+
+/**
+ * Get the size of a pixel in the buffer of `read_line`
+ * @param cf the color format of the opened image
+ * @return size in bytes
+ */
+static uint8_t get_line_px_size(lv_img_cf_t cf)
+{
+    return lv_img_cf_has_alpha(cf) ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+}
+
+#if LV_USE_FILESYSTEM
+/**
+ * Read from the image file. Small reads are served from a read ahead buffer
+ * so reading the lines one by one doesn't need a seek and a read for each line.
+ * @param user_data the decoder's data of the opened file
+ * @param pos position in the file
+ * @param buf store the read bytes here
+ * @param btr bytes to read
+ * @return LV_RES_OK: `btr` bytes are read; LV_RES_INV: error
+ */
+static lv_res_t file_read(lv_img_decoder_built_in_data_t * user_data, uint32_t pos, uint8_t * buf, uint32_t btr)
+{
+    lv_fs_res_t res;
+    uint32_t br = 0;
+
+#if LV_IMG_READ_BUF_SIZE
+    if(user_data->rd_buf && btr <= LV_IMG_READ_BUF_SIZE) {
+        if(pos < user_data->rd_pos || pos + btr > user_data->rd_pos + user_data->rd_len) {
+            /*Not in the buffer. Read ahead a new block from `pos`*/
+            user_data->rd_len = 0;
+            res = lv_fs_seek(&user_data->f, pos);
+            if(res != LV_FS_RES_OK) {
+                LV_LOG_WARN("Built-in image decoder seek failed");
+                return LV_RES_INV;
+            }
+
+            res = lv_fs_read(&user_data->f, user_data->rd_buf, LV_IMG_READ_BUF_SIZE, &br);
+            if(res != LV_FS_RES_OK || br < btr) {
+                LV_LOG_WARN("Built-in image decoder read failed");
+                return LV_RES_INV;
+            }
+            user_data->rd_pos = pos;
+            user_data->rd_len = br;
+        }
+
+        _lv_memcpy(buf, &user_data->rd_buf[pos - user_data->rd_pos], btr);
+        return LV_RES_OK;
+    }
+#endif
+
+    res = lv_fs_seek(&user_data->f, pos);
+    if(res != LV_FS_RES_OK) {
+        LV_LOG_WARN("Built-in image decoder seek failed");
+        return LV_RES_INV;
+    }
+
+    res = lv_fs_read(&user_data->f, buf, btr, &br);
+    if(res != LV_FS_RES_OK || btr != br) {
+        LV_LOG_WARN("Built-in image decoder read failed");
+        return LV_RES_INV;
+    }
+
+    return LV_RES_OK;
+}
+#endif
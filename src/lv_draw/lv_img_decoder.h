@@ -77,6 +77,22 @@ typedef lv_res_t (*lv_img_decoder_open_f_t)(struct _lv_img_decoder * decoder, st
 typedef lv_res_t (*lv_img_decoder_read_line_f_t)(struct _lv_img_decoder * decoder, struct _lv_img_decoder_dsc * dsc,
                                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf);
 
+/**
+ * Decode `lines` lines of `len` pixels starting from the given `x`, `y` coordinates and store them in `buf`.
+ * Optional. Useful if reading more lines at once is faster (e.g. the lines follow each other in a file).
+ * @param decoder pointer to the decoder the function associated with
+ * @param dsc pointer to decoder descriptor
+ * @param x start x coordinate
+ * @param y start y coordinate
+ * @param len number of pixels to decode in each line
+ * @param lines number of lines to decode
+ * @param buf a buffer to store the decoded lines continuously in the format of `read_line`
+ * @return LV_RES_OK: ok; LV_RES_INV: failed
+ */
+typedef lv_res_t (*lv_img_decoder_read_lines_f_t)(struct _lv_img_decoder * decoder, struct _lv_img_decoder_dsc * dsc,
+                                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, lv_coord_t lines,
+                                                  uint8_t * buf);
+
 /**
  * Close the pending decoding. Free resources etc.
  * @param decoder pointer to the decoder the function associated with
@@ -88,8 +104,13 @@ typedef struct _lv_img_decoder {
     lv_img_decoder_info_f_t info_cb;
     lv_img_decoder_open_f_t open_cb;
     lv_img_decoder_read_line_f_t read_line_cb;
+    lv_img_decoder_read_lines_f_t read_lines_cb;
     lv_img_decoder_close_f_t close_cb;
 
+#if LV_USE_IMG_ASYNC
+    uint8_t async : 1;  /**< Open the images in the background (see `lv_img_async.h`)*/
+#endif
+
 #if LV_USE_USER_DATA
     lv_img_decoder_user_data_t user_data;
 #endif
@@ -175,6 +196,20 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
 lv_res_t lv_img_decoder_read_line(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len,
                                   uint8_t * buf);
 
+/**
+ * Read more lines from an opened image. Decoders without `read_lines_cb` are read line by line.
+ * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
+ * @param x start X coordinate (from left)
+ * @param y start Y coordinate (from top)
+ * @param len number of pixels to read in each line
+ * @param lines number of lines to read
+ * @param buf store the data here. The lines are stored continuously
+ *            in the same format as `lv_img_decoder_read_line` would store them.
+ * @return LV_RES_OK: success; LV_RES_INV: an error occurred
+ */
+lv_res_t lv_img_decoder_read_lines(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y, lv_coord_t len,
+                                   lv_coord_t lines, uint8_t * buf);
+
 /**
  * Close a decoding session
  * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
@@ -214,6 +249,13 @@ void lv_img_decoder_set_open_cb(lv_img_decoder_t * decoder, lv_img_decoder_open_
  */
 void lv_img_decoder_set_read_line_cb(lv_img_decoder_t * decoder, lv_img_decoder_read_line_f_t read_line_cb);
 
+/**
+ * Set a callback to read more decoded lines of an image at once. Optional, `read_line_cb` is used if not set.
+ * @param decoder pointer to an image decoder
+ * @param read_lines_cb a function to read more lines of an image
+ */
+void lv_img_decoder_set_read_lines_cb(lv_img_decoder_t * decoder, lv_img_decoder_read_lines_f_t read_lines_cb);
+
 /**
  * Set a callback to close a decoding session. E.g. close files and free other resources.
  * @param decoder pointer to an image decoder
@@ -221,6 +263,16 @@ void lv_img_decoder_set_read_line_cb(lv_img_decoder_t * decoder, lv_img_decoder_
  */
 void lv_img_decoder_set_close_cb(lv_img_decoder_t * decoder, lv_img_decoder_close_f_t close_cb);
 
+#if LV_USE_IMG_ASYNC
+/**
+ * Open the images of a decoder in the background. Useful for slow decoders (e.g. PNG or JPG).
+ * Requires an asynchronous decoding driver registered with `lv_img_async_drv_register`.
+ * @param decoder pointer to an image decoder
+ * @param en true: open the images in the background; false: open them while drawing
+ */
+void lv_img_decoder_set_async(lv_img_decoder_t * decoder, bool en);
+#endif
+
 /**
  * Get info about a built-in image
  * @param decoder the decoder where this function belongs
@@ -252,6 +304,20 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
 lv_res_t lv_img_decoder_built_in_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x,
                                            lv_coord_t y, lv_coord_t len, uint8_t * buf);
 
+/**
+ * Decode more lines. A full width stripe of a true color file is read at once, else line by line.
+ * @param decoder pointer to the decoder the function associated with
+ * @param dsc pointer to decoder descriptor
+ * @param x start x coordinate
+ * @param y start y coordinate
+ * @param len number of pixels to decode in each line
+ * @param lines number of lines to decode
+ * @param buf a buffer to store the decoded lines continuously
+ * @return LV_RES_OK: ok; LV_RES_INV: failed
+ */
+lv_res_t lv_img_decoder_built_in_read_lines(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x,
+                                            lv_coord_t y, lv_coord_t len, lv_coord_t lines, uint8_t * buf);
+
 /**
  * Close the pending decoding. Free resources etc.
  * @param decoder pointer to the decoder the function associated with
@@ -0,0 +1,344 @@
+/**
+ * @file lv_img_trans_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_img_trans_cache.h"
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_MEM
+
+#include <string.h>
+#include "lv_img_cache.h"
+#include "lv_img_buf.h"
+#include "../lv_misc/lv_debug.h"
+#include "../lv_misc/lv_mem.h"
+#include "../lv_misc/lv_gc.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const void * src;           /*The source image (a copy of the path for files)*/
+    lv_img_dsc_t * snapshot;    /*The transformed image*/
+    lv_area_t area;             /*Area of the snapshot relative to the source image*/
+    uint32_t size;              /*Memory used by the snapshot*/
+    lv_point_t pivot;
+    int16_t angle;
+    uint16_t zoom;
+    uint8_t antialias : 1;
+} lv_img_trans_cache_entry_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_img_trans_cache_entry_t * find_entry(const void * src, const lv_draw_img_dsc_t * dsc);
+static lv_img_trans_cache_entry_t * add_entry(const lv_area_t * coords, const void * src,
+                                              const lv_draw_img_dsc_t * dsc);
+static lv_img_dsc_t * render_snapshot(const lv_img_decoder_dsc_t * dec_dsc, const lv_draw_img_dsc_t * dsc,
+                                      const lv_area_t * area);
+static void entry_free(lv_img_trans_cache_entry_t * e);
+static bool src_match(const void * src1, const void * src2);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_img_trans_cache_stat_t stat;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Initialize the transformed image snapshot cache
+ */
+void _lv_img_trans_cache_init(void)
+{
+    _lv_ll_init(&LV_GC_ROOT(_lv_img_trans_cache_ll), sizeof(lv_img_trans_cache_entry_t));
+    _lv_memset_00(&stat, sizeof(stat));
+}
+
+/**
+ * Draw a rotated and/or zoomed image from its cached snapshot.
+ * On the first call the transformed image is rendered into an ARGB snapshot which is reused
+ * while the angle, zoom, pivot and source are the same.
+ * Only the images opened to RAM in a true color format can be cached.
+ * @param coords the coordinates of the image
+ * @param mask the image will be drawn only in this area
+ * @param src pointer to a `lv_img_dsc_t` variable or a path to a file
+ * @param dsc pointer to an initialized `lv_draw_img_dsc_t` variable
+ * @return true: the image is drawn; false: the image can't be cached, draw it with `lv_draw_img`
+ */
+bool _lv_img_trans_cache_draw(const lv_area_t * coords, const lv_area_t * mask, const void * src,
+                              const lv_draw_img_dsc_t * dsc)
+{
+    if(dsc->angle == 0 && dsc->zoom == LV_IMG_ZOOM_NONE) return false;
+    if(dsc->opa <= LV_OPA_MIN) return true;
+
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+    if(src_type != LV_IMG_SRC_VARIABLE && src_type != LV_IMG_SRC_FILE) return false;
+
+    lv_img_trans_cache_entry_t * e = find_entry(src, dsc);
+    if(e) {
+        /*Keep the most recently used snapshots at the head*/
+        lv_img_trans_cache_entry_t * head = _lv_ll_get_head(&LV_GC_ROOT(_lv_img_trans_cache_ll));
+        if(e != head) _lv_ll_move_before(&LV_GC_ROOT(_lv_img_trans_cache_ll), e, head);
+        stat.hit_cnt++;
+    }
+    else {
+        e = add_entry(coords, src, dsc);
+        if(e == NULL) return false;
+    }
+
+    lv_area_t snapshot_coords;
+    snapshot_coords.x1 = coords->x1 + e->area.x1;
+    snapshot_coords.y1 = coords->y1 + e->area.y1;
+    snapshot_coords.x2 = coords->x1 + e->area.x2;
+    snapshot_coords.y2 = coords->y1 + e->area.y2;
+
+    lv_draw_img_dsc_t snapshot_dsc;
+    _lv_memcpy_small(&snapshot_dsc, dsc, sizeof(lv_draw_img_dsc_t));
+    snapshot_dsc.angle = 0;
+    snapshot_dsc.zoom = LV_IMG_ZOOM_NONE;
+    lv_draw_img(&snapshot_coords, mask, e->snapshot, &snapshot_dsc);
+
+    return true;
+}
+
+/**
+ * Free the snapshots of an image source. Needs to be called if the content of a source image changes.
+ * @param src the image source or NULL to free all snapshots
+ */
+void lv_img_trans_cache_invalidate_src(const void * src)
+{
+    lv_img_trans_cache_entry_t * e = _lv_ll_get_head(&LV_GC_ROOT(_lv_img_trans_cache_ll));
+    while(e) {
+        lv_img_trans_cache_entry_t * e_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_img_trans_cache_ll), e);
+        if(src == NULL || src_match(src, e->src)) {
+            entry_free(e);
+            stat.evict_cnt++;
+        }
+        e = e_next;
+    }
+}
+
+/**
+ * Get the statistics of the snapshot cache.
+ * @param stat_p pointer to a `lv_img_trans_cache_stat_t` variable to store the result
+ */
+void lv_img_trans_cache_get_stat(lv_img_trans_cache_stat_t * stat_p)
+{
+    *stat_p = stat;
+}
+
+/**
+ * Reset the hit, miss and eviction counters of the snapshot cache.
+ */
+void lv_img_trans_cache_reset_stat(void)
+{
+    stat.hit_cnt = 0;
+    stat.miss_cnt = 0;
+    stat.evict_cnt = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_img_trans_cache_entry_t * find_entry(const void * src, const lv_draw_img_dsc_t * dsc)
+{
+    lv_img_trans_cache_entry_t * e;
+    _LV_LL_READ(LV_GC_ROOT(_lv_img_trans_cache_ll), e) {
+        if(e->angle != dsc->angle || e->zoom != dsc->zoom) continue;
+        if(e->pivot.x != dsc->pivot.x || e->pivot.y != dsc->pivot.y) continue;
+        if(e->antialias != (dsc->antialias ? 1 : 0)) continue;
+        if(src_match(src, e->src)) return e;
+    }
+
+    return NULL;
+}
+
+static lv_img_trans_cache_entry_t * add_entry(const lv_area_t * coords, const void * src,
+                                              const lv_draw_img_dsc_t * dsc)
+{
+    /*Check the size before opening the image*/
+    lv_img_header_t header;
+    if(lv_img_decoder_get_info(src, &header) != LV_RES_OK) return NULL;
+    if(header.w != lv_area_get_width(coords) || header.h != lv_area_get_height(coords)) return NULL;
+
+    lv_area_t area;
+    _lv_img_buf_get_transformed_area(&area, header.w, header.h, dsc->angle, dsc->zoom, &dsc->pivot);
+    uint32_t size = lv_img_buf_get_img_size(lv_area_get_width(&area), lv_area_get_height(&area),
+                                            LV_IMG_CF_TRUE_COLOR_ALPHA) + sizeof(lv_img_dsc_t);
+    if(size > LV_IMG_TRANSFORM_CACHE_MEM) return NULL;
+
+    lv_img_cache_entry_t * cdsc = _lv_img_cache_open(src, dsc->recolor);
+    if(cdsc == NULL) return NULL;
+
+    lv_img_dsc_t * snapshot = NULL;
+    lv_img_cf_t cf = cdsc->dec_dsc.header.cf;
+    if(cdsc->dec_dsc.img_data && cdsc->dec_dsc.error_msg == NULL &&
+       (cf == LV_IMG_CF_TRUE_COLOR || cf == LV_IMG_CF_TRUE_COLOR_ALPHA || cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED)) {
+        /*Free the least recently used snapshots to fit into the budget*/
+        while(stat.used_size + size > LV_IMG_TRANSFORM_CACHE_MEM) {
+            lv_img_trans_cache_entry_t * tail = _lv_ll_get_tail(&LV_GC_ROOT(_lv_img_trans_cache_ll));
+            if(tail == NULL) break;
+            entry_free(tail);
+            stat.evict_cnt++;
+        }
+
+        snapshot = render_snapshot(&cdsc->dec_dsc, dsc, &area);
+    }
+
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    lv_img_decoder_close(&cdsc->dec_dsc);
+#endif
+
+    if(snapshot == NULL) return NULL;
+
+    lv_img_trans_cache_entry_t * e = _lv_ll_ins_head(&LV_GC_ROOT(_lv_img_trans_cache_ll));
+    LV_ASSERT_MEM(e);
+    if(e == NULL) {
+        lv_img_buf_free(snapshot);
+        return NULL;
+    }
+    _lv_memset_00(e, sizeof(lv_img_trans_cache_entry_t));
+
+    /*The image object might free its path meanwhile so save it*/
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_FILE) {
+        size_t len = strlen(src);
+        char * path = lv_mem_alloc(len + 1);
+        LV_ASSERT_MEM(path);
+        if(path == NULL) {
+            _lv_ll_remove(&LV_GC_ROOT(_lv_img_trans_cache_ll), e);
+            lv_mem_free(e);
+            lv_img_buf_free(snapshot);
+            return NULL;
+        }
+        _lv_memcpy(path, src, len + 1);
+        e->src = path;
+    }
+    else {
+        e->src = src;
+    }
+
+    e->snapshot = snapshot;
+    e->area = area;
+    e->size = size;
+    e->pivot = dsc->pivot;
+    e->angle = dsc->angle;
+    e->zoom = dsc->zoom;
+    e->antialias = dsc->antialias ? 1 : 0;
+    stat.used_size += size;
+    stat.entry_cnt++;
+    stat.miss_cnt++;
+
+    return e;
+}
+
+/**
+ * Transform an image into a new `LV_IMG_CF_TRUE_COLOR_ALPHA` image
+ * @param dec_dsc the opened source image
+ * @param dsc the draw descriptor with the transformation parameters
+ * @param area the transformed area relative to the source image
+ * @return the transformed image allocated with `lv_img_buf_alloc` or NULL on error
+ */
+static lv_img_dsc_t * render_snapshot(const lv_img_decoder_dsc_t * dec_dsc, const lv_draw_img_dsc_t * dsc,
+                                      const lv_area_t * area)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t h = lv_area_get_height(area);
+    lv_img_dsc_t * snapshot = lv_img_buf_alloc(w, h, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    if(snapshot == NULL) return NULL;
+
+    lv_img_transform_dsc_t trans_dsc;
+    _lv_memset_00(&trans_dsc, sizeof(lv_img_transform_dsc_t));
+    trans_dsc.cfg.angle = dsc->angle;
+    trans_dsc.cfg.zoom = dsc->zoom;
+    trans_dsc.cfg.src = dec_dsc->img_data;
+    trans_dsc.cfg.src_w = dec_dsc->header.w;
+    trans_dsc.cfg.src_h = dec_dsc->header.h;
+    trans_dsc.cfg.cf = dec_dsc->header.cf;
+    trans_dsc.cfg.pivot_x = dsc->pivot.x;
+    trans_dsc.cfg.pivot_y = dsc->pivot.y;
+    trans_dsc.cfg.color = dsc->recolor;
+    trans_dsc.cfg.antialias = dsc->antialias;
+    _lv_img_buf_transform_init(&trans_dsc);
+
+    lv_color_t * cbuf = _lv_mem_buf_get(w * sizeof(lv_color_t));
+    lv_opa_t * abuf = _lv_mem_buf_get(w);
+
+    uint8_t * px = (uint8_t *)snapshot->data;
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        if(trans_dsc.tmp.line_kernel != LV_IMG_TRANSFORM_LINE_NONE) {
+            _lv_img_buf_transform_line(&trans_dsc, area->x1, y, w, cbuf, abuf);
+        }
+        else {
+            for(x = 0; x < w; x++) {
+                if(_lv_img_buf_transform(&trans_dsc, area->x1 + x, y)) {
+                    cbuf[x] = trans_dsc.res.color;
+                    abuf[x] = trans_dsc.res.opa;
+                }
+                else {
+                    abuf[x] = LV_OPA_TRANSP;
+                }
+            }
+        }
+
+        for(x = 0; x < w; x++, px += LV_IMG_PX_SIZE_ALPHA_BYTE) {
+            if(abuf[x] == LV_OPA_TRANSP) {
+                _lv_memset_00(px, LV_IMG_PX_SIZE_ALPHA_BYTE);
+            }
+            else {
+                _lv_memcpy_small(px, &cbuf[x], LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+                px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = abuf[x];
+            }
+        }
+    }
+
+    _lv_mem_buf_release(abuf);
+    _lv_mem_buf_release(cbuf);
+
+    return snapshot;
+}
+
+static void entry_free(lv_img_trans_cache_entry_t * e)
+{
+    /*The snapshot might be opened in the image cache*/
+    lv_img_cache_invalidate_src(e->snapshot);
+    lv_img_buf_free(e->snapshot);
+
+    if(lv_img_src_get_type(e->src) == LV_IMG_SRC_FILE) {
+        lv_mem_free((void *)e->src);
+    }
+
+    stat.used_size -= e->size;
+    stat.entry_cnt--;
+    _lv_ll_remove(&LV_GC_ROOT(_lv_img_trans_cache_ll), e);
+    lv_mem_free(e);
+}
+
+static bool src_match(const void * src1, const void * src2)
+{
+    lv_img_src_t src_type = lv_img_src_get_type(src1);
+    if(src_type == LV_IMG_SRC_VARIABLE)
+        return src1 == src2;
+    if(src_type != LV_IMG_SRC_FILE)
+        return false;
+    if(lv_img_src_get_type(src2) != LV_IMG_SRC_FILE)
+        return false;
+    return strcmp(src1, src2) == 0;
+}
+
+#endif /*LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_MEM*/
@@ -0,0 +1,92 @@
+/**
+ * @file lv_img_trans_cache.h
+ *
+ */
+
+#ifndef LV_IMG_TRANS_CACHE_H
+#define LV_IMG_TRANS_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_MEM
+
+#include "lv_draw_img.h"
+#include "../lv_misc/lv_area.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Statistics of the transformed image snapshot cache
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of draws served from a snapshot*/
+    uint32_t miss_cnt;      /**< Number of snapshots rendered*/
+    uint32_t evict_cnt;     /**< Number of snapshots freed to make room or invalidated*/
+    uint32_t used_size;     /**< Memory used by the snapshots in bytes*/
+    uint32_t entry_cnt;     /**< Number of cached snapshots*/
+} lv_img_trans_cache_stat_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the transformed image snapshot cache
+ */
+void _lv_img_trans_cache_init(void);
+
+/**
+ * Draw a rotated and/or zoomed image from its cached snapshot.
+ * On the first call the transformed image is rendered into an ARGB snapshot which is reused
+ * while the angle, zoom, pivot and source are the same.
+ * Only the images opened to RAM in a true color format can be cached.
+ * @param coords the coordinates of the image
+ * @param mask the image will be drawn only in this area
+ * @param src pointer to a `lv_img_dsc_t` variable or a path to a file
+ * @param dsc pointer to an initialized `lv_draw_img_dsc_t` variable
+ * @return true: the image is drawn; false: the image can't be cached, draw it with `lv_draw_img`
+ */
+bool _lv_img_trans_cache_draw(const lv_area_t * coords, const lv_area_t * mask, const void * src,
+                              const lv_draw_img_dsc_t * dsc);
+
+/**
+ * Free the snapshots of an image source. Needs to be called if the content of a source image changes.
+ * @param src the image source or NULL to free all snapshots
+ */
+void lv_img_trans_cache_invalidate_src(const void * src);
+
+/**
+ * Get the statistics of the snapshot cache.
+ * @param stat_p pointer to a `lv_img_trans_cache_stat_t` variable to store the result
+ */
+void lv_img_trans_cache_get_stat(lv_img_trans_cache_stat_t * stat_p);
+
+/**
+ * Reset the hit, miss and eviction counters of the snapshot cache.
+ */
+void lv_img_trans_cache_reset_stat(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_MEM*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_IMG_TRANS_CACHE_H*/
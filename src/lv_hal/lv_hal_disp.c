@@ -196,6 +196,7 @@ void lv_disp_drv_update(lv_disp_t * disp, lv_disp_drv_t * new_drv)
     _lv_memset_00(disp->inv_areas, sizeof(disp->inv_areas));
     _lv_memset_00(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
+    disp->scroll_pending = 0;
     if(disp->act_scr != NULL)
         lv_obj_invalidate(disp->act_scr);
 }
@@ -97,6 +97,12 @@ typedef struct _disp_drv_t {
      */
     uint32_t dpi : 10;
 
+    /** Color format of `buffer` as `lv_img_cf_t`.
+     * 0 (`LV_IMG_CF_UNKNOWN`) by default which means `lv_color_t` pixels.
+     * With `LV_IMG_CF_TRUE_COLOR_ALPHA` and `LV_IMG_CF_ALPHA_8BIT` the buffer is drawn directly, without `set_px_cb`.
+     * Used by the canvas to draw to its image buffer.*/
+    uint32_t buf_cf : 5;
+
     /** MANDATORY: Write the internal buffer (VDB) to the display. 'lv_disp_flush_ready()' has to be
      * called when finished */
     void (*flush_cb)(struct _disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
@@ -182,6 +188,11 @@ uint8_t del_prev  :
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint32_t inv_p : 10;
 
+    /** Area whose rendered content is moved by `scroll_ofs` in the frame buffer instead of being redrawn*/
+    lv_area_t scroll_area;
+    lv_point_t scroll_ofs;
+    uint32_t scroll_pending : 1;
+
     int render_direction; /**< 0 when rendering down, 1 when rendering up */
 
     /*Miscellaneous data*/
@@ -119,6 +119,10 @@ typedef struct _lv_indev_drv_t {
 
     /**< Repeated trigger period in long press [ms] */
     uint16_t long_press_rep_time;
+
+    /**< 1: Don't read the device periodically, only after `lv_indev_read_event` and while it's in use.
+     *   Useful if the device can signal new data with an interrupt. */
+    uint8_t read_on_event : 1;
 } lv_indev_drv_t;
 
 /** Run time data of input devices
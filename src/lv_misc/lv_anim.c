@@ -23,6 +23,7 @@
 #define LV_ANIM_RESOLUTION 1024
 #define LV_ANIM_RES_SHIFT 10
 #define LV_ANIM_TASK_PRIO LV_TASK_PRIO_HIGH
+#define LV_ANIM_ARR_SIZE_MIN 8
 
 /**********************
  *      TYPEDEFS
@@ -33,14 +34,21 @@
  **********************/
 static void anim_task(lv_task_t * param);
 static void anim_mark_list_change(void);
-static void anim_ready_handler(lv_anim_t * a);
+static void anim_ready_handler(uint32_t idx);
+static void anim_remove(uint32_t idx);
+static void anim_arr_compact(void);
+static inline int32_t anim_path_value(const lv_anim_t * a);
+static inline lv_anim_value_t anim_bezier3_value(const lv_anim_t * a, uint32_t u1, uint32_t u2);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static uint32_t last_task_run;
-static bool anim_list_changed;
 static bool anim_run_round;
+static uint32_t anim_cnt;       /*Number of used slots in `_lv_anim_arr`. (Includes the deleted slots while `anim_task` runs)*/
+static uint32_t anim_size;      /*Number of allocated slots in `_lv_anim_arr`*/
+static uint32_t anim_live_cnt;  /*Number of not deleted animations*/
+static uint8_t anim_task_depth; /*>0: `anim_task` is running so the deleted slots can't be removed yet*/
 static lv_task_t * _lv_anim_task;
 const lv_anim_path_t lv_anim_path_def = {.cb = lv_anim_path_linear};
 
@@ -57,10 +65,13 @@ const lv_anim_path_t lv_anim_path_def = {.cb = lv_anim_path_linear};
  */
 void _lv_anim_core_init(void)
 {
-    _lv_ll_init(&LV_GC_ROOT(_lv_anim_ll), sizeof(lv_anim_t));
+    LV_GC_ROOT(_lv_anim_arr) = NULL;
+    anim_cnt = 0;
+    anim_size = 0;
+    anim_live_cnt = 0;
+    anim_task_depth = 0;
     _lv_anim_task = lv_task_create(anim_task, LV_DISP_DEF_REFR_PERIOD, LV_ANIM_TASK_PRIO, NULL);
     anim_mark_list_change(); /*Turn off the animation task*/
-    anim_list_changed = false; /*The list has not actually changed*/
 }
 
 /**
@@ -91,13 +102,23 @@ void lv_anim_start(lv_anim_t * a)
     /* Do not let two animations for the same 'var' with the same 'fp'*/
     if(a->exec_cb != NULL) lv_anim_del(a->var, a->exec_cb); /*fp == NULL would delete all animations of var*/
 
-    /*If the list is empty the anim task was suspended and it's last run measure is invalid*/
-    if(_lv_ll_is_empty(&LV_GC_ROOT(_lv_anim_ll))) {
+    /*If there are no animations the anim task was suspended and it's last run measure is invalid*/
+    if(anim_live_cnt == 0) {
         last_task_run = lv_tick_get();
     }
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = _lv_ll_ins_head(&LV_GC_ROOT(_lv_anim_ll));
+    /*Be sure there is free slot in the animation table*/
+    if(anim_cnt >= anim_size) {
+        uint32_t new_size = anim_size == 0 ? LV_ANIM_ARR_SIZE_MIN : anim_size * 2;
+        lv_anim_t ** new_arr = lv_mem_realloc(LV_GC_ROOT(_lv_anim_arr), new_size * sizeof(lv_anim_t *));
+        LV_ASSERT_MEM(new_arr);
+        if(new_arr == NULL) return;
+        LV_GC_ROOT(_lv_anim_arr) = new_arr;
+        anim_size = new_size;
+    }
+
+    /*Add the new animation to the end of the table*/
+    lv_anim_t * new_anim = lv_mem_alloc(sizeof(lv_anim_t));
     LV_ASSERT_MEM(new_anim);
     if(new_anim == NULL) return;
 
@@ -105,16 +126,20 @@ void lv_anim_start(lv_anim_t * a)
     a->time_orig = a->time;
     a->run_round = anim_run_round;
     _lv_memcpy(new_anim, a, sizeof(lv_anim_t));
+    LV_GC_ROOT(_lv_anim_arr)[anim_cnt] = new_anim;
+    anim_cnt++;
+    anim_live_cnt++;
 
     /*Set the start value*/
     if(new_anim->early_apply) {
         if(new_anim->exec_cb && new_anim->var) new_anim->exec_cb(new_anim->var, new_anim->start);
     }
 
-    /* Creating an animation changed the linked list.
-     * It's important if it happens in a ready callback. (see `anim_task`)*/
     anim_mark_list_change();
 
+    /*The anim task might sleep until a delayed animation. Run it with normal period to handle the new animation too*/
+    lv_task_set_period(_lv_anim_task, LV_DISP_DEF_REFR_PERIOD);
+
     LV_LOG_TRACE("animation created")
 }
 
@@ -127,25 +152,20 @@ void lv_anim_start(lv_anim_t * a)
  */
 bool lv_anim_del(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    lv_anim_t * a_next;
     bool del = false;
-    a        = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
-    while(a != NULL) {
-        /*'a' might be deleted, so get the next object while 'a' is valid*/
-        a_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
+    uint32_t i;
+    for(i = 0; i < anim_cnt; i++) {
+        lv_anim_t * a = LV_GC_ROOT(_lv_anim_arr)[i];
+        if(a == NULL) continue;
 
         if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
-            _lv_ll_remove(&LV_GC_ROOT(_lv_anim_ll), a);
-            lv_mem_free(a);
-            anim_mark_list_change(); /*Read by `anim_task`. It need to know if a delete occurred in
-                                         the linked list*/
+            anim_remove(i);
             del = true;
         }
-
-        a = a_next;
     }
 
+    if(del) anim_arr_compact();
+
     return del;
 }
 
@@ -154,8 +174,12 @@ bool lv_anim_del(void * var, lv_anim_exec_xcb_t exec_cb)
  */
 void lv_anim_del_all(void)
 {
-    _lv_ll_clear(&LV_GC_ROOT(_lv_anim_ll));
-    anim_mark_list_change();
+    uint32_t i;
+    for(i = 0; i < anim_cnt; i++) {
+        if(LV_GC_ROOT(_lv_anim_arr)[i]) anim_remove(i);
+    }
+
+    anim_arr_compact();
 }
 
 /**
@@ -167,9 +191,10 @@ void lv_anim_del_all(void)
  */
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    _LV_LL_READ(LV_GC_ROOT(_lv_anim_ll), a) {
-        if(a->var == var && a->exec_cb == exec_cb) {
+    uint32_t i;
+    for(i = 0; i < anim_cnt; i++) {
+        lv_anim_t * a = LV_GC_ROOT(_lv_anim_arr)[i];
+        if(a && a->var == var && a->exec_cb == exec_cb) {
             return a;
         }
     }
@@ -183,11 +208,7 @@ lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
  */
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    _LV_LL_READ(LV_GC_ROOT(_lv_anim_ll), a) cnt++;
-
-    return cnt;
+    return anim_live_cnt;
 }
 
 /**
@@ -251,17 +272,7 @@ lv_anim_value_t lv_anim_path_ease_in(const lv_anim_path_t * path, const lv_anim_
 {
     LV_UNUSED(path);
 
-    /*Calculate the current step*/
-
-    uint32_t t = _lv_map(a->act_time, 0, a->time, 0, 1024);
-    int32_t step = _lv_bezier3(t, 0, 1, 1, 1024);
-
-    int32_t new_value;
-    new_value = step * (a->end - a->start);
-    new_value = new_value >> 10;
-    new_value += a->start;
-
-    return new_value;
+    return anim_bezier3_value(a, 1, 1);
 }
 
 /**
@@ -273,17 +284,7 @@ lv_anim_value_t lv_anim_path_ease_out(const lv_anim_path_t * path, const lv_anim
 {
     LV_UNUSED(path);
 
-    /*Calculate the current step*/
-
-    uint32_t t = _lv_map(a->act_time, 0, a->time, 0, 1024);
-    int32_t step = _lv_bezier3(t, 0, 1023, 1023, 1024);
-
-    int32_t new_value;
-    new_value = step * (a->end - a->start);
-    new_value = new_value >> 10;
-    new_value += a->start;
-
-    return new_value;
+    return anim_bezier3_value(a, 1023, 1023);
 }
 
 /**
@@ -295,17 +296,7 @@ lv_anim_value_t lv_anim_path_ease_in_out(const lv_anim_path_t * path, const lv_a
 {
     LV_UNUSED(path);
 
-    /*Calculate the current step*/
-
-    uint32_t t = _lv_map(a->act_time, 0, a->time, 0, 1024);
-    int32_t step = _lv_bezier3(t, 0, 100, 924, 1024);
-
-    int32_t new_value;
-    new_value = step * (a->end - a->start);
-    new_value = new_value >> 10;
-    new_value += a->start;
-
-    return new_value;
+    return anim_bezier3_value(a, 100, 924);
 }
 
 /**
@@ -317,17 +308,7 @@ lv_anim_value_t lv_anim_path_overshoot(const lv_anim_path_t * path, const lv_ani
 {
     LV_UNUSED(path);
 
-    /*Calculate the current step*/
-
-    uint32_t t = _lv_map(a->act_time, 0, a->time, 0, 1024);
-    int32_t step = _lv_bezier3(t, 0, 1000, 1300, 1024);
-
-    int32_t new_value;
-    new_value = step * (a->end - a->start);
-    new_value = new_value >> 10;
-    new_value += a->start;
-
-    return new_value;
+    return anim_bezier3_value(a, 1000, 1300);
 }
 
 /**
@@ -423,51 +404,63 @@ static void anim_task(lv_task_t * param)
     /*Flip the run round*/
     anim_run_round = anim_run_round ? false : true;
 
-    lv_anim_t * a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
-
-    while(a != NULL) {
-        /*It can be set by `lv_anim_del()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_ready_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        anim_list_changed = false;
-
-        if(a->run_round != anim_run_round) {
-            a->run_round = anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
-
-            /*The animation will run now for the first time. Call `start_cb`*/
-            int32_t new_act_time = a->act_time + elaps;
-            if(a->act_time <= 0 && new_act_time >= 0) {
-                if(a->start_cb) a->start_cb(a);
+    /* Deleted animations are only marked with `NULL` until the end of the task
+     * so the table can be processed in one pass even if the callbacks delete animations.
+     * The animations created meanwhile are added to the end and will run only in the next round.*/
+    anim_task_depth++;
+    uint32_t cnt = anim_cnt;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_anim_t * a = LV_GC_ROOT(_lv_anim_arr)[i];
+        if(a == NULL) continue;
+
+        if(a->run_round == anim_run_round) continue;
+        a->run_round = anim_run_round; /*`lv_anim_refr_now` might run the table again in a callback*/
+
+        /*The animation will run now for the first time. Call `start_cb`*/
+        int32_t new_act_time = a->act_time + elaps;
+        if(a->act_time <= 0 && new_act_time >= 0) {
+            if(a->start_cb) {
+                a->start_cb(a);
+                if(LV_GC_ROOT(_lv_anim_arr)[i] != a) continue;  /*Deleted in `start_cb`*/
             }
-            a->act_time += elaps;
-            if(a->act_time >= 0) {
-                if(a->act_time > a->time) a->act_time = a->time;
-
-                int32_t new_value;
-                if(a->path.cb) new_value = a->path.cb(&a->path, a);
-                else new_value = lv_anim_path_linear(&a->path, a);
-
-                if(new_value != a->current) {
-                    a->current = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
+        }
+        a->act_time += elaps;
+        if(a->act_time >= 0) {
+            if(a->act_time > a->time) a->act_time = a->time;
+
+            int32_t new_value = anim_path_value(a);
+            if(new_value != a->current) {
+                a->current = new_value;
+                /*Apply the calculated value*/
+                if(a->exec_cb) {
+                    a->exec_cb(a->var, new_value);
+                    if(LV_GC_ROOT(_lv_anim_arr)[i] != a) continue;  /*Deleted in `exec_cb`*/
                 }
+            }
 
-                /*If the time is elapsed the animation is ready*/
-                if(a->act_time >= a->time) {
-                    anim_ready_handler(a);
-                }
+            /*If the time is elapsed the animation is ready*/
+            if(a->act_time >= a->time) {
+                anim_ready_handler(i);
             }
         }
-
-        /* If the linked list changed due to anim. delete then it's not safe to continue
-         * the reading of the list from here -> start from the head*/
-        if(anim_list_changed)
-            a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
-        else
-            a = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
     }
+    anim_task_depth--;
+    anim_arr_compact();
+
+    /*If all the animations wait for their delay, don't wake up until the first one starts*/
+    uint32_t period = UINT32_MAX;
+    for(i = 0; i < anim_cnt; i++) {
+        lv_anim_t * a = LV_GC_ROOT(_lv_anim_arr)[i];
+        if(a == NULL) continue;     /*Not compacted yet if `anim_task` is called from a callback*/
+        if(a->act_time >= 0) {
+            period = LV_DISP_DEF_REFR_PERIOD;
+            break;
+        }
+        if((uint32_t)(-a->act_time) < period) period = -a->act_time;
+    }
+    if(period == UINT32_MAX) period = LV_DISP_DEF_REFR_PERIOD;
+    lv_task_set_period(_lv_anim_task, period);
 
     last_task_run = lv_tick_get();
 }
@@ -475,10 +468,12 @@ static void anim_task(lv_task_t * param)
 /**
  * Called when an animation is ready to do the necessary thinks
  * e.g. repeat, play back, delete etc.
- * @param a pointer to an animation descriptor
+ * @param idx index of the animation in the animation table
  */
-static void anim_ready_handler(lv_anim_t * a)
+static void anim_ready_handler(uint32_t idx)
 {
+    lv_anim_t * a = LV_GC_ROOT(_lv_anim_arr)[idx];
+
     /*In the end of a forward anim decrement repeat cnt.*/
     if(a->playback_now == 0 && a->repeat_cnt > 0 && a->repeat_cnt != LV_ANIM_REPEAT_INFINITE) {
         a->repeat_cnt--;
@@ -489,14 +484,11 @@ static void anim_ready_handler(lv_anim_t * a)
      * - no repeat, play back is enabled and play back is ready */
     if(a->repeat_cnt == 0 && ((a->playback_time == 0) || (a->playback_time && a->playback_now == 1))) {
 
-        /*Create copy from the animation and delete the animation from the list.
+        /*Create copy from the animation and delete the animation from the table.
          * This way the `ready_cb` will see the animations like it's animation is ready deleted*/
         lv_anim_t a_tmp;
         _lv_memcpy(&a_tmp, a, sizeof(lv_anim_t));
-        _lv_ll_remove(&LV_GC_ROOT(_lv_anim_ll), a);
-        lv_mem_free(a);
-        /*Flag that the list has changed */
-        anim_mark_list_change();
+        anim_remove(idx);
 
         /* Call the callback function at the end*/
         if(a_tmp.ready_cb != NULL) a_tmp.ready_cb(&a_tmp);
@@ -521,10 +513,84 @@ static void anim_ready_handler(lv_anim_t * a)
         }
     }
 }
+
+/**
+ * Free an animation and mark its slot as deleted in the animation table
+ * @param idx index of the animation in the animation table
+ */
+static void anim_remove(uint32_t idx)
+{
+    lv_mem_free(LV_GC_ROOT(_lv_anim_arr)[idx]);
+    LV_GC_ROOT(_lv_anim_arr)[idx] = NULL;
+    anim_live_cnt--;
+    anim_mark_list_change();
+}
+
+/**
+ * Remove the slots of the deleted animations from the table keeping the order of the others.
+ * Does nothing while `anim_task` is running.
+ */
+static void anim_arr_compact(void)
+{
+    if(anim_task_depth > 0) return;
+    if(anim_live_cnt == anim_cnt) return;
+
+    lv_anim_t ** arr = LV_GC_ROOT(_lv_anim_arr);
+    uint32_t i;
+    uint32_t j = 0;
+    for(i = 0; i < anim_cnt; i++) {
+        if(arr[i]) {
+            arr[j] = arr[i];
+            j++;
+        }
+    }
+    anim_cnt = j;
+}
+
+/**
+ * Calculate the current value of an animation.
+ * The built-in paths are evaluated directly, others are called via `path.cb`.
+ * @param a pointer to an animation
+ * @return the current value to set
+ */
+static inline int32_t anim_path_value(const lv_anim_t * a)
+{
+    lv_anim_path_cb_t cb = a->path.cb;
+    if(cb == NULL || cb == lv_anim_path_linear) {
+        int32_t step = _lv_map(a->act_time, 0, a->time, 0, LV_ANIM_RESOLUTION);
+        return ((step * (a->end - a->start)) >> LV_ANIM_RES_SHIFT) + a->start;
+    }
+    else if(cb == lv_anim_path_ease_in) return anim_bezier3_value(a, 1, 1);
+    else if(cb == lv_anim_path_ease_out) return anim_bezier3_value(a, 1023, 1023);
+    else if(cb == lv_anim_path_ease_in_out) return anim_bezier3_value(a, 100, 924);
+    else if(cb == lv_anim_path_overshoot) return anim_bezier3_value(a, 1000, 1300);
+    else if(cb == lv_anim_path_step) return a->act_time >= a->time ? a->end : a->start;
+    else return cb(&a->path, a);
+}
+
+/**
+ * Calculate the current value of an animation on a cubic bezier path from 0 to 1024
+ * @param a pointer to an animation
+ * @param u1 first control point
+ * @param u2 second control point
+ * @return the current value to set
+ */
+static inline lv_anim_value_t anim_bezier3_value(const lv_anim_t * a, uint32_t u1, uint32_t u2)
+{
+    uint32_t t = _lv_map(a->act_time, 0, a->time, 0, 1024);
+    int32_t step = _lv_bezier3(t, 0, u1, u2, 1024);
+
+    int32_t new_value;
+    new_value = step * (a->end - a->start);
+    new_value = new_value >> 10;
+    new_value += a->start;
+
+    return new_value;
+}
+
 static void anim_mark_list_change(void)
 {
-    anim_list_changed = true;
-    if(_lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll)) == NULL)
+    if(anim_live_cnt == 0)
         lv_task_set_prio(_lv_anim_task, LV_TASK_PRIO_OFF);
     else
         lv_task_set_prio(_lv_anim_task, LV_ANIM_TASK_PRIO);
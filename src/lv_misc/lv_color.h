@@ -147,7 +147,8 @@ enum {
 # define LV_COLOR_GET_A1(c) 0xFF
 
 # define _LV_COLOR_ZERO_INITIALIZER1 {0x00}
-# define LV_COLOR_MAKE1(r8, g8, b8) (_LV_COLOR_MAKE_TYPE_HELPER{(uint8_t)((b8 >> 7) | (g8 >> 7) | (r8 >> 7))})
+# define _LV_COLOR_INITIALIZER1(r8, g8, b8) {(uint8_t)((b8 >> 7) | (g8 >> 7) | (r8 >> 7))}
+# define LV_COLOR_MAKE1(r8, g8, b8) (_LV_COLOR_MAKE_TYPE_HELPER _LV_COLOR_INITIALIZER1(r8, g8, b8))
 
 # define LV_COLOR_SET_R8(c, v) (c).ch.red = (uint8_t)((v) & 0x7U)
 # define LV_COLOR_SET_G8(c, v) (c).ch.green = (uint8_t)((v) & 0x7U)
@@ -160,7 +161,8 @@ enum {
 # define LV_COLOR_GET_A8(c) 0xFF
 
 # define _LV_COLOR_ZERO_INITIALIZER8 {{0x00, 0x00, 0x00}}
-# define LV_COLOR_MAKE8(r8, g8, b8) (_LV_COLOR_MAKE_TYPE_HELPER{{(uint8_t)((b8 >> 6) & 0x3U), (uint8_t)((g8 >> 5) & 0x7U), (uint8_t)((r8 >> 5) & 0x7U)}})
+# define _LV_COLOR_INITIALIZER8(r8, g8, b8) {{(uint8_t)((b8 >> 6) & 0x3U), (uint8_t)((g8 >> 5) & 0x7U), (uint8_t)((r8 >> 5) & 0x7U)}}
+# define LV_COLOR_MAKE8(r8, g8, b8) (_LV_COLOR_MAKE_TYPE_HELPER _LV_COLOR_INITIALIZER8(r8, g8, b8))
 
 # define LV_COLOR_SET_R16(c, v) (c).ch.red = (uint8_t)((v) & 0x1FU)
 #if LV_COLOR_16_SWAP == 0
@@ -182,10 +184,12 @@ enum {
 
 #if LV_COLOR_16_SWAP == 0
 # define _LV_COLOR_ZERO_INITIALIZER16 {{0x00, 0x00, 0x00}}
-# define LV_COLOR_MAKE16(r8, g8, b8) (_LV_COLOR_MAKE_TYPE_HELPER{{(uint8_t)((b8 >> 3) & 0x1FU), (uint8_t)((g8 >> 2) & 0x3FU), (uint8_t)((r8 >> 3) & 0x1FU)}})
+# define _LV_COLOR_INITIALIZER16(r8, g8, b8) {{(uint8_t)((b8 >> 3) & 0x1FU), (uint8_t)((g8 >> 2) & 0x3FU), (uint8_t)((r8 >> 3) & 0x1FU)}}
+# define LV_COLOR_MAKE16(r8, g8, b8) (_LV_COLOR_MAKE_TYPE_HELPER _LV_COLOR_INITIALIZER16(r8, g8, b8))
 #else
 # define _LV_COLOR_ZERO_INITIALIZER16 {{0x00, 0x00, 0x00, 0x00}}
-# define LV_COLOR_MAKE16(r8, g8, b8) (_LV_COLOR_MAKE_TYPE_HELPER{{(uint8_t)((g8 >> 5) & 0x7U), (uint8_t)((r8 >> 3) & 0x1FU), (uint8_t)((b8 >> 3) & 0x1FU), (uint8_t)((g8 >> 2) & 0x7U)}})
+# define _LV_COLOR_INITIALIZER16(r8, g8, b8) {{(uint8_t)((g8 >> 5) & 0x7U), (uint8_t)((r8 >> 3) & 0x1FU), (uint8_t)((b8 >> 3) & 0x1FU), (uint8_t)((g8 >> 2) & 0x7U)}}
+# define LV_COLOR_MAKE16(r8, g8, b8) (_LV_COLOR_MAKE_TYPE_HELPER _LV_COLOR_INITIALIZER16(r8, g8, b8))
 #endif
 
 # define LV_COLOR_SET_R32(c, v) (c).ch.red = (uint8_t)((v) & 0xFF)
@@ -199,7 +203,8 @@ enum {
 # define LV_COLOR_GET_A32(c) (c).ch.alpha
 
 # define _LV_COLOR_ZERO_INITIALIZER32 {{0x00, 0x00, 0x00, 0x00}}
-# define LV_COLOR_MAKE32(r8, g8, b8) (_LV_COLOR_MAKE_TYPE_HELPER{{b8, g8, r8, 0xff}}) /*Fix 0xff alpha*/
+# define _LV_COLOR_INITIALIZER32(r8, g8, b8) {{b8, g8, r8, 0xff}} /*Fix 0xff alpha*/
+# define LV_COLOR_MAKE32(r8, g8, b8) (_LV_COLOR_MAKE_TYPE_HELPER _LV_COLOR_INITIALIZER32(r8, g8, b8))
 
 /*---------------------------------------
  * Macros for the current color depth
@@ -218,6 +223,9 @@ enum {
 #define _LV_COLOR_ZERO_INITIALIZER LV_CONCAT(_LV_COLOR_ZERO_INITIALIZER, LV_COLOR_DEPTH)
 #define LV_COLOR_MAKE(r8, g8, b8) LV_CONCAT(LV_COLOR_MAKE, LV_COLOR_DEPTH)(r8, g8, b8)
 
+/*Same as `LV_COLOR_MAKE` but can be used to initialize static and constant variables*/
+#define _LV_COLOR_INITIALIZER(r8, g8, b8) LV_CONCAT(_LV_COLOR_INITIALIZER, LV_COLOR_DEPTH)(r8, g8, b8)
+
 /**********************
  *      TYPEDEFS
  **********************/
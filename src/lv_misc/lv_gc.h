@@ -31,18 +31,21 @@ extern "C" {
     f(lv_ll_t, _lv_indev_ll) /*Linked list of input device*/       \
     f(lv_ll_t, _lv_drv_ll)                                         \
     f(lv_ll_t, _lv_file_ll)                                        \
-    f(lv_ll_t, _lv_anim_ll)                                        \
+    f(struct _lv_anim_t **, _lv_anim_arr)                          \
     f(lv_ll_t, _lv_group_ll)                                       \
     f(lv_ll_t, _lv_img_defoder_ll)                                 \
     f(lv_ll_t, _lv_obj_style_trans_ll)                             \
     f(lv_img_cache_entry_t*, _lv_img_cache_array)                  \
+    f(lv_ll_t, _lv_img_async_ll)                                   \
+    f(lv_ll_t, _lv_img_trans_cache_ll)                             \
+    f(lv_ll_t, _lv_layer_cache_ll)                                 \
     f(lv_task_t*, _lv_task_act)                                    \
+    f(lv_task_t**, _lv_task_heap)                                  \
     f(lv_mem_buf_arr_t , _lv_mem_buf)                              \
     f(_lv_draw_mask_saved_arr_t , _lv_draw_mask_list)              \
     f(void * , _lv_theme_material_styles)                          \
     f(void * , _lv_theme_template_styles)                          \
     f(void * , _lv_theme_mono_styles)                              \
-    f(void * , _lv_theme_empty_styles)                             \
     f(uint8_t *, _lv_font_decompr_buf)                             \
 
 #define LV_DEFINE_ROOT(root_type, root_name) root_type root_name;
@@ -19,6 +19,13 @@
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PRIO LV_TASK_PRIO_MID
 #define DEF_PERIOD 500
+#define HEAP_SIZE_MIN 8
+
+/*Where a task is in the scheduler (`lv_task_t.sched_state`)*/
+#define SCHED_NONE  0   /*Not scheduled, its priority is `LV_TASK_PRIO_OFF`*/
+#define SCHED_HEAP  1   /*Waiting for its deadline in the heap*/
+#define SCHED_READY 2   /*Its deadline has passed, waiting in a ready queue*/
+#define SCHED_RUN   3   /*Running or already ran in the current `lv_task_handler` call*/
 
 /**********************
  *      TYPEDEFS
@@ -29,6 +36,17 @@
  **********************/
 static bool lv_task_exec(lv_task_t * task);
 static uint32_t lv_task_time_remaining(lv_task_t * task);
+static bool sched_add(lv_task_t * task);
+static void sched_remove(lv_task_t * task);
+static void sched_update(lv_task_t * task);
+static void sched_collect_ready(void);
+static void ready_push(lv_task_t * task);
+static lv_task_t * ready_pop(void);
+static void heap_insert(lv_task_t * task);
+static void heap_remove(lv_task_t * task);
+static void heap_sift_up(uint32_t i);
+static void heap_sift_down(uint32_t i);
+static inline bool deadline_less(const lv_task_t * t1, const lv_task_t * t2);
 
 /**********************
  *  STATIC VARIABLES
@@ -36,8 +54,12 @@ static uint32_t lv_task_time_remaining(lv_task_t * task);
 static bool lv_task_run  = false;
 static uint8_t idle_last = 0;
 static bool task_deleted;
-static bool task_list_changed;
-static bool task_created;
+static uint32_t heap_cnt;       /*Number of tasks in the deadline heap*/
+static uint32_t heap_size;      /*Allocated size of the deadline heap*/
+static uint32_t sched_cnt;      /*Number of tasks with not `SCHED_NONE` state*/
+static lv_task_t * ready_head[_LV_TASK_PRIO_NUM];
+static lv_task_t * ready_tail[_LV_TASK_PRIO_NUM];
+static lv_task_t * run_head;    /*Tasks executed in the current `lv_task_handler` call*/
 
 /**********************
  *      MACROS
@@ -54,13 +76,22 @@ void _lv_task_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_task_ll), sizeof(lv_task_t));
 
+    LV_GC_ROOT(_lv_task_heap) = NULL;
+    heap_cnt = 0;
+    heap_size = 0;
+    sched_cnt = 0;
+    _lv_memset_00(ready_head, sizeof(ready_head));
+    _lv_memset_00(ready_tail, sizeof(ready_tail));
+    run_head = NULL;
+
     /*Initially enable the lv_task handling*/
     lv_task_enable(true);
 }
 
 /**
  * Call it periodically to handle lv_tasks.
- * @return the time after which it must be called again
+ * @return the time after which it must be called again or
+ *         `LV_NO_TASK_READY` if there is no scheduled task, i.e. it's enough to call it again after an event
  */
 LV_ATTRIBUTE_TASK_HANDLER uint32_t lv_task_handler(void)
 {
@@ -81,91 +112,47 @@ LV_ATTRIBUTE_TASK_HANDLER uint32_t lv_task_handler(void)
 
     uint32_t handler_start = lv_tick_get();
 
-    /* Run all task from the highest to the lowest priority
-     * If a lower priority task is executed check task again from the highest priority
-     * but on the priority of executed tasks don't run tasks before the executed*/
-    lv_task_t * task_interrupter = NULL;
-    lv_task_t * next;
-    bool end_flag;
-    do {
-        end_flag                 = true;
-        task_deleted             = false;
-        task_created             = false;
-        task_list_changed        = false;
-        LV_GC_ROOT(_lv_task_act) = _lv_ll_get_head(&LV_GC_ROOT(_lv_task_ll));
-        while(LV_GC_ROOT(_lv_task_act)) {
-            /* The task might be deleted if it runs only once ('once = 1')
-             * So get next element until the current is surely valid*/
-            next = _lv_ll_get_next(&LV_GC_ROOT(_lv_task_ll), LV_GC_ROOT(_lv_task_act));
-
-            /*We reach priority of the turned off task. There is nothing more to do.*/
-            if(LV_GC_ROOT(_lv_task_act)->prio == LV_TASK_PRIO_OFF) {
-                break;
-            }
-
-            /*Here is the interrupter task. Don't execute it again.*/
-            if(LV_GC_ROOT(_lv_task_act) == task_interrupter) {
-                task_interrupter = NULL; /*From this point only task after the interrupter comes, so
-                                            the interrupter is not interesting anymore*/
-                LV_GC_ROOT(_lv_task_act) = next;
-                continue; /*Load the next task*/
-            }
-
-            /*Just try to run the tasks with highest priority.*/
-            if(LV_GC_ROOT(_lv_task_act)->prio == LV_TASK_PRIO_HIGHEST) {
-                lv_task_exec(LV_GC_ROOT(_lv_task_act));
+    /* Run the ready tasks from the highest to the lowest priority.
+     * After every execution the newly ready tasks are collected too
+     * so a higher priority task can interrupt the lower priority ones.
+     * A task runs only once in a call even if its period is shorter than the execution time.*/
+    sched_collect_ready();
+    lv_task_t * task = ready_pop();
+    while(task) {
+        LV_GC_ROOT(_lv_task_act) = task;
+        task_deleted = false;
+        task->sched_state = SCHED_RUN;
+
+        bool exec = lv_task_exec(task);
+
+        /*The task might be deleted or turned off in its callback*/
+        if(task_deleted == false && task->sched_state == SCHED_RUN) {
+            if(exec) {
+                task->sched_next = run_head;
+                run_head = task;
             }
-            /*Tasks with higher priority than the interrupted shall be run in every case*/
-            else if(task_interrupter) {
-                if(LV_GC_ROOT(_lv_task_act)->prio > task_interrupter->prio) {
-                    if(lv_task_exec(LV_GC_ROOT(_lv_task_act))) {
-                        if(!task_created && !task_deleted) {
-                            /*Check all tasks again from the highest priority */
-                            task_interrupter = LV_GC_ROOT(_lv_task_act);
-                            end_flag = false;
-                            break;
-                        }
-                    }
-                }
-            }
-            /* It is no interrupter task or we already reached it earlier.
-             * Just run the remaining tasks*/
+            /*Reset meanwhile so it's not ready anymore*/
             else {
-                if(lv_task_exec(LV_GC_ROOT(_lv_task_act))) {
-                    if(!task_created && !task_deleted) {
-                        task_interrupter = LV_GC_ROOT(_lv_task_act); /*Check all tasks again from the highest priority */
-                        end_flag         = false;
-                        break;
-                    }
-                }
-            }
-
-            /*If a task was created or deleted then this or the next item might be corrupted*/
-            if(task_created || task_deleted) {
-                task_interrupter = NULL;
-                break;
+                heap_insert(task);
             }
-
-            if(task_list_changed) {
-                task_interrupter = NULL;
-                end_flag = false;
-                break;
-            }
-
-            LV_GC_ROOT(_lv_task_act) = next; /*Load the next task*/
         }
-    } while(!end_flag);
 
-    uint32_t time_till_next = LV_NO_TASK_READY;
-    next = _lv_ll_get_head(&LV_GC_ROOT(_lv_task_ll));
-    while(next && next->prio != LV_TASK_PRIO_OFF) {
-        uint32_t delay = lv_task_time_remaining(next);
-        if(delay < time_till_next)
-            time_till_next = delay;
+        sched_collect_ready();
+        task = ready_pop();
+    }
+    LV_GC_ROOT(_lv_task_act) = NULL;
 
-        next = _lv_ll_get_next(&LV_GC_ROOT(_lv_task_ll), next); /*Find the next task*/
+    /*Schedule the executed tasks for their next run*/
+    while(run_head) {
+        task = run_head;
+        run_head = task->sched_next;
+        heap_insert(task);
     }
 
+    /*The heap's root is the task with the earliest deadline*/
+    uint32_t time_till_next = LV_NO_TASK_READY;
+    if(heap_cnt > 0) time_till_next = lv_task_time_remaining(LV_GC_ROOT(_lv_task_heap)[0]);
+
     busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
     if(idle_period_time >= IDLE_MEAS_PERIOD) {
@@ -233,7 +220,6 @@ lv_task_t * lv_task_create(lv_task_cb_t task_xcb, uint32_t period, lv_task_prio_
             if(new_task == NULL) return NULL;
         }
     }
-    task_list_changed = true;
 
     new_task->period  = period;
     new_task->task_cb = task_xcb;
@@ -244,7 +230,16 @@ lv_task_t * lv_task_create(lv_task_cb_t task_xcb, uint32_t period, lv_task_prio_
 
     new_task->user_data = user_data;
 
-    task_created = true;
+    new_task->sched_state = SCHED_NONE;
+    new_task->sched_next = NULL;
+    new_task->heap_idx = 0;
+    if(prio != LV_TASK_PRIO_OFF) {
+        if(sched_add(new_task) == false) {
+            _lv_ll_remove(&LV_GC_ROOT(_lv_task_ll), new_task);
+            lv_mem_free(new_task);
+            return NULL;
+        }
+    }
 
     return new_task;
 }
@@ -265,8 +260,8 @@ void lv_task_set_cb(lv_task_t * task, lv_task_cb_t task_cb)
  */
 void lv_task_del(lv_task_t * task)
 {
+    sched_remove(task);
     _lv_ll_remove(&LV_GC_ROOT(_lv_task_ll), task);
-    task_list_changed = true;
 
     lv_mem_free(task);
 
@@ -295,9 +290,28 @@ void lv_task_set_prio(lv_task_t * task, lv_task_prio_t prio)
     if(i == NULL) {
         _lv_ll_move_before(&LV_GC_ROOT(_lv_task_ll), task, NULL);
     }
-    task_list_changed = true;
 
-    task->prio = prio;
+    if(prio == LV_TASK_PRIO_OFF) {
+        sched_remove(task);
+        task->prio = prio;
+    }
+    else if(task->sched_state == SCHED_NONE) {
+        task->prio = prio;
+        if(sched_add(task) == false) {
+            LV_LOG_WARN("lv_task_set_prio: couldn't schedule the task");
+            task->prio = LV_TASK_PRIO_OFF;
+        }
+    }
+    else if(task->sched_state == SCHED_READY) {
+        /*Move it to the ready queue of the new priority*/
+        sched_remove(task);
+        task->prio = prio;
+        sched_cnt++;
+        ready_push(task);
+    }
+    else {
+        task->prio = prio;
+    }
 }
 
 /**
@@ -308,6 +322,7 @@ void lv_task_set_prio(lv_task_t * task, lv_task_prio_t prio)
 void lv_task_set_period(lv_task_t * task, uint32_t period)
 {
     task->period = period;
+    sched_update(task);
 }
 
 /**
@@ -317,6 +332,7 @@ void lv_task_set_period(lv_task_t * task, uint32_t period)
 void lv_task_ready(lv_task_t * task)
 {
     task->last_run = lv_tick_get() - task->period - 1;
+    sched_update(task);
 }
 
 /**
@@ -337,6 +353,7 @@ void lv_task_set_repeat_count(lv_task_t * task, int32_t repeat_count)
 void lv_task_reset(lv_task_t * task)
 {
     task->last_run = lv_tick_get();
+    sched_update(task);
 }
 
 /**
@@ -413,3 +430,196 @@ static uint32_t lv_task_time_remaining(lv_task_t * task)
         return 0;
     return task->period - elp;
 }
+
+/**
+ * Add a not scheduled task to the deadline heap
+ * @param task pointer to lv_task with `SCHED_NONE` state
+ * @return true: the task is scheduled; false: out of memory
+ */
+static bool sched_add(lv_task_t * task)
+{
+    /* The heap is large enough to hold all the scheduled tasks,
+     * so the tasks can be moved back from the ready queues any time without allocation*/
+    if(sched_cnt >= heap_size) {
+        uint32_t new_size = heap_size == 0 ? HEAP_SIZE_MIN : heap_size * 2;
+        lv_task_t ** new_heap = lv_mem_realloc(LV_GC_ROOT(_lv_task_heap), new_size * sizeof(lv_task_t *));
+        LV_ASSERT_MEM(new_heap);
+        if(new_heap == NULL) return false;
+
+        LV_GC_ROOT(_lv_task_heap) = new_heap;
+        heap_size = new_size;
+    }
+
+    sched_cnt++;
+    heap_insert(task);
+    return true;
+}
+
+/**
+ * Remove a task from the scheduler wherever it is
+ * @param task pointer to lv_task
+ */
+static void sched_remove(lv_task_t * task)
+{
+    if(task->sched_state == SCHED_NONE) return;
+
+    if(task->sched_state == SCHED_HEAP) {
+        heap_remove(task);
+    }
+    else if(task->sched_state == SCHED_READY) {
+        lv_task_t ** next_p = &ready_head[task->prio];
+        lv_task_t * prev = NULL;
+        while(*next_p != task) {
+            prev = *next_p;
+            next_p = &prev->sched_next;
+        }
+        *next_p = task->sched_next;
+        if(ready_tail[task->prio] == task) ready_tail[task->prio] = prev;
+    }
+    else if(LV_GC_ROOT(_lv_task_act) != task) {
+        /*Already executed in this round so it's in the run list*/
+        lv_task_t ** next_p = &run_head;
+        while(*next_p != task) next_p = &(*next_p)->sched_next;
+        *next_p = task->sched_next;
+    }
+
+    task->sched_state = SCHED_NONE;
+    sched_cnt--;
+}
+
+/**
+ * Update the place of a task in the heap after its deadline has changed
+ * @param task pointer to lv_task
+ */
+static void sched_update(lv_task_t * task)
+{
+    if(task->sched_state != SCHED_HEAP) return;
+
+    heap_sift_up(task->heap_idx);
+    heap_sift_down(task->heap_idx);
+}
+
+/**
+ * Move all the tasks whose deadline has passed from the heap to the ready queues
+ */
+static void sched_collect_ready(void)
+{
+    while(heap_cnt > 0 && lv_task_time_remaining(LV_GC_ROOT(_lv_task_heap)[0]) == 0) {
+        lv_task_t * task = LV_GC_ROOT(_lv_task_heap)[0];
+        heap_remove(task);
+        ready_push(task);
+    }
+}
+
+/**
+ * Add a task to the end of the ready queue of its priority
+ * @param task pointer to lv_task
+ */
+static void ready_push(lv_task_t * task)
+{
+    task->sched_state = SCHED_READY;
+    task->sched_next = NULL;
+    if(ready_tail[task->prio]) ready_tail[task->prio]->sched_next = task;
+    else ready_head[task->prio] = task;
+    ready_tail[task->prio] = task;
+}
+
+/**
+ * Remove the first task from the highest priority, not empty ready queue
+ * @return pointer to a lv_task or NULL if there is no ready task
+ */
+static lv_task_t * ready_pop(void)
+{
+    int32_t prio;
+    for(prio = LV_TASK_PRIO_HIGHEST; prio > LV_TASK_PRIO_OFF; prio--) {
+        lv_task_t * task = ready_head[prio];
+        if(task) {
+            ready_head[prio] = task->sched_next;
+            if(ready_head[prio] == NULL) ready_tail[prio] = NULL;
+            task->sched_next = NULL;
+            return task;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Insert a task to the heap. The heap needs to have free space for it.
+ * @param task pointer to lv_task
+ */
+static void heap_insert(lv_task_t * task)
+{
+    task->sched_state = SCHED_HEAP;
+    task->heap_idx = heap_cnt;
+    LV_GC_ROOT(_lv_task_heap)[heap_cnt] = task;
+    heap_cnt++;
+    heap_sift_up(task->heap_idx);
+}
+
+/**
+ * Remove a task from the heap
+ * @param task pointer to lv_task which is in the heap
+ */
+static void heap_remove(lv_task_t * task)
+{
+    lv_task_t ** heap = LV_GC_ROOT(_lv_task_heap);
+    uint32_t i = task->heap_idx;
+
+    /*Fill the gap with the last task and restore the heap order*/
+    heap_cnt--;
+    if(i != heap_cnt) {
+        lv_task_t * moved = heap[heap_cnt];
+        heap[i] = moved;
+        moved->heap_idx = i;
+        heap_sift_up(i);
+        heap_sift_down(moved->heap_idx);
+    }
+}
+
+static void heap_sift_up(uint32_t i)
+{
+    lv_task_t ** heap = LV_GC_ROOT(_lv_task_heap);
+    lv_task_t * task = heap[i];
+    while(i > 0) {
+        uint32_t parent = (i - 1) / 2;
+        if(!deadline_less(task, heap[parent])) break;
+
+        heap[i] = heap[parent];
+        heap[i]->heap_idx = i;
+        i = parent;
+    }
+    heap[i] = task;
+    task->heap_idx = i;
+}
+
+static void heap_sift_down(uint32_t i)
+{
+    lv_task_t ** heap = LV_GC_ROOT(_lv_task_heap);
+    lv_task_t * task = heap[i];
+    while(1) {
+        uint32_t child = 2 * i + 1;
+        if(child >= heap_cnt) break;
+        if(child + 1 < heap_cnt && deadline_less(heap[child + 1], heap[child])) child++;
+        if(!deadline_less(heap[child], task)) break;
+
+        heap[i] = heap[child];
+        heap[i]->heap_idx = i;
+        i = child;
+    }
+    heap[i] = task;
+    task->heap_idx = i;
+}
+
+/**
+ * Compare the deadline of two tasks. The tick overflow is handled.
+ * @param t1 pointer to a lv_task
+ * @param t2 pointer to an other lv_task
+ * @return true: `t1` needs to run earlier than `t2`
+ */
+static inline bool deadline_less(const lv_task_t * t1, const lv_task_t * t2)
+{
+    uint32_t d1 = t1->last_run + t1->period;
+    uint32_t d2 = t2->last_run + t2->period;
+    return (int32_t)(d1 - d2) < 0;
+}
@@ -28,7 +28,7 @@ extern "C" {
 #define LV_ATTRIBUTE_TASK_HANDLER
 #endif
 
-#define LV_NO_TASK_READY 0xFFFFFFFF
+#define LV_NO_TASK_READY 0xFFFFFFFF   /*Returned by `lv_task_handler` if no task is scheduled*/
 /**********************
  *      TYPEDEFS
  **********************/
@@ -65,7 +65,12 @@ typedef struct _lv_task_t {
     void * user_data; /**< Custom user data */
 
     int32_t repeat_count; /**< 1: Task times;  -1 : infinity;  0 : stop ;  n>0: residual times */
+
+    struct _lv_task_t * sched_next; /**< Next task in the same ready queue (used internally by the scheduler)*/
+    uint32_t heap_idx; /**< Index in the deadline heap (used internally by the scheduler)*/
+
     uint8_t prio : 3; /**< Task priority */
+    uint8_t sched_state : 2; /**< Where the task is in the scheduler (used internally)*/
 } lv_task_t;
 
 /**********************
@@ -81,7 +86,8 @@ void _lv_task_core_init(void);
 
 /**
  * Call it periodically to handle lv_tasks.
- * @return time till it needs to be run next (in ms)
+ * @return time till it needs to be run next (in ms) or
+ *         `LV_NO_TASK_READY` if there is no scheduled task, i.e. it's enough to call it again after an event
  */
 LV_ATTRIBUTE_TASK_HANDLER uint32_t lv_task_handler(void);
 
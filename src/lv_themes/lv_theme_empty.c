@@ -10,8 +10,6 @@
 
 #if LV_USE_THEME_EMPTY
 
-#include "../lv_misc/lv_gc.h"
-
 /*********************
  *      DEFINES
  *********************/
@@ -19,9 +17,6 @@
 /**********************
  *      TYPEDEFS
  **********************/
-typedef struct {
-    lv_style_t opa_cover;
-} theme_styles_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -32,7 +27,13 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name);
  *  STATIC VARIABLES
  **********************/
 static lv_theme_t theme;
-static theme_styles_t * styles;
+
+/*The only style of the theme doesn't depend on the theme's parameters so it's constant and stays in ROM*/
+static const lv_style_const_prop_t opa_cover_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_opa_cover, opa_cover_props);
 
 /**********************
  *      MACROS
@@ -61,16 +62,6 @@ lv_theme_t * lv_theme_empty_init(lv_color_t color_primary, lv_color_t color_seco
                                  const lv_font_t * font_small, const lv_font_t * font_normal, const lv_font_t * font_subtitle,
                                  const lv_font_t * font_title)
 {
-    /* This trick is required only to avoid the garbage collection of
-     * styles' data if LVGL is used in a binding (e.g. Micropython)
-     * In a general case styles could be simple `static lv_style_t my style` variables*/
-    if(styles == NULL) {
-        styles = lv_mem_alloc(sizeof(theme_styles_t));
-        if(styles == NULL) return NULL;
-        _lv_memset_00(styles, sizeof(theme_styles_t));
-        LV_GC_ROOT(_lv_theme_empty_styles) = styles;
-    }
-
     theme.color_primary = color_primary;
     theme.color_secondary = color_secondary;
     theme.font_small = font_small;
@@ -79,9 +70,6 @@ lv_theme_t * lv_theme_empty_init(lv_color_t color_primary, lv_color_t color_seco
     theme.font_title = font_title;
     theme.flags = flags;
 
-    lv_style_reset(&styles->opa_cover);
-    lv_style_set_bg_opa(&styles->opa_cover, LV_STATE_DEFAULT, LV_OPA_COVER);
-
     theme.apply_xcb = NULL;
     theme.apply_cb = theme_apply;
     return &theme;
@@ -95,7 +83,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 {
     LV_UNUSED(th);
     if(name == LV_THEME_SCR) {
-        lv_obj_add_style(obj, LV_OBJ_PART_MAIN, &styles->opa_cover);
+        lv_obj_add_style(obj, LV_OBJ_PART_MAIN, &style_opa_cover);
         lv_obj_refresh_style(obj, LV_OBJ_PART_ALL, LV_STYLE_PROP_ALL);
     }
 }
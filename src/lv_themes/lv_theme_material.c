@@ -67,6 +67,93 @@
 
 #define PAD_DEF (lv_disp_get_size_category(NULL) <= LV_DISP_SIZE_MEDIUM ? LV_DPX(15) : (LV_DPX(30)))
 
+/*Compile-time versions of the values above for the constant style set.
+ *It's built from the defaults of `lv_conf.h` and used if `lv_theme_material_init` gets the same parameters.
+ *`LV_THEME_DEFAULT_COLOR_...` are function calls which can't be used in static initializers
+ *so their hex form (set by Kconfig or the default of `lv_conf_template.h`) is used instead.*/
+#ifdef CONFIG_LV_THEME_DEFAULT_COLOR_PRIMARY
+#define CONST_COLOR_PRIMARY     CONFIG_LV_THEME_DEFAULT_COLOR_PRIMARY
+#else
+#define CONST_COLOR_PRIMARY     0x01a2b1
+#endif
+
+#ifdef CONFIG_LV_THEME_DEFAULT_COLOR_SECONDARY
+#define CONST_COLOR_SECONDARY   CONFIG_LV_THEME_DEFAULT_COLOR_SECONDARY
+#else
+#define CONST_COLOR_SECONDARY   0x44d1b6
+#endif
+
+#define CONST_IS_LIGHT          (LV_THEME_DEFAULT_FLAG & LV_THEME_MATERIAL_FLAG_LIGHT)
+#define CONST_DPX(n)            ((n) == 0 ? 0 : LV_MATH_MAX((LV_DPI * (n) + 80) / 160, 1))
+#define CONST_SMALL_DISP        (LV_HOR_RES_MAX * 10 / LV_DPI < LV_DISP_MEDIUM_LIMIT)
+#define CONST_PAD_DEF           (CONST_SMALL_DISP ? CONST_DPX(15) : CONST_DPX(30))
+#define CONST_PAD_SMALL         (CONST_SMALL_DISP ? CONST_DPX(10) : CONST_DPX(20))
+#define CONST_BORDER_WIDTH      CONST_DPX(2)
+#define CONST_OUTLINE_WIDTH     CONST_DPX(2)
+#define CONST_STATE(s)          ((s) << LV_STYLE_STATE_POS)
+
+/*`lv_color_mix` on hex colors. Mix the channels on as many bits as the color depth has*/
+#if LV_COLOR_DEPTH == 1
+#define CONST_MIX(c1, c2, mix)  ((mix) > LV_OPA_50 ? (c1) : (c2))
+#else
+#if LV_COLOR_DEPTH == 8
+#define CONST_BITS_R    3
+#define CONST_BITS_G    3
+#define CONST_BITS_B    2
+#elif LV_COLOR_DEPTH == 16
+#define CONST_BITS_R    5
+#define CONST_BITS_G    6
+#define CONST_BITS_B    5
+#else
+#define CONST_BITS_R    8
+#define CONST_BITS_G    8
+#define CONST_BITS_B    8
+#endif
+#define CONST_MIX_CH(c1, c2, mix, bits) \
+    (LV_MATH_UDIV255(((c1) >> (8 - (bits))) * (mix) + ((c2) >> (8 - (bits))) * (255 - (mix)) + LV_COLOR_MIX_ROUND_OFS) << (8 - (bits)))
+#define CONST_MIX(c1, c2, mix) \
+    ((CONST_MIX_CH(((c1) >> 16) & 0xFF, ((c2) >> 16) & 0xFF, mix, CONST_BITS_R) << 16) | \
+     (CONST_MIX_CH(((c1) >> 8) & 0xFF, ((c2) >> 8) & 0xFF, mix, CONST_BITS_G) << 8) | \
+     CONST_MIX_CH((c1) & 0xFF, (c2) & 0xFF, mix, CONST_BITS_B))
+#endif
+
+#define CONST_DARKEN(c, lvl)    CONST_MIX(0x000000, c, lvl)
+#define CONST_LIGHTEN(c, lvl)   CONST_MIX(0xffffff, c, lvl)
+
+#define CONST_COLOR_SCR             (CONST_IS_LIGHT ? 0xeaeff3 : 0x444b5a)
+#define CONST_COLOR_SCR_TEXT        (CONST_IS_LIGHT ? 0x3b3e42 : 0xe7e9ec)
+
+#define CONST_COLOR_BTN             (CONST_IS_LIGHT ? 0xffffff : 0x586273)
+#define CONST_COLOR_BTN_PR          CONST_MIX(CONST_COLOR_PRIMARY, CONST_COLOR_BTN, CONST_IS_LIGHT ? LV_OPA_20 : LV_OPA_30)
+#define CONST_COLOR_BTN_CHK         CONST_COLOR_PRIMARY
+#define CONST_COLOR_BTN_CHK_PR      CONST_DARKEN(CONST_COLOR_PRIMARY, LV_OPA_30)
+#define CONST_COLOR_BTN_DIS         (CONST_IS_LIGHT ? 0xcccccc : 0x888888)
+#define CONST_COLOR_BTN_BORDER      CONST_COLOR_PRIMARY
+#define CONST_COLOR_BTN_BORDER_PR   CONST_COLOR_PRIMARY
+#define CONST_COLOR_BTN_BORDER_INA  (CONST_IS_LIGHT ? 0x888888 : 0x404040)
+
+#define CONST_COLOR_BG              (CONST_IS_LIGHT ? 0xffffff : 0x586273)
+#define CONST_COLOR_BG_PR           (CONST_IS_LIGHT ? 0xeeeeee : 0x494f57)
+#define CONST_COLOR_BG_CHK          CONST_COLOR_PRIMARY
+#define CONST_COLOR_BG_PR_CHK       CONST_DARKEN(CONST_COLOR_PRIMARY, LV_OPA_20)
+#define CONST_COLOR_BG_DIS          CONST_COLOR_BG
+
+#define CONST_COLOR_BG_BORDER           (CONST_IS_LIGHT ? 0xd6dde3 : 0x808a97)
+#define CONST_COLOR_BG_BORDER_PR        (CONST_IS_LIGHT ? 0xcccccc : 0x5f656e)
+#define CONST_COLOR_BG_BORDER_CHK       (CONST_IS_LIGHT ? 0x3b3e42 : 0x5f656e)
+#define CONST_COLOR_BG_BORDER_CHK_PR    (CONST_IS_LIGHT ? 0x3b3e42 : 0x5f656e)
+#define CONST_COLOR_BG_BORDER_DIS       (CONST_IS_LIGHT ? 0xd6dde3 : 0x5f656e)
+
+#define CONST_COLOR_BG_TEXT         (CONST_IS_LIGHT ? 0x3b3e42 : 0xffffff)
+#define CONST_COLOR_BG_TEXT_PR      (CONST_IS_LIGHT ? 0x3b3e42 : 0xffffff)
+#define CONST_COLOR_BG_TEXT_CHK     0xffffff
+#define CONST_COLOR_BG_TEXT_CHK_PR  0xffffff
+#define CONST_COLOR_BG_TEXT_DIS     (CONST_IS_LIGHT ? 0xaaaaaa : 0x999999)
+
+#define CONST_COLOR_BG_SEC          (CONST_IS_LIGHT ? 0xd4d7d9 : 0x45494d)
+#define CONST_COLOR_BG_SEC_BORDER   (CONST_IS_LIGHT ? 0xdfe7ed : 0x404040)
+#define CONST_COLOR_BG_SEC_TEXT     (CONST_IS_LIGHT ? 0x31404f : 0xa5a8ad)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -82,11 +169,6 @@ typedef struct {
 #if LV_USE_ARC
     lv_style_t arc_indic;
     lv_style_t arc_bg;
-    lv_style_t arc_knob;
-#endif
-
-#if LV_USE_LINE
-    lv_style_t line;
 #endif
 
 #if LV_USE_BAR
@@ -131,7 +213,7 @@ typedef struct {
 #endif
 
 #if LV_USE_LIST
-    lv_style_t list_bg, list_btn;
+    lv_style_t list_btn;
 #endif
 
 #if LV_USE_MSGBOX
@@ -140,9 +222,6 @@ typedef struct {
 
 #if LV_USE_PAGE
     lv_style_t sb;
-#if LV_USE_ANIMATION
-    lv_style_t edge_flash;
-#endif
 #endif
 
 #if LV_USE_ROLLER
@@ -179,12 +258,774 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name);
+static bool const_styles_usable(lv_color_t color_primary, lv_color_t color_secondary, uint32_t flags,
+                                const lv_font_t * font_small, const lv_font_t * font_normal, const lv_font_t * font_subtitle,
+                                const lv_font_t * font_title);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static lv_theme_t theme;
 static theme_styles_t * styles;
+static const theme_styles_t * act_styles;   /*`&const_styles` or `styles`*/
+
+/*Styles which don't depend on the theme's parameters are constant and stay in ROM.
+ *The others use the colors, fonts and flags of the theme or the DPI of the display (`LV_DPX`).
+ *They are in ROM too (`const_styles`) if the theme is initialized with the defaults of `lv_conf.h`
+ *else they are built at run time in the `..._init()` functions*/
+#if LV_USE_LINE
+static const lv_style_const_prop_t line_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, 1),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_line, line_props);
+#endif
+
+#if LV_USE_LIST
+static const lv_style_const_prop_t list_bg_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_CLIP_CORNER, true),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, 0),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_list_bg, list_bg_props);
+#endif
+
+#if LV_USE_PAGE && LV_USE_ANIMATION
+static const lv_style_const_prop_t edge_flash_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, 0x888888),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_edge_flash, edge_flash_props);
+#endif
+
+#if LV_USE_ARC
+static const lv_style_const_prop_t arc_knob_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, 0),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_arc_knob, arc_knob_props);
+#endif
+
+static const lv_style_const_prop_t scr_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_SCR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, CONST_COLOR_SCR_TEXT),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_VALUE_COLOR, CONST_COLOR_SCR_TEXT),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_SEL_COLOR, CONST_COLOR_SCR_TEXT),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_SEL_BG_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_PTR(LV_STYLE_VALUE_FONT, LV_THEME_DEFAULT_FONT_NORMAL),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t bg_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, CONST_DPX(8)),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_BG),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR, CONST_COLOR_BG_BORDER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_FOCUSED), CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_EDITED), CONST_COLOR_SECONDARY),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_WIDTH, CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_POST, true),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, CONST_COLOR_BG_TEXT),
+    LV_STYLE_CONST_PTR(LV_STYLE_VALUE_FONT, LV_THEME_DEFAULT_FONT_NORMAL),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_VALUE_COLOR, CONST_COLOR_BG_TEXT),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR, CONST_COLOR_BG_TEXT),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_LINE_COLOR, CONST_COLOR_BG_TEXT),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, 1),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_PAD_DEF + CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_PAD_DEF + CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_PAD_DEF + CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_PAD_DEF + CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_TIME, TRANSITION_TIME),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_PROP_6, LV_STYLE_BORDER_COLOR),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t bg_sec_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, CONST_DPX(8)),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_BG_SEC),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR, CONST_COLOR_BG_SEC_BORDER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_FOCUSED), CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_EDITED), CONST_COLOR_SECONDARY),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_WIDTH, CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_POST, true),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, CONST_COLOR_BG_SEC_TEXT),
+    LV_STYLE_CONST_PTR(LV_STYLE_VALUE_FONT, LV_THEME_DEFAULT_FONT_NORMAL),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_VALUE_COLOR, CONST_COLOR_BG_SEC_TEXT),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR, CONST_COLOR_BG_SEC_TEXT),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_LINE_COLOR, CONST_COLOR_BG_SEC_TEXT),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, 1),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_PAD_DEF + CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_PAD_DEF + CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_PAD_DEF + CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_PAD_DEF + CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_TIME, TRANSITION_TIME),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_PROP_6, LV_STYLE_BORDER_COLOR),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t bg_click_props[] = {
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_PRESSED), CONST_COLOR_BG_PR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_CHECKED), CONST_COLOR_BG_CHK),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_PRESSED | LV_STATE_CHECKED), CONST_COLOR_BG_PR_CHK),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_DISABLED), CONST_COLOR_BG_DIS),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_WIDTH | CONST_STATE(LV_STATE_CHECKED), 0),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_FOCUSED | LV_STATE_PRESSED), CONST_DARKEN(CONST_COLOR_PRIMARY, LV_OPA_20)),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_PRESSED), CONST_COLOR_BG_BORDER_PR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_CHECKED), CONST_COLOR_BG_BORDER_CHK),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_PRESSED | LV_STATE_CHECKED), CONST_COLOR_BG_BORDER_CHK_PR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_DISABLED), CONST_COLOR_BG_BORDER_DIS),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_PRESSED), CONST_COLOR_BG_TEXT_PR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_CHECKED), CONST_COLOR_BG_TEXT_CHK),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_PRESSED | LV_STATE_CHECKED), CONST_COLOR_BG_TEXT_CHK_PR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_DISABLED), CONST_COLOR_BG_TEXT_DIS),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR | CONST_STATE(LV_STATE_PRESSED), CONST_COLOR_BG_TEXT_PR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR | CONST_STATE(LV_STATE_CHECKED), CONST_COLOR_BG_TEXT_CHK),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR | CONST_STATE(LV_STATE_PRESSED | LV_STATE_CHECKED), CONST_COLOR_BG_TEXT_CHK_PR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR | CONST_STATE(LV_STATE_DISABLED), CONST_COLOR_BG_TEXT_DIS),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_PROP_5, LV_STYLE_BG_COLOR),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t btn_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_BTN),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_PRESSED), CONST_COLOR_BTN_PR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_CHECKED), CONST_COLOR_BTN_CHK),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_CHECKED | LV_STATE_PRESSED), CONST_COLOR_BTN_CHK_PR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_DISABLED), CONST_COLOR_BTN),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_DISABLED | LV_STATE_CHECKED), CONST_COLOR_BTN_DIS),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR, CONST_COLOR_BTN_BORDER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_PRESSED), CONST_COLOR_BTN_BORDER_PR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_DISABLED), CONST_COLOR_BTN_BORDER_INA),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_WIDTH, CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_OPA(LV_STYLE_BORDER_OPA | CONST_STATE(LV_STATE_CHECKED), LV_OPA_TRANSP),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, CONST_IS_LIGHT ? 0x31404f : 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_PRESSED), CONST_IS_LIGHT ? 0x31404f : 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_CHECKED), 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_CHECKED | LV_STATE_PRESSED), 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_DISABLED), 0x888888),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR, CONST_IS_LIGHT ? 0x31404f : 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR | CONST_STATE(LV_STATE_PRESSED), 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR | CONST_STATE(LV_STATE_CHECKED | LV_STATE_PRESSED), 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR | CONST_STATE(LV_STATE_DISABLED), 0x888888),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_VALUE_COLOR, CONST_IS_LIGHT ? 0x31404f : 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_VALUE_COLOR | CONST_STATE(LV_STATE_PRESSED), CONST_IS_LIGHT ? 0x31404f : 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_VALUE_COLOR | CONST_STATE(LV_STATE_CHECKED), 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_VALUE_COLOR | CONST_STATE(LV_STATE_CHECKED | LV_STATE_PRESSED), 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_VALUE_COLOR | CONST_STATE(LV_STATE_DISABLED), 0x888888),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_DPX(40)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_DPX(40)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_DPX(15)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_DPX(15)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_DPX(20)),
+    LV_STYLE_CONST_INT(LV_STYLE_OUTLINE_WIDTH, CONST_OUTLINE_WIDTH),
+    LV_STYLE_CONST_OPA(LV_STYLE_OUTLINE_OPA, LV_OPA_0),
+    LV_STYLE_CONST_OPA(LV_STYLE_OUTLINE_OPA | CONST_STATE(LV_STATE_FOCUSED), LV_OPA_50),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_OUTLINE_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_OUTLINE_COLOR | CONST_STATE(LV_STATE_EDITED), CONST_COLOR_SECONDARY),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_TIME, TRANSITION_TIME),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_PROP_4, LV_STYLE_BORDER_OPA),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_PROP_5, LV_STYLE_BG_COLOR),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_PROP_6, LV_STYLE_OUTLINE_OPA),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_DELAY, TRANSITION_TIME),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_DELAY | CONST_STATE(LV_STATE_PRESSED), 0),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t pad_inner_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_SMALL_DISP ? CONST_DPX(20) : CONST_DPX(40)),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t pad_small_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_PAD_SMALL),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_PAD_SMALL),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_PAD_SMALL),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_PAD_SMALL),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_PAD_SMALL),
+    LV_STYLE_CONST_END
+};
+
+#if LV_USE_BAR
+static const lv_style_const_prop_t bar_bg_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_BG_SEC),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_VALUE_COLOR, CONST_IS_LIGHT ? 0x31404f : 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_OUTLINE_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_OUTLINE_COLOR | CONST_STATE(LV_STATE_EDITED), CONST_COLOR_SECONDARY),
+    LV_STYLE_CONST_OPA(LV_STYLE_OUTLINE_OPA, LV_OPA_TRANSP),
+    LV_STYLE_CONST_OPA(LV_STYLE_OUTLINE_OPA | CONST_STATE(LV_STATE_FOCUSED), LV_OPA_50),
+    LV_STYLE_CONST_INT(LV_STYLE_OUTLINE_WIDTH, CONST_OUTLINE_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_TIME, TRANSITION_TIME),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_PROP_6, LV_STYLE_OUTLINE_OPA),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t bar_indic_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_DISABLED), 0x888888),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_VALUE_COLOR, CONST_IS_LIGHT ? 0x41404f : 0xffffff),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_LED
+static const lv_style_const_prop_t led_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_WIDTH, 2),
+    LV_STYLE_CONST_OPA(LV_STYLE_BORDER_OPA, LV_OPA_50),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR, CONST_LIGHTEN(CONST_COLOR_PRIMARY, LV_OPA_30)),
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_INT(LV_STYLE_SHADOW_WIDTH, CONST_DPX(15)),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_SHADOW_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_INT(LV_STYLE_SHADOW_SPREAD, CONST_DPX(5)),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_SLIDER
+static const lv_style_const_prop_t slider_knob_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_IS_LIGHT ? CONST_COLOR_PRIMARY : 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_VALUE_COLOR, CONST_IS_LIGHT ? 0x31404f : 0xffffff),
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_DPX(7)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_DPX(7)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_DPX(7)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_DPX(7)),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t slider_bg_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_MARGIN_LEFT, CONST_DPX(10)),
+    LV_STYLE_CONST_INT(LV_STYLE_MARGIN_RIGHT, CONST_DPX(10)),
+    LV_STYLE_CONST_INT(LV_STYLE_MARGIN_TOP, CONST_DPX(10)),
+    LV_STYLE_CONST_INT(LV_STYLE_MARGIN_BOTTOM, CONST_DPX(10)),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_SWITCH
+static const lv_style_const_prop_t sw_knob_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, 0xffffff),
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, -CONST_DPX(4)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, -CONST_DPX(4)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, -CONST_DPX(4)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, -CONST_DPX(4)),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_LINEMETER
+static const lv_style_const_prop_t lmeter_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_DPX(20)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_DPX(20)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_DPX(20)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_DPX(30)),
+    LV_STYLE_CONST_INT(LV_STYLE_SCALE_WIDTH, CONST_DPX(25)),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_LINE_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_SCALE_GRAD_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_SCALE_END_COLOR, 0x888888),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, CONST_DPX(10)),
+    LV_STYLE_CONST_INT(LV_STYLE_SCALE_END_LINE_WIDTH, CONST_DPX(7)),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_GAUGE
+static const lv_style_const_prop_t gauge_main_props[] = {
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_LINE_COLOR, 0x888888),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_SCALE_GRAD_COLOR, 0x888888),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_SCALE_END_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, CONST_DPX(5)),
+    LV_STYLE_CONST_INT(LV_STYLE_SCALE_END_LINE_WIDTH, CONST_DPX(4)),
+    LV_STYLE_CONST_INT(LV_STYLE_SCALE_END_BORDER_WIDTH, CONST_DPX(8)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_DPX(20)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_DPX(20)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_DPX(20)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_DPX(20)),
+    LV_STYLE_CONST_INT(LV_STYLE_SCALE_WIDTH, CONST_DPX(15)),
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t gauge_strong_props[] = {
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_LINE_COLOR, 0x888888),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_SCALE_GRAD_COLOR, 0x888888),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_SCALE_END_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, CONST_DPX(8)),
+    LV_STYLE_CONST_INT(LV_STYLE_SCALE_END_LINE_WIDTH, CONST_DPX(8)),
+    LV_STYLE_CONST_INT(LV_STYLE_SCALE_WIDTH, CONST_DPX(25)),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t gauge_needle_props[] = {
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_LINE_COLOR, CONST_IS_LIGHT ? 0x464b5b : 0xffffff),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, CONST_DPX(8)),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_IS_LIGHT ? 0x464b5b : 0xffffff),
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_INT(LV_STYLE_SIZE, CONST_DPX(30)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_DPX(10)),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_ARC
+static const lv_style_const_prop_t arc_indic_props[] = {
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_LINE_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, CONST_DPX(25)),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_ROUNDED, true),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t arc_bg_props[] = {
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_LINE_COLOR, CONST_COLOR_BG_SEC),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, CONST_DPX(25)),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_ROUNDED, true),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_CHART
+static const lv_style_const_prop_t chart_bg_props[] = {
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, CONST_IS_LIGHT ? CONST_COLOR_BG_TEXT_DIS : 0xa1adbd),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t chart_series_bg_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, CONST_DPX(1)),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_DASH_WIDTH, CONST_DPX(10)),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_DASH_GAP, CONST_DPX(10)),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_LINE_COLOR, CONST_COLOR_BG_BORDER),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t chart_series_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, CONST_DPX(3)),
+    LV_STYLE_CONST_INT(LV_STYLE_SIZE, CONST_DPX(4)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_DPX(2)),
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, CONST_DPX(1)),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_CALENDAR
+static const lv_style_const_prop_t calendar_header_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_MARGIN_TOP, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_MARGIN_BOTTOM, CONST_PAD_DEF),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_PRESSED), CONST_IS_LIGHT ? 0x888888 : 0xffffff),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t calendar_daynames_props[] = {
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, CONST_IS_LIGHT ? 0x31404f : 0xeeeeee),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_PAD_DEF),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t calendar_date_nums_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, CONST_DPX(4)),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_CHECKED), CONST_IS_LIGHT ? 0x31404f : 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_DISABLED), 0x808080),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA | CONST_STATE(LV_STATE_CHECKED), CONST_IS_LIGHT ? LV_OPA_20 : LV_OPA_40),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA | CONST_STATE(LV_STATE_PRESSED), LV_OPA_20),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA | CONST_STATE(LV_STATE_FOCUSED), LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_FOCUSED), 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_FOCUSED), CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_IS_LIGHT ? 0x666666 : 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_CHECKED), CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_WIDTH | CONST_STATE(LV_STATE_CHECKED), 2),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_SIDE | CONST_STATE(LV_STATE_CHECKED), LV_BORDER_SIDE_LEFT),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_CHECKED), CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_DPX(3)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_PAD_DEF),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_CPICKER
+static const lv_style_const_prop_t cpicker_bg_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_SCALE_WIDTH, CONST_DPX(30)),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_SCR),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_DPX(20)),
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t cpicker_indic_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, 0xffffff),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_WIDTH, 2),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR, 0x808080),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_FOCUSED), CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_EDITED), CONST_COLOR_SECONDARY),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_DPX(13)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_DPX(13)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_DPX(13)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_DPX(13)),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_CHECKBOX
+static const lv_style_const_prop_t cb_bg_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, CONST_DPX(4)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_DPX(10)),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_OUTLINE_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_OPA(LV_STYLE_OUTLINE_OPA, LV_OPA_TRANSP),
+    LV_STYLE_CONST_OPA(LV_STYLE_OUTLINE_OPA | CONST_STATE(LV_STATE_FOCUSED), LV_OPA_50),
+    LV_STYLE_CONST_INT(LV_STYLE_OUTLINE_WIDTH, CONST_OUTLINE_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_OUTLINE_PAD, CONST_DPX(10)),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_TIME, TRANSITION_TIME),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_PROP_6, LV_STYLE_OUTLINE_OPA),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t cb_bullet_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_OUTLINE_OPA | CONST_STATE(LV_STATE_FOCUSED), LV_OPA_TRANSP),
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, CONST_DPX(4)),
+    LV_STYLE_CONST_PTR(LV_STYLE_PATTERN_IMAGE | CONST_STATE(LV_STATE_CHECKED), LV_SYMBOL_OK),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_PATTERN_RECOLOR | CONST_STATE(LV_STATE_CHECKED), 0xffffff),
+    LV_STYLE_CONST_OPA(LV_STYLE_PATTERN_OPA, LV_OPA_TRANSP),
+    LV_STYLE_CONST_OPA(LV_STYLE_PATTERN_OPA | CONST_STATE(LV_STATE_CHECKED), LV_OPA_COVER),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_PROP_3, LV_STYLE_PATTERN_OPA),
+    LV_STYLE_CONST_PTR(LV_STYLE_TEXT_FONT | CONST_STATE(LV_STATE_CHECKED), LV_THEME_DEFAULT_FONT_SMALL),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_DPX(3)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_DPX(3)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_DPX(3)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_DPX(3)),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_KEYBOARD
+static const lv_style_const_prop_t kb_bg_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_WIDTH, CONST_DPX(4)),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_SIDE, LV_BORDER_SIDE_TOP),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR, CONST_IS_LIGHT ? CONST_COLOR_BG_TEXT : 0x000000),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_EDITED), CONST_COLOR_SECONDARY),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_DPX(5)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_DPX(5)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_DPX(5)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_DPX(5)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_DPX(3)),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_MSGBOX
+static const lv_style_const_prop_t mbox_bg_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_SHADOW_WIDTH, CONST_DPX(50)),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_SHADOW_COLOR, CONST_IS_LIGHT ? 0xc0c0c0 : 0x999999),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_PAGE
+static const lv_style_const_prop_t sb_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_IS_LIGHT ? 0xcccfd1 : 0x777f85),
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_INT(LV_STYLE_SIZE, CONST_DPX(7)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_DPX(7)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_DPX(7)),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_TEXTAREA
+static const lv_style_const_prop_t ta_cursor_props[] = {
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR, CONST_COLOR_BG_SEC_TEXT),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_WIDTH, CONST_DPX(2)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_DPX(1)),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_SIDE, LV_BORDER_SIDE_LEFT),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t ta_placeholder_props[] = {
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, CONST_IS_LIGHT ? CONST_COLOR_BG_TEXT_DIS : 0xa1adbd),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_SPINBOX
+static const lv_style_const_prop_t spinbox_cursor_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, 0xffffff),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_DPX(100)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_DPX(100)),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_LIST
+static const lv_style_const_prop_t list_btn_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_BG),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_PRESSED), CONST_COLOR_BG_PR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_DISABLED), CONST_COLOR_BG_DIS),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_CHECKED), CONST_COLOR_BG_CHK),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_CHECKED | LV_STATE_PRESSED), CONST_COLOR_BG_PR_CHK),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, CONST_COLOR_BG_TEXT),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_CHECKED), CONST_COLOR_BG_TEXT_CHK),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_DISABLED), CONST_COLOR_BG_TEXT_DIS),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR, CONST_COLOR_BG_TEXT),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR | CONST_STATE(LV_STATE_CHECKED), CONST_COLOR_BG_TEXT_CHK),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR | CONST_STATE(LV_STATE_DISABLED), CONST_COLOR_BG_TEXT_DIS),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_SIDE, LV_BORDER_SIDE_BOTTOM),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR, CONST_COLOR_BG_BORDER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR | CONST_STATE(LV_STATE_FOCUSED), CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_WIDTH, 1),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_OUTLINE_COLOR | CONST_STATE(LV_STATE_FOCUSED), CONST_COLOR_SECONDARY),
+    LV_STYLE_CONST_INT(LV_STYLE_OUTLINE_WIDTH | CONST_STATE(LV_STATE_FOCUSED), CONST_OUTLINE_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_OUTLINE_PAD | CONST_STATE(LV_STATE_FOCUSED), -CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSFORM_WIDTH, -CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSFORM_WIDTH | CONST_STATE(LV_STATE_PRESSED), -CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSFORM_WIDTH | CONST_STATE(LV_STATE_CHECKED), -CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSFORM_WIDTH | CONST_STATE(LV_STATE_DISABLED), -CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSFORM_WIDTH | CONST_STATE(LV_STATE_FOCUSED), -CONST_BORDER_WIDTH),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_TIME, TRANSITION_TIME),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_PROP_6, LV_STYLE_BG_COLOR),
+    LV_STYLE_CONST_INT(LV_STYLE_TRANSITION_PROP_5, LV_STYLE_TRANSFORM_WIDTH),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_DROPDOWN
+static const lv_style_const_prop_t ddlist_page_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_TEXT_LINE_SPACE, CONST_DPX(20)),
+    LV_STYLE_CONST_INT(LV_STYLE_CLIP_CORNER, true),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t ddlist_sel_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, 0xffffff),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_PRESSED), CONST_COLOR_BG_PR),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_PRESSED), CONST_COLOR_BG_TEXT_PR),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_ROLLER
+static const lv_style_const_prop_t roller_bg_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_TEXT_LINE_SPACE, CONST_DPX(25)),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t roller_sel_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, 0xffffff),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_TABLE
+static const lv_style_const_prop_t table_cell_props[] = {
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BORDER_COLOR, CONST_COLOR_BG_BORDER),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_WIDTH, 1),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_SIDE, LV_BORDER_SIDE_TOP | LV_BORDER_SIDE_BOTTOM),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_PAD_DEF),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+#if LV_USE_TABVIEW || LV_USE_WIN
+static const lv_style_const_prop_t tabview_btns_bg_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_BG),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, CONST_COLOR_SCR_TEXT),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_IMAGE_RECOLOR, 0x979a9f),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_DPX(7)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_DPX(7)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_DPX(7)),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t tabview_btns_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA | CONST_STATE(LV_STATE_PRESSED), LV_OPA_50),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_PRESSED), 0x888888),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_CHECKED), CONST_COLOR_SCR_TEXT),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_DPX(20)),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_DPX(20)),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_FOCUSED), CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR | CONST_STATE(LV_STATE_EDITED), CONST_COLOR_SECONDARY),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t tabview_indic_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_COVER),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, CONST_COLOR_PRIMARY),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | CONST_STATE(LV_STATE_EDITED), CONST_COLOR_SECONDARY),
+    LV_STYLE_CONST_INT(LV_STYLE_SIZE, CONST_DPX(5)),
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_END
+};
+
+static const lv_style_const_prop_t tabview_page_scrl_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, CONST_PAD_DEF),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, CONST_PAD_DEF),
+    LV_STYLE_CONST_END
+};
+
+#endif
+
+static const theme_styles_t const_styles = {
+    .scr = LV_STYLE_CONST_INITIALIZER(scr_props),
+    .bg = LV_STYLE_CONST_INITIALIZER(bg_props),
+    .bg_sec = LV_STYLE_CONST_INITIALIZER(bg_sec_props),
+    .bg_click = LV_STYLE_CONST_INITIALIZER(bg_click_props),
+    .btn = LV_STYLE_CONST_INITIALIZER(btn_props),
+    .pad_inner = LV_STYLE_CONST_INITIALIZER(pad_inner_props),
+    .pad_small = LV_STYLE_CONST_INITIALIZER(pad_small_props),
+#if LV_USE_BAR
+    .bar_bg = LV_STYLE_CONST_INITIALIZER(bar_bg_props),
+    .bar_indic = LV_STYLE_CONST_INITIALIZER(bar_indic_props),
+#endif
+#if LV_USE_LED
+    .led = LV_STYLE_CONST_INITIALIZER(led_props),
+#endif
+#if LV_USE_SLIDER
+    .slider_knob = LV_STYLE_CONST_INITIALIZER(slider_knob_props),
+    .slider_bg = LV_STYLE_CONST_INITIALIZER(slider_bg_props),
+#endif
+#if LV_USE_SWITCH
+    .sw_knob = LV_STYLE_CONST_INITIALIZER(sw_knob_props),
+#endif
+#if LV_USE_LINEMETER
+    .lmeter = LV_STYLE_CONST_INITIALIZER(lmeter_props),
+#endif
+#if LV_USE_GAUGE
+    .gauge_main = LV_STYLE_CONST_INITIALIZER(gauge_main_props),
+    .gauge_strong = LV_STYLE_CONST_INITIALIZER(gauge_strong_props),
+    .gauge_needle = LV_STYLE_CONST_INITIALIZER(gauge_needle_props),
+#endif
+#if LV_USE_ARC
+    .arc_indic = LV_STYLE_CONST_INITIALIZER(arc_indic_props),
+    .arc_bg = LV_STYLE_CONST_INITIALIZER(arc_bg_props),
+#endif
+#if LV_USE_CHART
+    .chart_bg = LV_STYLE_CONST_INITIALIZER(chart_bg_props),
+    .chart_series_bg = LV_STYLE_CONST_INITIALIZER(chart_series_bg_props),
+    .chart_series = LV_STYLE_CONST_INITIALIZER(chart_series_props),
+#endif
+#if LV_USE_CALENDAR
+    .calendar_header = LV_STYLE_CONST_INITIALIZER(calendar_header_props),
+    .calendar_daynames = LV_STYLE_CONST_INITIALIZER(calendar_daynames_props),
+    .calendar_date_nums = LV_STYLE_CONST_INITIALIZER(calendar_date_nums_props),
+#endif
+#if LV_USE_CPICKER
+    .cpicker_bg = LV_STYLE_CONST_INITIALIZER(cpicker_bg_props),
+    .cpicker_indic = LV_STYLE_CONST_INITIALIZER(cpicker_indic_props),
+#endif
+#if LV_USE_CHECKBOX
+    .cb_bg = LV_STYLE_CONST_INITIALIZER(cb_bg_props),
+    .cb_bullet = LV_STYLE_CONST_INITIALIZER(cb_bullet_props),
+#endif
+#if LV_USE_KEYBOARD
+    .kb_bg = LV_STYLE_CONST_INITIALIZER(kb_bg_props),
+#endif
+#if LV_USE_MSGBOX
+    .mbox_bg = LV_STYLE_CONST_INITIALIZER(mbox_bg_props),
+#endif
+#if LV_USE_PAGE
+    .sb = LV_STYLE_CONST_INITIALIZER(sb_props),
+#endif
+#if LV_USE_TEXTAREA
+    .ta_cursor = LV_STYLE_CONST_INITIALIZER(ta_cursor_props),
+    .ta_placeholder = LV_STYLE_CONST_INITIALIZER(ta_placeholder_props),
+#endif
+#if LV_USE_SPINBOX
+    .spinbox_cursor = LV_STYLE_CONST_INITIALIZER(spinbox_cursor_props),
+#endif
+#if LV_USE_LIST
+    .list_btn = LV_STYLE_CONST_INITIALIZER(list_btn_props),
+#endif
+#if LV_USE_DROPDOWN
+    .ddlist_page = LV_STYLE_CONST_INITIALIZER(ddlist_page_props),
+    .ddlist_sel = LV_STYLE_CONST_INITIALIZER(ddlist_sel_props),
+#endif
+#if LV_USE_ROLLER
+    .roller_bg = LV_STYLE_CONST_INITIALIZER(roller_bg_props),
+    .roller_sel = LV_STYLE_CONST_INITIALIZER(roller_sel_props),
+#endif
+#if LV_USE_TABLE
+    .table_cell = LV_STYLE_CONST_INITIALIZER(table_cell_props),
+#endif
+#if LV_USE_TABVIEW || LV_USE_WIN
+    .tabview_btns_bg = LV_STYLE_CONST_INITIALIZER(tabview_btns_bg_props),
+    .tabview_btns = LV_STYLE_CONST_INITIALIZER(tabview_btns_props),
+    .tabview_indic = LV_STYLE_CONST_INITIALIZER(tabview_indic_props),
+    .tabview_page_scrl = LV_STYLE_CONST_INITIALIZER(tabview_page_scrl_props),
+#endif
+};
 
 /**********************
  *      MACROS
@@ -324,27 +1165,6 @@ static void basic_init(void)
     lv_style_set_pad_inner(&styles->pad_small, LV_STATE_DEFAULT, pad_small_value);
 }
 
-static void cont_init(void)
-{
-#if LV_USE_CONT != 0
-
-#endif
-}
-
-static void btn_init(void)
-{
-#if LV_USE_BTN != 0
-
-#endif
-}
-
-static void label_init(void)
-{
-#if LV_USE_LABEL != 0
-
-#endif
-}
-
 static void bar_init(void)
 {
 #if LV_USE_BAR
@@ -370,22 +1190,6 @@ static void bar_init(void)
 #endif
 }
 
-static void img_init(void)
-{
-#if LV_USE_IMG != 0
-
-#endif
-}
-
-static void line_init(void)
-{
-#if LV_USE_LINE != 0
-    lv_style_reset(&styles->line);
-    lv_style_set_line_width(&styles->line, LV_STATE_DEFAULT, 1);
-
-#endif
-}
-
 static void led_init(void)
 {
 #if LV_USE_LED != 0
@@ -505,20 +1309,6 @@ static void arc_init(void)
     lv_style_set_line_color(&styles->arc_bg, LV_STATE_DEFAULT, COLOR_BG_SEC);
     lv_style_set_line_width(&styles->arc_bg, LV_STATE_DEFAULT, LV_DPX(25));
     lv_style_set_line_rounded(&styles->arc_bg, LV_STATE_DEFAULT, true);
-
-    lv_style_reset(&styles->arc_knob);
-    lv_style_set_radius(&styles->arc_knob, LV_STATE_DEFAULT,   LV_RADIUS_CIRCLE);
-    lv_style_set_pad_top(&styles->arc_knob, LV_STATE_DEFAULT,  LV_DPX(0));
-    lv_style_set_pad_bottom(&styles->arc_knob, LV_STATE_DEFAULT,  LV_DPX(0));
-    lv_style_set_pad_left(&styles->arc_knob, LV_STATE_DEFAULT,    LV_DPX(0));
-    lv_style_set_pad_right(&styles->arc_knob, LV_STATE_DEFAULT,   LV_DPX(0));
-
-#endif
-}
-
-static void spinner_init(void)
-{
-#if LV_USE_SPINNER != 0
 #endif
 }
 
@@ -641,10 +1431,6 @@ static void checkbox_init(void)
 #endif
 }
 
-static void btnmatrix_init(void)
-{
-}
-
 static void keyboard_init(void)
 {
 #if LV_USE_KEYBOARD
@@ -682,12 +1468,6 @@ static void page_init(void)
     lv_style_set_size(&styles->sb, LV_STATE_DEFAULT, LV_DPX(7));
     lv_style_set_pad_right(&styles->sb, LV_STATE_DEFAULT,  LV_DPX(7));
     lv_style_set_pad_bottom(&styles->sb, LV_STATE_DEFAULT,  LV_DPX(7));
-
-#if LV_USE_ANIMATION
-    lv_style_reset(&styles->edge_flash);
-    lv_style_set_bg_opa(&styles->edge_flash, LV_STATE_DEFAULT, LV_OPA_COVER);
-    lv_style_set_bg_color(&styles->edge_flash, LV_STATE_DEFAULT,  lv_color_hex3(0x888));
-#endif
 #endif
 }
 
@@ -723,14 +1503,6 @@ static void spinbox_init(void)
 static void list_init(void)
 {
 #if LV_USE_LIST != 0
-    lv_style_reset(&styles->list_bg);
-    lv_style_set_clip_corner(&styles->list_bg, LV_STATE_DEFAULT, true);
-    lv_style_set_pad_left(&styles->list_bg, LV_STATE_DEFAULT, 0);
-    lv_style_set_pad_right(&styles->list_bg, LV_STATE_DEFAULT, 0);
-    lv_style_set_pad_top(&styles->list_bg, LV_STATE_DEFAULT, 0);
-    lv_style_set_pad_bottom(&styles->list_bg, LV_STATE_DEFAULT, 0);
-    lv_style_set_pad_inner(&styles->list_bg, LV_STATE_DEFAULT, 0);
-
     lv_style_reset(&styles->list_btn);
     lv_style_set_bg_opa(&styles->list_btn, LV_STATE_DEFAULT, LV_OPA_COVER);
     lv_style_set_bg_color(&styles->list_btn, LV_STATE_DEFAULT, COLOR_BG);
@@ -804,18 +1576,6 @@ static void roller_init(void)
 #endif
 }
 
-static void tabview_init(void)
-{
-#if LV_USE_TABVIEW != 0
-#endif
-}
-
-static void tileview_init(void)
-{
-#if LV_USE_TILEVIEW != 0
-#endif
-}
-
 static void table_init(void)
 {
 #if LV_USE_TABLE != 0
@@ -831,12 +1591,6 @@ static void table_init(void)
 #endif
 }
 
-static void win_init(void)
-{
-#if LV_USE_WIN != 0
-#endif
-}
-
 static void tabview_win_shared_init(void)
 {
 #if LV_USE_TABVIEW || LV_USE_WIN
@@ -893,6 +1647,22 @@ lv_theme_t * lv_theme_material_init(lv_color_t color_primary, lv_color_t color_s
                                     const lv_font_t * font_small, const lv_font_t * font_normal, const lv_font_t * font_subtitle,
                                     const lv_font_t * font_title)
 {
+    theme.color_primary = color_primary;
+    theme.color_secondary = color_secondary;
+    theme.font_small = font_small;
+    theme.font_normal = font_normal;
+    theme.font_subtitle = font_subtitle;
+    theme.font_title = font_title;
+    theme.flags = flags;
+
+    theme.apply_xcb = NULL;
+    theme.apply_cb = theme_apply;
+
+    /*With the defaults of `lv_conf.h` the styles are already in ROM. Nothing to build or allocate.*/
+    if(const_styles_usable(color_primary, color_secondary, flags, font_small, font_normal, font_subtitle, font_title)) {
+        act_styles = &const_styles;
+        return &theme;
+    }
 
     /* This trick is required only to avoid the garbage collection of
      * styles' data if LVGL is used in a binding (e.g. Micropython)
@@ -904,33 +1674,18 @@ lv_theme_t * lv_theme_material_init(lv_color_t color_primary, lv_color_t color_s
         LV_GC_ROOT(_lv_theme_material_styles) = styles;
     }
 
-    theme.color_primary = color_primary;
-    theme.color_secondary = color_secondary;
-    theme.font_small = font_small;
-    theme.font_normal = font_normal;
-    theme.font_subtitle = font_subtitle;
-    theme.font_title = font_title;
-    theme.flags = flags;
-
     basic_init();
-    cont_init();
-    btn_init();
-    label_init();
     bar_init();
-    img_init();
-    line_init();
     led_init();
     slider_init();
     switch_init();
     linemeter_init();
     gauge_init();
     arc_init();
-    spinner_init();
     chart_init();
     calendar_init();
     cpicker_init();
     checkbox_init();
-    btnmatrix_init();
     keyboard_init();
     msgbox_init();
     page_init();
@@ -939,14 +1694,10 @@ lv_theme_t * lv_theme_material_init(lv_color_t color_primary, lv_color_t color_s
     list_init();
     ddlist_init();
     roller_init();
-    tabview_init();
-    tileview_init();
     table_init();
-    win_init();
     tabview_win_shared_init();
 
-    theme.apply_xcb = NULL;
-    theme.apply_cb = theme_apply;
+    act_styles = styles;
 
     lv_obj_report_style_mod(NULL);
 
@@ -969,70 +1720,70 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 
         case LV_THEME_SCR:
             list = lv_obj_get_style_list(obj, LV_OBJ_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->scr);
+            _lv_style_list_add_style(list, &act_styles->scr);
             break;
         case LV_THEME_OBJ:
             list = lv_obj_get_style_list(obj, LV_OBJ_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->bg);
+            _lv_style_list_add_style(list, &act_styles->bg);
             break;
 #if LV_USE_CONT
         case LV_THEME_CONT:
             list = lv_obj_get_style_list(obj, LV_CONT_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->bg);
+            _lv_style_list_add_style(list, &act_styles->bg);
             break;
 #endif
 
 #if LV_USE_BTN
         case LV_THEME_BTN:
             list = lv_obj_get_style_list(obj, LV_BTN_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->btn);
+            _lv_style_list_add_style(list, &act_styles->btn);
             break;
 #endif
 
 #if LV_USE_BTNMATRIX
         case LV_THEME_BTNMATRIX:
             list = lv_obj_get_style_list(obj, LV_BTNMATRIX_PART_BG);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->pad_small);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->pad_small);
 
             list = lv_obj_get_style_list(obj, LV_BTNMATRIX_PART_BTN);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->bg_click);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->bg_click);
             break;
 #endif
 
 #if LV_USE_KEYBOARD
         case LV_THEME_KEYBOARD:
             list = lv_obj_get_style_list(obj, LV_KEYBOARD_PART_BG);
-            _lv_style_list_add_style(list, &styles->scr);
-            _lv_style_list_add_style(list, &styles->kb_bg);
+            _lv_style_list_add_style(list, &act_styles->scr);
+            _lv_style_list_add_style(list, &act_styles->kb_bg);
 
             list = lv_obj_get_style_list(obj, LV_KEYBOARD_PART_BTN);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->bg_click);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->bg_click);
             break;
 #endif
 
 #if LV_USE_BAR
         case LV_THEME_BAR:
             list = lv_obj_get_style_list(obj, LV_BAR_PART_BG);
-            _lv_style_list_add_style(list, &styles->bar_bg);
+            _lv_style_list_add_style(list, &act_styles->bar_bg);
 
             list = lv_obj_get_style_list(obj, LV_BAR_PART_INDIC);
-            _lv_style_list_add_style(list, &styles->bar_indic);
+            _lv_style_list_add_style(list, &act_styles->bar_indic);
             break;
 #endif
 
 #if LV_USE_SWITCH
         case LV_THEME_SWITCH:
             list = lv_obj_get_style_list(obj, LV_SWITCH_PART_BG);
-            _lv_style_list_add_style(list, &styles->bar_bg);
+            _lv_style_list_add_style(list, &act_styles->bar_bg);
 
             list = lv_obj_get_style_list(obj, LV_SWITCH_PART_INDIC);
-            _lv_style_list_add_style(list, &styles->bar_indic);
+            _lv_style_list_add_style(list, &act_styles->bar_indic);
 
             list = lv_obj_get_style_list(obj, LV_SWITCH_PART_KNOB);
-            _lv_style_list_add_style(list, &styles->sw_knob);
+            _lv_style_list_add_style(list, &act_styles->sw_knob);
             break;
 #endif
 
@@ -1059,118 +1810,118 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 #if LV_USE_LINE
         case LV_THEME_LINE:
             list = lv_obj_get_style_list(obj, LV_LINE_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->line);
+            _lv_style_list_add_style(list, &style_line);
             break;
 #endif
 
 #if LV_USE_ARC
         case LV_THEME_ARC:
             list = lv_obj_get_style_list(obj, LV_ARC_PART_BG);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->arc_bg);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->arc_bg);
 
             list = lv_obj_get_style_list(obj, LV_ARC_PART_INDIC);
-            _lv_style_list_add_style(list, &styles->arc_indic);
+            _lv_style_list_add_style(list, &act_styles->arc_indic);
 
             list = lv_obj_get_style_list(obj, LV_ARC_PART_KNOB);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->bg_click);
-            _lv_style_list_add_style(list, &styles->arc_knob);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->bg_click);
+            _lv_style_list_add_style(list, &style_arc_knob);
             break;
 #endif
 
 #if LV_USE_SPINNER
         case LV_THEME_SPINNER:
             list = lv_obj_get_style_list(obj, LV_SPINNER_PART_BG);
-            _lv_style_list_add_style(list, &styles->arc_bg);
+            _lv_style_list_add_style(list, &act_styles->arc_bg);
 
             list = lv_obj_get_style_list(obj, LV_SPINNER_PART_INDIC);
-            _lv_style_list_add_style(list, &styles->arc_indic);
+            _lv_style_list_add_style(list, &act_styles->arc_indic);
             break;
 #endif
 
 #if LV_USE_SLIDER
         case LV_THEME_SLIDER:
             list = lv_obj_get_style_list(obj, LV_SLIDER_PART_BG);
-            _lv_style_list_add_style(list, &styles->bar_bg);
-            _lv_style_list_add_style(list, &styles->slider_bg);
+            _lv_style_list_add_style(list, &act_styles->bar_bg);
+            _lv_style_list_add_style(list, &act_styles->slider_bg);
 
             list = lv_obj_get_style_list(obj, LV_SLIDER_PART_INDIC);
-            _lv_style_list_add_style(list, &styles->bar_indic);
+            _lv_style_list_add_style(list, &act_styles->bar_indic);
 
             list = lv_obj_get_style_list(obj, LV_SLIDER_PART_KNOB);
-            _lv_style_list_add_style(list, &styles->slider_knob);
+            _lv_style_list_add_style(list, &act_styles->slider_knob);
             break;
 #endif
 
 #if LV_USE_CHECKBOX
         case LV_THEME_CHECKBOX:
             list = lv_obj_get_style_list(obj, LV_CHECKBOX_PART_BG);
-            _lv_style_list_add_style(list, &styles->cb_bg);
+            _lv_style_list_add_style(list, &act_styles->cb_bg);
 
             list = lv_obj_get_style_list(obj, LV_CHECKBOX_PART_BULLET);
-            _lv_style_list_add_style(list, &styles->btn);
-            _lv_style_list_add_style(list, &styles->cb_bullet);
+            _lv_style_list_add_style(list, &act_styles->btn);
+            _lv_style_list_add_style(list, &act_styles->cb_bullet);
             break;
 #endif
 
 #if LV_USE_MSGBOX
         case LV_THEME_MSGBOX:
             list = lv_obj_get_style_list(obj, LV_MSGBOX_PART_BG);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->mbox_bg);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->mbox_bg);
             break;
 
         case LV_THEME_MSGBOX_BTNS:
             list = lv_obj_get_style_list(obj, LV_MSGBOX_PART_BTN_BG);
-            _lv_style_list_add_style(list, &styles->pad_small);
+            _lv_style_list_add_style(list, &act_styles->pad_small);
 
             list = lv_obj_get_style_list(obj, LV_MSGBOX_PART_BTN);
-            _lv_style_list_add_style(list, &styles->btn);
+            _lv_style_list_add_style(list, &act_styles->btn);
             break;
 
 #endif
 #if LV_USE_LED
         case LV_THEME_LED:
             list = lv_obj_get_style_list(obj, LV_LED_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->led);
+            _lv_style_list_add_style(list, &act_styles->led);
             break;
 #endif
 #if LV_USE_PAGE
         case LV_THEME_PAGE:
             list = lv_obj_get_style_list(obj, LV_PAGE_PART_BG);
-            _lv_style_list_add_style(list, &styles->bg);
+            _lv_style_list_add_style(list, &act_styles->bg);
 
             list = lv_obj_get_style_list(obj, LV_PAGE_PART_SCROLLABLE);
-            _lv_style_list_add_style(list, &styles->pad_inner);
+            _lv_style_list_add_style(list, &act_styles->pad_inner);
 
             list = lv_obj_get_style_list(obj, LV_PAGE_PART_SCROLLBAR);
-            _lv_style_list_add_style(list, &styles->sb);
+            _lv_style_list_add_style(list, &act_styles->sb);
 
 #if LV_USE_ANIMATION
             list = lv_obj_get_style_list(obj, LV_PAGE_PART_EDGE_FLASH);
-            _lv_style_list_add_style(list, &styles->edge_flash);
+            _lv_style_list_add_style(list, &style_edge_flash);
 #endif
             break;
 #endif
 #if LV_USE_TABVIEW
         case LV_THEME_TABVIEW:
             list = lv_obj_get_style_list(obj, LV_TABVIEW_PART_BG);
-            _lv_style_list_add_style(list, &styles->scr);
+            _lv_style_list_add_style(list, &act_styles->scr);
 
             list = lv_obj_get_style_list(obj, LV_TABVIEW_PART_TAB_BG);
-            _lv_style_list_add_style(list, &styles->tabview_btns_bg);
+            _lv_style_list_add_style(list, &act_styles->tabview_btns_bg);
 
             list = lv_obj_get_style_list(obj, LV_TABVIEW_PART_INDIC);
-            _lv_style_list_add_style(list, &styles->tabview_indic);
+            _lv_style_list_add_style(list, &act_styles->tabview_indic);
 
             list = lv_obj_get_style_list(obj, LV_TABVIEW_PART_TAB_BTN);
-            _lv_style_list_add_style(list, &styles->tabview_btns);
+            _lv_style_list_add_style(list, &act_styles->tabview_btns);
             break;
 
         case LV_THEME_TABVIEW_PAGE:
             list = lv_obj_get_style_list(obj, LV_PAGE_PART_SCROLLABLE);
-            _lv_style_list_add_style(list, &styles->tabview_page_scrl);
+            _lv_style_list_add_style(list, &act_styles->tabview_page_scrl);
 
             break;
 #endif
@@ -1178,14 +1929,14 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 #if LV_USE_TILEVIEW
         case LV_THEME_TILEVIEW:
             list = lv_obj_get_style_list(obj, LV_TILEVIEW_PART_BG);
-            _lv_style_list_add_style(list, &styles->scr);
+            _lv_style_list_add_style(list, &act_styles->scr);
 
             list = lv_obj_get_style_list(obj, LV_TILEVIEW_PART_SCROLLBAR);
-            _lv_style_list_add_style(list, &styles->sb);
+            _lv_style_list_add_style(list, &act_styles->sb);
 
 #if LV_USE_ANIMATION
             list = lv_obj_get_style_list(obj, LV_TILEVIEW_PART_EDGE_FLASH);
-            _lv_style_list_add_style(list, &styles->edge_flash);
+            _lv_style_list_add_style(list, &style_edge_flash);
 #endif
             break;
 #endif
@@ -1193,11 +1944,11 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 #if LV_USE_ROLLER
         case LV_THEME_ROLLER:
             list = lv_obj_get_style_list(obj, LV_ROLLER_PART_BG);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->roller_bg);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->roller_bg);
 
             list = lv_obj_get_style_list(obj, LV_ROLLER_PART_SELECTED);
-            _lv_style_list_add_style(list, &styles->roller_sel);
+            _lv_style_list_add_style(list, &act_styles->roller_sel);
             break;
 #endif
 
@@ -1210,60 +1961,60 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 #if LV_USE_LIST
         case LV_THEME_LIST:
             list = lv_obj_get_style_list(obj, LV_LIST_PART_BG);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->list_bg);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &style_list_bg);
 
             list = lv_obj_get_style_list(obj, LV_LIST_PART_SCROLLBAR);
-            _lv_style_list_add_style(list, &styles->sb);
+            _lv_style_list_add_style(list, &act_styles->sb);
             break;
 
         case LV_THEME_LIST_BTN:
             list = lv_obj_get_style_list(obj, LV_BTN_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->list_btn);
+            _lv_style_list_add_style(list, &act_styles->list_btn);
             break;
 #endif
 
 #if LV_USE_DROPDOWN
         case LV_THEME_DROPDOWN:
             list = lv_obj_get_style_list(obj, LV_DROPDOWN_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->bg_click);
-            _lv_style_list_add_style(list, &styles->pad_small);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->bg_click);
+            _lv_style_list_add_style(list, &act_styles->pad_small);
 
             list = lv_obj_get_style_list(obj, LV_DROPDOWN_PART_LIST);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->ddlist_page);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->ddlist_page);
 
             list = lv_obj_get_style_list(obj, LV_DROPDOWN_PART_SCROLLBAR);
-            _lv_style_list_add_style(list, &styles->sb);
+            _lv_style_list_add_style(list, &act_styles->sb);
 
             list = lv_obj_get_style_list(obj, LV_DROPDOWN_PART_SELECTED);
-            _lv_style_list_add_style(list, &styles->ddlist_sel);
+            _lv_style_list_add_style(list, &act_styles->ddlist_sel);
             break;
 #endif
 
 #if LV_USE_CHART
         case LV_THEME_CHART:
             list = lv_obj_get_style_list(obj, LV_CHART_PART_BG);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->chart_bg);
-            _lv_style_list_add_style(list, &styles->pad_small);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->chart_bg);
+            _lv_style_list_add_style(list, &act_styles->pad_small);
 
             list = lv_obj_get_style_list(obj, LV_CHART_PART_SERIES_BG);
-            _lv_style_list_add_style(list, &styles->pad_small);
-            _lv_style_list_add_style(list, &styles->chart_series_bg);
+            _lv_style_list_add_style(list, &act_styles->pad_small);
+            _lv_style_list_add_style(list, &act_styles->chart_series_bg);
 
             list = lv_obj_get_style_list(obj, LV_CHART_PART_CURSOR);
-            _lv_style_list_add_style(list, &styles->chart_series_bg);
+            _lv_style_list_add_style(list, &act_styles->chart_series_bg);
 
             list = lv_obj_get_style_list(obj, LV_CHART_PART_SERIES);
-            _lv_style_list_add_style(list, &styles->chart_series);
+            _lv_style_list_add_style(list, &act_styles->chart_series);
             break;
 #endif
 #if LV_USE_TABLE
         case LV_THEME_TABLE: {
                 list = lv_obj_get_style_list(obj, LV_TABLE_PART_BG);
-                _lv_style_list_add_style(list, &styles->bg);
+                _lv_style_list_add_style(list, &act_styles->bg);
 
                 int idx = 1; /* start value should be 1, not zero, since cell styles
                             start at 1 due to presence of LV_TABLE_PART_BG=0
@@ -1271,7 +2022,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
                 /* declaring idx outside loop to work with older compilers */
                 for(; idx <= LV_TABLE_CELL_STYLE_CNT; idx ++) {
                     list = lv_obj_get_style_list(obj, idx);
-                    _lv_style_list_add_style(list, &styles->table_cell);
+                    _lv_style_list_add_style(list, &act_styles->table_cell);
                 }
                 break;
             }
@@ -1280,38 +2031,38 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 #if LV_USE_WIN
         case LV_THEME_WIN:
             list = lv_obj_get_style_list(obj, LV_WIN_PART_BG);
-            _lv_style_list_add_style(list, &styles->scr);
+            _lv_style_list_add_style(list, &act_styles->scr);
 
             list = lv_obj_get_style_list(obj, LV_WIN_PART_SCROLLBAR);
-            _lv_style_list_add_style(list, &styles->sb);
+            _lv_style_list_add_style(list, &act_styles->sb);
 
             list = lv_obj_get_style_list(obj, LV_WIN_PART_CONTENT_SCROLLABLE);
-            _lv_style_list_add_style(list, &styles->tabview_page_scrl);
+            _lv_style_list_add_style(list, &act_styles->tabview_page_scrl);
 
             list = lv_obj_get_style_list(obj, LV_WIN_PART_HEADER);
-            _lv_style_list_add_style(list, &styles->tabview_btns_bg);
+            _lv_style_list_add_style(list, &act_styles->tabview_btns_bg);
             break;
 
         case LV_THEME_WIN_BTN:
             list = lv_obj_get_style_list(obj, LV_BTN_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->tabview_btns);
+            _lv_style_list_add_style(list, &act_styles->tabview_btns);
             break;
 #endif
 
 #if LV_USE_TEXTAREA
         case LV_THEME_TEXTAREA:
             list = lv_obj_get_style_list(obj, LV_TEXTAREA_PART_BG);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->pad_small);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->pad_small);
 
             list = lv_obj_get_style_list(obj, LV_TEXTAREA_PART_PLACEHOLDER);
-            _lv_style_list_add_style(list, &styles->ta_placeholder);
+            _lv_style_list_add_style(list, &act_styles->ta_placeholder);
 
             list = lv_obj_get_style_list(obj, LV_TEXTAREA_PART_CURSOR);
-            _lv_style_list_add_style(list, &styles->ta_cursor);
+            _lv_style_list_add_style(list, &act_styles->ta_cursor);
 
             list = lv_obj_get_style_list(obj, LV_TEXTAREA_PART_SCROLLBAR);
-            _lv_style_list_add_style(list, &styles->sb);
+            _lv_style_list_add_style(list, &act_styles->sb);
             break;
 
 #endif
@@ -1319,63 +2070,63 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 #if LV_USE_SPINBOX
         case LV_THEME_SPINBOX:
             list = lv_obj_get_style_list(obj, LV_SPINBOX_PART_BG);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->pad_small);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->pad_small);
 
             list = lv_obj_get_style_list(obj, LV_SPINBOX_PART_CURSOR);
-            _lv_style_list_add_style(list, &styles->spinbox_cursor);
+            _lv_style_list_add_style(list, &act_styles->spinbox_cursor);
             break;
 
         case LV_THEME_SPINBOX_BTN:
             list = lv_obj_get_style_list(obj, LV_BTN_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->bg_click);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->bg_click);
             break;
 #endif
 
 #if LV_USE_CALENDAR
         case LV_THEME_CALENDAR:
             list = lv_obj_get_style_list(obj, LV_CALENDAR_PART_BG);
-            _lv_style_list_add_style(list, &styles->bg);
+            _lv_style_list_add_style(list, &act_styles->bg);
 
             list = lv_obj_get_style_list(obj, LV_CALENDAR_PART_DATE);
-            _lv_style_list_add_style(list, &styles->calendar_date_nums);
+            _lv_style_list_add_style(list, &act_styles->calendar_date_nums);
 
             list = lv_obj_get_style_list(obj, LV_CALENDAR_PART_HEADER);
-            _lv_style_list_add_style(list, &styles->calendar_header);
+            _lv_style_list_add_style(list, &act_styles->calendar_header);
 
             list = lv_obj_get_style_list(obj, LV_CALENDAR_PART_DAY_NAMES);
-            _lv_style_list_add_style(list, &styles->calendar_daynames);
+            _lv_style_list_add_style(list, &act_styles->calendar_daynames);
             break;
 #endif
 #if LV_USE_CPICKER
         case LV_THEME_CPICKER:
             list = lv_obj_get_style_list(obj, LV_CPICKER_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->cpicker_bg);
+            _lv_style_list_add_style(list, &act_styles->cpicker_bg);
 
             list = lv_obj_get_style_list(obj, LV_CPICKER_PART_KNOB);
-            _lv_style_list_add_style(list, &styles->cpicker_indic);
+            _lv_style_list_add_style(list, &act_styles->cpicker_indic);
             break;
 #endif
 
 #if LV_USE_LINEMETER
         case LV_THEME_LINEMETER:
             list = lv_obj_get_style_list(obj, LV_LINEMETER_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->lmeter);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->lmeter);
             break;
 #endif
 #if LV_USE_GAUGE
         case LV_THEME_GAUGE:
             list = lv_obj_get_style_list(obj, LV_GAUGE_PART_MAIN);
-            _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->gauge_main);
+            _lv_style_list_add_style(list, &act_styles->bg);
+            _lv_style_list_add_style(list, &act_styles->gauge_main);
 
             list = lv_obj_get_style_list(obj, LV_GAUGE_PART_MAJOR);
-            _lv_style_list_add_style(list, &styles->gauge_strong);
+            _lv_style_list_add_style(list, &act_styles->gauge_strong);
 
             list = lv_obj_get_style_list(obj, LV_GAUGE_PART_NEEDLE);
-            _lv_style_list_add_style(list, &styles->gauge_needle);
+            _lv_style_list_add_style(list, &act_styles->gauge_needle);
             break;
 #endif
         default:
@@ -1385,4 +2136,27 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
     lv_obj_refresh_style(obj, LV_OBJ_PART_ALL, LV_STYLE_PROP_ALL);
 }
 
+/**
+ * Tell whether the constant style set matches the parameters of the theme and the display.
+ * The set is built with `LV_DPI` and `LV_HOR_RES_MAX` so the display has to have the same DPI and size category.
+ */
+static bool const_styles_usable(lv_color_t color_primary, lv_color_t color_secondary, uint32_t flags,
+                                const lv_font_t * font_small, const lv_font_t * font_normal, const lv_font_t * font_subtitle,
+                                const lv_font_t * font_title)
+{
+    /*The focus border of the background is always in the constant set*/
+    if(flags != LV_THEME_DEFAULT_FLAG || (flags & LV_THEME_MATERIAL_FLAG_NO_FOCUS)) return false;
+
+    if(color_primary.full != lv_color_hex(CONST_COLOR_PRIMARY).full) return false;
+    if(color_secondary.full != lv_color_hex(CONST_COLOR_SECONDARY).full) return false;
+
+    if(font_small != LV_THEME_DEFAULT_FONT_SMALL || font_normal != LV_THEME_DEFAULT_FONT_NORMAL ||
+       font_subtitle != LV_THEME_DEFAULT_FONT_SUBTITLE || font_title != LV_THEME_DEFAULT_FONT_TITLE) return false;
+
+    if(lv_disp_get_dpi(NULL) != LV_DPI) return false;
+    if((lv_disp_get_size_category(NULL) <= LV_DISP_SIZE_MEDIUM) != CONST_SMALL_DISP) return false;
+
+    return true;
+}
+
 #endif
@@ -23,39 +23,17 @@
 typedef struct {
     lv_style_t scr;
     lv_style_t bg;
-    lv_style_t clip_corner;
     lv_style_t btn;
-    lv_style_t round;
-    lv_style_t no_radius;
     lv_style_t fg_color;
-    lv_style_t border_none;
-    lv_style_t big_line_space;       /*In roller or dropdownlist*/
-    lv_style_t pad_none;
-    lv_style_t pad_normal;
-    lv_style_t pad_small;
-    lv_style_t pad_inner;
-    lv_style_t txt_underline;
 
 #if LV_USE_ARC
     lv_style_t arc_bg, arc_indic;
 #endif
 
-#if LV_USE_LIST
-    lv_style_t list_btn;
-#endif
-
 #if LV_USE_CALENDAR
     lv_style_t calendar_date;
 #endif
 
-#if LV_USE_CHART
-    lv_style_t chart_series;
-#endif
-
-#if LV_USE_LINEMETER
-    lv_style_t linemeter;
-#endif
-
 #if LV_USE_GAUGE
     lv_style_t gauge_needle, gauge_major;
 #endif
@@ -88,6 +66,132 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name);
 static lv_theme_t theme;
 static theme_styles_t * styles;
 
+/*Styles which don't depend on the theme's parameters are constant and stay in ROM.
+ *The others use the colors or the fonts of the theme so they are built at run time*/
+#if LV_USE_LIST
+static const lv_style_const_prop_t clip_corner_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_CLIP_CORNER, true),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_clip_corner, clip_corner_props);
+#endif
+
+#if LV_USE_BAR || LV_USE_CPICKER || LV_USE_GAUGE || LV_USE_LED || LV_USE_LINEMETER || LV_USE_SLIDER || LV_USE_SWITCH
+static const lv_style_const_prop_t round_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_round, round_props);
+#endif
+
+#if LV_USE_DROPDOWN || LV_USE_ROLLER || LV_USE_SPINBOX || LV_USE_TABLE
+static const lv_style_const_prop_t no_radius_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, 0),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_no_radius, no_radius_props);
+#endif
+
+#if LV_USE_CALENDAR || LV_USE_CHART
+static const lv_style_const_prop_t border_none_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_WIDTH, 0),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_border_none, border_none_props);
+#endif
+
+#if LV_USE_DROPDOWN || LV_USE_ROLLER
+/*In roller or dropdownlist*/
+static const lv_style_const_prop_t big_line_space_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_TEXT_LINE_SPACE, LV_DPI / 10),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_big_line_space, big_line_space_props);
+#endif
+
+#if LV_USE_BAR || LV_USE_LIST || LV_USE_SLIDER || LV_USE_SPINBOX || LV_USE_SWITCH
+static const lv_style_const_prop_t pad_none_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, 0),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_pad_none, pad_none_props);
+#endif
+
+#if LV_USE_CALENDAR || LV_USE_TABVIEW
+static const lv_style_const_prop_t pad_normal_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, LV_DPI / 10),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, LV_DPI / 10),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, LV_DPI / 10),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, LV_DPI / 10),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, LV_DPI / 10),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_pad_normal, pad_normal_props);
+#endif
+
+#if LV_USE_CALENDAR || LV_USE_CHECKBOX || LV_USE_KEYBOARD || LV_USE_SLIDER || LV_USE_TABVIEW
+static const lv_style_const_prop_t pad_small_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, LV_DPI / 20),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, LV_DPI / 20),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, LV_DPI / 20),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, LV_DPI / 20),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, LV_DPI / 20),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_pad_small, pad_small_props);
+#endif
+
+#if LV_USE_MSGBOX || LV_USE_PAGE
+static const lv_style_const_prop_t pad_inner_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, LV_DPI / 15),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_pad_inner, pad_inner_props);
+#endif
+
+#if LV_USE_BTN || LV_USE_BTNMATRIX || LV_USE_LIST || LV_USE_MSGBOX || LV_USE_SPINBOX || LV_USE_TABVIEW
+static const lv_style_const_prop_t txt_underline_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_TEXT_DECOR | (LV_STATE_FOCUSED << LV_STYLE_STATE_POS), LV_TEXT_DECOR_UNDERLINE),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_txt_underline, txt_underline_props);
+#endif
+
+#if LV_USE_LIST
+static const lv_style_const_prop_t list_btn_props[] = {
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_TRANSP),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA | (LV_STATE_PRESSED << LV_STYLE_STATE_POS), LV_OPA_COVER),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA | (LV_STATE_CHECKED << LV_STYLE_STATE_POS), LV_OPA_COVER),
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_BORDER_SIDE, LV_BORDER_SIDE_BOTTOM),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_list_btn, list_btn_props);
+#endif
+
+#if LV_USE_CHART
+static const lv_style_const_prop_t chart_series_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_SIZE, 0),
+    LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_TRANSP),
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, LV_MATH_MAX(LV_DPI / 50, 1)),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_chart_series, chart_series_props);
+#endif
+
+#if LV_USE_LINEMETER
+static const lv_style_const_prop_t linemeter_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_LINE_WIDTH, LV_MATH_MAX(LV_DPI / 25, 2)),
+    LV_STYLE_CONST_INT(LV_STYLE_SCALE_END_LINE_WIDTH, LV_MATH_MAX(LV_DPI / 70, 1)),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_linemeter, linemeter_props);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -133,9 +237,6 @@ static void basic_init(void)
     lv_style_set_pad_bottom(&styles->bg, LV_STATE_DEFAULT, LV_DPI / 10);
     lv_style_set_pad_inner(&styles->bg, LV_STATE_DEFAULT, LV_DPI / 10);
 
-    lv_style_reset(&styles->clip_corner);
-    lv_style_set_clip_corner(&styles->clip_corner, LV_STATE_DEFAULT, true);
-
     lv_style_reset(&styles->btn);
     lv_style_set_radius(&styles->btn, LV_STATE_DEFAULT, RADIUS);
     lv_style_set_border_width(&styles->btn, LV_STATE_DEFAULT, BORDER_WIDTH);
@@ -159,50 +260,11 @@ static void basic_init(void)
     lv_style_set_image_recolor(&styles->btn, LV_STATE_CHECKED, BG_COLOR);
     lv_style_set_image_recolor(&styles->btn, LV_STATE_CHECKED | LV_STATE_PRESSED, FG_COLOR);
 
-    lv_style_reset(&styles->round);
-    lv_style_set_radius(&styles->round, LV_STATE_DEFAULT, LV_RADIUS_CIRCLE);
-
-    lv_style_reset(&styles->no_radius);
-    lv_style_set_radius(&styles->no_radius, LV_STATE_DEFAULT, 0);
-
-    lv_style_reset(&styles->border_none);
-    lv_style_set_border_width(&styles->border_none, LV_STATE_DEFAULT, 0);
-
     lv_style_reset(&styles->fg_color);
     lv_style_set_bg_color(&styles->fg_color, LV_STATE_DEFAULT, FG_COLOR);
     lv_style_set_text_color(&styles->fg_color, LV_STATE_DEFAULT, BG_COLOR);
     lv_style_set_image_recolor(&styles->fg_color, LV_STATE_DEFAULT, BG_COLOR);
     lv_style_set_line_color(&styles->fg_color, LV_STATE_DEFAULT, FG_COLOR);
-
-    lv_style_reset(&styles->big_line_space);
-    lv_style_set_text_line_space(&styles->big_line_space, LV_STATE_DEFAULT, LV_DPI / 10);
-
-    lv_style_reset(&styles->pad_none);
-    lv_style_set_pad_left(&styles->pad_none, LV_STATE_DEFAULT, 0);
-    lv_style_set_pad_right(&styles->pad_none, LV_STATE_DEFAULT, 0);
-    lv_style_set_pad_top(&styles->pad_none, LV_STATE_DEFAULT, 0);
-    lv_style_set_pad_bottom(&styles->pad_none, LV_STATE_DEFAULT, 0);
-    lv_style_set_pad_inner(&styles->pad_none, LV_STATE_DEFAULT, 0);
-
-    lv_style_reset(&styles->pad_normal);
-    lv_style_set_pad_left(&styles->pad_normal, LV_STATE_DEFAULT, LV_DPI / 10);
-    lv_style_set_pad_right(&styles->pad_normal, LV_STATE_DEFAULT, LV_DPI / 10);
-    lv_style_set_pad_top(&styles->pad_normal, LV_STATE_DEFAULT, LV_DPI / 10);
-    lv_style_set_pad_bottom(&styles->pad_normal, LV_STATE_DEFAULT, LV_DPI / 10);
-    lv_style_set_pad_inner(&styles->pad_normal, LV_STATE_DEFAULT, LV_DPI / 10);
-
-    lv_style_reset(&styles->pad_small);
-    lv_style_set_pad_left(&styles->pad_small, LV_STATE_DEFAULT, LV_DPI / 20);
-    lv_style_set_pad_right(&styles->pad_small, LV_STATE_DEFAULT, LV_DPI / 20);
-    lv_style_set_pad_top(&styles->pad_small, LV_STATE_DEFAULT, LV_DPI / 20);
-    lv_style_set_pad_bottom(&styles->pad_small, LV_STATE_DEFAULT, LV_DPI / 20);
-    lv_style_set_pad_inner(&styles->pad_small, LV_STATE_DEFAULT, LV_DPI / 20);
-
-    lv_style_reset(&styles->pad_inner);
-    lv_style_set_pad_inner(&styles->pad_inner, LV_STATE_DEFAULT, LV_DPI / 15);
-
-    lv_style_reset(&styles->txt_underline);
-    lv_style_set_text_decor(&styles->txt_underline, LV_STATE_FOCUSED, LV_TEXT_DECOR_UNDERLINE);
 }
 
 static void arc_init(void)
@@ -218,27 +280,6 @@ static void arc_init(void)
 #endif
 }
 
-static void bar_init(void)
-{
-#if LV_USE_BAR
-
-#endif
-}
-
-static void btn_init(void)
-{
-#if LV_USE_BTN != 0
-
-#endif
-}
-
-static void btnmatrix_init(void)
-{
-#if LV_USE_BTNMATRIX
-
-#endif
-}
-
 static void calendar_init(void)
 {
 #if LV_USE_CALENDAR
@@ -260,38 +301,6 @@ static void calendar_init(void)
 #endif
 }
 
-static void chart_init(void)
-{
-#if LV_USE_CHART
-    lv_style_reset(&styles->chart_series);
-    lv_style_set_size(&styles->chart_series, LV_STATE_DEFAULT, 0);
-    lv_style_set_bg_opa(&styles->chart_series, LV_STATE_DEFAULT, LV_OPA_TRANSP);
-    lv_style_set_line_width(&styles->chart_series, LV_STATE_DEFAULT, LV_MATH_MAX(LV_DPI / 50, 1));
-
-#endif
-}
-
-static void cpicker_init(void)
-{
-#if LV_USE_CPICKER
-
-#endif
-}
-
-static void checkbox_init(void)
-{
-#if LV_USE_CHECKBOX != 0
-
-#endif
-}
-
-static void cont_init(void)
-{
-#if LV_USE_CONT != 0
-
-#endif
-}
-
 static void gauge_init(void)
 {
 #if LV_USE_GAUGE != 0
@@ -313,57 +322,6 @@ static void gauge_init(void)
 #endif
 }
 
-static void img_init(void)
-{
-#if LV_USE_IMG != 0
-
-#endif
-}
-
-static void label_init(void)
-{
-#if LV_USE_LABEL != 0
-
-#endif
-}
-
-static void linemeter_init(void)
-{
-#if LV_USE_LINEMETER != 0
-    lv_style_reset(&styles->linemeter);
-    lv_style_set_line_width(&styles->linemeter, LV_STATE_DEFAULT, LV_MATH_MAX(LV_DPI / 25, 2));
-    lv_style_set_scale_end_line_width(&styles->linemeter, LV_STATE_DEFAULT, LV_MATH_MAX(LV_DPI / 70, 1));
-#endif
-}
-
-static void line_init(void)
-{
-#if LV_USE_LINE != 0
-
-#endif
-}
-
-static void led_init(void)
-{
-#if LV_USE_LED != 0
-
-#endif
-}
-
-static void page_init(void)
-{
-#if LV_USE_PAGE
-
-#endif
-}
-
-static void slider_init(void)
-{
-#if LV_USE_SLIDER != 0
-
-#endif
-}
-
 static void switch_init(void)
 {
 #if LV_USE_SWITCH != 0
@@ -377,34 +335,6 @@ static void switch_init(void)
 #endif
 }
 
-static void spinbox_init(void)
-{
-#if LV_USE_SPINBOX
-
-#endif
-}
-
-static void spinner_init(void)
-{
-#if LV_USE_SPINNER != 0
-
-#endif
-}
-
-static void keyboard_init(void)
-{
-#if LV_USE_KEYBOARD
-
-#endif
-}
-
-static void msgbox_init(void)
-{
-#if LV_USE_MSGBOX
-
-#endif
-}
-
 static void textarea_init(void)
 {
 #if LV_USE_TEXTAREA
@@ -417,32 +347,6 @@ static void textarea_init(void)
 #endif
 }
 
-static void list_init(void)
-{
-#if LV_USE_LIST != 0
-    lv_style_reset(&styles->list_btn);
-    lv_style_set_bg_opa(&styles->list_btn, LV_STATE_DEFAULT, LV_OPA_TRANSP);
-    lv_style_set_bg_opa(&styles->list_btn, LV_STATE_PRESSED, LV_OPA_COVER);
-    lv_style_set_bg_opa(&styles->list_btn, LV_STATE_CHECKED, LV_OPA_COVER);
-    lv_style_set_radius(&styles->list_btn, LV_STATE_DEFAULT, 0);
-    lv_style_set_border_side(&styles->list_btn, LV_STATE_DEFAULT, LV_BORDER_SIDE_BOTTOM);
-#endif
-}
-
-static void ddlist_init(void)
-{
-#if LV_USE_DROPDOWN != 0
-
-#endif
-}
-
-static void roller_init(void)
-{
-#if LV_USE_ROLLER != 0
-
-#endif
-}
-
 static void tabview_init(void)
 {
 #if LV_USE_TABVIEW != 0
@@ -454,26 +358,6 @@ static void tabview_init(void)
 #endif
 }
 
-static void tileview_init(void)
-{
-#if LV_USE_TILEVIEW != 0
-#endif
-}
-
-static void table_init(void)
-{
-#if LV_USE_TABLE != 0
-
-#endif
-}
-
-static void win_init(void)
-{
-#if LV_USE_WIN != 0
-
-#endif
-}
-
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -513,36 +397,12 @@ lv_theme_t * lv_theme_mono_init(lv_color_t color_primary, lv_color_t color_secon
     theme.flags = flags;
 
     basic_init();
-    cont_init();
-    btn_init();
-    label_init();
-    bar_init();
-    img_init();
-    line_init();
-    led_init();
-    slider_init();
     switch_init();
-    linemeter_init();
     gauge_init();
     arc_init();
-    spinner_init();
-    chart_init();
     calendar_init();
-    cpicker_init();
-    checkbox_init();
-    btnmatrix_init();
-    keyboard_init();
-    msgbox_init();
-    page_init();
     textarea_init();
-    spinbox_init();
-    list_init();
-    ddlist_init();
-    roller_init();
     tabview_init();
-    tileview_init();
-    table_init();
-    win_init();
 
     theme.apply_xcb = NULL;
     theme.apply_cb = theme_apply;
@@ -584,7 +444,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
             list = lv_obj_get_style_list(obj, LV_BTN_PART_MAIN);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->btn);
-            _lv_style_list_add_style(list, &styles->txt_underline);
+            _lv_style_list_add_style(list, &style_txt_underline);
             break;
 #endif
 
@@ -596,7 +456,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
             list = lv_obj_get_style_list(obj, LV_BTNMATRIX_PART_BTN);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->btn);
-            _lv_style_list_add_style(list, &styles->txt_underline);
+            _lv_style_list_add_style(list, &style_txt_underline);
             break;
 #endif
 
@@ -604,7 +464,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_KEYBOARD:
             list = lv_obj_get_style_list(obj, LV_KEYBOARD_PART_BG);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->pad_small);
+            _lv_style_list_add_style(list, &style_pad_small);
 
             list = lv_obj_get_style_list(obj, LV_KEYBOARD_PART_BTN);
             _lv_style_list_add_style(list, &styles->bg);
@@ -616,13 +476,13 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_BAR:
             list = lv_obj_get_style_list(obj, LV_BAR_PART_BG);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->pad_none);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_pad_none);
+            _lv_style_list_add_style(list, &style_round);
 
             list = lv_obj_get_style_list(obj, LV_BAR_PART_INDIC);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->fg_color);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_round);
             break;
 #endif
 
@@ -630,8 +490,8 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_SWITCH:
             list = lv_obj_get_style_list(obj, LV_SWITCH_PART_BG);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->pad_none);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_pad_none);
+            _lv_style_list_add_style(list, &style_round);
 
             list = lv_obj_get_style_list(obj, LV_SWITCH_PART_INDIC);
             _lv_style_list_add_style(list, &styles->bg);
@@ -639,8 +499,8 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 
             list = lv_obj_get_style_list(obj, LV_SWITCH_PART_KNOB);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->pad_none);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_pad_none);
+            _lv_style_list_add_style(list, &style_round);
             break;
 #endif
 
@@ -698,7 +558,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_SLIDER:
             list = lv_obj_get_style_list(obj, LV_SLIDER_PART_BG);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->pad_none);
+            _lv_style_list_add_style(list, &style_pad_none);
 
             list = lv_obj_get_style_list(obj, LV_SLIDER_PART_INDIC);
             _lv_style_list_add_style(list, &styles->bg);
@@ -706,8 +566,8 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 
             list = lv_obj_get_style_list(obj, LV_SLIDER_PART_KNOB);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->round);
-            _lv_style_list_add_style(list, &styles->pad_small);
+            _lv_style_list_add_style(list, &style_round);
+            _lv_style_list_add_style(list, &style_pad_small);
             _lv_style_list_add_style(list, &styles->fg_color);
             break;
 #endif
@@ -715,12 +575,12 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 #if LV_USE_CHECKBOX
         case LV_THEME_CHECKBOX:
             list = lv_obj_get_style_list(obj, LV_CHECKBOX_PART_BG);
-            _lv_style_list_add_style(list, &styles->pad_small);
+            _lv_style_list_add_style(list, &style_pad_small);
 
             list = lv_obj_get_style_list(obj, LV_CHECKBOX_PART_BULLET);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->btn);
-            _lv_style_list_add_style(list, &styles->pad_small);
+            _lv_style_list_add_style(list, &style_pad_small);
             break;
 #endif
 
@@ -732,12 +592,12 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 
         case LV_THEME_MSGBOX_BTNS:
             list = lv_obj_get_style_list(obj, LV_MSGBOX_PART_BTN_BG);
-            _lv_style_list_add_style(list, &styles->pad_inner);
+            _lv_style_list_add_style(list, &style_pad_inner);
 
             list = lv_obj_get_style_list(obj, LV_MSGBOX_PART_BTN);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->btn);
-            _lv_style_list_add_style(list, &styles->txt_underline);
+            _lv_style_list_add_style(list, &style_txt_underline);
             break;
 
 #endif
@@ -745,7 +605,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_LED:
             list = lv_obj_get_style_list(obj, LV_LED_PART_MAIN);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_round);
             break;
 #endif
 #if LV_USE_PAGE
@@ -754,7 +614,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
             _lv_style_list_add_style(list, &styles->bg);
 
             list = lv_obj_get_style_list(obj, LV_PAGE_PART_SCROLLABLE);
-            _lv_style_list_add_style(list, &styles->pad_inner);
+            _lv_style_list_add_style(list, &style_pad_inner);
 
             list = lv_obj_get_style_list(obj, LV_PAGE_PART_SCROLLBAR);
             _lv_style_list_add_style(list, &styles->sb);
@@ -767,17 +627,17 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 
             list = lv_obj_get_style_list(obj, LV_TABVIEW_PART_TAB_BG);
             _lv_style_list_add_style(list, &styles->tab_bg);
-            _lv_style_list_add_style(list, &styles->pad_small);
+            _lv_style_list_add_style(list, &style_pad_small);
 
             list = lv_obj_get_style_list(obj, LV_TABVIEW_PART_TAB_BTN);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->btn);
-            _lv_style_list_add_style(list, &styles->txt_underline);
+            _lv_style_list_add_style(list, &style_txt_underline);
             break;
 
         case LV_THEME_TABVIEW_PAGE:
             list = lv_obj_get_style_list(obj, LV_PAGE_PART_SCROLLABLE);
-            _lv_style_list_add_style(list, &styles->pad_normal);
+            _lv_style_list_add_style(list, &style_pad_normal);
 
             break;
 #endif
@@ -799,12 +659,12 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_ROLLER:
             list = lv_obj_get_style_list(obj, LV_ROLLER_PART_BG);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->big_line_space);
+            _lv_style_list_add_style(list, &style_big_line_space);
 
             list = lv_obj_get_style_list(obj, LV_ROLLER_PART_SELECTED);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->fg_color);
-            _lv_style_list_add_style(list, &styles->no_radius);
+            _lv_style_list_add_style(list, &style_no_radius);
             break;
 #endif
 
@@ -818,8 +678,8 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_LIST:
             list = lv_obj_get_style_list(obj, LV_LIST_PART_BG);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->pad_none);
-            _lv_style_list_add_style(list, &styles->clip_corner);
+            _lv_style_list_add_style(list, &style_pad_none);
+            _lv_style_list_add_style(list, &style_clip_corner);
 
             list = lv_obj_get_style_list(obj, LV_LIST_PART_SCROLLBAR);
             _lv_style_list_add_style(list, &styles->sb);
@@ -829,8 +689,8 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
             list = lv_obj_get_style_list(obj, LV_BTN_PART_MAIN);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->btn);
-            _lv_style_list_add_style(list, &styles->list_btn);
-            _lv_style_list_add_style(list, &styles->txt_underline);
+            _lv_style_list_add_style(list, &style_list_btn);
+            _lv_style_list_add_style(list, &style_txt_underline);
 
             break;
 #endif
@@ -843,7 +703,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 
             list = lv_obj_get_style_list(obj, LV_DROPDOWN_PART_LIST);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->big_line_space);
+            _lv_style_list_add_style(list, &style_big_line_space);
 
             list = lv_obj_get_style_list(obj, LV_DROPDOWN_PART_SCROLLBAR);
             _lv_style_list_add_style(list, &styles->sb);
@@ -851,7 +711,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
             list = lv_obj_get_style_list(obj, LV_DROPDOWN_PART_SELECTED);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->fg_color);
-            _lv_style_list_add_style(list, &styles->no_radius);
+            _lv_style_list_add_style(list, &style_no_radius);
             break;
 #endif
 
@@ -862,10 +722,10 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 
             list = lv_obj_get_style_list(obj, LV_CHART_PART_SERIES_BG);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->border_none);
+            _lv_style_list_add_style(list, &style_border_none);
 
             list = lv_obj_get_style_list(obj, LV_CHART_PART_SERIES);
-            _lv_style_list_add_style(list, &styles->chart_series);
+            _lv_style_list_add_style(list, &style_chart_series);
             break;
 #endif
 #if LV_USE_TABLE
@@ -880,7 +740,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
                 for(; idx <= LV_TABLE_CELL_STYLE_CNT; idx ++) {
                     list = lv_obj_get_style_list(obj, idx);
                     _lv_style_list_add_style(list, &styles->bg);
-                    _lv_style_list_add_style(list, &styles->no_radius);
+                    _lv_style_list_add_style(list, &style_no_radius);
                 }
                 break;
             }
@@ -929,16 +789,16 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
             list = lv_obj_get_style_list(obj, LV_SPINBOX_PART_CURSOR);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->fg_color);
-            _lv_style_list_add_style(list, &styles->pad_none);
-            _lv_style_list_add_style(list, &styles->no_radius);
-            _lv_style_list_add_style(list, &styles->txt_underline);
+            _lv_style_list_add_style(list, &style_pad_none);
+            _lv_style_list_add_style(list, &style_no_radius);
+            _lv_style_list_add_style(list, &style_txt_underline);
             break;
 
         case LV_THEME_SPINBOX_BTN:
             list = lv_obj_get_style_list(obj, LV_BTN_PART_MAIN);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->btn);
-            _lv_style_list_add_style(list, &styles->txt_underline);
+            _lv_style_list_add_style(list, &style_txt_underline);
             break;
 #endif
 
@@ -950,17 +810,17 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
             list = lv_obj_get_style_list(obj, LV_CALENDAR_PART_DATE);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->btn);
-            _lv_style_list_add_style(list, &styles->pad_small);
-            _lv_style_list_add_style(list, &styles->border_none);
+            _lv_style_list_add_style(list, &style_pad_small);
+            _lv_style_list_add_style(list, &style_border_none);
             _lv_style_list_add_style(list, &styles->calendar_date);
 
             list = lv_obj_get_style_list(obj, LV_CALENDAR_PART_HEADER);
-            _lv_style_list_add_style(list, &styles->pad_normal);
-            _lv_style_list_add_style(list, &styles->border_none);
+            _lv_style_list_add_style(list, &style_pad_normal);
+            _lv_style_list_add_style(list, &style_border_none);
 
             list = lv_obj_get_style_list(obj, LV_CALENDAR_PART_DAY_NAMES);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->pad_small);
+            _lv_style_list_add_style(list, &style_pad_small);
             break;
 #endif
 #if LV_USE_CPICKER
@@ -970,7 +830,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 
             list = lv_obj_get_style_list(obj, LV_CPICKER_PART_KNOB);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_round);
             break;
 #endif
 
@@ -978,15 +838,15 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_LINEMETER:
             list = lv_obj_get_style_list(obj, LV_LINEMETER_PART_MAIN);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->round);
-            _lv_style_list_add_style(list, &styles->linemeter);
+            _lv_style_list_add_style(list, &style_round);
+            _lv_style_list_add_style(list, &style_linemeter);
             break;
 #endif
 #if LV_USE_GAUGE
         case LV_THEME_GAUGE:
             list = lv_obj_get_style_list(obj, LV_GAUGE_PART_MAIN);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_round);
 
             list = lv_obj_get_style_list(obj, LV_GAUGE_PART_MAJOR);
             _lv_style_list_add_style(list, &styles->gauge_major);
@@ -23,11 +23,8 @@
 typedef struct {
     lv_style_t bg;
     lv_style_t btn;
-    lv_style_t round;
     lv_style_t color;
-    lv_style_t gray;
     lv_style_t tick_line;
-    lv_style_t tight;
 } theme_styles_t;
 
 /**********************
@@ -42,6 +39,36 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name);
 static lv_theme_t theme;
 static theme_styles_t * styles;
 
+/*Styles which don't depend on the theme's parameters are constant and stay in ROM.
+ *The others use the colors of the theme so they are built at run time*/
+#if LV_USE_ARC || LV_USE_CPICKER || LV_USE_GAUGE || LV_USE_LED || LV_USE_LINEMETER || LV_USE_SLIDER || LV_USE_SWITCH
+static const lv_style_const_prop_t round_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_RADIUS, LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_round, round_props);
+#endif
+
+#if LV_USE_PAGE || LV_USE_TABVIEW || LV_USE_TEXTAREA
+static const lv_style_const_prop_t gray_props[] = {
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR, 0xC0C0C0),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_LINE_COLOR, 0xC0C0C0),
+    LV_STYLE_CONST_COLOR_HEX(LV_STYLE_TEXT_COLOR, 0x808080),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_gray, gray_props);
+#endif
+
+static const lv_style_const_prop_t tight_props[] = {
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_LEFT, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_RIGHT, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_TOP, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_BOTTOM, 0),
+    LV_STYLE_CONST_INT(LV_STYLE_PAD_INNER, 0),
+    LV_STYLE_CONST_END
+};
+static LV_STYLE_CONST_INIT(style_tight, tight_props);
+
 /**********************
  *      MACROS
  **********************/
@@ -77,29 +104,14 @@ static void basic_init(void)
     lv_style_set_text_color(&styles->btn, LV_STATE_DISABLED, LV_COLOR_GRAY);
     lv_style_set_image_recolor(&styles->btn, LV_STATE_DISABLED, LV_COLOR_GRAY);
 
-    lv_style_reset(&styles->round);
-    lv_style_set_radius(&styles->round, LV_STATE_DEFAULT, LV_RADIUS_CIRCLE);
-
     lv_style_reset(&styles->color);
     lv_style_set_bg_color(&styles->color, LV_STATE_DEFAULT, theme.color_primary);
     lv_style_set_line_color(&styles->color, LV_STATE_DEFAULT, theme.color_primary);
 
-    lv_style_reset(&styles->gray);
-    lv_style_set_bg_color(&styles->gray, LV_STATE_DEFAULT, LV_COLOR_SILVER);
-    lv_style_set_line_color(&styles->gray, LV_STATE_DEFAULT, LV_COLOR_SILVER);
-    lv_style_set_text_color(&styles->gray, LV_STATE_DEFAULT, LV_COLOR_GRAY);
-
     lv_style_reset(&styles->tick_line);
     lv_style_set_line_width(&styles->tick_line, LV_STATE_DEFAULT, 5);
     lv_style_set_scale_end_line_width(&styles->tick_line, LV_STATE_DEFAULT, 5);
     lv_style_set_scale_end_color(&styles->tick_line, LV_STATE_DEFAULT, theme.color_primary);
-
-    lv_style_reset(&styles->tight);
-    lv_style_set_pad_left(&styles->tight, LV_STATE_DEFAULT, 0);
-    lv_style_set_pad_right(&styles->tight, LV_STATE_DEFAULT, 0);
-    lv_style_set_pad_top(&styles->tight, LV_STATE_DEFAULT, 0);
-    lv_style_set_pad_bottom(&styles->tight, LV_STATE_DEFAULT, 0);
-    lv_style_set_pad_inner(&styles->tight, LV_STATE_DEFAULT, 0);
 }
 
 static void arc_init(void)
@@ -404,7 +416,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_SCR:
             list = lv_obj_get_style_list(obj, LV_OBJ_PART_MAIN);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->tight);
+            _lv_style_list_add_style(list, &style_tight);
             break;
         case LV_THEME_OBJ:
             list = lv_obj_get_style_list(obj, LV_OBJ_PART_MAIN);
@@ -451,7 +463,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_BAR:
             list = lv_obj_get_style_list(obj, LV_BAR_PART_BG);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->tight);
+            _lv_style_list_add_style(list, &style_tight);
 
             list = lv_obj_get_style_list(obj, LV_BAR_PART_INDIC);
             _lv_style_list_add_style(list, &styles->bg);
@@ -463,8 +475,8 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_SWITCH:
             list = lv_obj_get_style_list(obj, LV_SWITCH_PART_BG);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->tight);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_tight);
+            _lv_style_list_add_style(list, &style_round);
 
             list = lv_obj_get_style_list(obj, LV_SWITCH_PART_INDIC);
             _lv_style_list_add_style(list, &styles->bg);
@@ -472,8 +484,8 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 
             list = lv_obj_get_style_list(obj, LV_SWITCH_PART_KNOB);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->tight);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_tight);
+            _lv_style_list_add_style(list, &style_round);
             break;
 #endif
 
@@ -512,7 +524,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
             list = lv_obj_get_style_list(obj, LV_ARC_PART_BG);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->tick_line);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_round);
 
             list = lv_obj_get_style_list(obj, LV_ARC_PART_INDIC);
             _lv_style_list_add_style(list, &styles->bg);
@@ -545,7 +557,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 
             list = lv_obj_get_style_list(obj, LV_SLIDER_PART_KNOB);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_round);
             break;
 #endif
 
@@ -580,14 +592,14 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
             list = lv_obj_get_style_list(obj, LV_LED_PART_MAIN);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->color);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_round);
             break;
 #endif
 #if LV_USE_PAGE
         case LV_THEME_PAGE:
             list = lv_obj_get_style_list(obj, LV_PAGE_PART_BG);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->gray);
+            _lv_style_list_add_style(list, &style_gray);
 
             list = lv_obj_get_style_list(obj, LV_PAGE_PART_SCROLLABLE);
             _lv_style_list_add_style(list, &styles->bg);
@@ -620,7 +632,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_TABVIEW_PAGE:
             list = lv_obj_get_style_list(obj, LV_PAGE_PART_BG);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->gray);
+            _lv_style_list_add_style(list, &style_gray);
 
             list = lv_obj_get_style_list(obj, LV_PAGE_PART_SCROLLABLE);
             _lv_style_list_add_style(list, &styles->bg);
@@ -704,7 +716,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 
             list = lv_obj_get_style_list(obj, LV_CHART_PART_SERIES);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->tight);
+            _lv_style_list_add_style(list, &style_tight);
             break;
 #endif
 #if LV_USE_TABLE
@@ -752,11 +764,11 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
             _lv_style_list_add_style(list, &styles->bg);
 
             list = lv_obj_get_style_list(obj, LV_TEXTAREA_PART_PLACEHOLDER);
-            _lv_style_list_add_style(list, &styles->gray);
+            _lv_style_list_add_style(list, &style_gray);
 
             list = lv_obj_get_style_list(obj, LV_TEXTAREA_PART_CURSOR);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->tight);
+            _lv_style_list_add_style(list, &style_tight);
 
             list = lv_obj_get_style_list(obj, LV_TEXTAREA_PART_SCROLLBAR);
             _lv_style_list_add_style(list, &styles->bg);
@@ -787,14 +799,14 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
             list = lv_obj_get_style_list(obj, LV_CALENDAR_PART_DATE);
             _lv_style_list_add_style(list, &styles->bg);
             _lv_style_list_add_style(list, &styles->btn);
-            _lv_style_list_add_style(list, &styles->tight);
+            _lv_style_list_add_style(list, &style_tight);
 
             list = lv_obj_get_style_list(obj, LV_CALENDAR_PART_HEADER);
             _lv_style_list_add_style(list, &styles->bg);
 
             list = lv_obj_get_style_list(obj, LV_CALENDAR_PART_DAY_NAMES);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->tight);
+            _lv_style_list_add_style(list, &style_tight);
             break;
 #endif
 #if LV_USE_CPICKER
@@ -804,7 +816,7 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
 
             list = lv_obj_get_style_list(obj, LV_CPICKER_PART_KNOB);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_round);
             break;
 #endif
 
@@ -812,14 +824,14 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj, lv_theme_style_t name)
         case LV_THEME_LINEMETER:
             list = lv_obj_get_style_list(obj, LV_LINEMETER_PART_MAIN);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_round);
             break;
 #endif
 #if LV_USE_GAUGE
         case LV_THEME_GAUGE:
             list = lv_obj_get_style_list(obj, LV_GAUGE_PART_MAIN);
             _lv_style_list_add_style(list, &styles->bg);
-            _lv_style_list_add_style(list, &styles->round);
+            _lv_style_list_add_style(list, &style_round);
 
             list = lv_obj_get_style_list(obj, LV_GAUGE_PART_MAJOR);
             _lv_style_list_add_style(list, &styles->tick_line);
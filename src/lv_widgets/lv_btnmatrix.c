@@ -43,6 +43,7 @@ static bool button_is_tgl_enabled(lv_btnmatrix_ctrl_t ctrl_bits);
 static bool button_get_tgl_state(lv_btnmatrix_ctrl_t ctrl_bits);
 static uint16_t get_button_from_point(lv_obj_t * btnm, lv_point_t * p);
 static void allocate_btn_areas_and_controls(const lv_obj_t * btnm, const char ** map);
+static void refr_click_areas(lv_obj_t * btnm);
 static void invalidate_button_area(const lv_obj_t * btnm, uint16_t btn_idx);
 static void make_one_button_toggled(lv_obj_t * btnm, uint16_t btn_idx);
 
@@ -93,6 +94,9 @@ lv_obj_t * lv_btnmatrix_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->btn_id_focused = LV_BTNMATRIX_BTN_NONE;
     ext->btn_id_act     = LV_BTNMATRIX_BTN_NONE;
     ext->button_areas   = NULL;
+    ext->button_click_areas = NULL;
+    ext->row_first      = NULL;
+    ext->row_cnt        = 0;
     ext->ctrl_bits      = NULL;
     ext->map_p          = NULL;
     ext->recolor        = 0;
@@ -170,12 +174,19 @@ void lv_btnmatrix_set_map(lv_obj_t * btnm, const char * map[])
     lv_coord_t act_y            = top;
 
     /*Count the lines to calculate button height*/
-    uint8_t line_cnt = 1;
-    uint8_t li;
+    uint16_t line_cnt = 1;
+    uint16_t li;
     for(li = 0; strlen(map[li]) != 0; li++) {
         if(strcmp(map[li], "\n") == 0) line_cnt++;
     }
 
+    /*Save the first button of the rows to find the pressed button quickly*/
+    uint16_t * row_first = lv_mem_realloc(ext->row_first, (line_cnt + 1) * sizeof(uint16_t));
+    LV_ASSERT_MEM(row_first);
+    if(row_first == NULL) lv_mem_free(ext->row_first);  /*Too small for the new map. Search without the rows then.*/
+    ext->row_first = row_first;
+    ext->row_cnt = 0;
+
     lv_coord_t btn_h = max_h - ((line_cnt - 1) * inner);
     btn_h            = (btn_h + line_cnt / 2) / line_cnt;
     btn_h--; /*-1 because e.g. height = 100 means 101 pixels (0..100)*/
@@ -206,6 +217,11 @@ void lv_btnmatrix_set_map(lv_obj_t * btnm, const char * map[])
 
         /*Only deal with the non empty lines*/
         if(btn_cnt != 0) {
+            if(row_first) {
+                row_first[ext->row_cnt] = btn_i;
+                ext->row_cnt++;
+            }
+
             /*Calculate the width of all units*/
             lv_coord_t all_unit_w = max_w - ((unit_cnt - 1) * inner);
 
@@ -256,6 +272,9 @@ void lv_btnmatrix_set_map(lv_obj_t * btnm, const char * map[])
         i_tot++;                                   /*Skip the '\n'*/
     }
 
+    if(row_first) row_first[ext->row_cnt] = btn_i;
+    refr_click_areas(btnm);
+
     lv_obj_invalidate(btnm);
 }
 
@@ -859,6 +878,8 @@ static lv_res_t lv_btnmatrix_signal(lv_obj_t * btnm, lv_signal_t sign, void * pa
     if(sign == LV_SIGNAL_CLEANUP) {
         lv_obj_clean_style_list(btnm, LV_BTNMATRIX_PART_BTN);
         lv_mem_free(ext->button_areas);
+        lv_mem_free(ext->button_click_areas);
+        lv_mem_free(ext->row_first);
         lv_mem_free(ext->ctrl_bits);
     }
     else if(sign == LV_SIGNAL_STYLE_CHG) {
@@ -1154,6 +1175,10 @@ static void allocate_btn_areas_and_controls(const lv_obj_t * btnm, const char **
         lv_mem_free(ext->button_areas);
         ext->button_areas = NULL;
     }
+    if(ext->button_click_areas != NULL) {
+        lv_mem_free(ext->button_click_areas);
+        ext->button_click_areas = NULL;
+    }
     if(ext->ctrl_bits != NULL) {
         lv_mem_free(ext->ctrl_bits);
         ext->ctrl_bits = NULL;
@@ -1161,9 +1186,11 @@ static void allocate_btn_areas_and_controls(const lv_obj_t * btnm, const char **
 
     ext->button_areas = lv_mem_alloc(sizeof(lv_area_t) * btn_cnt);
     LV_ASSERT_MEM(ext->button_areas);
+    ext->button_click_areas = lv_mem_alloc(sizeof(lv_area_t) * btn_cnt);
+    LV_ASSERT_MEM(ext->button_click_areas);
     ext->ctrl_bits = lv_mem_alloc(sizeof(lv_btnmatrix_ctrl_t) * btn_cnt);
     LV_ASSERT_MEM(ext->ctrl_bits);
-    if(ext->button_areas == NULL || ext->ctrl_bits == NULL) btn_cnt = 0;
+    if(ext->button_areas == NULL || ext->button_click_areas == NULL || ext->ctrl_bits == NULL) btn_cnt = 0;
 
     _lv_memset_00(ext->ctrl_bits, sizeof(lv_btnmatrix_ctrl_t) * btn_cnt);
 
@@ -1212,18 +1239,14 @@ static bool button_get_tgl_state(lv_btnmatrix_ctrl_t ctrl_bits)
 }
 
 /**
- * Gives the button id of a button under a given point
+ * Extend the areas of the buttons with the half inner padding, or with the padding of the background
+ * on the edges, to get the areas where they can be pressed.
  * @param btnm pointer to a button matrix object
- * @param p a point with absolute coordinates
- * @return the id of the button or LV_BTNMATRIX_BTN_NONE.
  */
-static uint16_t get_button_from_point(lv_obj_t * btnm, lv_point_t * p)
+static void refr_click_areas(lv_obj_t * btnm)
 {
-    lv_area_t btnm_cords;
-    lv_area_t btn_area;
     lv_btnmatrix_ext_t * ext = lv_obj_get_ext_attr(btnm);
     uint16_t i;
-    lv_obj_get_coords(btnm, &btnm_cords);
 
     lv_coord_t w = lv_obj_get_width(btnm);
     lv_coord_t h = lv_obj_get_height(btnm);
@@ -1242,29 +1265,75 @@ static uint16_t get_button_from_point(lv_obj_t * btnm, lv_point_t * p)
     pbottom = LV_MATH_MIN(pbottom, BTN_EXTRA_CLICK_AREA_MAX);
 
     for(i = 0; i < ext->btn_cnt; i++) {
-        lv_area_copy(&btn_area, &ext->button_areas[i]);
-        if(btn_area.x1 <= pleft) btn_area.x1 += btnm_cords.x1 - LV_MATH_MIN(pleft, BTN_EXTRA_CLICK_AREA_MAX);
-        else btn_area.x1 += btnm_cords.x1 - pinner;
+        lv_area_t * btn_area = &ext->button_click_areas[i];
+        lv_area_copy(btn_area, &ext->button_areas[i]);
+        if(btn_area->x1 <= pleft) btn_area->x1 -= LV_MATH_MIN(pleft, BTN_EXTRA_CLICK_AREA_MAX);
+        else btn_area->x1 -= pinner;
 
-        if(btn_area.y1 <= ptop) btn_area.y1 += btnm_cords.y1 - LV_MATH_MIN(ptop, BTN_EXTRA_CLICK_AREA_MAX);
-        else btn_area.y1 += btnm_cords.y1 - pinner;
+        if(btn_area->y1 <= ptop) btn_area->y1 -= LV_MATH_MIN(ptop, BTN_EXTRA_CLICK_AREA_MAX);
+        else btn_area->y1 -= pinner;
 
-        if(btn_area.x2 >= w - pright - 2) btn_area.x2 += btnm_cords.x1 + LV_MATH_MIN(pright,
-                                                                                         BTN_EXTRA_CLICK_AREA_MAX);  /*-2 for rounding error*/
-        else btn_area.x2 += btnm_cords.x1 + pinner;
+        if(btn_area->x2 >= w - pright - 2) btn_area->x2 += LV_MATH_MIN(pright, BTN_EXTRA_CLICK_AREA_MAX); /*-2 for rounding error*/
+        else btn_area->x2 += pinner;
 
-        if(btn_area.y2 >= h - pbottom - 2) btn_area.y2 += btnm_cords.y1 + LV_MATH_MIN(pbottom,
-                                                                                          BTN_EXTRA_CLICK_AREA_MAX); /*-2 for rounding error*/
-        else btn_area.y2 += btnm_cords.y1 + pinner;
+        if(btn_area->y2 >= h - pbottom - 2) btn_area->y2 += LV_MATH_MIN(pbottom, BTN_EXTRA_CLICK_AREA_MAX); /*-2 for rounding error*/
+        else btn_area->y2 += pinner;
+    }
+}
 
-        if(_lv_area_is_point_on(&btn_area, p, 0) != false) {
-            break;
+/**
+ * Gives the button id of a button under a given point
+ * @param btnm pointer to a button matrix object
+ * @param p a point with absolute coordinates
+ * @return the id of the button or LV_BTNMATRIX_BTN_NONE.
+ */
+static uint16_t get_button_from_point(lv_obj_t * btnm, lv_point_t * p)
+{
+    lv_btnmatrix_ext_t * ext = lv_obj_get_ext_attr(btnm);
+    if(ext->btn_cnt == 0) return LV_BTNMATRIX_BTN_NONE;
+
+    const lv_area_t * areas = ext->button_click_areas;
+    lv_coord_t x = p->x - btnm->coords.x1;
+    lv_coord_t y = p->y - btnm->coords.y1;
+
+    /*Check all buttons if the rows couldn't be saved*/
+    if(ext->row_first == NULL) {
+        uint16_t i;
+        for(i = 0; i < ext->btn_cnt; i++) {
+            if(areas[i].x1 <= x && areas[i].x2 >= x && areas[i].y1 <= y && areas[i].y2 >= y) return i;
         }
+        return LV_BTNMATRIX_BTN_NONE;
+    }
+
+    /*Find the first row which is not above the point. The buttons of a row have the same height.*/
+    uint16_t min = 0;
+    uint16_t max = ext->row_cnt;
+    while(min < max) {
+        uint16_t mid = min + (max - min) / 2;
+        if(areas[ext->row_first[mid]].y2 >= y) max = mid;
+        else min = mid + 1;
     }
 
-    if(i == ext->btn_cnt) i = LV_BTNMATRIX_BTN_NONE;
+    /* The click areas of the neighbor rows might overlap.
+     * If the point is not on a button of the upper row check the next rows too.*/
+    uint16_t row;
+    for(row = min; row < ext->row_cnt && areas[ext->row_first[row]].y1 <= y; row++) {
+        /*Find the first button which is not left to the point (right to the point with RTL base direction)*/
+        uint16_t first = ext->row_first[row];
+        uint16_t last = ext->row_first[row + 1] - 1;
+        bool rtl = last > first && areas[last].x1 < areas[first].x1;
+        min = first;
+        max = last + 1;
+        while(min < max) {
+            uint16_t mid = min + (max - min) / 2;
+            if((rtl == false && areas[mid].x2 >= x) || (rtl && areas[mid].x1 <= x)) max = mid;
+            else min = mid + 1;
+        }
+
+        if(min <= last && areas[min].x1 <= x && areas[min].x2 >= x) return min;
+    }
 
-    return i;
+    return LV_BTNMATRIX_BTN_NONE;
 }
 
 static void invalidate_button_area(const lv_obj_t * btnm, uint16_t btn_idx)
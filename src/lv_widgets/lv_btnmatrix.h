@@ -51,6 +51,9 @@ typedef struct {
     /*New data for this type */
     const char ** map_p;                              /*Pointer to the current map*/
     lv_area_t * button_areas;                         /*Array of areas of buttons*/
+    lv_area_t * button_click_areas;   /*Areas of the buttons extended with the padding to find the pressed button*/
+    uint16_t * row_first;                             /*Index of the first button of each row and `btn_cnt` at the end*/
+    uint16_t row_cnt;                                 /*Number of non-empty rows*/
     lv_btnmatrix_ctrl_t * ctrl_bits;                       /*Array of control bytes*/
     lv_style_list_t style_btn;                     /*Styles of buttons in each state*/
     uint16_t btn_cnt;                                 /*Number of button in 'map_p'(Handled by the library)*/
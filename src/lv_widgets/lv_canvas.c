@@ -21,19 +21,53 @@
  *********************/
 #define LV_OBJX_NAME "lv_canvas"
 
+/*Largest blur window where the division by multiplication is exact*/
+#define BLUR_R_MAX  4096
+
 /**********************
  *      TYPEDEFS
  **********************/
+/*A dummy display to make the lv_draw functions draw to the buffer of a canvas*/
+typedef struct {
+    lv_disp_t disp;
+    lv_disp_buf_t disp_buf;
+    lv_area_t clip;         /*The whole canvas*/
+    lv_disp_t * refr_ori;   /*The display refreshed before starting to draw to the canvas*/
+} draw_ctx_t;
+
+/*Channel sums of a blur window*/
+typedef struct {
+    uint32_t r;
+    uint32_t g;
+    uint32_t b;
+    uint32_t a;
+} blur_sum_t;
+
+/*A horizontal or vertical blur of true color pixels, split into parts*/
+typedef struct {
+    lv_img_dsc_t * img;
+    lv_area_t area;
+    uint16_t r_back;        /*Number of pixels before the current one in the window*/
+    uint16_t r_front;       /*Number of pixels after the current one in the window*/
+    uint32_t inv;           /*2^32 / window size rounded up to divide with multiplication*/
+    uint8_t * buf;          /*Work buffer of all parts*/
+    uint32_t part_buf_size; /*Size of the work buffer of a part*/
+    uint32_t part_cnt;
+    lv_coord_t ring_h;      /*Number of original rows kept by the vertical blur*/
+    uint8_t px_size;
+    uint8_t has_alpha : 1;
+    uint8_t ver : 1;
+} blur_job_t;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static lv_res_t lv_canvas_signal(lv_obj_t * canvas, lv_signal_t sign, void * param);
 static void set_set_px_cb(lv_disp_drv_t * disp_drv, lv_img_cf_t cf);
+static void draw_ctx_init(draw_ctx_t * ctx, const lv_img_dsc_t * dsc);
+static draw_ctx_t * draw_ctx_enter(lv_obj_t * canvas, draw_ctx_t * tmp_ctx);
+static void draw_ctx_leave(lv_obj_t * canvas, draw_ctx_t * ctx);
 
-static void set_px_true_color_alpha(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x,
-                                    lv_coord_t y,
-                                    lv_color_t color, lv_opa_t opa);
 
 static void set_px_cb_alpha1(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
                              lv_color_t color, lv_opa_t opa);
@@ -44,16 +78,28 @@ static void set_px_cb_alpha2(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t
 static void set_px_cb_alpha4(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
                              lv_color_t color, lv_opa_t opa);
 
-static void set_px_cb_alpha8(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
-                             lv_color_t color, lv_opa_t opa);
 
 static void set_px_alpha_generic(lv_img_dsc_t * d, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa);
 
+static void get_blur_area(lv_obj_t * canvas, const lv_area_t * area, lv_area_t * a);
+static void blur_hor_px(lv_obj_t * canvas, const lv_area_t * area, uint16_t r);
+static void blur_ver_px(lv_obj_t * canvas, const lv_area_t * area, uint16_t r);
+static bool blur_native(lv_obj_t * canvas, const lv_area_t * a, uint16_t r, bool ver);
+static void blur_part_cb(void * user_data, uint32_t part);
+static void blur_hor_rows(const blur_job_t * job, lv_coord_t y1, lv_coord_t y2, uint8_t * row_buf);
+static void blur_ver_cols(const blur_job_t * job, lv_coord_t x1, lv_coord_t x2, uint8_t * buf);
+static inline void blur_sum_add(blur_sum_t * sum, const uint8_t * px, bool has_alpha);
+static inline void blur_sum_sub(blur_sum_t * sum, const uint8_t * px, bool has_alpha);
+static inline void blur_px_set(uint8_t * px, const blur_sum_t * sum, const blur_job_t * job);
+static inline uint32_t blur_div(uint32_t sum, uint32_t inv);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
 static lv_signal_cb_t ancestor_signal;
 static lv_design_cb_t ancestor_design;
+static lv_canvas_parallel_cb_t parallel_cb;
+static uint32_t parallel_part_cnt = 1;
 
 /**********************
  *      MACROS
@@ -96,6 +142,7 @@ lv_obj_t * lv_canvas_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->dsc.header.w           = 0;
     ext->dsc.data_size          = 0;
     ext->dsc.data               = NULL;
+    ext->draw_ctx               = NULL;
 
     lv_img_set_src(new_canvas, &ext->dsc);
 
@@ -147,6 +194,9 @@ void lv_canvas_set_buffer(lv_obj_t * canvas, void * buf, lv_coord_t w, lv_coord_
     ext->dsc.header.h  = h;
     ext->dsc.data      = buf;
 
+    /*Draw to the new buffer with the opened drawing context*/
+    if(ext->draw_ctx) draw_ctx_init(ext->draw_ctx, &ext->dsc);
+
     lv_img_set_src(canvas, &ext->dsc);
 }
 
@@ -388,126 +438,12 @@ void lv_canvas_blur_hor(lv_obj_t * canvas, const lv_area_t * area, uint16_t r)
 
     if(r == 0) return;
 
-    lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
-
     lv_area_t a;
-    if(area) {
-        lv_area_copy(&a, area);
-        if(a.x1 < 0) a.x1 = 0;
-        if(a.y1 < 0) a.y1 = 0;
-        if(a.x2 > ext->dsc.header.w - 1) a.x2 = ext->dsc.header.w - 1;
-        if(a.y2 > ext->dsc.header.h - 1) a.y2 = ext->dsc.header.h - 1;
-    }
-    else {
-        a.x1 = 0;
-        a.y1 = 0;
-        a.x2 = ext->dsc.header.w - 1;
-        a.y2 = ext->dsc.header.h - 1;
-    }
-
-    lv_color_t color = lv_obj_get_style_image_recolor(canvas, LV_CANVAS_PART_MAIN);
-
-    uint16_t r_back = r / 2;
-    uint16_t r_front = r / 2;
-
-    if((r & 0x1) == 0) r_back--;
-
-    bool has_alpha = lv_img_cf_has_alpha(ext->dsc.header.cf);
-
-    lv_coord_t line_w = lv_img_buf_get_img_size(ext->dsc.header.w, 1, ext->dsc.header.cf);
-    uint8_t * line_buf = _lv_mem_buf_get(line_w);
-
-    lv_img_dsc_t line_img;
-    line_img.data = line_buf;
-    line_img.header.always_zero = 0;
-    line_img.header.w = ext->dsc.header.w;
-    line_img.header.h = 1;
-    line_img.header.cf = ext->dsc.header.cf;
-
-    lv_coord_t x;
-    lv_coord_t y;
-    lv_coord_t x_safe;
-
-    for(y = a.y1; y <= a.y2; y++) {
-        uint32_t asum = 0;
-        uint32_t rsum = 0;
-        uint32_t gsum = 0;
-        uint32_t bsum = 0;
-
-        lv_color_t c;
-        lv_opa_t opa = LV_OPA_TRANSP;
-        _lv_memcpy(line_buf, &ext->dsc.data[y * line_w], line_w);
-
-        for(x = a.x1 - r_back; x <= a.x1 + r_front; x++) {
-            x_safe = x < 0 ? 0 : x;
-            x_safe = x_safe > ext->dsc.header.w - 1 ? ext->dsc.header.w - 1 : x_safe;
-
-            c = lv_img_buf_get_px_color(&line_img, x_safe, 0, color);
-            if(has_alpha) opa = lv_img_buf_get_px_alpha(&line_img, x_safe, 0);
-
-            rsum += c.ch.red;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-            gsum += (c.ch.green_h << 3) + c.ch.green_l;
-#else
-            gsum += c.ch.green;
-#endif
-            bsum += c.ch.blue;
-            if(has_alpha) asum += opa;
-        }
-
-        /*Just to indicate that the px is visible*/
-        if(has_alpha == false) asum = LV_OPA_COVER;
-
-        for(x = a.x1; x <= a.x2; x++) {
-
-            if(asum) {
-                c.ch.red = rsum / r;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-                uint8_t gtmp = gsum / r;
-                c.ch.green_h = gtmp >> 3;
-                c.ch.green_l = gtmp & 0x7;
-#else
-                c.ch.green = gsum / r;
-#endif
-                c.ch.blue = bsum / r;
-                if(has_alpha) opa = asum / r;
-
-                lv_img_buf_set_px_color(&ext->dsc, x, y, c);
-            }
-            if(has_alpha) lv_img_buf_set_px_alpha(&ext->dsc, x, y, opa);
-
-            x_safe = x - r_back;
-            x_safe = x_safe < 0 ? 0 : x_safe;
-            c = lv_img_buf_get_px_color(&line_img, x_safe, 0, color);
-            if(has_alpha) opa = lv_img_buf_get_px_alpha(&line_img, x_safe, 0);
-
-            rsum -= c.ch.red;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-            gsum -= (c.ch.green_h << 3) + c.ch.green_l;
-#else
-            gsum -= c.ch.green;
-#endif
-            bsum -= c.ch.blue;
-            if(has_alpha) asum -= opa;
+    get_blur_area(canvas, area, &a);
 
-            x_safe = x + 1 + r_front;
-            x_safe = x_safe > ext->dsc.header.w - 1 ? ext->dsc.header.w - 1 : x_safe;
-            c = lv_img_buf_get_px_color(&line_img, x_safe, 0, LV_COLOR_RED);
-            if(has_alpha) opa = lv_img_buf_get_px_alpha(&line_img, x_safe, 0);
+    if(blur_native(canvas, &a, r, false) == false) blur_hor_px(canvas, &a, r);
 
-            rsum += c.ch.red;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-            gsum += (c.ch.green_h << 3) + c.ch.green_l;
-#else
-            gsum += c.ch.green;
-#endif
-            bsum += c.ch.blue;
-            if(has_alpha) asum += opa;
-        }
-    }
     lv_obj_invalidate(canvas);
-
-    _lv_mem_buf_release(line_buf);
 }
 
 /**
@@ -522,131 +458,58 @@ void lv_canvas_blur_ver(lv_obj_t * canvas, const lv_area_t * area, uint16_t r)
 
     if(r == 0) return;
 
-    lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
-
     lv_area_t a;
-    if(area) {
-        lv_area_copy(&a, area);
-        if(a.x1 < 0) a.x1 = 0;
-        if(a.y1 < 0) a.y1 = 0;
-        if(a.x2 > ext->dsc.header.w - 1) a.x2 = ext->dsc.header.w - 1;
-        if(a.y2 > ext->dsc.header.h - 1) a.y2 = ext->dsc.header.h - 1;
-    }
-    else {
-        a.x1 = 0;
-        a.y1 = 0;
-        a.x2 = ext->dsc.header.w - 1;
-        a.y2 = ext->dsc.header.h - 1;
-    }
-
-    lv_color_t color = lv_obj_get_style_image_recolor(canvas, LV_CANVAS_PART_MAIN);
-
-    uint16_t r_back = r / 2;
-    uint16_t r_front = r / 2;
-
-    if((r & 0x1) == 0) r_back--;
-
-    bool has_alpha = lv_img_cf_has_alpha(ext->dsc.header.cf);
-    lv_coord_t col_w = lv_img_buf_get_img_size(1, ext->dsc.header.h, ext->dsc.header.cf);
-    uint8_t * col_buf = _lv_mem_buf_get(col_w);
-    lv_img_dsc_t line_img;
-
-    line_img.data = col_buf;
-    line_img.header.always_zero = 0;
-    line_img.header.w = 1;
-    line_img.header.h = ext->dsc.header.h;
-    line_img.header.cf = ext->dsc.header.cf;
-
-    lv_coord_t x;
-    lv_coord_t y;
-    lv_coord_t y_safe;
-
-    for(x = a.x1; x <= a.x2; x++) {
-        uint32_t asum = 0;
-        uint32_t rsum = 0;
-        uint32_t gsum = 0;
-        uint32_t bsum = 0;
-
-        lv_color_t c;
-        lv_opa_t opa = LV_OPA_COVER;
-
-        for(y = a.y1 - r_back; y <= a.y1 + r_front; y++) {
-            y_safe = y < 0 ? 0 : y;
-            y_safe = y_safe > ext->dsc.header.h - 1 ? ext->dsc.header.h - 1 : y_safe;
-
-            c = lv_img_buf_get_px_color(&ext->dsc, x, y_safe, color);
-            if(has_alpha) opa = lv_img_buf_get_px_alpha(&ext->dsc, x, y_safe);
-
-            lv_img_buf_set_px_color(&line_img, 0, y_safe, c);
-            if(has_alpha) lv_img_buf_set_px_alpha(&line_img, 0, y_safe, opa);
+    get_blur_area(canvas, area, &a);
 
-            rsum += c.ch.red;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-            gsum += (c.ch.green_h << 3) + c.ch.green_l;
-#else
-            gsum += c.ch.green;
-#endif
-            bsum += c.ch.blue;
-            if(has_alpha) asum += opa;
-        }
-
-        /*Just to indicate that the px is visible*/
-        if(has_alpha == false) asum = LV_OPA_COVER;
-
-        for(y = a.y1; y <= a.y2; y++) {
-            if(asum) {
-                c.ch.red = rsum / r;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-                uint8_t gtmp = gsum / r;
-                c.ch.green_h = gtmp >> 3;
-                c.ch.green_l = gtmp & 0x7;
-#else
-                c.ch.green = gsum / r;
-#endif
-                c.ch.blue = bsum / r;
-                if(has_alpha) opa = asum / r;
+    if(blur_native(canvas, &a, r, true) == false) blur_ver_px(canvas, &a, r);
 
-                lv_img_buf_set_px_color(&ext->dsc, x, y, c);
-            }
-            if(has_alpha) lv_img_buf_set_px_alpha(&ext->dsc, x, y, opa);
+    lv_obj_invalidate(canvas);
+}
 
-            y_safe = y - r_back;
-            y_safe = y_safe < 0 ? 0 : y_safe;
-            c = lv_img_buf_get_px_color(&line_img, 0, y_safe, color);
-            if(has_alpha) opa = lv_img_buf_get_px_alpha(&line_img, 0, y_safe);
+/**
+ * Apply an approximated gaussian blur on the canvas (3 horizontal and 3 vertical box blurs)
+ * @param canvas pointer to a canvas object
+ * @param area the area to blur. If `NULL` the whole canvas will be blurred.
+ * @param sigma standard deviation of the gaussian in pixels
+ */
+void lv_canvas_blur_gauss(lv_obj_t * canvas, const lv_area_t * area, uint16_t sigma)
+{
+    LV_ASSERT_OBJ(canvas, LV_OBJX_NAME);
 
-            rsum -= c.ch.red;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-            gsum -= (c.ch.green_h << 3) + c.ch.green_l;
-#else
-            gsum -= c.ch.green;
-#endif
-            bsum -= c.ch.blue;
-            if(has_alpha) asum -= opa;
+    if(sigma == 0) return;
 
-            y_safe = y + 1 + r_front;
-            y_safe = y_safe > ext->dsc.header.h - 1 ? ext->dsc.header.h - 1 : y_safe;
+    lv_area_t a;
+    get_blur_area(canvas, area, &a);
 
-            c = lv_img_buf_get_px_color(&ext->dsc, x, y_safe, color);
-            if(has_alpha) opa = lv_img_buf_get_px_alpha(&ext->dsc, x, y_safe);
+    /* Box sizes whose 3 passes approximate the gaussian the best.
+     * With the ideal width `sqrt(4 * sigma^2 + 1)` it's 2 boxes of `2 * sigma - 1` and one of `2 * sigma + 1`*/
+    uint16_t boxes[3];
+    boxes[0] = 2 * sigma - 1;
+    boxes[1] = 2 * sigma - 1;
+    boxes[2] = 2 * sigma + 1;
 
-            lv_img_buf_set_px_color(&line_img, 0, y_safe, c);
-            if(has_alpha) lv_img_buf_set_px_alpha(&line_img, 0, y_safe, opa);
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        if(blur_native(canvas, &a, boxes[i], false) == false) blur_hor_px(canvas, &a, boxes[i]);
+    }
 
-            rsum += c.ch.red;
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
-            gsum += (c.ch.green_h << 3) + c.ch.green_l;
-#else
-            gsum += c.ch.green;
-#endif
-            bsum += c.ch.blue;
-            if(has_alpha) asum += opa;
-        }
+    for(i = 0; i < 3; i++) {
+        if(blur_native(canvas, &a, boxes[i], true) == false) blur_ver_px(canvas, &a, boxes[i]);
     }
 
     lv_obj_invalidate(canvas);
+}
 
-    _lv_mem_buf_release(col_buf);
+/**
+ * Run the blur of the true color canvases in parts in parallel. Applies to all canvases.
+ * The horizontal blur is split into bands of rows, the vertical into bands of columns.
+ * @param cb a callback to run the parts (e.g. on worker threads) or `NULL` to run them in the caller's context
+ * @param part_cnt number of parts to split the blur into (e.g. the number of CPU cores)
+ */
+void lv_canvas_set_parallel_cb(lv_canvas_parallel_cb_t cb, uint32_t part_cnt)
+{
+    parallel_cb = cb;
+    parallel_part_cnt = part_cnt ? part_cnt : 1;
 }
 
 /**
@@ -684,6 +547,47 @@ void lv_canvas_fill_bg(lv_obj_t * canvas, lv_color_t color, lv_opa_t opa)
     lv_obj_invalidate(canvas);
 }
 
+/**
+ * Open a drawing context on the canvas to draw many things to it with `lv_canvas_draw_...()` functions.
+ * Until `lv_canvas_draw_end()` the draw functions don't need to set up drawing one by one
+ * and the canvas is invalidated only once, in `lv_canvas_draw_end()`.
+ * @param canvas pointer to a canvas object
+ * @return LV_RES_OK: the context is opened; LV_RES_INV: out of memory (the draw functions still work without it)
+ */
+lv_res_t lv_canvas_draw_begin(lv_obj_t * canvas)
+{
+    LV_ASSERT_OBJ(canvas, LV_OBJX_NAME);
+
+    lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
+    if(ext->draw_ctx) return LV_RES_OK;
+
+    draw_ctx_t * ctx = lv_mem_alloc(sizeof(draw_ctx_t));
+    LV_ASSERT_MEM(ctx);
+    if(ctx == NULL) return LV_RES_INV;
+
+    draw_ctx_init(ctx, &ext->dsc);
+    ext->draw_ctx = ctx;
+
+    return LV_RES_OK;
+}
+
+/**
+ * Close the drawing context opened by `lv_canvas_draw_begin()` and invalidate the canvas
+ * @param canvas pointer to a canvas object
+ */
+void lv_canvas_draw_end(lv_obj_t * canvas)
+{
+    LV_ASSERT_OBJ(canvas, LV_OBJX_NAME);
+
+    lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
+    if(ext->draw_ctx == NULL) return;
+
+    lv_mem_free(ext->draw_ctx);
+    ext->draw_ctx = NULL;
+
+    lv_obj_invalidate(canvas);
+}
+
 /**
  * Draw a rectangle on the canvas
  * @param canvas pointer to a canvas object
@@ -705,53 +609,29 @@ void lv_canvas_draw_rect(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord
         return;
     }
 
-    /* Create a dummy display to fool the lv_draw function.
-     * It will think it draws to real screen. */
-    lv_area_t mask;
-    mask.x1 = 0;
-    mask.x2 = dsc->header.w - 1;
-    mask.y1 = 0;
-    mask.y2 = dsc->header.h - 1;
-
     lv_area_t coords;
     coords.x1 = x;
     coords.y1 = y;
     coords.x2 = x + w - 1;
     coords.y2 = y + h - 1;
 
-    lv_disp_t disp;
-    _lv_memset_00(&disp, sizeof(lv_disp_t));
-
-    lv_disp_buf_t disp_buf;
-    lv_disp_buf_init(&disp_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
-    lv_area_copy(&disp_buf.area, &mask);
-
-    lv_disp_drv_init(&disp.driver);
-
-    disp.driver.buffer  = &disp_buf;
-    disp.driver.hor_res = dsc->header.w;
-    disp.driver.ver_res = dsc->header.h;
-
-    set_set_px_cb(&disp.driver, dsc->header.cf);
+    /* Draw with a dummy display to fool the lv_draw function.
+     * It will think it draws to real screen. */
+    draw_ctx_t tmp_ctx;
+    draw_ctx_t * ctx = draw_ctx_enter(canvas, &tmp_ctx);
 
 #if LV_ANTIALIAS
-
     /*Disable anti-aliasing if drawing with transparent color to chroma keyed canvas*/
     lv_color_t ctransp = LV_COLOR_TRANSP;
     if(dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED &&
        rect_dsc->bg_color.full == ctransp.full) {
-        disp.driver.antialiasing = 0;
+        ctx->disp.driver.antialiasing = 0;
     }
 #endif
 
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&disp);
-
-    lv_draw_rect(&coords, &mask, rect_dsc);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
+    lv_draw_rect(&coords, &ctx->clip, rect_dsc);
 
-    lv_obj_invalidate(canvas);
+    draw_ctx_leave(canvas, ctx);
 }
 
 /**
@@ -777,37 +657,16 @@ void lv_canvas_draw_text(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord
         return;
     }
 
-    /* Create a dummy display to fool the lv_draw function.
-     * It will think it draws to real screen. */
-    lv_area_t mask;
-    mask.x1 = 0;
-    mask.x2 = dsc->header.w - 1;
-    mask.y1 = 0;
-    mask.y2 = dsc->header.h - 1;
-
     lv_area_t coords;
     coords.x1 = x;
     coords.y1 = y;
     coords.x2 = x + max_w - 1;
     coords.y2 = dsc->header.h - 1;
 
-    lv_disp_t disp;
-    _lv_memset_00(&disp, sizeof(lv_disp_t));
-
-    lv_disp_buf_t disp_buf;
-    lv_disp_buf_init(&disp_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
-    lv_area_copy(&disp_buf.area, &mask);
-
-    lv_disp_drv_init(&disp.driver);
-
-    disp.driver.buffer  = &disp_buf;
-    disp.driver.hor_res = dsc->header.w;
-    disp.driver.ver_res = dsc->header.h;
-
-    set_set_px_cb(&disp.driver, dsc->header.cf);
-
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&disp);
+    /* Draw with a dummy display to fool the lv_draw function.
+     * It will think it draws to real screen. */
+    draw_ctx_t tmp_ctx;
+    draw_ctx_t * ctx = draw_ctx_enter(canvas, &tmp_ctx);
 
     lv_txt_flag_t flag;
     switch(align) {
@@ -827,11 +686,9 @@ void lv_canvas_draw_text(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord
 
     label_draw_dsc->flag = flag;
 
-    lv_draw_label(&coords, &mask, label_draw_dsc, txt, NULL);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
+    lv_draw_label(&coords, &ctx->clip, label_draw_dsc, txt, NULL);
 
-    lv_obj_invalidate(canvas);
+    draw_ctx_leave(canvas, ctx);
 }
 
 /**
@@ -852,14 +709,6 @@ void lv_canvas_draw_img(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, const voi
         return;
     }
 
-    /* Create a dummy display to fool the lv_draw function.
-     * It will think it draws to real screen. */
-    lv_area_t mask;
-    mask.x1 = 0;
-    mask.x2 = dsc->header.w - 1;
-    mask.y1 = 0;
-    mask.y2 = dsc->header.h - 1;
-
     lv_img_header_t header;
     lv_res_t res = lv_img_decoder_get_info(src, &header);
     if(res != LV_RES_OK) {
@@ -873,29 +722,14 @@ void lv_canvas_draw_img(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, const voi
     coords.x2 = x + header.w - 1;
     coords.y2 = y + header.h - 1;
 
-    lv_disp_t disp;
-    _lv_memset_00(&disp, sizeof(lv_disp_t));
-
-    lv_disp_buf_t disp_buf;
-    lv_disp_buf_init(&disp_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
-    lv_area_copy(&disp_buf.area, &mask);
-
-    lv_disp_drv_init(&disp.driver);
-
-    disp.driver.buffer  = &disp_buf;
-    disp.driver.hor_res = dsc->header.w;
-    disp.driver.ver_res = dsc->header.h;
-
-    set_set_px_cb(&disp.driver, dsc->header.cf);
-
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&disp);
-
-    lv_draw_img(&coords, &mask, src, img_draw_dsc);
+    /* Draw with a dummy display to fool the lv_draw function.
+     * It will think it draws to real screen. */
+    draw_ctx_t tmp_ctx;
+    draw_ctx_t * ctx = draw_ctx_enter(canvas, &tmp_ctx);
 
-    _lv_refr_set_disp_refreshing(refr_ori);
+    lv_draw_img(&coords, &ctx->clip, src, img_draw_dsc);
 
-    lv_obj_invalidate(canvas);
+    draw_ctx_leave(canvas, ctx);
 }
 
 /**
@@ -916,49 +750,26 @@ void lv_canvas_draw_line(lv_obj_t * canvas, const lv_point_t points[], uint32_t
         LV_LOG_WARN("lv_canvas_draw_line: can't draw to LV_IMG_CF_INDEXED canvas");
         return;
     }
-    /* Create a dummy display to fool the lv_draw function.
+    /* Draw with a dummy display to fool the lv_draw function.
      * It will think it draws to real screen. */
-    lv_area_t mask;
-    mask.x1 = 0;
-    mask.x2 = dsc->header.w - 1;
-    mask.y1 = 0;
-    mask.y2 = dsc->header.h - 1;
-
-    lv_disp_t disp;
-    _lv_memset_00(&disp, sizeof(lv_disp_t));
-
-    lv_disp_buf_t disp_buf;
-    lv_disp_buf_init(&disp_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
-    lv_area_copy(&disp_buf.area, &mask);
-
-    lv_disp_drv_init(&disp.driver);
-
-    disp.driver.buffer  = &disp_buf;
-    disp.driver.hor_res = dsc->header.w;
-    disp.driver.ver_res = dsc->header.h;
-
-    set_set_px_cb(&disp.driver, dsc->header.cf);
+    draw_ctx_t tmp_ctx;
+    draw_ctx_t * ctx = draw_ctx_enter(canvas, &tmp_ctx);
 
 #if LV_ANTIALIAS
     /*Disable anti-aliasing if drawing with transparent color to chroma keyed canvas*/
     lv_color_t ctransp = LV_COLOR_TRANSP;
     if(dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED &&
        line_draw_dsc->color.full == ctransp.full) {
-        disp.driver.antialiasing = 0;
+        ctx->disp.driver.antialiasing = 0;
     }
 #endif
 
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&disp);
-
     uint32_t i;
     for(i = 0; i < point_cnt - 1; i++) {
-        lv_draw_line(&points[i], &points[i + 1], &mask, line_draw_dsc);
+        lv_draw_line(&points[i], &points[i + 1], &ctx->clip, line_draw_dsc);
     }
 
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    lv_obj_invalidate(canvas);
+    draw_ctx_leave(canvas, ctx);
 }
 
 /**
@@ -980,46 +791,23 @@ void lv_canvas_draw_polygon(lv_obj_t * canvas, const lv_point_t points[], uint32
         return;
     }
 
-    /* Create a dummy display to fool the lv_draw function.
+    /* Draw with a dummy display to fool the lv_draw function.
      * It will think it draws to real screen. */
-    lv_area_t mask;
-    mask.x1 = 0;
-    mask.x2 = dsc->header.w - 1;
-    mask.y1 = 0;
-    mask.y2 = dsc->header.h - 1;
-
-    lv_disp_t disp;
-    _lv_memset_00(&disp, sizeof(lv_disp_t));
-
-    lv_disp_buf_t disp_buf;
-    lv_disp_buf_init(&disp_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
-    lv_area_copy(&disp_buf.area, &mask);
-
-    lv_disp_drv_init(&disp.driver);
-
-    disp.driver.buffer  = &disp_buf;
-    disp.driver.hor_res = dsc->header.w;
-    disp.driver.ver_res = dsc->header.h;
-
-    set_set_px_cb(&disp.driver, dsc->header.cf);
+    draw_ctx_t tmp_ctx;
+    draw_ctx_t * ctx = draw_ctx_enter(canvas, &tmp_ctx);
 
 #if LV_ANTIALIAS
     /*Disable anti-aliasing if drawing with transparent color to chroma keyed canvas*/
     lv_color_t ctransp = LV_COLOR_TRANSP;
     if(dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED &&
        poly_draw_dsc->bg_color.full == ctransp.full) {
-        disp.driver.antialiasing = 0;
+        ctx->disp.driver.antialiasing = 0;
     }
 #endif
 
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&disp);
+    lv_draw_polygon(points, point_cnt, &ctx->clip, poly_draw_dsc);
 
-    lv_draw_polygon(points, point_cnt, &mask, poly_draw_dsc);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    lv_obj_invalidate(canvas);
+    draw_ctx_leave(canvas, ctx);
 }
 
 /**
@@ -1044,46 +832,23 @@ void lv_canvas_draw_arc(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord_
         return;
     }
 
-    /* Create a dummy display to fool the lv_draw function.
+    /* Draw with a dummy display to fool the lv_draw function.
      * It will think it draws to real screen. */
-    lv_area_t mask;
-    mask.x1 = 0;
-    mask.x2 = dsc->header.w - 1;
-    mask.y1 = 0;
-    mask.y2 = dsc->header.h - 1;
-
-    lv_disp_t disp;
-    _lv_memset_00(&disp, sizeof(lv_disp_t));
-
-    lv_disp_buf_t disp_buf;
-    lv_disp_buf_init(&disp_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
-    lv_area_copy(&disp_buf.area, &mask);
-
-    lv_disp_drv_init(&disp.driver);
-
-    disp.driver.buffer  = &disp_buf;
-    disp.driver.hor_res = dsc->header.w;
-    disp.driver.ver_res = dsc->header.h;
-
-    set_set_px_cb(&disp.driver, dsc->header.cf);
+    draw_ctx_t tmp_ctx;
+    draw_ctx_t * ctx = draw_ctx_enter(canvas, &tmp_ctx);
 
 #if LV_ANTIALIAS
     /*Disable anti-aliasing if drawing with transparent color to chroma keyed canvas*/
     lv_color_t ctransp = LV_COLOR_TRANSP;
     if(dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED &&
        arc_draw_dsc->color.full == ctransp.full) {
-        disp.driver.antialiasing = 0;
+        ctx->disp.driver.antialiasing = 0;
     }
 #endif
 
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&disp);
+    lv_draw_arc(x, y, r,  start_angle, end_angle, &ctx->clip, arc_draw_dsc);
 
-    lv_draw_arc(x, y, r,  start_angle, end_angle, &mask, arc_draw_dsc);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    lv_obj_invalidate(canvas);
+    draw_ctx_leave(canvas, ctx);
 }
 
 /**********************
@@ -1107,7 +872,11 @@ static lv_res_t lv_canvas_signal(lv_obj_t * canvas, lv_signal_t sign, void * par
     if(sign == LV_SIGNAL_GET_TYPE) return lv_obj_handle_get_type_signal(param, LV_OBJX_NAME);
 
     if(sign == LV_SIGNAL_CLEANUP) {
-        /*Nothing to cleanup. (No dynamically allocated memory in 'ext')*/
+        lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
+        if(ext->draw_ctx) {
+            lv_mem_free(ext->draw_ctx);
+            ext->draw_ctx = NULL;
+        }
     }
 
     return res;
@@ -1117,7 +886,10 @@ static void set_set_px_cb(lv_disp_drv_t * disp_drv, lv_img_cf_t cf)
 {
     switch(cf) {
         case LV_IMG_CF_TRUE_COLOR_ALPHA:
-            disp_drv->set_px_cb = set_px_true_color_alpha;
+        case LV_IMG_CF_ALPHA_8BIT:
+            /*Drawn directly by the blend functions*/
+            disp_drv->set_px_cb = NULL;
+            disp_drv->buf_cf = cf;
             break;
         case LV_IMG_CF_ALPHA_1BIT:
             disp_drv->set_px_cb = set_px_cb_alpha1;
@@ -1128,14 +900,78 @@ static void set_set_px_cb(lv_disp_drv_t * disp_drv, lv_img_cf_t cf)
         case LV_IMG_CF_ALPHA_4BIT:
             disp_drv->set_px_cb = set_px_cb_alpha4;
             break;
-        case LV_IMG_CF_ALPHA_8BIT:
-            disp_drv->set_px_cb = set_px_cb_alpha8;
-            break;
         default:
             disp_drv->set_px_cb = NULL;
     }
 }
 
+/**
+ * Initialize a dummy display which draws to the buffer of a canvas
+ * @param ctx pointer to a context to initialize
+ * @param dsc the image descriptor of the canvas
+ */
+static void draw_ctx_init(draw_ctx_t * ctx, const lv_img_dsc_t * dsc)
+{
+    ctx->clip.x1 = 0;
+    ctx->clip.x2 = dsc->header.w - 1;
+    ctx->clip.y1 = 0;
+    ctx->clip.y2 = dsc->header.h - 1;
+
+    _lv_memset_00(&ctx->disp, sizeof(lv_disp_t));
+
+    lv_disp_buf_init(&ctx->disp_buf, (void *)dsc->data, NULL, dsc->header.w * dsc->header.h);
+    lv_area_copy(&ctx->disp_buf.area, &ctx->clip);
+
+    lv_disp_drv_init(&ctx->disp.driver);
+
+    ctx->disp.driver.buffer  = &ctx->disp_buf;
+    ctx->disp.driver.hor_res = dsc->header.w;
+    ctx->disp.driver.ver_res = dsc->header.h;
+
+    set_set_px_cb(&ctx->disp.driver, dsc->header.cf);
+}
+
+/**
+ * Start drawing to a canvas: use the context opened by `lv_canvas_draw_begin()` or initialize a temporary one
+ * and make it the refreshed display
+ * @param canvas pointer to a canvas object
+ * @param tmp_ctx context to initialize if the canvas has no opened context
+ * @return the context to use
+ */
+static draw_ctx_t * draw_ctx_enter(lv_obj_t * canvas, draw_ctx_t * tmp_ctx)
+{
+    lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
+    draw_ctx_t * ctx = ext->draw_ctx;
+    if(ctx == NULL) {
+        ctx = tmp_ctx;
+        draw_ctx_init(ctx, &ext->dsc);
+    }
+
+#if LV_ANTIALIAS
+    /*Might be disabled by the previous draw*/
+    ctx->disp.driver.antialiasing = 1;
+#endif
+
+    ctx->refr_ori = _lv_refr_get_disp_refreshing();
+    _lv_refr_set_disp_refreshing(&ctx->disp);
+
+    return ctx;
+}
+
+/**
+ * Finish drawing to a canvas
+ * @param canvas pointer to a canvas object
+ * @param ctx the context returned by `draw_ctx_enter()`
+ */
+static void draw_ctx_leave(lv_obj_t * canvas, draw_ctx_t * ctx)
+{
+    _lv_refr_set_disp_refreshing(ctx->refr_ori);
+
+    /*With an opened context the canvas is invalidated only in `lv_canvas_draw_end()`*/
+    lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
+    if(ext->draw_ctx == NULL) lv_obj_invalidate(canvas);
+}
+
 static void set_px_cb_alpha1(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
                              lv_color_t color, lv_opa_t opa)
 {
@@ -1178,20 +1014,6 @@ static void set_px_cb_alpha4(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t
     set_px_alpha_generic(&d, x, y, color, opa);
 }
 
-static void set_px_cb_alpha8(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x, lv_coord_t y,
-                             lv_color_t color, lv_opa_t opa)
-{
-    (void) disp_drv; /*Unused*/
-
-    if(opa <= LV_OPA_MIN) return;
-    lv_img_dsc_t d;
-    d.data = buf;
-    d.header.w = buf_w;
-    d.header.cf = LV_IMG_CF_ALPHA_8BIT;
-
-    set_px_alpha_generic(&d, x, y, color, opa);
-}
-
 static void set_px_alpha_generic(lv_img_dsc_t * d, lv_coord_t x, lv_coord_t y, lv_color_t color, lv_opa_t opa)
 {
     d->header.always_zero = 0;
@@ -1206,30 +1028,491 @@ static void set_px_alpha_generic(lv_img_dsc_t * d, lv_coord_t x, lv_coord_t y, l
     lv_img_buf_set_px_alpha(d, x, y, br);
 }
 
-static void set_px_true_color_alpha(lv_disp_drv_t * disp_drv, uint8_t * buf, lv_coord_t buf_w, lv_coord_t x,
-                                    lv_coord_t y,
-                                    lv_color_t color, lv_opa_t opa)
+static void get_blur_area(lv_obj_t * canvas, const lv_area_t * area, lv_area_t * a)
 {
-    (void) disp_drv; /*Unused*/
+    lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
 
-    if(opa <= LV_OPA_MIN) return;
-    lv_img_dsc_t d;
-    d.data = buf;
-    d.header.always_zero = 0;
-    d.header.h = LV_VER_RES_MAX;
-    d.header.w = buf_w;
-    d.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    if(area) {
+        lv_area_copy(a, area);
+        if(a->x1 < 0) a->x1 = 0;
+        if(a->y1 < 0) a->y1 = 0;
+        if(a->x2 > ext->dsc.header.w - 1) a->x2 = ext->dsc.header.w - 1;
+        if(a->y2 > ext->dsc.header.h - 1) a->y2 = ext->dsc.header.h - 1;
+    }
+    else {
+        a->x1 = 0;
+        a->y1 = 0;
+        a->x2 = ext->dsc.header.w - 1;
+        a->y2 = ext->dsc.header.h - 1;
+    }
+}
 
-    lv_color_t bg_color = lv_img_buf_get_px_color(&d, x, y, LV_COLOR_BLACK);
-    lv_opa_t bg_opa = lv_img_buf_get_px_alpha(&d, x, y);
+/**
+ * Blur horizontally pixel by pixel. Used with the non true color formats.
+ */
+static void blur_hor_px(lv_obj_t * canvas, const lv_area_t * area, uint16_t r)
+{
+    lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
+    lv_area_t a;
+    lv_area_copy(&a, area);
 
-    lv_opa_t res_opa;
-    lv_color_t res_color;
+    lv_color_t color = lv_obj_get_style_image_recolor(canvas, LV_CANVAS_PART_MAIN);
 
-    lv_color_mix_with_alpha(bg_color, bg_opa, color, opa, &res_color, &res_opa);
+    uint16_t r_back = r / 2;
+    uint16_t r_front = r / 2;
+
+    if((r & 0x1) == 0) r_back--;
+
+    bool has_alpha = lv_img_cf_has_alpha(ext->dsc.header.cf);
+
+    lv_coord_t line_w = lv_img_buf_get_img_size(ext->dsc.header.w, 1, ext->dsc.header.cf);
+    uint8_t * line_buf = _lv_mem_buf_get(line_w);
+
+    lv_img_dsc_t line_img;
+    line_img.data = line_buf;
+    line_img.header.always_zero = 0;
+    line_img.header.w = ext->dsc.header.w;
+    line_img.header.h = 1;
+    line_img.header.cf = ext->dsc.header.cf;
 
-    lv_img_buf_set_px_alpha(&d, x, y, res_opa);
-    lv_img_buf_set_px_color(&d, x, y, res_color);
+    lv_coord_t x;
+    lv_coord_t y;
+    lv_coord_t x_safe;
+
+    for(y = a.y1; y <= a.y2; y++) {
+        uint32_t asum = 0;
+        uint32_t rsum = 0;
+        uint32_t gsum = 0;
+        uint32_t bsum = 0;
+
+        lv_color_t c;
+        lv_opa_t opa = LV_OPA_TRANSP;
+        _lv_memcpy(line_buf, &ext->dsc.data[y * line_w], line_w);
+
+        for(x = a.x1 - r_back; x <= a.x1 + r_front; x++) {
+            x_safe = x < 0 ? 0 : x;
+            x_safe = x_safe > ext->dsc.header.w - 1 ? ext->dsc.header.w - 1 : x_safe;
+
+            c = lv_img_buf_get_px_color(&line_img, x_safe, 0, color);
+            if(has_alpha) opa = lv_img_buf_get_px_alpha(&line_img, x_safe, 0);
+
+            rsum += c.ch.red;
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+            gsum += (c.ch.green_h << 3) + c.ch.green_l;
+#else
+            gsum += c.ch.green;
+#endif
+            bsum += c.ch.blue;
+            if(has_alpha) asum += opa;
+        }
+
+        /*Just to indicate that the px is visible*/
+        if(has_alpha == false) asum = LV_OPA_COVER;
+
+        for(x = a.x1; x <= a.x2; x++) {
+
+            if(asum) {
+                c.ch.red = rsum / r;
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+                uint8_t gtmp = gsum / r;
+                c.ch.green_h = gtmp >> 3;
+                c.ch.green_l = gtmp & 0x7;
+#else
+                c.ch.green = gsum / r;
+#endif
+                c.ch.blue = bsum / r;
+                if(has_alpha) opa = asum / r;
+
+                lv_img_buf_set_px_color(&ext->dsc, x, y, c);
+            }
+            if(has_alpha) lv_img_buf_set_px_alpha(&ext->dsc, x, y, opa);
+
+            x_safe = x - r_back;
+            x_safe = x_safe < 0 ? 0 : x_safe;
+            c = lv_img_buf_get_px_color(&line_img, x_safe, 0, color);
+            if(has_alpha) opa = lv_img_buf_get_px_alpha(&line_img, x_safe, 0);
+
+            rsum -= c.ch.red;
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+            gsum -= (c.ch.green_h << 3) + c.ch.green_l;
+#else
+            gsum -= c.ch.green;
+#endif
+            bsum -= c.ch.blue;
+            if(has_alpha) asum -= opa;
+
+            x_safe = x + 1 + r_front;
+            x_safe = x_safe > ext->dsc.header.w - 1 ? ext->dsc.header.w - 1 : x_safe;
+            c = lv_img_buf_get_px_color(&line_img, x_safe, 0, LV_COLOR_RED);
+            if(has_alpha) opa = lv_img_buf_get_px_alpha(&line_img, x_safe, 0);
+
+            rsum += c.ch.red;
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+            gsum += (c.ch.green_h << 3) + c.ch.green_l;
+#else
+            gsum += c.ch.green;
+#endif
+            bsum += c.ch.blue;
+            if(has_alpha) asum += opa;
+        }
+    }
+    _lv_mem_buf_release(line_buf);
+}
+
+/**
+ * Blur vertically pixel by pixel. Used with the non true color formats.
+ */
+static void blur_ver_px(lv_obj_t * canvas, const lv_area_t * area, uint16_t r)
+{
+    lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
+    lv_area_t a;
+    lv_area_copy(&a, area);
+
+    lv_color_t color = lv_obj_get_style_image_recolor(canvas, LV_CANVAS_PART_MAIN);
+
+    uint16_t r_back = r / 2;
+    uint16_t r_front = r / 2;
+
+    if((r & 0x1) == 0) r_back--;
+
+    bool has_alpha = lv_img_cf_has_alpha(ext->dsc.header.cf);
+    lv_coord_t col_w = lv_img_buf_get_img_size(1, ext->dsc.header.h, ext->dsc.header.cf);
+    uint8_t * col_buf = _lv_mem_buf_get(col_w);
+    lv_img_dsc_t line_img;
+
+    line_img.data = col_buf;
+    line_img.header.always_zero = 0;
+    line_img.header.w = 1;
+    line_img.header.h = ext->dsc.header.h;
+    line_img.header.cf = ext->dsc.header.cf;
+
+    lv_coord_t x;
+    lv_coord_t y;
+    lv_coord_t y_safe;
+
+    for(x = a.x1; x <= a.x2; x++) {
+        uint32_t asum = 0;
+        uint32_t rsum = 0;
+        uint32_t gsum = 0;
+        uint32_t bsum = 0;
+
+        lv_color_t c;
+        lv_opa_t opa = LV_OPA_COVER;
+
+        for(y = a.y1 - r_back; y <= a.y1 + r_front; y++) {
+            y_safe = y < 0 ? 0 : y;
+            y_safe = y_safe > ext->dsc.header.h - 1 ? ext->dsc.header.h - 1 : y_safe;
+
+            c = lv_img_buf_get_px_color(&ext->dsc, x, y_safe, color);
+            if(has_alpha) opa = lv_img_buf_get_px_alpha(&ext->dsc, x, y_safe);
+
+            lv_img_buf_set_px_color(&line_img, 0, y_safe, c);
+            if(has_alpha) lv_img_buf_set_px_alpha(&line_img, 0, y_safe, opa);
+
+            rsum += c.ch.red;
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+            gsum += (c.ch.green_h << 3) + c.ch.green_l;
+#else
+            gsum += c.ch.green;
+#endif
+            bsum += c.ch.blue;
+            if(has_alpha) asum += opa;
+        }
+
+        /*Just to indicate that the px is visible*/
+        if(has_alpha == false) asum = LV_OPA_COVER;
+
+        for(y = a.y1; y <= a.y2; y++) {
+            if(asum) {
+                c.ch.red = rsum / r;
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+                uint8_t gtmp = gsum / r;
+                c.ch.green_h = gtmp >> 3;
+                c.ch.green_l = gtmp & 0x7;
+#else
+                c.ch.green = gsum / r;
+#endif
+                c.ch.blue = bsum / r;
+                if(has_alpha) opa = asum / r;
+
+                lv_img_buf_set_px_color(&ext->dsc, x, y, c);
+            }
+            if(has_alpha) lv_img_buf_set_px_alpha(&ext->dsc, x, y, opa);
+
+            y_safe = y - r_back;
+            y_safe = y_safe < 0 ? 0 : y_safe;
+            c = lv_img_buf_get_px_color(&line_img, 0, y_safe, color);
+            if(has_alpha) opa = lv_img_buf_get_px_alpha(&line_img, 0, y_safe);
+
+            rsum -= c.ch.red;
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+            gsum -= (c.ch.green_h << 3) + c.ch.green_l;
+#else
+            gsum -= c.ch.green;
+#endif
+            bsum -= c.ch.blue;
+            if(has_alpha) asum -= opa;
+
+            y_safe = y + 1 + r_front;
+            y_safe = y_safe > ext->dsc.header.h - 1 ? ext->dsc.header.h - 1 : y_safe;
+
+            c = lv_img_buf_get_px_color(&ext->dsc, x, y_safe, color);
+            if(has_alpha) opa = lv_img_buf_get_px_alpha(&ext->dsc, x, y_safe);
+
+            lv_img_buf_set_px_color(&line_img, 0, y_safe, c);
+            if(has_alpha) lv_img_buf_set_px_alpha(&line_img, 0, y_safe, opa);
+
+            rsum += c.ch.red;
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+            gsum += (c.ch.green_h << 3) + c.ch.green_l;
+#else
+            gsum += c.ch.green;
+#endif
+            bsum += c.ch.blue;
+            if(has_alpha) asum += opa;
+        }
+    }
+
+    _lv_mem_buf_release(col_buf);
+}
+
+/**
+ * Blur the true color canvases row by row on the raw pixels.
+ * The horizontal pass slides a window on a copy of the row.
+ * The vertical pass also walks the rows and slides the windows of all columns at once,
+ * keeping only the original pixels of the rows which are still in the window.
+ * @param canvas pointer to a canvas object
+ * @param a the area to blur, already clipped to the canvas
+ * @param r the size of the window
+ * @param ver true: vertical blur; false: horizontal blur
+ * @return true: blurred; false: the format is not supported or no memory, blur it pixel by pixel
+ */
+static bool blur_native(lv_obj_t * canvas, const lv_area_t * a, uint16_t r, bool ver)
+{
+    lv_canvas_ext_t * ext = lv_obj_get_ext_attr(canvas);
+    lv_img_cf_t cf = ext->dsc.header.cf;
+    if(cf != LV_IMG_CF_TRUE_COLOR && cf != LV_IMG_CF_TRUE_COLOR_ALPHA && cf != LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) {
+        return false;
+    }
+
+    /*Larger windows could make the division by multiplication inaccurate*/
+    if(r > BLUR_R_MAX) return false;
+    if(lv_area_get_width(a) <= 0 || lv_area_get_height(a) <= 0) return true;
+
+    blur_job_t job;
+    job.img = &ext->dsc;
+    lv_area_copy(&job.area, a);
+    job.r_back = r / 2;
+    job.r_front = r / 2;
+    if((r & 0x1) == 0) job.r_back--;
+    job.inv = r == 1 ? 0 : (uint32_t)((((uint64_t)1 << 32) + r - 1) / r);
+    job.has_alpha = lv_img_cf_has_alpha(cf) ? 1 : 0;
+    job.px_size = job.has_alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    job.ver = ver ? 1 : 0;
+
+    lv_coord_t len = ver ? lv_area_get_width(a) : lv_area_get_height(a);
+    job.part_cnt = parallel_cb ? parallel_part_cnt : 1;
+    if(job.part_cnt > (uint32_t)len) job.part_cnt = len;
+
+    if(ver) {
+        /*Every part needs the sums of its columns and a ring of the original rows still in the window*/
+        lv_coord_t band_w = (len + job.part_cnt - 1) / job.part_cnt;
+        job.ring_h = LV_MATH_MIN(job.r_back + 1, lv_area_get_height(a));
+        job.part_buf_size = band_w * (sizeof(blur_sum_t) + job.ring_h * job.px_size);
+    }
+    else {
+        /*Every part needs a copy of the row*/
+        job.ring_h = 0;
+        job.part_buf_size = ext->dsc.header.w * job.px_size;
+    }
+
+    /*Keep the sums of the next part aligned*/
+    job.part_buf_size = (job.part_buf_size + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1);
+
+    job.buf = lv_mem_alloc(job.part_buf_size * job.part_cnt);
+    if(job.buf == NULL) {
+        LV_LOG_WARN("lv_canvas_blur: no memory for the row buffers, blur pixel by pixel");
+        return false;
+    }
+
+    if(job.part_cnt > 1) parallel_cb(blur_part_cb, &job, job.part_cnt);
+    else blur_part_cb(&job, 0);
+
+    lv_mem_free(job.buf);
+    return true;
+}
+
+/**
+ * Blur a band of rows (horizontal blur) or columns (vertical blur).
+ * Called by `blur_native` or in parallel by the `lv_canvas_parallel_cb_t` callback.
+ */
+static void blur_part_cb(void * user_data, uint32_t part)
+{
+    const blur_job_t * job = user_data;
+    uint8_t * buf = job->buf + part * job->part_buf_size;
+
+    if(job->ver) {
+        lv_coord_t w = lv_area_get_width(&job->area);
+        lv_coord_t x1 = job->area.x1 + (w * part) / job->part_cnt;
+        lv_coord_t x2 = job->area.x1 + (w * (part + 1)) / job->part_cnt - 1;
+        blur_ver_cols(job, x1, x2, buf);
+    }
+    else {
+        lv_coord_t h = lv_area_get_height(&job->area);
+        lv_coord_t y1 = job->area.y1 + (h * part) / job->part_cnt;
+        lv_coord_t y2 = job->area.y1 + (h * (part + 1)) / job->part_cnt - 1;
+        blur_hor_rows(job, y1, y2, buf);
+    }
+}
+
+static void blur_hor_rows(const blur_job_t * job, lv_coord_t y1, lv_coord_t y2, uint8_t * row_buf)
+{
+    const lv_area_t * a = &job->area;
+    lv_coord_t w = job->img->header.w;
+    uint8_t px_size = job->px_size;
+    bool has_alpha = job->has_alpha;
+    uint32_t row_size = w * px_size;
+
+    lv_coord_t y;
+    for(y = y1; y <= y2; y++) {
+        uint8_t * row = (uint8_t *)job->img->data + y * row_size;
+
+        /*Only the original pixels can be used*/
+        _lv_memcpy(row_buf, row, row_size);
+
+        blur_sum_t sum;
+        _lv_memset_00(&sum, sizeof(sum));
+
+        lv_coord_t x;
+        for(x = a->x1 - job->r_back; x <= a->x1 + job->r_front; x++) {
+            lv_coord_t x_safe = LV_MATH_MIN(LV_MATH_MAX(x, 0), w - 1);
+            blur_sum_add(&sum, &row_buf[x_safe * px_size], has_alpha);
+        }
+
+        uint8_t * dst = &row[a->x1 * px_size];
+        for(x = a->x1; x <= a->x2; x++) {
+            blur_px_set(dst, &sum, job);
+            dst += px_size;
+
+            lv_coord_t x_out = LV_MATH_MAX(x - job->r_back, 0);
+            lv_coord_t x_in = LV_MATH_MIN(x + 1 + job->r_front, w - 1);
+            blur_sum_sub(&sum, &row_buf[x_out * px_size], has_alpha);
+            blur_sum_add(&sum, &row_buf[x_in * px_size], has_alpha);
+        }
+    }
+}
+
+static void blur_ver_cols(const blur_job_t * job, lv_coord_t x1, lv_coord_t x2, uint8_t * buf)
+{
+    const lv_area_t * a = &job->area;
+    lv_coord_t h = job->img->header.h;
+    uint8_t px_size = job->px_size;
+    bool has_alpha = job->has_alpha;
+    uint32_t row_size = job->img->header.w * px_size;
+    uint8_t * data = (uint8_t *)job->img->data + x1 * px_size;
+    lv_coord_t cnt = x2 - x1 + 1;
+    uint32_t seg_size = cnt * px_size;
+
+    blur_sum_t * sums = (blur_sum_t *)buf;
+    uint8_t * ring = buf + cnt * sizeof(blur_sum_t);
+    _lv_memset_00(sums, cnt * sizeof(blur_sum_t));
+
+    lv_coord_t i;
+    lv_coord_t y;
+    for(y = a->y1 - job->r_back; y <= a->y1 + job->r_front; y++) {
+        lv_coord_t y_safe = LV_MATH_MIN(LV_MATH_MAX(y, 0), h - 1);
+        const uint8_t * src = data + y_safe * row_size;
+        for(i = 0; i < cnt; i++) {
+            blur_sum_add(&sums[i], src, has_alpha);
+            src += px_size;
+        }
+    }
+
+    for(y = a->y1; y <= a->y2; y++) {
+        uint8_t * row = data + y * row_size;
+
+        /*Save the original pixels because they are needed until they leave the window*/
+        _lv_memcpy(ring + ((y - a->y1) % job->ring_h) * seg_size, row, seg_size);
+
+        uint8_t * dst = row;
+        for(i = 0; i < cnt; i++) {
+            blur_px_set(dst, &sums[i], job);
+            dst += px_size;
+        }
+
+        if(y == a->y2) break;
+
+        /*The rows above the area are not modified, the others are in the ring*/
+        lv_coord_t y_out = LV_MATH_MAX(y - job->r_back, 0);
+        const uint8_t * src_out;
+        if(y_out < a->y1) src_out = data + y_out * row_size;
+        else src_out = ring + ((y_out - a->y1) % job->ring_h) * seg_size;
+
+        /*The rows below are not modified yet*/
+        lv_coord_t y_in = LV_MATH_MIN(y + 1 + job->r_front, h - 1);
+        const uint8_t * src_in = data + y_in * row_size;
+
+        for(i = 0; i < cnt; i++) {
+            blur_sum_sub(&sums[i], src_out, has_alpha);
+            blur_sum_add(&sums[i], src_in, has_alpha);
+            src_out += px_size;
+            src_in += px_size;
+        }
+    }
+}
+
+LV_ATTRIBUTE_FAST_MEM static inline void blur_sum_add(blur_sum_t * sum, const uint8_t * px, bool has_alpha)
+{
+    lv_color_t c;
+    _lv_memcpy_small(&c, px, sizeof(lv_color_t));
+    sum->r += LV_COLOR_GET_R(c);
+    sum->g += LV_COLOR_GET_G(c);
+    sum->b += LV_COLOR_GET_B(c);
+    if(has_alpha) sum->a += px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+}
+
+LV_ATTRIBUTE_FAST_MEM static inline void blur_sum_sub(blur_sum_t * sum, const uint8_t * px, bool has_alpha)
+{
+    lv_color_t c;
+    _lv_memcpy_small(&c, px, sizeof(lv_color_t));
+    sum->r -= LV_COLOR_GET_R(c);
+    sum->g -= LV_COLOR_GET_G(c);
+    sum->b -= LV_COLOR_GET_B(c);
+    if(has_alpha) sum->a -= px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+}
+
+/**
+ * Write the average of a window into a pixel.
+ * Like the pixel by pixel blur, keep the color of the fully transparent areas.
+ */
+LV_ATTRIBUTE_FAST_MEM static inline void blur_px_set(uint8_t * px, const blur_sum_t * sum, const blur_job_t * job)
+{
+    if(job->has_alpha && sum->a == 0) {
+        px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = LV_OPA_TRANSP;
+        return;
+    }
+
+    lv_color_t c;
+    c.full = 0;
+    LV_COLOR_SET_R(c, blur_div(sum->r, job->inv));
+    LV_COLOR_SET_G(c, blur_div(sum->g, job->inv));
+    LV_COLOR_SET_B(c, blur_div(sum->b, job->inv));
+    LV_COLOR_SET_A(c, LV_OPA_COVER);
+    _lv_memcpy_small(px, &c, sizeof(lv_color_t));
+
+    if(job->has_alpha) px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = (lv_opa_t)blur_div(sum->a, job->inv);
+}
+
+/**
+ * Divide a sum by the window size with a multiplication.
+ * It's exact while `255 * r^2 < 2^32` (see `BLUR_R_MAX`).
+ * @param sum the sum to divide
+ * @param inv `2^32 / r` rounded up, or 0 if `r == 1`
+ */
+LV_ATTRIBUTE_FAST_MEM static inline uint32_t blur_div(uint32_t sum, uint32_t inv)
+{
+    if(inv == 0) return sum;
+    return (uint32_t)(((uint64_t)sum * inv) >> 32);
 }
 
 #endif
@@ -33,6 +33,7 @@ typedef struct {
     lv_img_ext_t img; /*Ext. of ancestor*/
     /*New data for this type */
     lv_img_dsc_t dsc;
+    void * draw_ctx; /*Drawing context opened by `lv_canvas_draw_begin()`*/
 } lv_canvas_ext_t;
 
 /*Canvas part*/
@@ -41,6 +42,14 @@ enum {
 };
 typedef uint8_t lv_canvas_part_t;
 
+/**
+ * Run the independent parts of a canvas operation (e.g. of a blur) in parallel, e.g. on worker threads.
+ * Call `part_cb(user_data, i)` once for every `i` in `[0, part_cnt)` and return only when all of them are finished.
+ * `part_cb` doesn't call LVGL functions and doesn't allocate memory.
+ */
+typedef void (*lv_canvas_parallel_cb_t)(void (*part_cb)(void * user_data, uint32_t part), void * user_data,
+                                        uint32_t part_cnt);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -164,6 +173,22 @@ void lv_canvas_blur_hor(lv_obj_t * canvas, const lv_area_t * area, uint16_t r);
  */
 void lv_canvas_blur_ver(lv_obj_t * canvas, const lv_area_t * area, uint16_t r);
 
+/**
+ * Apply an approximated gaussian blur on the canvas (3 horizontal and 3 vertical box blurs)
+ * @param canvas pointer to a canvas object
+ * @param area the area to blur. If `NULL` the whole canvas will be blurred.
+ * @param sigma standard deviation of the gaussian in pixels
+ */
+void lv_canvas_blur_gauss(lv_obj_t * canvas, const lv_area_t * area, uint16_t sigma);
+
+/**
+ * Run the blur of the true color canvases in parts in parallel. Applies to all canvases.
+ * The horizontal blur is split into bands of rows, the vertical into bands of columns.
+ * @param cb a callback to run the parts (e.g. on worker threads) or `NULL` to run them in the caller's context
+ * @param part_cnt number of parts to split the blur into (e.g. the number of CPU cores)
+ */
+void lv_canvas_set_parallel_cb(lv_canvas_parallel_cb_t cb, uint32_t part_cnt);
+
 /**
  * Fill the canvas with color
  * @param canvas pointer to a canvas
@@ -172,6 +197,21 @@ void lv_canvas_blur_ver(lv_obj_t * canvas, const lv_area_t * area, uint16_t r);
  */
 void lv_canvas_fill_bg(lv_obj_t * canvas, lv_color_t color, lv_opa_t opa);
 
+/**
+ * Open a drawing context on the canvas to draw many things to it with `lv_canvas_draw_...()` functions.
+ * Until `lv_canvas_draw_end()` the draw functions don't need to set up drawing one by one
+ * and the canvas is invalidated only once, in `lv_canvas_draw_end()`.
+ * @param canvas pointer to a canvas object
+ * @return LV_RES_OK: the context is opened; LV_RES_INV: out of memory (the draw functions still work without it)
+ */
+lv_res_t lv_canvas_draw_begin(lv_obj_t * canvas);
+
+/**
+ * Close the drawing context opened by `lv_canvas_draw_begin()` and invalidate the canvas
+ * @param canvas pointer to a canvas object
+ */
+void lv_canvas_draw_end(lv_obj_t * canvas);
+
 /**
  * Draw a rectangle on the canvas
  * @param canvas pointer to a canvas object
@@ -12,6 +12,7 @@
 #include "../lv_misc/lv_debug.h"
 #include "../lv_core/lv_refr.h"
 #include "../lv_draw/lv_draw.h"
+#include "../lv_draw/lv_img_cache.h"
 #include "../lv_misc/lv_math.h"
 #include "../lv_themes/lv_theme.h"
 
@@ -33,6 +34,11 @@
 /**********************
  *      TYPEDEFS
  **********************/
+/*A dummy display to make the lv_draw functions draw to the strip buffer*/
+typedef struct {
+    lv_disp_t disp;
+    lv_disp_buf_t disp_buf;
+} strip_disp_t;
 
 typedef struct {
     const char * list_start;
@@ -50,11 +56,18 @@ static lv_style_list_t * lv_chart_get_style(lv_obj_t * chart, uint8_t part);
 
 static void draw_series_bg(lv_obj_t * chart, const lv_area_t * series_area, const lv_area_t * mask);
 static void draw_series_line(lv_obj_t * chart, const lv_area_t * series_area, const lv_area_t * clip_area);
+static void draw_series_line_part(const lv_point_t * p1, const lv_point_t * p2, const lv_area_t * series_area,
+                                  const lv_area_t * series_mask, const lv_draw_line_dsc_t * line_dsc,
+                                  const lv_draw_rect_dsc_t * area_dsc, lv_draw_mask_fade_param_t * mask_fade_p);
+static bool draw_series_strip(lv_obj_t * chart, const lv_area_t * series_area, const lv_area_t * clip_area);
+static void render_strip(lv_obj_t * chart, const lv_area_t * series_area, lv_coord_t x1, lv_coord_t x2);
+static void get_line_x_map(lv_obj_t * chart, const lv_area_t * series_area, int32_t * x_ofs, int32_t * x_w);
 static void draw_series_column(lv_obj_t * chart, const lv_area_t * series_area, const lv_area_t * clip_area);
 static void draw_cursors(lv_obj_t * chart, const lv_area_t * series_area, const lv_area_t * clip_area);
 static void draw_axes(lv_obj_t * chart, const lv_area_t * series_area, const lv_area_t * mask);
-static void invalidate_lines(lv_obj_t * chart, uint16_t i);
-static void invalidate_columns(lv_obj_t * chart, uint16_t i);
+static void invalidate_points(lv_obj_t * chart, uint16_t first, uint16_t cnt);
+static void invalidate_lines(lv_obj_t * chart, uint16_t first, uint16_t last);
+static void invalidate_columns(lv_obj_t * chart, uint16_t first, uint16_t last);
 static void get_next_axis_label(lv_chart_label_iterator_t * iterator, char * buf);
 static inline bool is_tick_with_label(uint8_t tick_num, lv_chart_axis_cfg_t * axis);
 static lv_chart_label_iterator_t create_axis_label_iter(const char * list, uint8_t iterator_dir);
@@ -111,6 +124,8 @@ lv_obj_t * lv_chart_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->point_cnt             = LV_CHART_PNUM_DEF;
     ext->type                  = LV_CHART_TYPE_LINE;
     ext->update_mode           = LV_CHART_UPDATE_MODE_SHIFT;
+    ext->strip_buf             = NULL;
+    ext->strip_valid           = 0;
     _lv_memset_00(&ext->x_axis, sizeof(ext->x_axis));
     _lv_memset_00(&ext->y_axis, sizeof(ext->y_axis));
     _lv_memset_00(&ext->secondary_y_axis, sizeof(ext->secondary_y_axis));
@@ -194,6 +209,7 @@ lv_chart_series_t * lv_chart_add_series(lv_obj_t * chart, lv_color_t color)
     }
 
     ser->start_point = 0;
+    ser->strip_new_cnt = 0;
     ser->ext_buf_assigned = false;
     ser->hidden = 0;
     ser->y_axis = LV_CHART_AXIS_PRIMARY_Y;
@@ -205,6 +221,8 @@ lv_chart_series_t * lv_chart_add_series(lv_obj_t * chart, lv_color_t color)
         p_tmp++;
     }
 
+    ext->strip_valid = 0;
+
     return ser;
 }
 
@@ -224,6 +242,7 @@ void lv_chart_remove_series(lv_obj_t * chart, lv_chart_series_t * series)
 
     _lv_ll_remove(&ext->series_ll, series);
     lv_mem_free(series);
+    ext->strip_valid = 0;
 
     return;
 }
@@ -272,6 +291,7 @@ void lv_chart_clear_series(lv_obj_t * chart, lv_chart_series_t * series)
     }
 
     series->start_point = 0;
+    ext->strip_valid = 0;
 }
 
 /**
@@ -475,16 +495,75 @@ void lv_chart_set_next(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t y)
         ser->start_point = (ser->start_point + 1) % ext->point_cnt;
         lv_chart_refresh(chart);
     }
+    else if(ext->update_mode == LV_CHART_UPDATE_MODE_STRIP) {
+        ser->points[ser->start_point] = y;
+        ser->start_point = (ser->start_point + 1) % ext->point_cnt;
+
+        /*Keep the strip buffer. The drawn lines will be shifted and only the new points drawn*/
+        if(ser->strip_new_cnt < UINT16_MAX) ser->strip_new_cnt++;
+        lv_area_t series_area;
+        lv_chart_get_series_area(chart, &series_area);
+        lv_obj_invalidate_area(chart, &series_area);
+    }
     else if(ext->update_mode == LV_CHART_UPDATE_MODE_CIRCULAR) {
         ser->points[ser->start_point] = y;
 
-        if(ext->type & LV_CHART_TYPE_LINE) invalidate_lines(chart, ser->start_point);
-        if(ext->type & LV_CHART_TYPE_COLUMN) invalidate_columns(chart, ser->start_point);
+        invalidate_points(chart, ser->start_point, 1);
 
         ser->start_point = (ser->start_point + 1) % ext->point_cnt; /*update the x for next incoming y*/
     }
 }
 
+/**
+ * Add many new points to a data line at once.
+ * It's the same as calling `lv_chart_set_next` for each value but the chart is invalidated only once.
+ * @param chart pointer to chart object
+ * @param ser pointer to a data series on 'chart'
+ * @param values array of the new values. If `NULL` the values are already written to the places of the next points
+ *               e.g. to an external array used as ring buffer (see `lv_chart_set_ext_array`)
+ * @param cnt number of new values
+ */
+void lv_chart_set_next_array(lv_obj_t * chart, lv_chart_series_t * ser, const lv_coord_t values[], uint16_t cnt)
+{
+    LV_ASSERT_OBJ(chart, LV_OBJX_NAME);
+    LV_ASSERT_NULL(ser);
+
+    if(cnt == 0) return;
+
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    uint16_t first = ser->start_point;
+
+    if(values) {
+        /*Only the last `point_cnt` values remain. Copy them in maximum 2 parts around the end of the array.*/
+        uint32_t skip = cnt > ext->point_cnt ? cnt - ext->point_cnt : 0;
+        uint32_t id = (first + skip) % ext->point_cnt;
+        uint32_t left = cnt - skip;
+        values += skip;
+        while(left) {
+            uint32_t part = LV_MATH_MIN(left, ext->point_cnt - id);
+            _lv_memcpy(&ser->points[id], values, part * sizeof(lv_coord_t));
+            values += part;
+            left -= part;
+            id = 0;
+        }
+    }
+
+    ser->start_point = (first + cnt) % ext->point_cnt;
+
+    if(ext->update_mode == LV_CHART_UPDATE_MODE_SHIFT) {
+        lv_chart_refresh(chart);
+    }
+    else if(ext->update_mode == LV_CHART_UPDATE_MODE_STRIP) {
+        ser->strip_new_cnt = LV_MATH_MIN((uint32_t)ser->strip_new_cnt + cnt, UINT16_MAX);
+        lv_area_t series_area;
+        lv_chart_get_series_area(chart, &series_area);
+        lv_obj_invalidate_area(chart, &series_area);
+    }
+    else if(ext->update_mode == LV_CHART_UPDATE_MODE_CIRCULAR) {
+        invalidate_points(chart, first, cnt);
+    }
+}
+
 /**
  * Set update mode of the chart object.
  * @param chart pointer to a chart object
@@ -498,7 +577,12 @@ void lv_chart_set_update_mode(lv_obj_t * chart, lv_chart_update_mode_t update_mo
     if(ext->update_mode == update_mode) return;
 
     ext->update_mode = update_mode;
-    lv_obj_invalidate(chart);
+    if(ext->strip_buf) {
+        lv_img_cache_invalidate_src(ext->strip_buf);
+        lv_img_buf_free(ext->strip_buf);
+        ext->strip_buf = NULL;
+    }
+    lv_chart_refresh(chart);
 }
 
 /**
@@ -628,6 +712,7 @@ void lv_chart_set_x_start_point(lv_obj_t * chart, lv_chart_series_t * ser, uint1
     if(ext == NULL) return;
     if(id >= ext->point_cnt) return;
     ser->start_point = id;
+    ext->strip_valid = 0;
 }
 
 /**
@@ -649,6 +734,7 @@ void lv_chart_set_ext_array(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_
     ser->ext_buf_assigned = true;
     ser->points = array;
     ext->point_cnt = point_cnt;
+    ext->strip_valid = 0;
 }
 
 /**
@@ -668,6 +754,7 @@ void lv_chart_set_point_id(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t
     if(ext == NULL) return;
     if(id >= ext->point_cnt) return;
     ser->points[id] = value;
+    ext->strip_valid = 0;
 }
 
 /**
@@ -847,7 +934,10 @@ lv_coord_t lv_chart_get_x_from_index(lv_obj_t * chart, lv_chart_series_t * ser,
     lv_coord_t x = 0;
 
     if(ext->type & LV_CHART_TYPE_LINE) {
-        x = (w * id) / (ext->point_cnt - 1);
+        int32_t x_ofs;
+        int32_t x_w;
+        get_line_x_map(chart, &series_area, &x_ofs, &x_w);
+        x = (int32_t)((int64_t)x_w * id / LV_MATH_MAX(ext->point_cnt - 1, 1)) + x_ofs - series_area.x1;
     }
     else if(ext->type & LV_CHART_TYPE_COLUMN) {
         lv_coord_t col_w = w / ((_lv_ll_get_len(&ext->series_ll) + 1) * ext->point_cnt); /* Suppose + 1 series as separator*/
@@ -925,6 +1015,9 @@ void lv_chart_refresh(lv_obj_t * chart)
 {
     LV_ASSERT_OBJ(chart, LV_OBJX_NAME);
 
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    ext->strip_valid = 0;
+
     lv_obj_invalidate(chart);
 }
 
@@ -961,7 +1054,11 @@ static lv_design_res_t lv_chart_design(lv_obj_t * chart, const lv_area_t * clip_
         draw_axes(chart, &series_area, clip_area);
 
         lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
-        if(ext->type & LV_CHART_TYPE_LINE) draw_series_line(chart, &series_area, clip_area);
+        if(ext->type & LV_CHART_TYPE_LINE) {
+            bool strip_drawn = false;
+            if(ext->update_mode == LV_CHART_UPDATE_MODE_STRIP) strip_drawn = draw_series_strip(chart, &series_area, clip_area);
+            if(!strip_drawn) draw_series_line(chart, &series_area, clip_area);
+        }
         if(ext->type & LV_CHART_TYPE_COLUMN) draw_series_column(chart, &series_area, clip_area);
         draw_cursors(chart, &series_area, clip_area);
 
@@ -1007,6 +1104,15 @@ static lv_res_t lv_chart_signal(lv_obj_t * chart, lv_signal_t sign, void * param
         lv_obj_clean_style_list(chart, LV_CHART_PART_SERIES);
         lv_obj_clean_style_list(chart, LV_CHART_PART_CURSOR);
         lv_obj_clean_style_list(chart, LV_CHART_PART_SERIES_BG);
+
+        if(ext->strip_buf) {
+            lv_img_cache_invalidate_src(ext->strip_buf);
+            lv_img_buf_free(ext->strip_buf);
+            ext->strip_buf = NULL;
+        }
+    }
+    else if(sign == LV_SIGNAL_STYLE_CHG) {
+        ext->strip_valid = 0;
     }
 
     return res;
@@ -1128,13 +1234,13 @@ static void draw_series_line(lv_obj_t * chart, const lv_area_t * series_area, co
 
     lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
 
-    uint16_t i;
-    lv_point_t p1;
-    lv_point_t p2;
-    lv_coord_t w     = lv_area_get_width(series_area);
+    int32_t i;
+    int32_t w;
+    int32_t x_ofs;
+    get_line_x_map(chart, series_area, &x_ofs, &w);
     lv_coord_t h     = lv_area_get_height(series_area);
-    lv_coord_t x_ofs = series_area->x1;
     lv_coord_t y_ofs = series_area->y1;
+    int32_t x_div    = ext->point_cnt > 1 ? ext->point_cnt - 1 : 1;
     lv_chart_series_t * ser;
 
     lv_area_t series_mask;
@@ -1146,7 +1252,6 @@ static void draw_series_line(lv_obj_t * chart, const lv_area_t * series_area, co
     lv_obj_init_draw_line_dsc(chart, LV_CHART_PART_SERIES, &line_dsc);
 
     lv_draw_mask_fade_param_t mask_fade_p;
-    int16_t mask_fade_id = LV_MASK_ID_INV;
     lv_draw_rect_dsc_t area_dsc;
     bool has_area = lv_obj_get_style_bg_opa(chart, LV_CHART_PART_SERIES) > LV_OPA_MIN ? true : false;
     bool has_fade = false;
@@ -1172,6 +1277,13 @@ static void draw_series_line(lv_obj_t * chart, const lv_area_t * series_area, co
     /*Do not bother with line ending is the point will over it*/
     if(point_radius > line_dsc.width / 2) line_dsc.raw_end = 1;
 
+    /*Only the points around the clip area are required. Get the last point left to it and the first right to it.*/
+    int32_t col_start = clip_area->x1 - x_ofs - point_radius - line_dsc.width;
+    int32_t col_end = clip_area->x2 - x_ofs + point_radius + line_dsc.width;
+    int32_t i_start = (int64_t)LV_MATH_MAX(col_start, 0) * x_div / w;
+    int32_t i_end = ((int64_t)LV_MATH_MAX(col_end, 0) * x_div + w - 1) / w;
+    if(i_end > ext->point_cnt - 1) i_end = ext->point_cnt - 1;
+
     /*Go through all data lines*/
     _LV_LL_READ_BACK(ext->series_ll, ser) {
         if(ser->hidden) continue;
@@ -1180,92 +1292,278 @@ static void draw_series_line(lv_obj_t * chart, const lv_area_t * series_area, co
         area_dsc.bg_color = ser->color;
         area_dsc.bg_grad_color = ser->color;
 
-        lv_coord_t start_point = ext->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+        lv_coord_t start_point = ext->update_mode != LV_CHART_UPDATE_MODE_CIRCULAR ? ser->start_point : 0;
+        int32_t y_range = ext->ymax[ser->y_axis] - ext->ymin[ser->y_axis];
 
-        p1.x = 0 + x_ofs;
-        p2.x = 0 + x_ofs;
+        /* If there are more points than pixel columns the consecutive points in the same column
+         * would be connected with many overlapping vertical lines. Instead collect the
+         * min. and max. of the column and draw only one vertical line between them.
+         * Together with the lines between the columns it gives exactly the same result. */
+        lv_point_t p_prev = {0, 0};
+        bool prev_valid = false;
+        lv_coord_t col_min = 0;
+        lv_coord_t col_max = 0;
+        lv_point_t p_cir = {LV_COORD_MIN, LV_COORD_MIN};   /*Don't draw the same point circle again*/
 
-        lv_coord_t p_act = start_point;
-        lv_coord_t p_prev = start_point;
-        int32_t y_tmp = (int32_t)((int32_t)ser->points[p_prev] - ext->ymin[ser->y_axis]) * h;
-        y_tmp = y_tmp / (ext->ymax[ser->y_axis] - ext->ymin[ser->y_axis]);
-        p2.y   = h - y_tmp + y_ofs;
+        for(i = i_start; i <= i_end; i++) {
+            lv_coord_t p_act = (start_point + i) % ext->point_cnt;
+            bool valid = ser->points[p_act] != LV_CHART_POINT_DEF ? true : false;
+
+            lv_point_t p;
+            p.x = (int64_t)w * i / x_div + x_ofs;
+            p.y = 0;
+            if(valid) {
+                int32_t y_tmp = (int32_t)((int32_t)ser->points[p_act] - ext->ymin[ser->y_axis]) * h;
+                y_tmp = y_tmp / y_range;
+                p.y  = h - y_tmp + y_ofs;
+            }
 
-        for(i = 0; i < ext->point_cnt; i++) {
-            p1.x = p2.x;
-            p1.y = p2.y;
+            /*Leaving a column: draw the vertical line of its points*/
+            if(prev_valid && (valid == false || p.x != p_prev.x) && col_min != col_max) {
+                lv_point_t p1 = {p_prev.x, col_min};
+                lv_point_t p2 = {p_prev.x, col_max};
+                lv_draw_line(&p1, &p2, &series_mask, &line_dsc);
+            }
 
-            p2.x = ((w * i) / (ext->point_cnt - 1)) + x_ofs;
+            if(valid) {
+                if(prev_valid && p.x == p_prev.x) {
+                    col_min = LV_MATH_MIN(col_min, p.y);
+                    col_max = LV_MATH_MAX(col_max, p.y);
+                }
+                else {
+                    /*Connect the last point of the previous column with the first point of this column*/
+                    if(prev_valid) draw_series_line_part(&p_prev, &p, series_area, &series_mask, &line_dsc,
+                                                             has_area ? &area_dsc : NULL, has_fade ? &mask_fade_p : NULL);
+                    col_min = p.y;
+                    col_max = p.y;
+                }
 
-            p_act = (start_point + i) % ext->point_cnt;
+                if(point_radius && (p.x != p_cir.x || p.y != p_cir.y)) {
+                    lv_area_t point_area;
+                    point_area.x1 = p.x - point_radius;
+                    point_area.x2 = p.x + point_radius;
+                    point_area.y1 = p.y - point_radius;
+                    point_area.y2 = p.y + point_radius;
 
-            y_tmp = (int32_t)((int32_t)ser->points[p_act] - ext->ymin[ser->y_axis]) * h;
-            y_tmp = y_tmp / (ext->ymax[ser->y_axis] - ext->ymin[ser->y_axis]);
-            p2.y  = h - y_tmp + y_ofs;
+                    /*Don't limit to `series_mask` to get full circles on the ends*/
+                    lv_draw_rect(&point_area, clip_area, &point_dsc);
+                    p_cir = p;
+                }
+            }
 
-            /*Don't draw the first point. A second point is also required to draw the line*/
-            if(i != 0 && ser->points[p_prev] != LV_CHART_POINT_DEF && ser->points[p_act] != LV_CHART_POINT_DEF) {
-                lv_draw_line(&p1, &p2, &series_mask, &line_dsc);
+            p_prev = p;
+            prev_valid = valid;
+        }
 
-                lv_coord_t y_top = LV_MATH_MIN(p1.y, p2.y);
-                if(has_area && y_top <= clip_area->y2) {
-                    int16_t mask_line_id;
-                    lv_draw_mask_line_param_t mask_line_p;
-                    lv_draw_mask_line_points_init(&mask_line_p, p1.x, p1.y, p2.x, p2.y, LV_DRAW_MASK_LINE_SIDE_BOTTOM);
-                    mask_line_id = lv_draw_mask_add(&mask_line_p, NULL);
+        /*Draw the vertical line of the last column*/
+        if(prev_valid && col_min != col_max) {
+            lv_point_t p1 = {p_prev.x, col_min};
+            lv_point_t p2 = {p_prev.x, col_max};
+            lv_draw_line(&p1, &p2, &series_mask, &line_dsc);
+        }
+    }
+}
 
-                    lv_area_t a;
-                    a.x1 = p1.x;
-                    a.x2 = p2.x - 1;
-                    a.y1 = y_top;
-                    a.y2 = series_area->y2;
+/**
+ * Draw a line between two points of a series and the area below it
+ * @param p1 the left point
+ * @param p2 the right point
+ * @param series_area area of the series
+ * @param series_mask the series area clipped to the clip area
+ * @param line_dsc descriptor of the line
+ * @param area_dsc descriptor of the area below the line or NULL if there is no area
+ * @param mask_fade_p parameter of a fade mask for the area or NULL to not fade it
+ */
+static void draw_series_line_part(const lv_point_t * p1, const lv_point_t * p2, const lv_area_t * series_area,
+                                  const lv_area_t * series_mask, const lv_draw_line_dsc_t * line_dsc,
+                                  const lv_draw_rect_dsc_t * area_dsc, lv_draw_mask_fade_param_t * mask_fade_p)
+{
+    lv_draw_line(p1, p2, series_mask, line_dsc);
 
-                    if(has_fade) mask_fade_id = lv_draw_mask_add(&mask_fade_p, NULL);
+    lv_coord_t y_top = LV_MATH_MIN(p1->y, p2->y);
+    if(area_dsc == NULL || y_top > series_mask->y2) return;
 
-                    lv_draw_rect(&a, &series_mask, &area_dsc);
+    lv_draw_mask_line_param_t mask_line_p;
+    lv_draw_mask_line_points_init(&mask_line_p, p1->x, p1->y, p2->x, p2->y, LV_DRAW_MASK_LINE_SIDE_BOTTOM);
+    int16_t mask_line_id = lv_draw_mask_add(&mask_line_p, NULL);
+    int16_t mask_fade_id = LV_MASK_ID_INV;
+    if(mask_fade_p) mask_fade_id = lv_draw_mask_add(mask_fade_p, NULL);
 
-                    lv_draw_mask_remove_id(mask_line_id);
-                    lv_draw_mask_remove_id(mask_fade_id);
-                }
-            }
+    lv_area_t a;
+    a.x1 = p1->x;
+    a.x2 = p2->x - 1;
+    a.y1 = y_top;
+    a.y2 = series_area->y2;
+    lv_draw_rect(&a, series_mask, area_dsc);
+
+    lv_draw_mask_remove_id(mask_line_id);
+    lv_draw_mask_remove_id(mask_fade_id);
+}
+
+/**
+ * Draw the line series from the strip buffer in `LV_CHART_UPDATE_MODE_STRIP`.
+ * The buffer is shifted by the pixels of the new points and only the new part is drawn
+ * so it's independent from the number of points.
+ * @param chart pointer to a chart object
+ * @param series_area the area of the series
+ * @param clip_area draw only in this area
+ * @return true: drawn; false: there is no memory for the buffer or there are more points than pixels,
+ *         draw the series normally
+ */
+static bool draw_series_strip(lv_obj_t * chart, const lv_area_t * series_area, const lv_area_t * clip_area)
+{
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    lv_coord_t w = lv_area_get_width(series_area);
+    lv_coord_t h = lv_area_get_height(series_area);
 
-            if(point_radius) {
-                lv_area_t point_area;
+    /*The points are not on whole pixels (see `get_line_x_map`) so the drawn lines can't be shifted*/
+    if(ext->point_cnt - 1 > w) return false;
 
-                point_area.x1 = p1.x;
-                point_area.x2 = point_area.x1 + point_radius;
-                point_area.x1 -= point_radius;
+    if(ext->strip_buf && (ext->strip_buf->header.w != w || ext->strip_buf->header.h != h)) {
+        lv_img_cache_invalidate_src(ext->strip_buf);
+        lv_img_buf_free(ext->strip_buf);
+        ext->strip_buf = NULL;
+    }
 
-                point_area.y1 = p1.y;
-                point_area.y2 = point_area.y1 + point_radius;
-                point_area.y1 -= point_radius;
+    if(ext->strip_buf == NULL) {
+        ext->strip_buf = lv_img_buf_alloc(w, h, LV_IMG_CF_TRUE_COLOR_ALPHA);
+        if(ext->strip_buf == NULL) {
+            LV_LOG_WARN("lv_chart: no memory for the strip buffer");
+            return false;
+        }
+        ext->strip_valid = 0;
+    }
 
-                if(ser->points[p_act] != LV_CHART_POINT_DEF) {
-                    /*Don't limit to `series_mask` to get full circles on the ends*/
-                    lv_draw_rect(&point_area, clip_area, &point_dsc);
-                }
-            }
+    /*The drawn lines can be shifted only if all series got the same number of new points*/
+    lv_chart_series_t * ser;
+    int32_t new_cnt = -1;
+    _LV_LL_READ(ext->series_ll, ser) {
+        if(ser->hidden == 0) {
+            if(new_cnt < 0) new_cnt = ser->strip_new_cnt;
+            else if(new_cnt != ser->strip_new_cnt) ext->strip_valid = 0;
+        }
+        ser->strip_new_cnt = 0;
+    }
+
+    int32_t x_ofs;
+    int32_t x_w;
+    get_line_x_map(chart, series_area, &x_ofs, &x_w);
+    int32_t shift = new_cnt > 0 ? (x_w / LV_MATH_MAX(ext->point_cnt - 1, 1)) * new_cnt : 0;
 
-            p_prev = p_act;
+    if(ext->strip_valid == 0 || shift >= w) {
+        render_strip(chart, series_area, series_area->x1, series_area->x2);
+    }
+    else if(shift > 0) {
+        uint32_t px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+        uint8_t * row = (uint8_t *)ext->strip_buf->data;
+        lv_coord_t y;
+        for(y = 0; y < h; y++) {
+            memmove(row, row + shift * px_size, (w - shift) * px_size);
+            row += w * px_size;
         }
 
-        /*Draw the last point*/
-        if(point_radius) {
-            lv_area_t point_area;
+        /*Draw the new points with the lines and points around them which were cut off.
+         *If the first point is not on the left edge remove the shifted in points before it too.*/
+        lv_coord_t pad = lv_obj_get_style_size(chart, LV_CHART_PART_SERIES) +
+                         lv_obj_get_style_line_width(chart, LV_CHART_PART_SERIES);
+        render_strip(chart, series_area, series_area->x2 - shift - pad, series_area->x2);
+        if(x_ofs + pad >= series_area->x1) render_strip(chart, series_area, series_area->x1, x_ofs + pad);
+    }
 
-            point_area.x1 = p2.x;
-            point_area.x2 = point_area.x1 + point_radius;
-            point_area.x1 -= point_radius;
+    ext->strip_valid = 1;
 
-            point_area.y1 = p2.y;
-            point_area.y2 = point_area.y1 + point_radius;
-            point_area.y1 -= point_radius;
+    lv_draw_img_dsc_t img_dsc;
+    lv_draw_img_dsc_init(&img_dsc);
+    lv_draw_img(series_area, clip_area, ext->strip_buf, &img_dsc);
 
-            if(ser->points[p_act] != LV_CHART_POINT_DEF) {
-                /*Don't limit to `series_mask` to get full circles on the ends*/
-                lv_draw_rect(&point_area, clip_area, &point_dsc);
-            }
-        }
+    return true;
+}
+
+/**
+ * Clear columns of the strip buffer and draw the line series there
+ * @param chart pointer to a chart object
+ * @param series_area the area of the series
+ * @param x1 the first column to draw (absolute coordinate)
+ * @param x2 the last column to draw (absolute coordinate)
+ */
+static void render_strip(lv_obj_t * chart, const lv_area_t * series_area, lv_coord_t x1, lv_coord_t x2)
+{
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    lv_coord_t w = lv_area_get_width(series_area);
+    lv_coord_t h = lv_area_get_height(series_area);
+
+    lv_area_t clip;
+    lv_area_copy(&clip, series_area);
+    clip.x1 = LV_MATH_MAX(x1, series_area->x1);
+    clip.x2 = LV_MATH_MIN(x2, series_area->x2);
+    if(clip.x1 > clip.x2) return;
+
+    uint32_t px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+    uint8_t * row = (uint8_t *)ext->strip_buf->data + (clip.x1 - series_area->x1) * px_size;
+    lv_coord_t y;
+    for(y = 0; y < h; y++) {
+        _lv_memset_00(row, lv_area_get_width(&clip) * px_size);
+        row += w * px_size;
+    }
+
+    strip_disp_t * sd = lv_mem_alloc(sizeof(strip_disp_t));
+    LV_ASSERT_MEM(sd);
+    if(sd == NULL) return;
+
+    /* Create a dummy display to fool the lv_draw functions.
+     * They will think they draw to the series area on the real screen. */
+    lv_disp_t * disp_refr = _lv_refr_get_disp_refreshing();
+    _lv_memset_00(&sd->disp, sizeof(lv_disp_t));
+
+    lv_disp_buf_init(&sd->disp_buf, (void *)ext->strip_buf->data, NULL, w * h);
+    lv_area_copy(&sd->disp_buf.area, series_area);
+
+    lv_disp_drv_init(&sd->disp.driver);
+    sd->disp.driver.buffer  = &sd->disp_buf;
+    sd->disp.driver.hor_res = LV_MATH_MAX(w, lv_disp_get_hor_res(disp_refr));
+    sd->disp.driver.ver_res = LV_MATH_MAX(h, lv_disp_get_ver_res(disp_refr));
+    sd->disp.driver.dpi     = disp_refr->driver.dpi;
+    sd->disp.driver.buf_cf  = LV_IMG_CF_TRUE_COLOR_ALPHA;
+#if LV_ANTIALIAS
+    sd->disp.driver.antialiasing = disp_refr->driver.antialiasing;
+#endif
+
+    /*The masks of the parents are not related to the buffer*/
+    _lv_draw_mask_saved_arr_t masks;
+    _lv_draw_mask_save_all(masks);
+    _lv_refr_set_disp_refreshing(&sd->disp);
+
+    draw_series_line(chart, series_area, &clip);
+
+    _lv_refr_set_disp_refreshing(disp_refr);
+    _lv_draw_mask_restore_all(masks);
+
+    lv_mem_free(sd);
+}
+
+/**
+ * Get where the points of the line series are on the x axis.
+ * The `i`th point is at `x_ofs + (x_w * i) / (point_cnt - 1)`.
+ * @param chart pointer to a chart object
+ * @param series_area the area of the series
+ * @param x_ofs store the x coordinate of the first point here
+ * @param x_w store the distance of the first and last points here
+ */
+static void get_line_x_map(lv_obj_t * chart, const lv_area_t * series_area, int32_t * x_ofs, int32_t * x_w)
+{
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    lv_coord_t w = lv_area_get_width(series_area);
+
+    *x_ofs = series_area->x1;
+    *x_w = w;
+
+    /* In strip mode the points need to be on whole pixels to shift the drawn lines with the new points.
+     * The last point stays at the same place, the first is moved to keep the same distance between the points.
+     * If there are more points than pixels it's not possible, so they are mapped as normally.*/
+    if(ext->update_mode == LV_CHART_UPDATE_MODE_STRIP && ext->point_cnt > 1 && ext->point_cnt - 1 <= w) {
+        int32_t step = w / (ext->point_cnt - 1);
+        *x_w = step * (ext->point_cnt - 1);
+        *x_ofs = series_area->x1 + w - *x_w;
     }
 }
 
@@ -1312,7 +1610,7 @@ static void draw_series_column(lv_obj_t * chart, const lv_area_t * series_area,
         /*Draw the current point of all data line*/
         _LV_LL_READ_BACK(ext->series_ll, ser) {
             if(ser->hidden) continue;
-            lv_coord_t start_point = ext->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+            lv_coord_t start_point = ext->update_mode != LV_CHART_UPDATE_MODE_CIRCULAR ? ser->start_point : 0;
 
             col_a.x1 = x_act;
             col_a.x2 = col_a.x1 + col_w - col_space;
@@ -1793,47 +2091,83 @@ static void draw_axes(lv_obj_t * chart, const lv_area_t * series_area, const lv_
 }
 
 /**
- * invalid area of the new line data lines on a chart
- * @param obj pointer to chart object
+ * Invalidate the places of points in the circular update mode
+ * @param chart pointer to a chart object
+ * @param first index of the first point
+ * @param cnt number of points from `first`. Continued from the beginning at the last point.
  */
-static void invalidate_lines(lv_obj_t * chart, uint16_t i)
+static void invalidate_points(lv_obj_t * chart, uint16_t first, uint16_t cnt)
 {
     lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
-    if(i >= ext->point_cnt) return;
+    if(first >= ext->point_cnt) return;
+
+    if(cnt >= ext->point_cnt) {
+        first = 0;
+        cnt = ext->point_cnt;
+    }
+
+    uint32_t last = first + cnt - 1;
+    uint16_t last2 = 0;
+    bool wrap = false;
+    if(last >= ext->point_cnt) {
+        last2 = last - ext->point_cnt;
+        last = ext->point_cnt - 1;
+        wrap = true;
+    }
+
+    if(ext->type & LV_CHART_TYPE_LINE) {
+        invalidate_lines(chart, first, last);
+        if(wrap) invalidate_lines(chart, 0, last2);
+    }
+
+    if(ext->type & LV_CHART_TYPE_COLUMN) {
+        invalidate_columns(chart, first, last);
+        if(wrap) invalidate_columns(chart, 0, last2);
+    }
+}
+
+/**
+ * Invalidate the lines to and from a range of points
+ * @param chart pointer to a chart object
+ * @param first index of the first point
+ * @param last index of the last point
+ */
+static void invalidate_lines(lv_obj_t * chart, uint16_t first, uint16_t last)
+{
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    if(last >= ext->point_cnt) return;
 
     lv_area_t series_area;
     lv_chart_get_series_area(chart, &series_area);
 
-    lv_coord_t w     = lv_area_get_width(&series_area);
-    lv_coord_t x_ofs = series_area.x1;
+    int32_t w;
+    int32_t x_ofs;
+    get_line_x_map(chart, &series_area, &x_ofs, &w);
+    int32_t x_div = LV_MATH_MAX(ext->point_cnt - 1, 1);
 
     lv_style_int_t line_width = lv_obj_get_style_line_width(chart, LV_CHART_PART_SERIES);
     lv_style_int_t point_radius = lv_obj_get_style_size(chart, LV_CHART_PART_SERIES);
 
+    /*The lines from the previous point and to the next point are also changed*/
+    if(first > 0) first--;
+    if(last < ext->point_cnt - 1) last++;
+
     lv_area_t coords;
     lv_area_copy(&coords, &series_area);
     coords.y1 -= line_width + point_radius;
     coords.y2 += line_width + point_radius;
-
-    if(i < ext->point_cnt - 1) {
-        coords.x1 = ((w * i) / (ext->point_cnt - 1)) + x_ofs - line_width - point_radius;
-        coords.x2 = ((w * (i + 1)) / (ext->point_cnt - 1)) + x_ofs + line_width + point_radius;
-        lv_obj_invalidate_area(chart, &coords);
-    }
-
-    if(i > 0) {
-        coords.x1 = ((w * (i - 1)) / (ext->point_cnt - 1)) + x_ofs - line_width - point_radius;
-        coords.x2 = ((w * i) / (ext->point_cnt - 1)) + x_ofs + line_width + point_radius;
-        lv_obj_invalidate_area(chart, &coords);
-    }
+    coords.x1 = (int64_t)w * first / x_div + x_ofs - line_width - point_radius;
+    coords.x2 = (int64_t)w * last / x_div + x_ofs + line_width + point_radius;
+    lv_obj_invalidate_area(chart, &coords);
 }
 
 /**
- * invalid area of the new column data lines on a chart
- * @param chart pointer to chart object
- * @param mask mask, inherited from the design function
+ * Invalidate the columns of a range of points
+ * @param chart pointer to a chart object
+ * @param first index of the first point
+ * @param last index of the last point
  */
-static void invalidate_columns(lv_obj_t * chart, uint16_t i)
+static void invalidate_columns(lv_obj_t * chart, uint16_t first, uint16_t last)
 {
     lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
 
@@ -1843,17 +2177,13 @@ static void invalidate_columns(lv_obj_t * chart, uint16_t i)
     lv_area_t col_a;
     lv_coord_t w     = lv_area_get_width(&series_area);
     lv_coord_t col_w = w / ((_lv_ll_get_len(&ext->series_ll) + 1) * ext->point_cnt); /* Suppose + 1 series as separator*/
-    lv_coord_t x_ofs = col_w / 2;                                    /*Shift with a half col.*/
-
-    lv_coord_t x_act;
-    x_act = (int32_t)((int32_t)w * i) / ext->point_cnt;
-    x_act += series_area.x1 + x_ofs;
+    lv_coord_t x_ofs = series_area.x1 + col_w / 2;                  /*Shift with a half col.*/
 
     lv_obj_get_coords(chart, &col_a);
-    col_a.x1 = x_act;
-    col_a.x2 = col_a.x1 + col_w;
+    col_a.x1 = (int32_t)((int32_t)w * first) / ext->point_cnt + x_ofs;
+    col_a.x2 = (int32_t)((int32_t)w * last) / ext->point_cnt + x_ofs + col_w;
 
-    _lv_inv_area(lv_obj_get_disp(chart), &col_a);
+    lv_obj_invalidate_area(chart, &col_a);
 }
 
 #endif
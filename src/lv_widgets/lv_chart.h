@@ -49,6 +49,8 @@ typedef uint8_t lv_chart_type_t;
 enum {
     LV_CHART_UPDATE_MODE_SHIFT,     /**< Shift old data to the left and add the new one o the right*/
     LV_CHART_UPDATE_MODE_CIRCULAR,  /**< Add the new data in a circular way*/
+    LV_CHART_UPDATE_MODE_STRIP,     /**< Shift like `LV_CHART_UPDATE_MODE_SHIFT` but keep the drawn lines in a buffer,
+                                         scroll them and draw only the new points*/
 };
 typedef uint8_t lv_chart_update_mode_t;
 
@@ -72,6 +74,7 @@ typedef struct {
     lv_coord_t * points;
     lv_color_t color;
     uint16_t start_point;
+    uint16_t strip_new_cnt;     /*Points added since the strip buffer was updated*/
     uint8_t ext_buf_assigned : 1;
     uint8_t hidden : 1;
     lv_chart_axis_t y_axis  : 1;
@@ -117,7 +120,9 @@ typedef struct {
     lv_chart_axis_cfg_t y_axis;
     lv_chart_axis_cfg_t x_axis;
     lv_chart_axis_cfg_t secondary_y_axis;
-    uint8_t update_mode : 1;
+    lv_img_dsc_t * strip_buf;   /*The line series drawn in `LV_CHART_UPDATE_MODE_STRIP`*/
+    uint8_t update_mode : 2;
+    uint8_t strip_valid : 1;    /*The strip buffer is up to date except the newly added points*/
 } lv_chart_ext_t;
 
 /*Parts of the chart*/
@@ -243,6 +248,17 @@ void lv_chart_set_points(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t y
  */
 void lv_chart_set_next(lv_obj_t * chart, lv_chart_series_t * ser, lv_coord_t y);
 
+/**
+ * Add many new points to a data line at once.
+ * It's the same as calling `lv_chart_set_next` for each value but the chart is invalidated only once.
+ * @param chart pointer to chart object
+ * @param ser pointer to a data series on 'chart'
+ * @param values array of the new values. If `NULL` the values are already written to the places of the next points
+ *               e.g. to an external array used as ring buffer (see `lv_chart_set_ext_array`)
+ * @param cnt number of new values
+ */
+void lv_chart_set_next_array(lv_obj_t * chart, lv_chart_series_t * ser, const lv_coord_t values[], uint16_t cnt);
+
 /**
  * Set update mode of the chart object.
  * @param chart pointer to a chart object
@@ -10,6 +10,7 @@
 #if LV_USE_GAUGE != 0
 
 #include "../lv_misc/lv_debug.h"
+#include "../lv_core/lv_layer_cache.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_misc/lv_txt.h"
@@ -39,6 +40,7 @@
 static lv_design_res_t lv_gauge_design(lv_obj_t * gauge, const lv_area_t * clip_area, lv_design_mode_t mode);
 static lv_res_t lv_gauge_signal(lv_obj_t * gauge, lv_signal_t sign, void * param);
 static lv_style_list_t * lv_gauge_get_style(lv_obj_t * gauge, uint8_t part);
+static void lv_gauge_draw_bg(lv_obj_t * gauge, const lv_area_t * clip_area);
 static void lv_gauge_draw_labels(lv_obj_t * gauge, const lv_area_t * mask);
 static void lv_gauge_draw_needle(lv_obj_t * gauge, const lv_area_t * clip_area);
 
@@ -327,6 +329,7 @@ void lv_gauge_set_formatter_cb(lv_obj_t * gauge, lv_gauge_format_cb_t format_cb)
     lv_gauge_ext_t * ext = lv_obj_get_ext_attr(gauge);
 
     ext->format_cb = format_cb;
+    lv_obj_invalidate(gauge);
 }
 
 /*=====================
@@ -442,16 +445,14 @@ static lv_design_res_t lv_gauge_design(lv_obj_t * gauge, const lv_area_t * clip_
     }
     /*Draw the object*/
     else if(mode == LV_DESIGN_DRAW_MAIN) {
-        ancestor_design(gauge, clip_area, mode);
-
-        lv_gauge_ext_t * ext           = lv_obj_get_ext_attr(gauge);
-        lv_gauge_draw_labels(gauge, clip_area);
-
-        /*Add the strong lines*/
-        uint16_t line_cnt_tmp = ext->lmeter.line_cnt;
-        ext->lmeter.line_cnt         = ext->label_count;                 /*Only to labels*/
-        lv_linemeter_draw_scale(gauge, clip_area, LV_GAUGE_PART_MAJOR);
-        ext->lmeter.line_cnt = line_cnt_tmp; /*Restore the parameters*/
+        /*The scale changes rarely so draw it from a layer and draw only the needles directly*/
+#if LV_LAYER_CACHE_MEM
+        if(_lv_layer_cache_draw_bg(gauge, clip_area, lv_gauge_draw_bg) == false) {
+            lv_gauge_draw_bg(gauge, clip_area);
+        }
+#else
+        lv_gauge_draw_bg(gauge, clip_area);
+#endif
 
         lv_gauge_draw_needle(gauge, clip_area);
     }
@@ -487,6 +488,9 @@ static lv_res_t lv_gauge_signal(lv_obj_t * gauge, lv_signal_t sign, void * param
 
     lv_gauge_ext_t * ext = lv_obj_get_ext_attr(gauge);
     if(sign == LV_SIGNAL_CLEANUP) {
+#if LV_LAYER_CACHE_MEM
+        _lv_layer_cache_remove_bg(gauge);
+#endif
         lv_mem_free(ext->values);
         ext->values = NULL;
         lv_obj_clean_style_list(gauge, LV_GAUGE_PART_NEEDLE);
@@ -524,6 +528,25 @@ static lv_style_list_t * lv_gauge_get_style(lv_obj_t * gauge, uint8_t part)
 
     return style_dsc_p;
 }
+/**
+ * Draw the static parts of a gauge: the background, the scale and the labels
+ * @param gauge pointer to gauge object
+ * @param clip_area the object will be drawn only in this area
+ */
+static void lv_gauge_draw_bg(lv_obj_t * gauge, const lv_area_t * clip_area)
+{
+    ancestor_design(gauge, clip_area, LV_DESIGN_DRAW_MAIN);
+
+    lv_gauge_ext_t * ext = lv_obj_get_ext_attr(gauge);
+    lv_gauge_draw_labels(gauge, clip_area);
+
+    /*Add the strong lines*/
+    uint16_t line_cnt_tmp = ext->lmeter.line_cnt;
+    ext->lmeter.line_cnt         = ext->label_count;                 /*Only to labels*/
+    lv_linemeter_draw_scale(gauge, clip_area, LV_GAUGE_PART_MAJOR);
+    ext->lmeter.line_cnt = line_cnt_tmp; /*Restore the parameters*/
+}
+
 /**
  * Draw the scale on a gauge
  * @param gauge pointer to gauge object
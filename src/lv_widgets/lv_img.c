@@ -17,6 +17,8 @@
 #include "../lv_misc/lv_debug.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_draw/lv_img_decoder.h"
+#include "../lv_draw/lv_img_async.h"
+#include "../lv_draw/lv_img_trans_cache.h"
 #include "../lv_misc/lv_fs.h"
 #include "../lv_misc/lv_txt.h"
 #include "../lv_misc/lv_math.h"
@@ -84,6 +86,7 @@ lv_obj_t * lv_img_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->angle = 0;
     ext->zoom = LV_IMG_ZOOM_NONE;
     ext->antialias = LV_ANTIALIAS ? 1 : 0;
+    ext->trans_cache = 0;
     ext->auto_size = 1;
     ext->offset.x  = 0;
     ext->offset.y  = 0;
@@ -114,6 +117,7 @@ lv_obj_t * lv_img_create(lv_obj_t * par, const lv_obj_t * copy)
         ext->zoom          = copy_ext->zoom;
         ext->angle         = copy_ext->angle;
         ext->antialias     = copy_ext->antialias;
+        ext->trans_cache   = copy_ext->trans_cache;
         ext->offset.x     = copy_ext->offset.x;
         ext->offset.y     = copy_ext->offset.y;
         ext->pivot.x     = copy_ext->pivot.x;
@@ -172,6 +176,13 @@ void lv_img_set_src(lv_obj_t * img, const void * src_img)
         return;
     }
 
+#if LV_USE_IMG_ASYNC
+    /*Don't wait for the old image anymore. It's not decoded if no other object waits for it.*/
+    if(ext->src && ext->src != src_img && ext->src_type != LV_IMG_SRC_SYMBOL) {
+        _lv_img_async_remove_waiter(img, ext->src);
+    }
+#endif
+
     lv_img_header_t header;
     lv_img_decoder_get_info(src_img, &header);
 
@@ -421,6 +432,21 @@ void lv_img_set_antialias(lv_obj_t * img, bool antialias)
     lv_obj_invalidate(img);
 }
 
+/**
+ * Cache the rotated/zoomed image in a snapshot and redraw it from there while the angle, zoom,
+ * pivot and source are unchanged. Useful for images with static transformation.
+ * Requires `LV_IMG_TRANSFORM_CACHE_MEM > 0`.
+ * @param img pointer to an image object
+ * @param en true: enable the snapshot cache; false: transform the image on every redraw
+ */
+void lv_img_set_transform_cache(lv_obj_t * img, bool en)
+{
+    LV_ASSERT_OBJ(img, LV_OBJX_NAME);
+
+    lv_img_ext_t * ext = lv_obj_get_ext_attr(img);
+    ext->trans_cache = en ? 1 : 0;
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -554,6 +580,20 @@ bool lv_img_get_antialias(lv_obj_t * img)
     return ext->antialias ? true : false;
 }
 
+/**
+ * Get whether the transformed image is drawn from a cached snapshot
+ * @param img pointer to an image object
+ * @return true: the snapshot cache is enabled; false: disabled
+ */
+bool lv_img_get_transform_cache(lv_obj_t * img)
+{
+    LV_ASSERT_OBJ(img, LV_OBJX_NAME);
+
+    lv_img_ext_t * ext = lv_obj_get_ext_attr(img);
+
+    return ext->trans_cache ? true : false;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -709,6 +749,9 @@ static lv_design_res_t lv_img_design(lv_obj_t * img, const lv_area_t * clip_area
                 coords_tmp.x1 = zoomed_coords.x1;
                 coords_tmp.x2 = zoomed_coords.x1 + ext->w - 1;
                 for(; coords_tmp.x1 < zoomed_coords.x2; coords_tmp.x1 += zoomed_src_w, coords_tmp.x2 += zoomed_src_w) {
+#if LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_MEM
+                    if(ext->trans_cache && _lv_img_trans_cache_draw(&coords_tmp, &clip_real, ext->src, &img_dsc)) continue;
+#endif
                     lv_draw_img(&coords_tmp, &clip_real, ext->src, &img_dsc);
                 }
             }
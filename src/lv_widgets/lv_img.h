@@ -44,6 +44,7 @@ typedef struct {
     uint8_t auto_size : 1; /*1: automatically set the object size to the image size*/
     uint8_t cf : 5;        /*Color format from `lv_img_color_format_t`*/
     uint8_t antialias : 1; /*Apply anti-aliasing in transformations (rotate, zoom)*/
+    uint8_t trans_cache : 1; /*Draw the transformed image from a cached snapshot*/
 } lv_img_ext_t;
 
 /*Image parts*/
@@ -135,6 +136,15 @@ void lv_img_set_zoom(lv_obj_t * img, uint16_t zoom);
  */
 void lv_img_set_antialias(lv_obj_t * img, bool antialias);
 
+/**
+ * Cache the rotated/zoomed image in a snapshot and redraw it from there while the angle, zoom,
+ * pivot and source are unchanged. Useful for images with static transformation.
+ * Requires `LV_IMG_TRANSFORM_CACHE_MEM > 0`.
+ * @param img pointer to an image object
+ * @param en true: enable the snapshot cache; false: transform the image on every redraw
+ */
+void lv_img_set_transform_cache(lv_obj_t * img, bool en);
+
 /*=====================
  * Getter functions
  *====================*/
@@ -202,6 +212,13 @@ uint16_t lv_img_get_zoom(lv_obj_t * img);
  */
 bool lv_img_get_antialias(lv_obj_t * img);
 
+/**
+ * Get whether the transformed image is drawn from a cached snapshot
+ * @param img pointer to an image object
+ * @return true: the snapshot cache is enabled; false: disabled
+ */
+bool lv_img_get_transform_cache(lv_obj_t * img);
+
 /**********************
  *      MACROS
  **********************/
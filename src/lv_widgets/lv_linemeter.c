@@ -10,9 +10,11 @@
 #if LV_USE_LINEMETER != 0
 
 #include "../lv_misc/lv_debug.h"
+#include "../lv_core/lv_layer_cache.h"
 #include "../lv_draw/lv_draw.h"
 #include "../lv_themes/lv_theme.h"
 #include "../lv_core/lv_group.h"
+#include "../lv_core/lv_refr.h"
 #include "../lv_misc/lv_math.h"
 
 /*********************
@@ -20,6 +22,9 @@
  *********************/
 #define LV_OBJX_NAME "lv_linemeter"
 
+/*Lines not wider than this are drawn without masks*/
+#define LINEMETER_THIN_LINE_MAX_WIDTH   4
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -29,6 +34,15 @@
  **********************/
 static lv_design_res_t lv_linemeter_design(lv_obj_t * lmeter, const lv_area_t * clip_area, lv_design_mode_t mode);
 static lv_res_t lv_linemeter_signal(lv_obj_t * lmeter, lv_signal_t sign, void * param);
+static int16_t get_level(lv_obj_t * lmeter, int32_t value);
+static void invalidate_lines(lv_obj_t * lmeter, int16_t line_start, int16_t line_end);
+static lv_linemeter_line_t * get_scale_lines(lv_obj_t * lmeter, uint8_t part, lv_coord_t r_out, lv_coord_t r_in,
+                                             int16_t angle_ofs, lv_color_t main_color, lv_color_t grad_color);
+static void calc_line(lv_obj_t * lmeter, uint16_t i, lv_coord_t r_out, lv_coord_t r_in, int16_t angle_ofs,
+                      lv_color_t main_color, lv_color_t grad_color, lv_linemeter_line_t * line);
+static void draw_thin_line(const lv_linemeter_line_t * line, lv_coord_t x_ofs, lv_coord_t y_ofs, lv_coord_t r_out,
+                           lv_coord_t r_in, const lv_area_t * clip_area, const lv_draw_line_dsc_t * dsc,
+                           lv_opa_t * mask_buf, uint32_t mask_buf_size);
 
 /**********************
  *  STATIC VARIABLES
@@ -77,6 +91,7 @@ lv_obj_t * lv_linemeter_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->scale_angle = 240;
     ext->angle_ofs = 0;
     ext->mirrored = 0;
+    _lv_memset_00(ext->scale_cache, sizeof(ext->scale_cache));
 
     /*The signal and design functions are not copied so set them here*/
     lv_obj_set_signal_cb(linemeter, lv_linemeter_signal);
@@ -126,14 +141,28 @@ void lv_linemeter_set_value(lv_obj_t * lmeter, int32_t value)
     ext->cur_value = value > ext->max_value ? ext->max_value : value;
     ext->cur_value = ext->cur_value < ext->min_value ? ext->min_value : ext->cur_value;
 
-    int16_t level_old =
-        (int32_t)((int32_t)(old_value - ext->min_value) * (ext->line_cnt - 1)) / (ext->max_value - ext->min_value);
-    int16_t level_new =
-        (int32_t)((int32_t)(ext->cur_value - ext->min_value) * (ext->line_cnt - 1)) / (ext->max_value - ext->min_value);
+    int16_t level_old = get_level(lmeter, old_value);
+    int16_t level_new = get_level(lmeter, ext->cur_value);
 
     if(level_new == level_old) return;
 
-    lv_obj_invalidate(lmeter);
+    /* With the minimal value all the lines have the end color.
+     * The border arc is not drawn if the level is at the end.*/
+    if(old_value == ext->min_value || ext->cur_value == ext->min_value ||
+       LV_MATH_MAX(level_old, level_new) + 1 >= ext->line_cnt - 1) {
+        lv_obj_invalidate(lmeter);
+        return;
+    }
+
+    /* Only the lines between the old and new level change their color.
+     * The border arc changes from the line after the level.*/
+    invalidate_lines(lmeter, LV_MATH_MIN(level_old, level_new), LV_MATH_MAX(level_old, level_new) + 1);
+
+#if LV_LAYER_CACHE_MEM
+    /* A gauge sets its critical value here and draws the colored lines on its background layer.
+     * Render the layer again. A line meter has no layer so it's a no-op then.*/
+    _lv_layer_cache_remove_bg(lmeter);
+#endif
 }
 
 /**
@@ -304,6 +333,12 @@ bool lv_linemeter_get_mirror(lv_obj_t * lmeter)
     return ext->mirrored;
 }
 
+/**
+ * Draw the scale of a line meter
+ * @param lmeter pointer to a line meter object
+ * @param clip_area the scale will be drawn only in this area
+ * @param part the part whose style is used to draw the lines (e.g. the major lines of a gauge)
+ */
 void lv_linemeter_draw_scale(lv_obj_t * lmeter, const lv_area_t * clip_area, uint8_t part)
 {
     lv_linemeter_ext_t * ext    = lv_obj_get_ext_attr(lmeter);
@@ -319,10 +354,8 @@ void lv_linemeter_draw_scale(lv_obj_t * lmeter, const lv_area_t * clip_area, uin
     lv_coord_t x_ofs  = lmeter->coords.x1 + r_out + left;
     lv_coord_t y_ofs  = lmeter->coords.y1 + r_out + top;
     int16_t angle_ofs = ext->angle_ofs + 90 + (360 - ext->scale_angle) / 2;
-    int16_t level = ext->mirrored ?
-                    (int32_t)((int32_t)(ext->max_value - ext->cur_value) * (ext->line_cnt - 1)) / (ext->max_value - ext->min_value) :
-                    (int32_t)((int32_t)(ext->cur_value - ext->min_value) * (ext->line_cnt - 1)) / (ext->max_value - ext->min_value);
-    uint8_t i;
+    int16_t level = get_level(lmeter, ext->cur_value);
+    uint16_t i;
 
     lv_color_t main_color = lv_obj_get_style_line_color(lmeter, part);
     lv_color_t grad_color = lv_obj_get_style_scale_grad_color(lmeter, part);
@@ -335,128 +368,107 @@ void lv_linemeter_draw_scale(lv_obj_t * lmeter, const lv_area_t * clip_area, uin
     line_dsc.raw_end = 1;
 #endif
 
+    lv_style_int_t main_line_width = line_dsc.width;
     lv_style_int_t end_line_width = lv_obj_get_style_scale_end_line_width(lmeter, part);
 
+    /*Thin lines are drawn one by one with their coverage calculated directly
+     *instead of adding line and radius masks for each line.
+     *Only if there are no other masks because they wouldn't be applied.*/
+    bool thin = LV_MATH_MAX(main_line_width, end_line_width) <= LINEMETER_THIN_LINE_MAX_WIDTH &&
+                line_dsc.round_start == 0 && line_dsc.round_end == 0 &&
+                (line_dsc.dash_width == 0 || line_dsc.dash_gap == 0) &&
+                lv_draw_mask_get_cnt() == 0;
+
+    lv_linemeter_line_t * lines = get_scale_lines(lmeter, part, r_out, r_in, angle_ofs, main_color, grad_color);
+
+    lv_opa_t * mask_buf = NULL;
+    uint32_t mask_buf_size = 0;
+    if(thin) {
+        /*One buffer for all lines. It's enough for at least one row of any line.*/
+        uint32_t line_size = r_out - r_in + LINEMETER_THIN_LINE_MAX_WIDTH + 3;
+        mask_buf_size = LV_MATH_MIN(line_size * line_size, (uint32_t)lv_disp_get_hor_res(_lv_refr_get_disp_refreshing()));
+        mask_buf = _lv_mem_buf_get(mask_buf_size);
+        if(mask_buf == NULL) thin = false;  /*Draw them with `lv_draw_line` then*/
+    }
+
 #if LV_LINEMETER_PRECISE > 0
     lv_area_t mask_area;
-    mask_area.x1 = x_ofs - r_in;
-    mask_area.x2 = x_ofs + r_in - 1;
-    mask_area.y1 = y_ofs - r_in;
-    mask_area.y2 = y_ofs + r_in - 1;
-
     lv_draw_mask_radius_param_t mask_in_param;
-    lv_draw_mask_radius_init(&mask_in_param, &mask_area, LV_RADIUS_CIRCLE, true);
-    int16_t mask_in_id = lv_draw_mask_add(&mask_in_param, 0);
+    int16_t mask_in_id = LV_MASK_ID_INV;
+    if(!thin) {
+        mask_area.x1 = x_ofs - r_in;
+        mask_area.x2 = x_ofs + r_in - 1;
+        mask_area.y1 = y_ofs - r_in;
+        mask_area.y2 = y_ofs + r_in - 1;
+
+        lv_draw_mask_radius_init(&mask_in_param, &mask_area, LV_RADIUS_CIRCLE, true);
+        mask_in_id = lv_draw_mask_add(&mask_in_param, 0);
+    }
 #endif
 
 #if LV_LINEMETER_PRECISE > 1
-    mask_area.x1 = x_ofs - r_out;
-    mask_area.x2 = x_ofs + r_out - 1;
-    mask_area.y1 = y_ofs - r_out;
-    mask_area.y2 = y_ofs + r_out - 1;
     lv_draw_mask_radius_param_t mask_out_param;
-    lv_draw_mask_radius_init(&mask_out_param, &mask_area, LV_RADIUS_CIRCLE, false);
-    int16_t mask_out_id = lv_draw_mask_add(&mask_out_param, 0);
-    /*In calculation use a larger radius to avoid rounding errors */
-    lv_coord_t r_out_extra = r_out + LV_DPI;
-#else
-    lv_coord_t r_out_extra = r_out;
+    int16_t mask_out_id = LV_MASK_ID_INV;
+    if(!thin) {
+        mask_area.x1 = x_ofs - r_out;
+        mask_area.x2 = x_ofs + r_out - 1;
+        mask_area.y1 = y_ofs - r_out;
+        mask_area.y2 = y_ofs + r_out - 1;
+        lv_draw_mask_radius_init(&mask_out_param, &mask_area, LV_RADIUS_CIRCLE, false);
+        mask_out_id = lv_draw_mask_add(&mask_out_param, 0);
+    }
 #endif
 
     for(i = 0; i < ext->line_cnt; i++) {
-        /* `* 256` for extra precision*/
-        int32_t angle_upscale = (i * ext->scale_angle * 256) / (ext->line_cnt - 1);
-        int32_t angle_normal = angle_upscale >> 8;
-
-        int32_t angle_low = (angle_upscale >> 8);
-        int32_t angle_high = angle_low + 1;
-        int32_t angle_rem = angle_upscale & 0xFF;
-
-        /*Interpolate sine and cos*/
-        int32_t sin_low = _lv_trigo_sin(angle_low + angle_ofs);
-        int32_t sin_high = _lv_trigo_sin(angle_high + angle_ofs);
-        int32_t sin_mid = (sin_low * (256 - angle_rem) + sin_high * angle_rem) >> 8;
-
-        int32_t cos_low = _lv_trigo_sin(angle_low + 90 + angle_ofs);
-        int32_t cos_high = _lv_trigo_sin(angle_high + 90 + angle_ofs);
-        int32_t cos_mid = (cos_low * (256 - angle_rem) + cos_high * angle_rem) >> 8;
-
-        /*Use the interpolated values to get x and y coordinates*/
-        int32_t y_out_extra = (int32_t)((int32_t)sin_mid * r_out_extra) >> (LV_TRIGO_SHIFT - 8);
-        int32_t x_out_extra = (int32_t)((int32_t)cos_mid * r_out_extra) >> (LV_TRIGO_SHIFT - 8);
-
-        /*Rounding*/
-        if(x_out_extra > 0) x_out_extra = (x_out_extra + 127) >> 8;
-        else x_out_extra = (x_out_extra - 127) >> 8;
-
-        if(y_out_extra > 0) y_out_extra = (y_out_extra + 127) >> 8;
-        else y_out_extra = (y_out_extra - 127) >> 8;
-
-        x_out_extra += x_ofs;
-        y_out_extra += y_ofs;
-
-        /*With no extra precision use the coordinates on the inner radius*/
-#if LV_LINEMETER_PRECISE == 0
-        /*Use the interpolated values to get x and y coordinates*/
-        int32_t y_in_extra = (int32_t)((int32_t)sin_mid * r_in) >> (LV_TRIGO_SHIFT - 8);
-        int32_t x_in_extra = (int32_t)((int32_t)cos_mid * r_in) >> (LV_TRIGO_SHIFT - 8);
-
-        /*Rounding*/
-        if(x_in_extra > 0) x_in_extra = (x_in_extra + 127) >> 8;
-        else x_in_extra = (x_in_extra - 127) >> 8;
-
-        if(y_in_extra > 0) y_in_extra = (y_in_extra + 127) >> 8;
-        else y_in_extra = (y_in_extra - 127) >> 8;
+        /*Calculate the line here if the lines of the scale couldn't be cached*/
+        lv_linemeter_line_t line_calc;
+        const lv_linemeter_line_t * line;
+        if(lines) {
+            line = &lines[i];
+        }
+        else {
+            calc_line(lmeter, i, r_out, r_in, angle_ofs, main_color, grad_color, &line_calc);
+            line = &line_calc;
+        }
 
-        x_in_extra += x_ofs;
-        y_in_extra += y_ofs;
-#else
-        int32_t x_in_extra = x_ofs;
-        int32_t y_in_extra = y_ofs;
-#endif
+        /* Set the color of the lines */
+        if(ext->cur_value == ext->min_value || (!ext->mirrored && i > level) || (ext->mirrored && i < level)) {
+            line_dsc.color = end_color;
+            line_dsc.width = end_line_width;
+        }
+        else {
+            line_dsc.color = line->color;
+            line_dsc.width = main_line_width;
+        }
 
         /*Use smaller clip area only around the visible line*/
-        int32_t y_in  = (int32_t)((int32_t)_lv_trigo_sin(angle_normal + angle_ofs) * r_in) >> LV_TRIGO_SHIFT;
-        int32_t x_in  = (int32_t)((int32_t)_lv_trigo_sin(angle_normal + 90 + angle_ofs) * r_in) >> LV_TRIGO_SHIFT;
-
-        x_in += x_ofs;
-        y_in += y_ofs;
-
-        int32_t y_out  = (int32_t)((int32_t)_lv_trigo_sin(angle_normal + angle_ofs) * r_out) >> LV_TRIGO_SHIFT;
-        int32_t x_out  = (int32_t)((int32_t)_lv_trigo_sin(angle_normal + 90 + angle_ofs) * r_out) >> LV_TRIGO_SHIFT;
-
-        x_out += x_ofs;
-        y_out += y_ofs;
-
         lv_area_t clip_sub;
-        clip_sub.x1 = LV_MATH_MIN(x_in, x_out) - line_dsc.width;
-        clip_sub.x2 = LV_MATH_MAX(x_in, x_out) + line_dsc.width;
-        clip_sub.y1 = LV_MATH_MIN(y_in, y_out) - line_dsc.width;
-        clip_sub.y2 = LV_MATH_MAX(y_in, y_out) + line_dsc.width;
+        clip_sub.x1 = line->area.x1 + x_ofs - line_dsc.width;
+        clip_sub.x2 = line->area.x2 + x_ofs + line_dsc.width;
+        clip_sub.y1 = line->area.y1 + y_ofs - line_dsc.width;
+        clip_sub.y2 = line->area.y2 + y_ofs + line_dsc.width;
 
         if(_lv_area_intersect(&clip_sub, &clip_sub, clip_area) == false) continue;
 
-        lv_point_t p1;
-        lv_point_t p2;
+        if(thin) {
+            draw_thin_line(line, x_ofs, y_ofs, r_out, r_in, &clip_sub, &line_dsc, mask_buf, mask_buf_size);
+        }
+        else {
+            lv_point_t p1;
+            lv_point_t p2;
 
-        p2.x = x_in_extra;
-        p2.y = y_in_extra;
+            p2.x = line->p_in.x + x_ofs;
+            p2.y = line->p_in.y + y_ofs;
 
-        p1.x = x_out_extra;
-        p1.y = y_out_extra;
+            p1.x = line->p_out.x + x_ofs;
+            p1.y = line->p_out.y + y_ofs;
 
-        /* Set the color of the lines */
-        if(ext->cur_value == ext->min_value || (!ext->mirrored && i > level) || (ext->mirrored && i < level)) {
-            line_dsc.color = end_color;
-            line_dsc.width = end_line_width;
+            lv_draw_line(&p1, &p2, &clip_sub, &line_dsc);
         }
-        else {
-            line_dsc.color = lv_color_mix(grad_color, main_color, (255 * i) / ext->line_cnt);
-        }
-
-        lv_draw_line(&p1, &p2, &clip_sub, &line_dsc);
     }
 
+    if(mask_buf) _lv_mem_buf_release(mask_buf);
+
 #if LV_LINEMETER_PRECISE > 0
     lv_draw_mask_remove_id(mask_in_id);
 #endif
@@ -543,7 +555,12 @@ static lv_res_t lv_linemeter_signal(lv_obj_t * lmeter, lv_signal_t sign, void *
     if(sign == LV_SIGNAL_GET_TYPE) return lv_obj_handle_get_type_signal(param, LV_OBJX_NAME);
 
     if(sign == LV_SIGNAL_CLEANUP) {
-        /*Nothing to cleanup. (No dynamically allocated memory in 'ext')*/
+        lv_linemeter_ext_t * ext = lv_obj_get_ext_attr(lmeter);
+        uint8_t i;
+        for(i = 0; i < _LV_LINEMETER_SCALE_CACHE_CNT; i++) {
+            lv_mem_free(ext->scale_cache[i].lines);
+            ext->scale_cache[i].lines = NULL;
+        }
     }
     else if(sign == LV_SIGNAL_STYLE_CHG) {
         lv_obj_refresh_ext_draw_pad(lmeter);
@@ -552,4 +569,306 @@ static lv_res_t lv_linemeter_signal(lv_obj_t * lmeter, lv_signal_t sign, void *
 
     return res;
 }
+
+/**
+ * Get the index of the last line drawn with the main color for a value
+ * (With mirroring the lines before this index have the end color)
+ * @param lmeter pointer to a line meter object
+ * @param value a value of the line meter
+ * @return index of a line
+ */
+static int16_t get_level(lv_obj_t * lmeter, int32_t value)
+{
+    lv_linemeter_ext_t * ext = lv_obj_get_ext_attr(lmeter);
+
+    if(ext->mirrored) {
+        return (int32_t)((int32_t)(ext->max_value - value) * (ext->line_cnt - 1)) / (ext->max_value - ext->min_value);
+    }
+    else {
+        return (int32_t)((int32_t)(value - ext->min_value) * (ext->line_cnt - 1)) / (ext->max_value - ext->min_value);
+    }
+}
+
+/**
+ * Invalidate only the area of some lines of the scale
+ * @param lmeter pointer to a line meter object
+ * @param line_start index of the first line to invalidate
+ * @param line_end index of the last line to invalidate
+ */
+static void invalidate_lines(lv_obj_t * lmeter, int16_t line_start, int16_t line_end)
+{
+    lv_linemeter_ext_t * ext = lv_obj_get_ext_attr(lmeter);
+    if(ext->line_cnt < 2) {
+        lv_obj_invalidate(lmeter);
+        return;
+    }
+
+    if(line_start < 0) line_start = 0;
+    if(line_end > ext->line_cnt - 1) line_end = ext->line_cnt - 1;
+
+    lv_style_int_t left = lv_obj_get_style_pad_left(lmeter, LV_LINEMETER_PART_MAIN);
+    lv_style_int_t right = lv_obj_get_style_pad_right(lmeter, LV_LINEMETER_PART_MAIN);
+    lv_style_int_t top = lv_obj_get_style_pad_top(lmeter, LV_LINEMETER_PART_MAIN);
+
+    lv_coord_t r_out = (lv_obj_get_width(lmeter) - left - right) / 2 ;
+    lv_coord_t x_ofs  = lmeter->coords.x1 + r_out + left;
+    lv_coord_t y_ofs  = lmeter->coords.y1 + r_out + top;
+    int16_t angle_ofs = ext->angle_ofs + 90 + (360 - ext->scale_angle) / 2;
+
+    /*The lines and the border arc might be wider than the line of the current level*/
+    lv_coord_t w = lv_obj_get_style_line_width(lmeter, LV_LINEMETER_PART_MAIN);
+    w = LV_MATH_MAX(w, lv_obj_get_style_scale_end_line_width(lmeter, LV_LINEMETER_PART_MAIN));
+    w = LV_MATH_MAX(w, lv_obj_get_style_scale_border_width(lmeter, LV_LINEMETER_PART_MAIN));
+    w = LV_MATH_MAX(w, lv_obj_get_style_scale_end_border_width(lmeter, LV_LINEMETER_PART_MAIN));
+    w += 2; /*For rounding and anti-aliasing*/
+
+    /* Start from the center because the inner radius of the lines depends on the part
+     * (e.g. the major lines of a gauge)*/
+    lv_area_t a;
+    a.x1 = x_ofs;
+    a.y1 = y_ofs;
+    a.x2 = x_ofs;
+    a.y2 = y_ofs;
+
+    int16_t i;
+    for(i = line_start; i <= line_end; i++) {
+        int16_t angle = (int32_t)((int32_t)i * ext->scale_angle) / (ext->line_cnt - 1) + angle_ofs;
+        lv_coord_t x_out = x_ofs + ((_lv_trigo_sin(angle + 90) * r_out) >> LV_TRIGO_SHIFT);
+        lv_coord_t y_out = y_ofs + ((_lv_trigo_sin(angle) * r_out) >> LV_TRIGO_SHIFT);
+
+        a.x1 = LV_MATH_MIN(a.x1, x_out);
+        a.y1 = LV_MATH_MIN(a.y1, y_out);
+        a.x2 = LV_MATH_MAX(a.x2, x_out);
+        a.y2 = LV_MATH_MAX(a.y2, y_out);
+    }
+
+    a.x1 -= w;
+    a.y1 -= w;
+    a.x2 += w;
+    a.y2 += w;
+
+    lv_obj_invalidate_area(lmeter, &a);
+}
+
+/**
+ * Get the lines of a scale from the cache. Calculate them again if the geometry or the colors are changed.
+ * @param lmeter pointer to a line meter object
+ * @param part the part whose scale is drawn
+ * @param r_out outer radius of the scale
+ * @param r_in inner radius of the scale
+ * @param angle_ofs angle of the first line
+ * @param main_color color of the first line
+ * @param grad_color color of the last line
+ * @return the lines of the scale or NULL if they can't be allocated
+ */
+static lv_linemeter_line_t * get_scale_lines(lv_obj_t * lmeter, uint8_t part, lv_coord_t r_out, lv_coord_t r_in,
+                                             int16_t angle_ofs, lv_color_t main_color, lv_color_t grad_color)
+{
+    lv_linemeter_ext_t * ext = lv_obj_get_ext_attr(lmeter);
+    lv_linemeter_scale_cache_t * cache = &ext->scale_cache[part == LV_LINEMETER_PART_MAIN ? 0 : 1];
+
+    if(cache->lines &&
+       cache->r_out == r_out && cache->r_in == r_in &&
+       cache->angle_ofs == angle_ofs && cache->scale_angle == ext->scale_angle &&
+       cache->line_cnt == ext->line_cnt &&
+       cache->main_color.full == main_color.full && cache->grad_color.full == grad_color.full) {
+        return cache->lines;
+    }
+
+    if(cache->lines == NULL || cache->line_cnt != ext->line_cnt) {
+        lv_mem_free(cache->lines);
+        cache->lines = NULL;
+        if(ext->line_cnt == 0) return NULL;
+        cache->lines = lv_mem_alloc(ext->line_cnt * sizeof(lv_linemeter_line_t));
+        if(cache->lines == NULL) {
+            LV_LOG_WARN("lv_linemeter: couldn't allocate the lines of the scale");
+            return NULL;
+        }
+    }
+
+    cache->r_out = r_out;
+    cache->r_in = r_in;
+    cache->angle_ofs = angle_ofs;
+    cache->scale_angle = ext->scale_angle;
+    cache->line_cnt = ext->line_cnt;
+    cache->main_color = main_color;
+    cache->grad_color = grad_color;
+
+    uint16_t i;
+    for(i = 0; i < ext->line_cnt; i++) {
+        calc_line(lmeter, i, r_out, r_in, angle_ofs, main_color, grad_color, &cache->lines[i]);
+    }
+
+    return cache->lines;
+}
+
+/**
+ * Calculate the end points, the direction and the color of a line of the scale
+ * @param lmeter pointer to a line meter object
+ * @param i index of the line
+ * @param r_out outer radius of the scale
+ * @param r_in inner radius of the scale
+ * @param angle_ofs angle of the first line
+ * @param main_color color of the first line
+ * @param grad_color color of the last line
+ * @param line store the result here
+ */
+static void calc_line(lv_obj_t * lmeter, uint16_t i, lv_coord_t r_out, lv_coord_t r_in, int16_t angle_ofs,
+                      lv_color_t main_color, lv_color_t grad_color, lv_linemeter_line_t * line)
+{
+    lv_linemeter_ext_t * ext = lv_obj_get_ext_attr(lmeter);
+
+#if LV_LINEMETER_PRECISE > 1
+    /*In calculation use a larger radius to avoid rounding errors */
+    lv_coord_t r_out_extra = r_out + LV_DPI;
+#else
+    lv_coord_t r_out_extra = r_out;
+#endif
+
+    /* `* 256` for extra precision*/
+    int32_t angle_upscale = ((int32_t)i * ext->scale_angle * 256) / (ext->line_cnt - 1);
+
+    int32_t angle_low = (angle_upscale >> 8);
+    int32_t angle_high = angle_low + 1;
+    int32_t angle_rem = angle_upscale & 0xFF;
+
+    /*Interpolate sine and cos*/
+    int32_t sin_low = _lv_trigo_sin(angle_low + angle_ofs);
+    int32_t sin_high = _lv_trigo_sin(angle_high + angle_ofs);
+    int32_t sin_mid = (sin_low * (256 - angle_rem) + sin_high * angle_rem) >> 8;
+
+    int32_t cos_low = _lv_trigo_sin(angle_low + 90 + angle_ofs);
+    int32_t cos_high = _lv_trigo_sin(angle_high + 90 + angle_ofs);
+    int32_t cos_mid = (cos_low * (256 - angle_rem) + cos_high * angle_rem) >> 8;
+
+    line->sin = sin_mid;
+    line->cos = cos_mid;
+
+    /*Use the interpolated values to get x and y coordinates*/
+    int32_t y_out_extra = (int32_t)((int32_t)sin_mid * r_out_extra) >> (LV_TRIGO_SHIFT - 8);
+    int32_t x_out_extra = (int32_t)((int32_t)cos_mid * r_out_extra) >> (LV_TRIGO_SHIFT - 8);
+
+    /*Rounding*/
+    if(x_out_extra > 0) x_out_extra = (x_out_extra + 127) >> 8;
+    else x_out_extra = (x_out_extra - 127) >> 8;
+
+    if(y_out_extra > 0) y_out_extra = (y_out_extra + 127) >> 8;
+    else y_out_extra = (y_out_extra - 127) >> 8;
+
+    line->p_out.x = x_out_extra;
+    line->p_out.y = y_out_extra;
+
+    /*With no extra precision use the coordinates on the inner radius*/
+#if LV_LINEMETER_PRECISE == 0
+    /*Use the interpolated values to get x and y coordinates*/
+    int32_t y_in_extra = (int32_t)((int32_t)sin_mid * r_in) >> (LV_TRIGO_SHIFT - 8);
+    int32_t x_in_extra = (int32_t)((int32_t)cos_mid * r_in) >> (LV_TRIGO_SHIFT - 8);
+
+    /*Rounding*/
+    if(x_in_extra > 0) x_in_extra = (x_in_extra + 127) >> 8;
+    else x_in_extra = (x_in_extra - 127) >> 8;
+
+    if(y_in_extra > 0) y_in_extra = (y_in_extra + 127) >> 8;
+    else y_in_extra = (y_in_extra - 127) >> 8;
+
+    line->p_in.x = x_in_extra;
+    line->p_in.y = y_in_extra;
+#else
+    line->p_in.x = 0;
+    line->p_in.y = 0;
+#endif
+
+    /*The area of the visible part of the line. +/-1 for rounding.*/
+    int32_t y_in  = (int32_t)((int32_t)sin_mid * r_in) >> LV_TRIGO_SHIFT;
+    int32_t x_in  = (int32_t)((int32_t)cos_mid * r_in) >> LV_TRIGO_SHIFT;
+    int32_t y_out  = (int32_t)((int32_t)sin_mid * r_out) >> LV_TRIGO_SHIFT;
+    int32_t x_out  = (int32_t)((int32_t)cos_mid * r_out) >> LV_TRIGO_SHIFT;
+
+    line->area.x1 = LV_MATH_MIN(x_in, x_out) - 1;
+    line->area.x2 = LV_MATH_MAX(x_in, x_out) + 1;
+    line->area.y1 = LV_MATH_MIN(y_in, y_out) - 1;
+    line->area.y2 = LV_MATH_MAX(y_in, y_out) + 1;
+
+    line->color = lv_color_mix(grad_color, main_color, (255 * i) / ext->line_cnt);
+}
+
+/**
+ * Draw a thin line of the scale between the inner and outer radius.
+ * The coverage of the pixels is calculated from their distance to the center line and
+ * the radii so no masks are required.
+ * @param line pointer to the line to draw
+ * @param x_ofs x coordinate of the center
+ * @param y_ofs y coordinate of the center
+ * @param r_out outer radius of the scale
+ * @param r_in inner radius of the scale
+ * @param clip_area draw only in this area
+ * @param dsc width, color, opacity and blend mode of the line
+ * @param mask_buf buffer for the coverage of the pixels
+ * @param mask_buf_size size of `mask_buf`. Should be at least the width of `clip_area`
+ */
+static void draw_thin_line(const lv_linemeter_line_t * line, lv_coord_t x_ofs, lv_coord_t y_ofs, lv_coord_t r_out,
+                           lv_coord_t r_in, const lv_area_t * clip_area, const lv_draw_line_dsc_t * dsc,
+                           lv_opa_t * mask_buf, uint32_t mask_buf_size)
+{
+    if(dsc->width == 0) return;
+    if(dsc->opa <= LV_OPA_MIN) return;
+
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    bool aa = lv_disp_get_antialiasing(disp);
+
+    /* Work with 1/256 pixel units.
+     * The center of the scale is between the pixels like with the radius masks
+     * so the coordinates of the pixel centers are doubled to stay integer.*/
+    int32_t cos_v = line->cos;
+    int32_t sin_v = line->sin;
+    int32_t half_w = (dsc->width << 7) + 128;   /*(width / 2 + 0.5) * 256*/
+    int32_t r_in_ext = ((int32_t)r_in << 8) - 128;
+    int32_t r_out_ext = ((int32_t)r_out << 8) + 128;
+
+    int32_t w = lv_area_get_width(clip_area);
+    int32_t row_cnt = mask_buf_size / w;
+    if(row_cnt == 0) return;
+
+    lv_area_t fill_area;
+    fill_area.x1 = clip_area->x1;
+    fill_area.x2 = clip_area->x2;
+    fill_area.y1 = clip_area->y1;
+
+    while(fill_area.y1 <= clip_area->y2) {
+        fill_area.y2 = LV_MATH_MIN(fill_area.y1 + row_cnt - 1, clip_area->y2);
+
+        lv_opa_t * mask_p = mask_buf;
+        int32_t y;
+        for(y = fill_area.y1; y <= fill_area.y2; y++) {
+            int32_t dx2 = 2 * (fill_area.x1 - x_ofs) + 1;
+            int32_t dy2 = 2 * (y - y_ofs) + 1;
+            /*Distance along and across the line in 1/(256 * 2^(LV_TRIGO_SHIFT - 7)) units*/
+            int32_t along = dx2 * cos_v + dy2 * sin_v;
+            int32_t across = dy2 * cos_v - dx2 * sin_v;
+            int32_t x;
+            for(x = 0; x < w; x++) {
+                int32_t along_px = along >> (LV_TRIGO_SHIFT - 7);
+                int32_t across_px = across >> (LV_TRIGO_SHIFT - 7);
+                int32_t cov = half_w - LV_MATH_ABS(across_px);
+                cov = LV_MATH_MIN(cov, along_px - r_in_ext);
+                cov = LV_MATH_MIN(cov, r_out_ext - along_px);
+
+                if(cov <= 0) mask_p[x] = LV_OPA_TRANSP;
+                else if(cov >= 256) mask_p[x] = LV_OPA_COVER;
+                else if(aa) mask_p[x] = (cov * 255) >> 8;
+                else mask_p[x] = cov >= 128 ? LV_OPA_COVER : LV_OPA_TRANSP;
+
+                along += 2 * cos_v;
+                across -= 2 * sin_v;
+            }
+            mask_p += w;
+        }
+
+        _lv_blend_fill(clip_area, &fill_area, dsc->color, mask_buf, LV_DRAW_MASK_RES_CHANGED, dsc->opa,
+                       dsc->blend_mode);
+
+        fill_area.y1 = fill_area.y2 + 1;
+    }
+}
+
 #endif
@@ -22,10 +22,34 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+/*Number of scales whose line geometry is cached: the main part and an other part (e.g. the major lines of a gauge)*/
+#define _LV_LINEMETER_SCALE_CACHE_CNT   2
 
 /**********************
  *      TYPEDEFS
  **********************/
+/*Precomputed geometry and color of a line of the scale*/
+typedef struct {
+    lv_point_t p_out;       /*Outer end point of the line relative to the center*/
+    lv_point_t p_in;        /*Inner end point of the line relative to the center*/
+    lv_area_t area;         /*Area of the visible part of the line relative to the center*/
+    int16_t sin;            /*Direction of the line*/
+    int16_t cos;
+    lv_color_t color;       /*Color of the line on the gradient*/
+} lv_linemeter_line_t;
+
+/*Lines of a scale and the parameters they were calculated for*/
+typedef struct {
+    lv_linemeter_line_t * lines;
+    lv_coord_t r_out;
+    lv_coord_t r_in;
+    int16_t angle_ofs;
+    uint16_t scale_angle;
+    uint16_t line_cnt;
+    lv_color_t main_color;
+    lv_color_t grad_color;
+} lv_linemeter_scale_cache_t;
+
 /*Data of line meter*/
 typedef struct {
     /*No inherited ext.*/ /*Ext. of ancestor*/
@@ -37,6 +61,7 @@ typedef struct {
     int32_t min_value;
     int32_t max_value;
     uint8_t mirrored : 1;
+    lv_linemeter_scale_cache_t scale_cache[_LV_LINEMETER_SCALE_CACHE_CNT];
 } lv_linemeter_ext_t;
 
 /*Styles*/
@@ -147,6 +172,12 @@ uint16_t lv_linemeter_get_scale_angle(const lv_obj_t * lmeter);
  */
 uint16_t lv_linemeter_get_angle_offset(lv_obj_t * lmeter);
 
+/**
+ * Draw the scale of a line meter
+ * @param lmeter pointer to a line meter object
+ * @param clip_area the scale will be drawn only in this area
+ * @param part the part whose style is used to draw the lines (e.g. the major lines of a gauge)
+ */
 void lv_linemeter_draw_scale(lv_obj_t * lmeter, const lv_area_t * clip_area, uint8_t part);
 
 /**
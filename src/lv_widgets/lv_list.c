@@ -21,6 +21,7 @@
 #define LV_OBJX_NAME "lv_list"
 
 #define LV_LIST_LAYOUT_DEF LV_LAYOUT_COLUMN_MID
+#define LV_LIST_VIRT_ID_NONE 0xFFFFFFFF
 
 #if LV_USE_ANIMATION == 0
     #undef LV_LIST_DEF_ANIM_TIME
@@ -36,6 +37,12 @@
  **********************/
 static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param);
 static lv_res_t lv_list_btn_signal(lv_obj_t * btn, lv_signal_t sign, void * param);
+static lv_res_t lv_list_scrl_signal(lv_obj_t * scrl, lv_signal_t sign, void * param);
+static bool virt_add_btn(lv_obj_t * list);
+static void virt_refr(lv_obj_t * list, bool reset);
+static lv_obj_t * virt_show(lv_obj_t * list, uint32_t id);
+static int32_t virt_get_id_at(const lv_obj_t * list, lv_coord_t y);
+static void virt_free(lv_obj_t * list);
 static lv_style_list_t * lv_list_get_style(lv_obj_t * list, uint8_t part);
 static bool lv_list_is_list_btn(lv_obj_t * list_btn);
 static bool lv_list_is_list_img(lv_obj_t * list_btn);
@@ -50,6 +57,7 @@ static bool lv_list_is_list_label(lv_obj_t * list_btn);
 static lv_signal_cb_t label_signal;
 static lv_signal_cb_t ancestor_page_signal;
 static lv_signal_cb_t ancestor_btn_signal;
+static lv_signal_cb_t ancestor_scrl_signal;
 
 /**********************
  *      MACROS
@@ -87,6 +95,14 @@ lv_obj_t * lv_list_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->last_sel_btn = NULL;
 #endif
     ext->act_sel_btn = NULL;
+    ext->bind_cb = NULL;
+    ext->virt_btns = NULL;
+    ext->virt_cnt = 0;
+    ext->virt_base = 0;
+    ext->virt_win_cnt = 0;
+    ext->virt_btn_cnt = 0;
+    ext->virt_item_h = 0;
+    ext->virt_refr_ip = 0;
 
     lv_obj_set_signal_cb(list, lv_list_signal);
 
@@ -102,7 +118,8 @@ lv_obj_t * lv_list_create(lv_obj_t * par, const lv_obj_t * copy)
 
     }
     else {
-        lv_obj_t * copy_btn = lv_list_get_next_btn(copy, NULL);
+        lv_list_ext_t * copy_ext = lv_obj_get_ext_attr(copy);
+        lv_obj_t * copy_btn = copy_ext->bind_cb ? NULL : lv_list_get_next_btn(copy, NULL);
         while(copy_btn) {
             const void * img_src = NULL;
 #if LV_USE_IMG
@@ -113,6 +130,8 @@ lv_obj_t * lv_list_create(lv_obj_t * par, const lv_obj_t * copy)
             copy_btn = lv_list_get_next_btn(copy, copy_btn);
         }
 
+        if(copy_ext->bind_cb) lv_list_set_virtual(list, copy_ext->virt_cnt, copy_ext->bind_cb);
+
         /*Refresh the style with new signal function*/
         lv_obj_refresh_style(list, LV_OBJ_PART_ALL, LV_STYLE_PROP_ALL);
     }
@@ -130,6 +149,9 @@ void lv_list_clean(lv_obj_t * list)
 {
     LV_ASSERT_OBJ(list, LV_OBJX_NAME);
 
+    /*The recycled buttons are deleted too*/
+    virt_free(list);
+
     lv_obj_t * scrl = lv_page_get_scrollable(list);
     lv_obj_clean(scrl);
 }
@@ -142,12 +164,20 @@ void lv_list_clean(lv_obj_t * list)
  * @param list pointer to list object
  * @param img_fn file name of an image before the text (NULL if unused)
  * @param txt text of the list element (NULL if unused)
- * @return pointer to the new list element which can be customized (a button)
+ * @return pointer to the new list element which can be customized (a button).
+ *         NULL in virtual mode.
  */
 lv_obj_t * lv_list_add_btn(lv_obj_t * list, const void * img_src, const char * txt)
 {
     LV_ASSERT_OBJ(list, LV_OBJX_NAME);
 
+    /*In virtual mode only `virt_refr` can add the recycled buttons*/
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->bind_cb && ext->virt_refr_ip == 0) {
+        LV_LOG_WARN("lv_list_add_btn: the list is in virtual mode");
+        return NULL;
+    }
+
     lv_obj_t * last_btn = lv_list_get_prev_btn(list, NULL);
 
     /*The coordinates may changed due to autofit so revert them at the end*/
@@ -241,13 +271,18 @@ lv_obj_t * lv_list_add_btn(lv_obj_t * list, const void * img_src, const char * t
  * @param list pointer to a list object
  * @param index pointer to a the button's index in the list, index must be 0 <= index <
  * lv_list_ext_t.size
- * @return true: successfully deleted
+ * @return true: successfully deleted; false: not found or the list is in virtual mode
  */
 bool lv_list_remove(const lv_obj_t * list, uint16_t index)
 {
     LV_ASSERT_OBJ(list, LV_OBJX_NAME);
 
     lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->bind_cb) {
+        LV_LOG_WARN("lv_list_remove: the list is in virtual mode, use lv_list_set_virtual_cnt");
+        return false;
+    }
+
     uint16_t count = 0;
     lv_obj_t * e   = lv_list_get_next_btn(list, NULL);
     while(e != NULL) {
@@ -266,6 +301,90 @@ bool lv_list_remove(const lv_obj_t * list, uint16_t index)
     return false;
 }
 
+/**
+ * Show many items with a few recycled buttons. Only the buttons on the visible part of the list exist
+ * and they are bound to other items while the list is scrolled.
+ * All items have the same height and the existing buttons are deleted.
+ * @param list pointer to a list object
+ * @param cnt number of items
+ * @param bind_cb called to show an item on a button. NULL to leave the virtual mode.
+ * @note the scrollable can't be taller than the range of `lv_coord_t` so with a lot of items
+ * it covers only a window of the items which is moved while scrolling.
+ * The scrollbar shows the position in this window.
+ * @note `bind_cb` is also called to measure the height of the first item.
+ * In virtual mode `lv_list_add_btn` and `lv_list_remove` are rejected.
+ */
+void lv_list_set_virtual(lv_obj_t * list, uint32_t cnt, lv_list_bind_cb_t bind_cb)
+{
+    LV_ASSERT_OBJ(list, LV_OBJX_NAME);
+
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+
+    lv_list_clean(list);
+
+    if(bind_cb == NULL) {
+        if(ext->bind_cb == NULL) return;
+        ext->bind_cb = NULL;
+        ext->virt_cnt = 0;
+        lv_obj_set_signal_cb(scrl, ancestor_scrl_signal);
+        lv_page_set_scrollable_fit2(list, LV_FIT_PARENT, LV_FIT_TIGHT);
+        lv_page_set_scrl_layout(list, LV_LIST_LAYOUT_DEF);
+        return;
+    }
+
+    /*Follow the scrolling to bind the buttons to the visible items*/
+    if(ancestor_scrl_signal == NULL) ancestor_scrl_signal = lv_obj_get_signal_cb(scrl);
+    lv_obj_set_signal_cb(scrl, lv_list_scrl_signal);
+
+    /*The buttons are positioned manually*/
+    lv_page_set_scrl_layout(list, LV_LAYOUT_OFF);
+    lv_page_set_scrollable_fit2(list, LV_FIT_PARENT, LV_FIT_NONE);
+
+    ext->bind_cb = bind_cb;
+    ext->virt_cnt = cnt;
+    ext->virt_base = 0;
+    lv_obj_set_y(scrl, 0);
+    virt_refr(list, true);
+}
+
+/**
+ * Change the number of items of a virtual list and bind all visible buttons again
+ * @param list pointer to a list in virtual mode
+ * @param cnt new number of items
+ */
+void lv_list_set_virtual_cnt(lv_obj_t * list, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(list, LV_OBJX_NAME);
+
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->bind_cb == NULL) {
+        LV_LOG_WARN("lv_list_set_virtual_cnt: the list is not in virtual mode");
+        return;
+    }
+
+    ext->virt_cnt = cnt;
+    virt_refr(list, true);
+}
+
+/**
+ * Bind all visible buttons of a virtual list again. Call it when the items are changed.
+ * @param list pointer to a list in virtual mode
+ */
+void lv_list_refresh_virtual(lv_obj_t * list)
+{
+    LV_ASSERT_OBJ(list, LV_OBJX_NAME);
+
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->bind_cb == NULL) return;
+
+    uint16_t i;
+    for(i = 0; i < ext->virt_btn_cnt; i++) {
+        ext->virt_btns[i].id = LV_LIST_VIRT_ID_NONE;
+    }
+    virt_refr(list, false);
+}
+
 /*=====================
  * Setter functions
  *====================*/
@@ -495,6 +614,9 @@ uint16_t lv_list_get_size(const lv_obj_t * list)
 {
     LV_ASSERT_OBJ(list, LV_OBJX_NAME);
 
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->bind_cb) return ext->virt_cnt > UINT16_MAX ? UINT16_MAX : ext->virt_cnt;
+
     uint16_t size = 0;
     lv_obj_t * btn = lv_list_get_next_btn(list, NULL);
     while(btn) {
@@ -504,6 +626,27 @@ uint16_t lv_list_get_size(const lv_obj_t * list)
     return size;
 }
 
+/**
+ * Get the item bound to a button of a virtual list
+ * @param list pointer to a list in virtual mode
+ * @param btn pointer to a button of the list
+ * @return index of the item or -1 if no item is bound to the button
+ */
+int32_t lv_list_get_virtual_id(const lv_obj_t * list, const lv_obj_t * btn)
+{
+    LV_ASSERT_OBJ(list, LV_OBJX_NAME);
+
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    uint16_t i;
+    for(i = 0; i < ext->virt_btn_cnt; i++) {
+        if(ext->virt_btns[i].btn == btn) {
+            return ext->virt_btns[i].id == LV_LIST_VIRT_ID_NONE ? -1 : (int32_t)ext->virt_btns[i].id;
+        }
+    }
+
+    return -1;
+}
+
 #if LV_USE_GROUP
 /**
  * Get the currently selected button
@@ -538,11 +681,23 @@ lv_layout_t lv_list_get_layout(lv_obj_t * list)
 /**
  * Move the list elements up by one
  * @param list pointer a to list object
+ * @note in virtual mode it's never animated
  */
 void lv_list_up(const lv_obj_t * list)
 {
     LV_ASSERT_OBJ(list, LV_OBJX_NAME);
 
+    /*In virtual mode show the first item which is not entirely above the bottom edge.
+     *Skip the gap after the items to find it.*/
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->bind_cb) {
+        lv_style_int_t bg_bottom = lv_obj_get_style_pad_bottom(list, LV_PAGE_PART_BG);
+        lv_style_int_t pad_inner = lv_obj_get_style_pad_inner(lv_page_get_scrollable(list), LV_CONT_PART_MAIN);
+        int32_t id = virt_get_id_at(list, list->coords.y2 - bg_bottom + pad_inner + 1);
+        if(id >= 0) virt_show((lv_obj_t *)list, id);
+        return;
+    }
+
     /*Search the first list element which 'y' coordinate is below the parent
      * and position the list to show this element on the bottom*/
     lv_obj_t * scrl = lv_page_get_scrollable(list);
@@ -579,11 +734,21 @@ void lv_list_up(const lv_obj_t * list)
 /**
  * Move the list elements down by one
  * @param list pointer to a list object
+ * @note in virtual mode it's never animated
  */
 void lv_list_down(const lv_obj_t * list)
 {
     LV_ASSERT_OBJ(list, LV_OBJX_NAME);
 
+    /*In virtual mode show the item above the top edge*/
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->bind_cb) {
+        lv_style_int_t bg_top = lv_obj_get_style_pad_top(list, LV_PAGE_PART_BG);
+        int32_t id = virt_get_id_at(list, list->coords.y1 + bg_top - 1);
+        if(id >= 0) virt_show((lv_obj_t *)list, id);
+        return;
+    }
+
     /*Search the first list element which 'y' coordinate is above the parent
      * and position the list to show this element on the top*/
     lv_obj_t * scrl = lv_page_get_scrollable(list);
@@ -616,6 +781,7 @@ void lv_list_down(const lv_obj_t * list)
  * Focus on a list button. It ensures that the button will be visible on the list.
  * @param btn pointer to a list button to focus
  * @param anim_en LV_ANIM_ON: scroll with animation, LV_ANOM_OFF: without animation
+ * @note in virtual mode only a button bound to an item can be focused and it's never animated
  */
 void lv_list_focus(const lv_obj_t * btn, lv_anim_enable_t anim)
 {
@@ -627,6 +793,16 @@ void lv_list_focus(const lv_obj_t * btn, lv_anim_enable_t anim)
 
     lv_obj_t * list = lv_obj_get_parent(lv_obj_get_parent(btn));
 
+    /*In virtual mode the window of the scrollable might move while scrolling so don't animate it*/
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->bind_cb) {
+        if(lv_list_get_virtual_id(list, btn) < 0) {
+            LV_LOG_WARN("lv_list_focus: the button is not bound to an item");
+            return;
+        }
+        anim = LV_ANIM_OFF;
+    }
+
     lv_page_focus(list, btn, anim == LV_ANIM_OFF ? 0 : lv_list_get_anim_time(list));
 }
 
@@ -656,7 +832,20 @@ static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param)
     if(res != LV_RES_OK) return res;
     if(sign == LV_SIGNAL_GET_TYPE) return lv_obj_handle_get_type_signal(param, LV_OBJX_NAME);
 
-    if(sign == LV_SIGNAL_RELEASED || sign == LV_SIGNAL_PRESSED || sign == LV_SIGNAL_PRESSING ||
+    if(sign == LV_SIGNAL_CLEANUP) {
+        virt_free(list);
+    }
+    else if(sign == LV_SIGNAL_COORD_CHG) {
+        /*More or less buttons are required to fill the new height*/
+        lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+        if(ext->bind_cb && lv_obj_get_height(list) != lv_area_get_height(param)) virt_refr(list, true);
+    }
+    else if(sign == LV_SIGNAL_STYLE_CHG) {
+        /*The height of the items might be changed*/
+        lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+        if(ext->bind_cb) virt_refr(list, true);
+    }
+    else if(sign == LV_SIGNAL_RELEASED || sign == LV_SIGNAL_PRESSED || sign == LV_SIGNAL_PRESSING ||
        sign == LV_SIGNAL_LONG_PRESS || sign == LV_SIGNAL_LONG_PRESS_REP) {
 #if LV_USE_GROUP
         /*If pressed/released etc by a KEYPAD or ENCODER delegate signal and events to the button*/
@@ -715,6 +904,7 @@ static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param)
             lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
             /* Select the last used button, or use the first no last button */
             if(ext->last_sel_btn) lv_list_focus_btn(list, ext->last_sel_btn);
+            else if(ext->bind_cb) lv_list_focus_btn(list, virt_show(list, 0));
             else lv_list_focus_btn(list, lv_list_get_next_btn(list, NULL));
         }
         if(indev_type == LV_INDEV_TYPE_ENCODER && lv_group_get_editing(g) == false) {
@@ -742,8 +932,18 @@ static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param)
     else if(sign == LV_SIGNAL_CONTROL) {
 #if LV_USE_GROUP
         char c = *((char *)param);
-        if(c == LV_KEY_RIGHT || c == LV_KEY_DOWN) {
-            lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+        lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+        if(ext->bind_cb && (c == LV_KEY_RIGHT || c == LV_KEY_DOWN || c == LV_KEY_LEFT || c == LV_KEY_UP)) {
+            /*The buttons are recycled so step to the next or previous item instead of the next button*/
+            int32_t id = ext->act_sel_btn ? lv_list_get_virtual_id(list, ext->act_sel_btn) : -1;
+            if(id < 0) id = 0;
+            else if(c == LV_KEY_RIGHT || c == LV_KEY_DOWN) id++;
+            else if(id > 0) id--;
+
+            lv_obj_t * btn = virt_show(list, id);
+            if(btn) lv_list_focus_btn(list, btn);
+        }
+        else if(c == LV_KEY_RIGHT || c == LV_KEY_DOWN) {
             /*If there is a valid selected button the make the previous selected*/
             if(ext->act_sel_btn) {
                 lv_obj_t * btn_prev = lv_list_get_next_btn(list, ext->act_sel_btn);
@@ -758,7 +958,6 @@ static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param)
             }
         }
         else if(c == LV_KEY_LEFT || c == LV_KEY_UP) {
-            lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
             /*If there is a valid selected button the make the next selected*/
             if(ext->act_sel_btn != NULL) {
                 lv_obj_t * btn_next = lv_list_get_prev_btn(list, ext->act_sel_btn);
@@ -771,7 +970,6 @@ static lv_res_t lv_list_signal(lv_obj_t * list, lv_signal_t sign, void * param)
             }
         }
         else if(c == LV_KEY_ESC) {
-            lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
             /* Handle ESC/Cancel event */
             res = lv_event_send(ext->act_sel_btn, LV_EVENT_CANCEL, NULL);
         }
@@ -843,6 +1041,233 @@ static lv_res_t lv_list_btn_signal(lv_obj_t * btn, lv_signal_t sign, void * para
     return res;
 }
 
+/**
+ * Signal function of the scrollable part of a virtual list
+ * @param scrl pointer to the scrollable object
+ * @param sign a signal type from lv_signal_t enum
+ * @param param pointer to a signal specific variable
+ * @return LV_RES_OK: the object is not deleted in the function; LV_RES_INV: the object is deleted
+ */
+static lv_res_t lv_list_scrl_signal(lv_obj_t * scrl, lv_signal_t sign, void * param)
+{
+    lv_res_t res;
+
+    /* Include the ancient signal function */
+    res = ancestor_scrl_signal(scrl, sign, param);
+    if(res != LV_RES_OK) return res;
+
+    if(sign == LV_SIGNAL_COORD_CHG) {
+        /*Bind the buttons to the scrolled in items*/
+        const lv_area_t * ori = param;
+        if(ori->y1 != scrl->coords.y1) virt_refr(lv_obj_get_parent(scrl), false);
+    }
+
+    return res;
+}
+
+/**
+ * Add a recycled button to a virtual list
+ * @param list pointer to a list in virtual mode
+ * @return true: the button is added; false: out of memory
+ */
+static bool virt_add_btn(lv_obj_t * list)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+
+    lv_list_virt_btn_t * btns = lv_mem_realloc(ext->virt_btns, (ext->virt_btn_cnt + 1) * sizeof(lv_list_virt_btn_t));
+    LV_ASSERT_MEM(btns);
+    if(btns == NULL) return false;
+    ext->virt_btns = btns;
+
+    lv_obj_t * btn = lv_list_add_btn(list, NULL, "");
+    if(btn == NULL) return false;
+    lv_btn_set_fit2(btn, LV_FIT_PARENT, LV_FIT_TIGHT);
+    lv_obj_set_hidden(btn, true);
+
+    ext->virt_btns[ext->virt_btn_cnt].btn = btn;
+    ext->virt_btns[ext->virt_btn_cnt].id = LV_LIST_VIRT_ID_NONE;
+    ext->virt_btn_cnt++;
+
+    return true;
+}
+
+/**
+ * Create or delete recycled buttons to fill the list, move the window of the scrollable
+ * if the list is scrolled close to its edge and bind the buttons to the visible items.
+ * @param list pointer to a list in virtual mode
+ * @param reset true: measure the items and bind all buttons again
+ */
+static void virt_refr(lv_obj_t * list, bool reset)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->bind_cb == NULL || ext->virt_refr_ip) return;
+    ext->virt_refr_ip = 1;
+
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+    lv_style_int_t pad_top = lv_obj_get_style_pad_top(scrl, LV_CONT_PART_MAIN);
+
+    if(reset) {
+        /*Measure the height of the items on a button*/
+        if(ext->virt_btn_cnt == 0 && virt_add_btn(list) == false) {
+            ext->virt_refr_ip = 0;
+            return;
+        }
+
+        lv_style_int_t pad_bottom = lv_obj_get_style_pad_bottom(scrl, LV_CONT_PART_MAIN);
+        lv_style_int_t pad_inner = lv_obj_get_style_pad_inner(scrl, LV_CONT_PART_MAIN);
+        if(ext->virt_cnt > 0) ext->bind_cb(list, ext->virt_btns[0].btn, 0);   /*Bound again below*/
+        ext->virt_item_h = LV_MATH_MAX(lv_obj_get_height(ext->virt_btns[0].btn) + pad_inner, 1);
+
+        /*Enough buttons to cover the list even if the first and the last items are partially visible*/
+        uint32_t btn_cnt = lv_obj_get_height(list) / ext->virt_item_h + 2;
+        btn_cnt = LV_MATH_MIN(btn_cnt, LV_MATH_MAX(ext->virt_cnt, 1));
+        while(ext->virt_btn_cnt < btn_cnt) {
+            if(virt_add_btn(list) == false) break;
+        }
+        while(ext->virt_btn_cnt > btn_cnt) {
+            ext->virt_btn_cnt--;
+            lv_obj_t * btn = ext->virt_btns[ext->virt_btn_cnt].btn;
+#if LV_USE_GROUP
+            if(btn == ext->last_sel_btn) ext->last_sel_btn = NULL;
+#endif
+            if(btn == ext->act_sel_btn) ext->act_sel_btn = NULL;
+            lv_obj_del(btn);
+        }
+
+        uint16_t i;
+        for(i = 0; i < ext->virt_btn_cnt; i++) {
+            ext->virt_btns[i].id = LV_LIST_VIRT_ID_NONE;
+        }
+
+        /*The scrollable covers only as many items as fit into the coordinate range*/
+        uint32_t win_max = (LV_COORD_MAX / 2) / ext->virt_item_h;
+        ext->virt_win_cnt = LV_MATH_MIN(ext->virt_cnt, win_max);
+        if(ext->virt_base + ext->virt_win_cnt > ext->virt_cnt) ext->virt_base = ext->virt_cnt - ext->virt_win_cnt;
+
+        lv_coord_t h = pad_top + pad_bottom;
+        if(ext->virt_win_cnt > 0) h += ext->virt_win_cnt * ext->virt_item_h - pad_inner;
+        lv_obj_set_height(scrl, h);
+    }
+
+    /*The first visible item relative to the top of the window*/
+    lv_coord_t item_h = ext->virt_item_h;
+    lv_coord_t scrolled = list->coords.y1 - scrl->coords.y1 - pad_top;
+    int32_t first = scrolled > 0 ? scrolled / item_h : 0;
+
+    /*Move the window if the list is scrolled close to its edge.
+     *Move the scrollable by the same amount so the items remain in place on the screen.*/
+    int32_t btn_cnt = ext->virt_btn_cnt;
+    int32_t win_cnt = ext->virt_win_cnt;
+    if((first < btn_cnt && ext->virt_base > 0) ||
+       (win_cnt - first - btn_cnt < btn_cnt && ext->virt_base + win_cnt < ext->virt_cnt)) {
+        int32_t base = (int32_t)ext->virt_base + first - (win_cnt - btn_cnt) / 2;
+        if(base > (int32_t)(ext->virt_cnt - win_cnt)) base = ext->virt_cnt - win_cnt;
+        if(base < 0) base = 0;
+
+        int32_t diff = base - (int32_t)ext->virt_base;
+        ext->virt_base = base;
+        first -= diff;
+        lv_obj_set_y(scrl, lv_obj_get_y(scrl) + diff * item_h);
+    }
+
+    /*Each item has a fixed button so when scrolled by one item only one button needs to be bound*/
+    int32_t i;
+    for(i = 0; i < btn_cnt; i++) {
+        uint32_t id = ext->virt_base + first + i;
+        lv_list_virt_btn_t * vb = &ext->virt_btns[id % btn_cnt];
+        if(id >= ext->virt_cnt) {
+            vb->id = LV_LIST_VIRT_ID_NONE;
+            lv_obj_set_hidden(vb->btn, true);
+            continue;
+        }
+
+        lv_obj_set_y(vb->btn, pad_top + (id - ext->virt_base) * item_h);
+        if(vb->id != id) {
+            vb->id = id;
+            lv_obj_set_hidden(vb->btn, false);
+            ext->bind_cb(list, vb->btn, id);
+        }
+    }
+
+    ext->virt_refr_ip = 0;
+}
+
+/**
+ * Scroll an item of a virtual list into the list and get its button
+ * @param list pointer to a list in virtual mode
+ * @param id index of the item
+ * @return the button bound to the item or NULL if there is no such item
+ */
+static lv_obj_t * virt_show(lv_obj_t * list, uint32_t id)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(id >= ext->virt_cnt) return NULL;
+
+    /*Move the window to the item if the scrollable doesn't cover it*/
+    if(id < ext->virt_base || id >= ext->virt_base + ext->virt_win_cnt) {
+        int32_t base = (int32_t)id - (int32_t)ext->virt_win_cnt / 2;
+        if(base > (int32_t)(ext->virt_cnt - ext->virt_win_cnt)) base = ext->virt_cnt - ext->virt_win_cnt;
+        if(base < 0) base = 0;
+        ext->virt_base = base;
+    }
+
+    /*Scroll the item between the paddings of the list. Its button is bound when the scrollable moves.*/
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+    lv_style_int_t bg_top = lv_obj_get_style_pad_top(list, LV_PAGE_PART_BG);
+    lv_style_int_t bg_bottom = lv_obj_get_style_pad_bottom(list, LV_PAGE_PART_BG);
+    lv_style_int_t pad_top = lv_obj_get_style_pad_top(scrl, LV_CONT_PART_MAIN);
+    lv_style_int_t pad_inner = lv_obj_get_style_pad_inner(scrl, LV_CONT_PART_MAIN);
+    lv_coord_t y1 = scrl->coords.y1 + pad_top + (lv_coord_t)(id - ext->virt_base) * ext->virt_item_h;
+    lv_coord_t y2 = y1 + ext->virt_item_h - pad_inner - 1;
+    if(y1 < list->coords.y1 + bg_top) {
+        lv_obj_set_y(scrl, lv_obj_get_y(scrl) + list->coords.y1 + bg_top - y1);
+    }
+    else if(y2 > list->coords.y2 - bg_bottom) {
+        lv_obj_set_y(scrl, lv_obj_get_y(scrl) - (y2 - list->coords.y2 + bg_bottom));
+    }
+    virt_refr(list, false);
+
+    uint16_t i;
+    for(i = 0; i < ext->virt_btn_cnt; i++) {
+        if(ext->virt_btns[i].id == id) return ext->virt_btns[i].btn;
+    }
+
+    return NULL;
+}
+
+/**
+ * Get the item of a virtual list at a y coordinate. The gap after an item belongs to the item.
+ * @param list pointer to a list in virtual mode
+ * @param y an absolute y coordinate
+ * @return index of the item or -1 if there is no item at `y`
+ */
+static int32_t virt_get_id_at(const lv_obj_t * list, lv_coord_t y)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+    lv_style_int_t pad_top = lv_obj_get_style_pad_top(scrl, LV_CONT_PART_MAIN);
+
+    lv_coord_t rel_y = y - scrl->coords.y1 - pad_top;
+    if(rel_y < 0) return -1;
+
+    int32_t id = ext->virt_base + rel_y / ext->virt_item_h;
+    if(id >= (int32_t)ext->virt_cnt) return -1;
+
+    return id;
+}
+
+/**
+ * Free the recycled buttons of a virtual list. The buttons are deleted by the caller.
+ * @param list pointer to a list object
+ */
+static void virt_free(lv_obj_t * list)
+{
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    if(ext->virt_btns) lv_mem_free(ext->virt_btns);
+    ext->virt_btns = NULL;
+    ext->virt_btn_cnt = 0;
+}
+
 /**
  * Get the style descriptor of a part of the object
  * @param list pointer the object
@@ -43,6 +43,20 @@ extern "C" {
 /**********************
  *      TYPEDEFS
  **********************/
+/**
+ * Set the content of a recycled list button to an item in virtual mode
+ * @param list pointer to a list object
+ * @param btn pointer to a list button. Its label can be changed with `lv_list_get_btn_label()`.
+ * @param id index of the item to show on the button
+ */
+typedef void (*lv_list_bind_cb_t)(lv_obj_t * list, lv_obj_t * btn, uint32_t id);
+
+/*A recycled button of a virtual list*/
+typedef struct {
+    lv_obj_t * btn;
+    uint32_t id;    /*The item bound to the button*/
+} lv_list_virt_btn_t;
+
 /*Data of list*/
 typedef struct {
     lv_page_ext_t page; /*Ext. of ancestor*/
@@ -52,6 +66,16 @@ typedef struct {
     lv_obj_t * last_sel_btn;     /* The last selected button. It will be reverted when the list is focused again */
 #endif
     lv_obj_t * act_sel_btn; /* The button is currently being selected*/
+
+    /*Virtual mode*/
+    lv_list_bind_cb_t bind_cb;      /*Bind an item to a recycled button. NULL: not in virtual mode*/
+    lv_list_virt_btn_t * virt_btns; /*The recycled buttons*/
+    uint32_t virt_cnt;              /*Number of items*/
+    uint32_t virt_base;             /*The item at the top of the scrollable*/
+    uint32_t virt_win_cnt;          /*Number of items the scrollable is tall for*/
+    uint16_t virt_btn_cnt;          /*Number of recycled buttons*/
+    lv_coord_t virt_item_h;         /*Height of an item and the gap after it*/
+    uint8_t virt_refr_ip : 1;       /*The recycled buttons are being refreshed*/
 } lv_list_ext_t;
 
 /** List styles. */
@@ -92,7 +116,8 @@ void lv_list_clean(lv_obj_t * list);
  * @param list pointer to list object
  * @param img_fn file name of an image before the text (NULL if unused)
  * @param txt text of the list element (NULL if unused)
- * @return pointer to the new list element which can be customized (a button)
+ * @return pointer to the new list element which can be customized (a button).
+ *         NULL in virtual mode.
  */
 lv_obj_t * lv_list_add_btn(lv_obj_t * list, const void * img_src, const char * txt);
 
@@ -101,10 +126,38 @@ lv_obj_t * lv_list_add_btn(lv_obj_t * list, const void * img_src, const char * t
  * @param list pointer to a list object
  * @param index pointer to a the button's index in the list, index must be 0 <= index <
  * lv_list_ext_t.size
- * @return true: successfully deleted
+ * @return true: successfully deleted; false: not found or the list is in virtual mode
  */
 bool lv_list_remove(const lv_obj_t * list, uint16_t index);
 
+/**
+ * Show many items with a few recycled buttons. Only the buttons on the visible part of the list exist
+ * and they are bound to other items while the list is scrolled.
+ * All items have the same height and the existing buttons are deleted.
+ * @param list pointer to a list object
+ * @param cnt number of items
+ * @param bind_cb called to show an item on a button. NULL to leave the virtual mode.
+ * @note the scrollable can't be taller than the range of `lv_coord_t` so with a lot of items
+ * it covers only a window of the items which is moved while scrolling.
+ * The scrollbar shows the position in this window.
+ * @note `bind_cb` is also called to measure the height of the first item.
+ * In virtual mode `lv_list_add_btn` and `lv_list_remove` are rejected.
+ */
+void lv_list_set_virtual(lv_obj_t * list, uint32_t cnt, lv_list_bind_cb_t bind_cb);
+
+/**
+ * Change the number of items of a virtual list and bind all visible buttons again
+ * @param list pointer to a list in virtual mode
+ * @param cnt new number of items
+ */
+void lv_list_set_virtual_cnt(lv_obj_t * list, uint32_t cnt);
+
+/**
+ * Bind all visible buttons of a virtual list again. Call it when the items are changed.
+ * @param list pointer to a list in virtual mode
+ */
+void lv_list_refresh_virtual(lv_obj_t * list);
+
 /*=====================
  * Setter functions
  *====================*/
@@ -148,6 +201,17 @@ static inline void lv_list_set_edge_flash(lv_obj_t * list, bool en)
     lv_page_set_edge_flash(list, en);
 }
 
+/**
+ * Move the already rendered content of the list in the frame buffer while scrolling.
+ * See `lv_page_set_scroll_blit` for the limitations.
+ * @param list pointer to a List
+ * @param en true or false to enable/disable scrolling with buffer blit
+ */
+static inline void lv_list_set_scroll_blit(lv_obj_t * list, bool en)
+{
+    lv_page_set_scroll_blit(list, en);
+}
+
 /**
  * Set scroll animation duration on 'list_up()' 'list_down()' 'list_focus()'
  * @param list pointer to a list object
@@ -220,6 +284,14 @@ int32_t lv_list_get_btn_index(const lv_obj_t * list, const lv_obj_t * btn);
  */
 uint16_t lv_list_get_size(const lv_obj_t * list);
 
+/**
+ * Get the item bound to a button of a virtual list
+ * @param list pointer to a list in virtual mode
+ * @param btn pointer to a button of the list
+ * @return index of the item or -1 if no item is bound to the button
+ */
+int32_t lv_list_get_virtual_id(const lv_obj_t * list, const lv_obj_t * btn);
+
 #if LV_USE_GROUP
 /**
  * Get the currently selected button. Can be used while navigating in the list with a keypad.
@@ -266,6 +338,16 @@ static inline bool lv_list_get_edge_flash(lv_obj_t * list)
     return lv_page_get_edge_flash(list);
 }
 
+/**
+ * Get whether the list is scrolled with buffer blit
+ * @param list pointer to a List
+ * @return true or false
+ */
+static inline bool lv_list_get_scroll_blit(lv_obj_t * list)
+{
+    return lv_page_get_scroll_blit(list);
+}
+
 /**
  * Get scroll animation duration
  * @param list pointer to a list object
@@ -283,11 +365,13 @@ static inline uint16_t lv_list_get_anim_time(const lv_obj_t * list)
 /**
  * Move the list elements up by one
  * @param list pointer a to list object
+ * @note in virtual mode it's never animated
  */
 void lv_list_up(const lv_obj_t * list);
 /**
  * Move the list elements down by one
  * @param list pointer to a list object
+ * @note in virtual mode it's never animated
  */
 void lv_list_down(const lv_obj_t * list);
 
@@ -295,6 +379,7 @@ void lv_list_down(const lv_obj_t * list);
  * Focus on a list button. It ensures that the button will be visible on the list.
  * @param btn pointer to a list button to focus
  * @param anim LV_ANIM_ON: scroll with animation, LV_ANIM_OFF: without animation
+ * @note in virtual mode only a button bound to an item can be focused and it's never animated
  */
 void lv_list_focus(const lv_obj_t * btn, lv_anim_enable_t anim);
 
@@ -44,6 +44,7 @@
  *  STATIC PROTOTYPES
  **********************/
 static void scrlbar_refresh(lv_obj_t * page);
+static void scrl_blit_inv_edge(lv_obj_t * page);
 static void scrl_reposition(lv_obj_t * page);
 static lv_design_res_t lv_page_design(lv_obj_t * page, const lv_area_t * clip_area, lv_design_mode_t mode);
 static lv_res_t lv_page_signal(lv_obj_t * page, lv_signal_t sign, void * param);
@@ -261,6 +262,23 @@ void lv_page_set_edge_flash(lv_obj_t * page, bool en)
 #endif
 }
 
+/**
+ * Move the already rendered content of the page in the frame buffer while scrolling
+ * and redraw only the newly exposed parts.
+ * It works only with two screen sized frame buffers ("true double buffering").
+ * The background of the page should be a plain color and no other object should be drawn
+ * above the page else it's redrawn normally.
+ * @param page pointer to a Page
+ * @param en true or false to enable/disable scrolling with buffer blit
+ */
+void lv_page_set_scroll_blit(lv_obj_t * page, bool en)
+{
+    LV_ASSERT_OBJ(page, LV_OBJX_NAME);
+
+    lv_page_ext_t * ext = lv_obj_get_ext_attr(page);
+    ext->scrl->scroll_blit = en ? 1 : 0;
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -323,6 +341,19 @@ bool lv_page_get_scroll_propagation(lv_obj_t * page)
     return ext->scroll_prop ? true : false;
 }
 
+/**
+ * Get whether the page is scrolled with buffer blit
+ * @param page pointer to a Page
+ * @return true or false
+ */
+bool lv_page_get_scroll_blit(lv_obj_t * page)
+{
+    LV_ASSERT_OBJ(page, LV_OBJX_NAME);
+
+    lv_page_ext_t * ext = lv_obj_get_ext_attr(page);
+    return ext->scrl->scroll_blit ? true : false;
+}
+
 /**
  * Get the edge flash effect property.
  * @param page pointer to a Page
@@ -957,6 +988,9 @@ static lv_res_t lv_page_scrollable_signal(lv_obj_t * scrl, lv_signal_t sign, voi
            (lv_obj_get_width(scrl) != lv_area_get_width(param) || lv_obj_get_height(scrl) != lv_area_get_height(param))) {
             scrlbar_refresh(page);
         }
+
+        /*The moved content covers the border and the rounded corners of the page*/
+        if(scrl->scroll_blit) scrl_blit_inv_edge(page);
     }
     else if(sign == LV_SIGNAL_STYLE_CHG) {
         scrl_reposition(page);
@@ -1169,6 +1203,40 @@ static void scrl_reposition(lv_obj_t * page)
     }
 }
 
+/**
+ * Invalidate the border and the rounded corners of a page because
+ * the content moved in the frame buffer covers them.
+ * @param page pointer to a page object
+ */
+static void scrl_blit_inv_edge(lv_obj_t * page)
+{
+    lv_coord_t w = lv_obj_get_width(page);
+    lv_coord_t h = lv_obj_get_height(page);
+    lv_coord_t r = lv_obj_get_style_radius(page, LV_PAGE_PART_BG);
+    lv_coord_t short_side = LV_MATH_MIN(w, h);
+    if(r > short_side >> 1) r = short_side >> 1;
+
+    lv_coord_t edge = LV_MATH_MAX(r, lv_obj_get_style_border_width(page, LV_PAGE_PART_BG));
+    if(edge <= 0) return;
+
+    lv_area_t a;
+    lv_area_copy(&a, &page->coords);
+    a.y2 = a.y1 + edge - 1;
+    lv_obj_invalidate_area(page, &a);
+
+    lv_area_copy(&a, &page->coords);
+    a.y1 = a.y2 - edge + 1;
+    lv_obj_invalidate_area(page, &a);
+
+    lv_area_copy(&a, &page->coords);
+    a.x2 = a.x1 + edge - 1;
+    lv_obj_invalidate_area(page, &a);
+
+    lv_area_copy(&a, &page->coords);
+    a.x1 = a.x2 - edge + 1;
+    lv_obj_invalidate_area(page, &a);
+}
+
 /**
  * Refresh the position and size of the scroll bars.
  * @param page pointer to a page object
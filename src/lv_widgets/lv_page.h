@@ -161,6 +161,17 @@ void lv_page_set_scroll_propagation(lv_obj_t * page, bool en);
  */
 void lv_page_set_edge_flash(lv_obj_t * page, bool en);
 
+/**
+ * Move the already rendered content of the page in the frame buffer while scrolling
+ * and redraw only the newly exposed parts.
+ * It works only with two screen sized frame buffers ("true double buffering").
+ * The background of the page should be a plain color and no other object should be drawn
+ * above the page else it's redrawn normally.
+ * @param page pointer to a Page
+ * @param en true or false to enable/disable scrolling with buffer blit
+ */
+void lv_page_set_scroll_blit(lv_obj_t * page, bool en);
+
 /**
  * Set the fit policy in all 4 directions separately.
  * It tell how to change the page size automatically.
@@ -247,6 +258,13 @@ lv_scrollbar_mode_t lv_page_get_scrollbar_mode(const lv_obj_t * page);
  */
 bool lv_page_get_scroll_propagation(lv_obj_t * page);
 
+/**
+ * Get whether the page is scrolled with buffer blit
+ * @param page pointer to a Page
+ * @return true or false
+ */
+bool lv_page_get_scroll_blit(lv_obj_t * page);
+
 /**
  * Get the edge flash effect property.
  * @param page pointer to a Page
@@ -39,6 +39,9 @@ static lv_res_t lv_roller_signal(lv_obj_t * roller, lv_signal_t sign, void * par
 static void refr_position(lv_obj_t * roller, lv_anim_enable_t animen);
 static void refr_height(lv_obj_t * roller);
 static void refr_width(lv_obj_t * roller);
+static void refr_label_size(lv_obj_t * roller);
+static void draw_options(lv_obj_t * roller, const lv_area_t * coords, const lv_area_t * clip_area,
+                         lv_draw_label_dsc_t * dsc);
 static lv_res_t release_handler(lv_obj_t * roller);
 static void inf_normalize(void * roller_scrl);
 static lv_obj_t * get_label(const lv_obj_t * roller);
@@ -90,6 +93,7 @@ lv_obj_t * lv_roller_create(lv_obj_t * par, const lv_obj_t * copy)
 
     ext->mode = LV_ROLLER_MODE_NORMAL;
     ext->option_cnt = 0;
+    ext->opt_ofs = NULL;
     ext->sel_opt_id = 0;
     ext->sel_opt_id_ori = 0;
     ext->auto_fit = 1;
@@ -102,7 +106,9 @@ lv_obj_t * lv_roller_create(lv_obj_t * par, const lv_obj_t * copy)
     /*Init the new roller roller*/
     if(copy == NULL) {
 
+        /*The label only stores the options and gives the place of them. The options are drawn by the roller.*/
         lv_obj_t * label = lv_label_create(roller, NULL);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_CROP);
         lv_label_set_align(label, LV_LABEL_ALIGN_CENTER);
         if(ancestor_label_design == NULL) ancestor_label_design = lv_obj_get_design_cb(label);
         lv_obj_set_design_cb(label, lv_roller_label_design);
@@ -122,9 +128,16 @@ lv_obj_t * lv_roller_create(lv_obj_t * par, const lv_obj_t * copy)
     }
     /*Copy an existing roller*/
     else {
-        lv_label_create(roller, get_label(copy));
+        lv_obj_t * label = lv_label_create(roller, get_label(copy));
+        lv_obj_set_design_cb(label, lv_roller_label_design);
 
         lv_roller_ext_t * copy_ext = lv_obj_get_ext_attr(copy);
+        uint16_t real_cnt = lv_roller_get_option_cnt(copy);
+        ext->opt_ofs = lv_mem_alloc(real_cnt * sizeof(ext->opt_ofs[0]));
+        LV_ASSERT_MEM(ext->opt_ofs);
+        if(ext->opt_ofs == NULL) return roller;
+        _lv_memcpy(ext->opt_ofs, copy_ext->opt_ofs, real_cnt * sizeof(ext->opt_ofs[0]));
+
         ext->mode = copy_ext->mode;
         ext->option_cnt = copy_ext->option_cnt;
         ext->sel_opt_id = copy_ext->sel_opt_id;
@@ -160,35 +173,38 @@ void lv_roller_set_options(lv_obj_t * roller, const char * options, lv_roller_mo
     lv_roller_ext_t * ext = lv_obj_get_ext_attr(roller);
     lv_obj_t * label = get_label(roller);
 
-    ext->sel_opt_id     = 0;
-    ext->sel_opt_id_ori = 0;
-
     /*Count the '\n'-s to determine the number of options*/
-    ext->option_cnt = 0;
+    uint16_t opt_cnt = 1; /*Last option has no `\n`*/
     uint32_t cnt;
     for(cnt = 0; options[cnt] != '\0'; cnt++) {
-        if(options[cnt] == '\n') ext->option_cnt++;
+        if(options[cnt] == '\n') opt_cnt++;
     }
-    ext->option_cnt++; /*Last option has no `\n`*/
+
+    /*Save where the options start to draw only the visible ones*/
+    uint32_t * opt_ofs = lv_mem_realloc(ext->opt_ofs, opt_cnt * sizeof(ext->opt_ofs[0]));
+    LV_ASSERT_MEM(opt_ofs);
+    if(opt_ofs == NULL) return;
+    ext->opt_ofs = opt_ofs;
+
+    uint16_t i = 0;
+    ext->opt_ofs[i++] = 0;
+    for(cnt = 0; options[cnt] != '\0'; cnt++) {
+        if(options[cnt] == '\n') ext->opt_ofs[i++] = cnt + 1;
+    }
+
+    ext->sel_opt_id     = 0;
+    ext->sel_opt_id_ori = 0;
+    ext->option_cnt     = opt_cnt;
+
+    lv_label_set_text(label, options);
 
     if(mode == LV_ROLLER_MODE_NORMAL) {
         ext->mode = LV_ROLLER_MODE_NORMAL;
-        lv_label_set_text(label, options);
     }
     else {
+        /*The options are stored only once and repeated on every page while drawing*/
         ext->mode = LV_ROLLER_MODE_INFINITE;
 
-        size_t opt_len = strlen(options) + 1; /*+1 to add '\n' after option lists*/
-        char * opt_extra = _lv_mem_buf_get(opt_len * LV_ROLLER_INF_PAGES);
-        uint8_t i;
-        for(i = 0; i < LV_ROLLER_INF_PAGES; i++) {
-            strcpy(&opt_extra[opt_len * i], options);
-            opt_extra[opt_len * (i + 1) - 1] = '\n';
-        }
-        opt_extra[opt_len * LV_ROLLER_INF_PAGES - 1] = '\0';
-        lv_label_set_text(label, opt_extra);
-        _lv_mem_buf_release(opt_extra);
-
         ext->sel_opt_id     = ((LV_ROLLER_INF_PAGES / 2) + 0) * ext->option_cnt;
 
         ext->option_cnt = ext->option_cnt * LV_ROLLER_INF_PAGES;
@@ -322,17 +338,11 @@ void lv_roller_get_selected_str(const lv_obj_t * roller, char * buf, uint32_t bu
 
     lv_roller_ext_t * ext = lv_obj_get_ext_attr(roller);
     lv_obj_t * label = get_label(roller);
-    uint32_t i;
-    uint16_t line        = 0;
     const char * opt_txt = lv_label_get_text(label);
-    size_t txt_len     = strlen(opt_txt);
-
-    for(i = 0; i < txt_len && line != ext->sel_opt_id; i++) {
-        if(opt_txt[i] == '\n') line++;
-    }
+    uint32_t i = ext->opt_ofs ? ext->opt_ofs[lv_roller_get_selected(roller)] : 0;
 
     uint32_t c;
-    for(c = 0; i < txt_len && opt_txt[i] != '\n'; c++, i++) {
+    for(c = 0; opt_txt[i] != '\0' && opt_txt[i] != '\n'; c++, i++) {
         if(buf_size && c >= buf_size - 1) {
             LV_LOG_WARN("lv_dropdown_get_selected_str: the buffer was too small")
             break;
@@ -388,7 +398,8 @@ bool lv_roller_get_auto_fit(lv_obj_t * roller)
 /**
  * Get the options of a roller
  * @param roller pointer to roller object
- * @return the options separated by '\n'-s (E.g. "Option1\nOption2\nOption3")
+ * @return the options separated by '\n'-s (E.g. "Option1\nOption2\nOption3").
+ *         In infinite mode the options are not repeated.
  */
 const char * lv_roller_get_options(const lv_obj_t * roller)
 {
@@ -459,6 +470,7 @@ static lv_design_res_t lv_roller_design(lv_obj_t * roller, const lv_area_t * cli
         area_ok = _lv_area_intersect(&mask_sel, clip_area, &rect_area);
         if(area_ok) {
             lv_obj_t * label = get_label(roller);
+            lv_roller_ext_t * ext = lv_obj_get_ext_attr(roller);
             lv_label_align_t label_align = lv_roller_get_align(roller);
 
             if(LV_LABEL_ALIGN_CENTER == label_align) {
@@ -468,10 +480,9 @@ static lv_design_res_t lv_roller_design(lv_obj_t * roller, const lv_area_t * cli
                 label_dsc.flag |= LV_TXT_FLAG_RIGHT;
             }
 
-            /*Get the size of the "selected text"*/
+            /*Get the height of the "selected text". Every option is one line.*/
             lv_point_t res_p;
-            _lv_txt_get_size(&res_p, lv_label_get_text(label), label_dsc.font, label_dsc.letter_space, label_dsc.line_space,
-                             lv_obj_get_width(roller), LV_TXT_FLAG_EXPAND);
+            res_p.y = (lv_font_get_line_height(label_dsc.font) + label_dsc.line_space) * ext->option_cnt - label_dsc.line_space;
 
             /*Move the selected label proportionally with the background label*/
             lv_coord_t roller_h = lv_obj_get_height(roller);
@@ -498,7 +509,7 @@ static lv_design_res_t lv_roller_design(lv_obj_t * roller, const lv_area_t * cli
             label_sel_area.y2 = label_sel_area.y1 + res_p.y;
 
             label_dsc.flag |= LV_TXT_FLAG_EXPAND;
-            lv_draw_label(&label_sel_area, &mask_sel, &label_dsc, lv_label_get_text(label), NULL);
+            draw_options(roller, &label_sel_area, &mask_sel, &label_dsc);
         }
     }
 
@@ -540,13 +551,24 @@ static lv_design_res_t lv_roller_label_design(lv_obj_t * label, const lv_area_t
         rect_area.x1 = roller_coords.x1;
         rect_area.x2 = roller_coords.x2;
 
+        lv_draw_label_dsc_t label_dsc;
+        lv_draw_label_dsc_init(&label_dsc);
+        lv_obj_init_draw_label_dsc(label, LV_LABEL_PART_MAIN, &label_dsc);
+
+        /*Draw the options like a label with `LV_LABEL_LONG_EXPAND`*/
+        label_dsc.flag = LV_TXT_FLAG_FIT;
+        if(lv_label_get_recolor(label)) label_dsc.flag |= LV_TXT_FLAG_RECOLOR;
+        lv_label_align_t align = lv_label_get_align(label);
+        if(align == LV_LABEL_ALIGN_CENTER) label_dsc.flag |= LV_TXT_FLAG_CENTER;
+        else if(align == LV_LABEL_ALIGN_RIGHT) label_dsc.flag |= LV_TXT_FLAG_RIGHT;
+
         lv_area_t clip2;
         clip2.x1 = label->coords.x1;
         clip2.y1 = label->coords.y1;
         clip2.x2 = label->coords.x2;
         clip2.y2 = rect_area.y1;
         if(_lv_area_intersect(&clip2, clip_area, &clip2)) {
-            ancestor_label_design(label, &clip2, mode);
+            draw_options(roller, &label->coords, &clip2, &label_dsc);
         }
 
         clip2.x1 = label->coords.x1;
@@ -554,7 +576,7 @@ static lv_design_res_t lv_roller_label_design(lv_obj_t * label, const lv_area_t
         clip2.x2 = label->coords.x2;
         clip2.y2 = label->coords.y2;
         if(_lv_area_intersect(&clip2, clip_area, &clip2)) {
-            ancestor_label_design(label, &clip2, mode);
+            draw_options(roller, &label->coords, &clip2, &label_dsc);
         }
     }
 
@@ -668,6 +690,8 @@ static lv_res_t lv_roller_signal(lv_obj_t * roller, lv_signal_t sign, void * par
     }
     else if(sign == LV_SIGNAL_CLEANUP) {
         lv_obj_clean_style_list(roller, LV_ROLLER_PART_SELECTED);
+        lv_mem_free(ext->opt_ofs);
+        ext->opt_ofs = NULL;
     }
     return res;
 }
@@ -903,27 +927,19 @@ static lv_res_t release_handler(lv_obj_t * roller)
     if(label == NULL) return LV_RES_OK;
 
     if(lv_indev_get_type(indev) == LV_INDEV_TYPE_POINTER || lv_indev_get_type(indev) == LV_INDEV_TYPE_BUTTON) {
-        /*Search the clicked option (For KEYPAD and ENCODER the new value should be already set)*/
-        uint16_t new_opt  = 0;
+        /*Search the clicked option (For KEYPAD and ENCODER the new value should be already set)
+         *Every option is one line so simply divide by the line height*/
+        const lv_font_t * font = lv_obj_get_style_text_font(roller, LV_ROLLER_PART_BG);
+        lv_style_int_t line_space = lv_obj_get_style_text_line_space(roller, LV_ROLLER_PART_BG);
+        lv_coord_t label_unit = lv_font_get_line_height(font) + line_space;
+
         lv_point_t p;
         lv_indev_get_point(indev, &p);
-        p.y -= label->coords.y1;
-        p.x -= label->coords.x1;
-        uint32_t letter_i;
-        letter_i = lv_label_get_letter_on(label, &p);
-
-        const char * txt  = lv_label_get_text(label);
-        uint32_t i        = 0;
-        uint32_t i_prev   = 0;
-
-        uint32_t letter_cnt = 0;
-        for(letter_cnt = 0; letter_cnt < letter_i; letter_cnt++) {
-            uint32_t letter = _lv_txt_encoded_next(txt, &i);
-            /*Count he lines to reach the clicked letter. But ignore the last '\n' because it
-             * still belongs to the clicked line*/
-            if(letter == '\n' && i_prev != letter_i) new_opt++;
-            i_prev = i;
-        }
+        int32_t new_opt = 0;
+        if(label_unit > 0) new_opt = (p.y - label->coords.y1) / label_unit;
+        if(new_opt < 0) new_opt = 0;
+        if(new_opt >= ext->option_cnt) new_opt = ext->option_cnt - 1;
+
         lv_roller_set_selected(roller, new_opt, LV_ANIM_ON);
     }
 
@@ -980,6 +996,8 @@ static void refr_height(lv_obj_t * roller)
     lv_obj_t * label = get_label(roller);
     if(label == NULL) return;
 
+    refr_label_size(roller);
+
     lv_obj_set_height(lv_page_get_scrollable(roller), lv_obj_get_height(label) + lv_obj_get_height(roller));
 
 #if LV_USE_ANIMATION
@@ -988,6 +1006,65 @@ static void refr_height(lv_obj_t * roller)
     refr_position(roller, LV_ANIM_OFF);
 }
 
+/**
+ * Set the size of the label to fit the options. In infinite mode it's as high as all the pages.
+ * @param roller pointer to roller
+ */
+static void refr_label_size(lv_obj_t * roller)
+{
+    lv_roller_ext_t * ext = lv_obj_get_ext_attr(roller);
+    lv_obj_t * label = get_label(roller);
+
+    const lv_font_t * font = lv_obj_get_style_text_font(roller, LV_ROLLER_PART_BG);
+    lv_style_int_t letter_space = lv_obj_get_style_text_letter_space(roller, LV_ROLLER_PART_BG);
+    lv_style_int_t line_space = lv_obj_get_style_text_line_space(roller, LV_ROLLER_PART_BG);
+
+    lv_point_t size;
+    _lv_txt_get_size(&size, lv_label_get_text(label), font, letter_space, line_space, LV_COORD_MAX, LV_TXT_FLAG_NONE);
+    size.y = (lv_font_get_line_height(font) + line_space) * ext->option_cnt - line_space;
+
+    lv_obj_set_size(label, size.x, size.y);
+}
+
+/**
+ * Draw the options of the roller which are on the clip area.
+ * In infinite mode the options are repeated on every page.
+ * @param roller pointer to roller
+ * @param coords the area of the options of all pages
+ * @param clip_area draw only on this area
+ * @param dsc descriptor of the text
+ */
+static void draw_options(lv_obj_t * roller, const lv_area_t * coords, const lv_area_t * clip_area,
+                         lv_draw_label_dsc_t * dsc)
+{
+    lv_roller_ext_t * ext = lv_obj_get_ext_attr(roller);
+    if(ext->opt_ofs == NULL) return;
+
+    lv_coord_t unit = lv_font_get_line_height(dsc->font) + dsc->line_space;
+    if(unit <= 0) return;
+
+    const char * txt = lv_label_get_text(get_label(roller));
+    uint16_t real_cnt = lv_roller_get_option_cnt(roller);
+
+    /*Start from the option above the clip area because its letters might reach into it*/
+    int32_t row = (clip_area->y1 - coords->y1) / unit - 1;
+    if(row < 0) row = 0;
+
+    lv_area_t txt_area;
+    txt_area.x1 = coords->x1;
+    txt_area.x2 = coords->x2;
+    txt_area.y2 = coords->y2;
+    while(row < ext->option_cnt) {
+        txt_area.y1 = coords->y1 + row * unit;
+        if(txt_area.y1 > clip_area->y2) break;
+
+        /*`lv_draw_label` stops below the clip area so draw to the end of the page*/
+        uint16_t opt = row % real_cnt;
+        lv_draw_label(&txt_area, clip_area, dsc, &txt[ext->opt_ofs[opt]], NULL);
+        row += real_cnt - opt;
+    }
+}
+
 /**
  * Set the middle page for the roller if infinite is enabled
  * @param scrl pointer to the roller's scrollable (lv_obj_t *)
@@ -49,6 +49,7 @@ typedef struct {
     /*New data for this type */
     lv_style_list_t style_sel; /*Style of the selected option*/
     uint16_t option_cnt;          /*Number of options*/
+    uint32_t * opt_ofs;           /*Start of the options in the text (the options of one page in infinite mode)*/
     uint16_t sel_opt_id;          /*Index of the current option*/
     uint16_t sel_opt_id_ori;      /*Store the original index on focus*/
     lv_roller_mode_t mode : 1;
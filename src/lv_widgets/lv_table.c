@@ -37,6 +37,8 @@ static lv_coord_t get_row_height(lv_obj_t * table, uint16_t row_id, const lv_fon
                                  lv_style_int_t * letter_space, lv_style_int_t * line_space,
                                  lv_style_int_t * cell_left, lv_style_int_t * cell_right, lv_style_int_t * cell_top, lv_style_int_t * cell_bottom);
 static void refr_size(lv_obj_t * table);
+static void refr_rows(lv_obj_t * table, uint16_t row_start, uint16_t row_end);
+static uint16_t get_row_at(lv_table_ext_t * ext, lv_coord_t y);
 
 /**********************
  *  STATIC VARIABLES
@@ -83,6 +85,7 @@ lv_obj_t * lv_table_create(lv_obj_t * par, const lv_obj_t * copy)
     ext->col_cnt       = 0;
     ext->row_cnt       = 0;
     ext->row_h         = NULL;
+    ext->row_y         = NULL;
     ext->cell_types    = 1;
 
     uint16_t i;
@@ -188,7 +191,7 @@ void lv_table_set_cell_value(lv_obj_t * table, uint16_t row, uint16_t col, const
 #endif
 
     ext->cell_data[cell][0] = format.format_byte;
-    refr_size(table);
+    refr_rows(table, row, row);
 }
 
 /**
@@ -283,7 +286,7 @@ void lv_table_set_cell_value_fmt(lv_obj_t * table, uint16_t row, uint16_t col, c
     va_end(ap2);
 
     ext->cell_data[cell][0] = format.format_byte;
-    refr_size(table);
+    refr_rows(table, row, row);
 }
 
 /**
@@ -303,16 +306,28 @@ void lv_table_set_row_cnt(lv_obj_t * table, uint16_t row_cnt)
         ext->row_h = lv_mem_realloc(ext->row_h, ext->row_cnt * sizeof(ext->row_h[0]));
         LV_ASSERT_MEM(ext->row_h);
         if(ext->row_h == NULL) return;
+
+        ext->row_y = lv_mem_realloc(ext->row_y, (ext->row_cnt + 1) * sizeof(ext->row_y[0]));
+        LV_ASSERT_MEM(ext->row_y);
+        if(ext->row_y == NULL) return;
+        if(old_row_cnt == 0) ext->row_y[0] = 0;
+
+        /*Mark the new rows as not measured yet*/
+        if(old_row_cnt < row_cnt) {
+            _lv_memset_00(&ext->row_h[old_row_cnt], (row_cnt - old_row_cnt) * sizeof(ext->row_h[0]));
+        }
     }
     else {
         lv_mem_free(ext->row_h);
         ext->row_h = NULL;
+        lv_mem_free(ext->row_y);
+        ext->row_y = NULL;
     }
 
     if(ext->row_cnt > 0 && ext->col_cnt > 0) {
         /*Free the unused cells*/
         if(old_row_cnt > row_cnt) {
-            uint16_t old_cell_cnt = old_row_cnt * ext->col_cnt;
+            uint32_t old_cell_cnt = old_row_cnt * ext->col_cnt;
             uint32_t new_cell_cnt = ext->col_cnt * ext->row_cnt;
             uint32_t i;
             for(i = new_cell_cnt; i < old_cell_cnt; i++) {
@@ -325,7 +340,7 @@ void lv_table_set_row_cnt(lv_obj_t * table, uint16_t row_cnt)
 
         /*Initialize the new fields*/
         if(old_row_cnt < row_cnt) {
-            uint16_t old_cell_cnt = old_row_cnt * ext->col_cnt;
+            uint32_t old_cell_cnt = old_row_cnt * ext->col_cnt;
             uint32_t new_cell_cnt = ext->col_cnt * ext->row_cnt;
             _lv_memset_00(&ext->cell_data[old_cell_cnt], (new_cell_cnt - old_cell_cnt) * sizeof(ext->cell_data[0]));
         }
@@ -336,7 +351,9 @@ void lv_table_set_row_cnt(lv_obj_t * table, uint16_t row_cnt)
         ext->cell_data = NULL;
     }
 
-    refr_size(table);
+    /*Only the new rows need to be measured*/
+    if(old_row_cnt < row_cnt) refr_rows(table, old_row_cnt, row_cnt - 1);
+    else refr_rows(table, row_cnt, row_cnt);
 }
 
 /**
@@ -360,7 +377,7 @@ void lv_table_set_col_cnt(lv_obj_t * table, uint16_t col_cnt)
     if(ext->row_cnt > 0 && ext->col_cnt > 0) {
         /*Free the unused cells*/
         if(old_col_cnt > col_cnt) {
-           uint16_t old_cell_cnt = old_col_cnt * ext->row_cnt;
+           uint32_t old_cell_cnt = old_col_cnt * ext->row_cnt;
            uint32_t new_cell_cnt = ext->col_cnt * ext->row_cnt;
            uint32_t i;
            for(i = new_cell_cnt; i < old_cell_cnt; i++) {
@@ -374,7 +391,7 @@ void lv_table_set_col_cnt(lv_obj_t * table, uint16_t col_cnt)
 
         /*Initialize the new fields*/
         if(old_col_cnt < col_cnt) {
-            uint16_t old_cell_cnt = old_col_cnt * ext->row_cnt;
+            uint32_t old_cell_cnt = old_col_cnt * ext->row_cnt;
             uint32_t new_cell_cnt = ext->col_cnt * ext->row_cnt;
             _lv_memset_00(&ext->cell_data[old_cell_cnt], (new_cell_cnt - old_cell_cnt) * sizeof(ext->cell_data[0]));
         }
@@ -487,7 +504,8 @@ void lv_table_set_cell_type(lv_obj_t * table, uint16_t row, uint16_t col, uint8_
 
     ext->cell_types |= 1 << type;
 
-    lv_obj_invalidate(table);
+    /*The font and the paddings of the new type might change the height of the row*/
+    refr_rows(table, row, row);
 }
 
 /**
@@ -527,6 +545,7 @@ void lv_table_set_cell_crop(lv_obj_t * table, uint16_t row, uint16_t col, bool c
     format.format_byte      = ext->cell_data[cell][0];
     format.s.crop           = crop;
     ext->cell_data[cell][0] = format.format_byte;
+    refr_rows(table, row, row);
 }
 
 /**
@@ -566,7 +585,7 @@ void lv_table_set_cell_merge_right(lv_obj_t * table, uint16_t row, uint16_t col,
     format.format_byte      = ext->cell_data[cell][0];
     format.s.right_merge    = en ? 1 : 0;
     ext->cell_data[cell][0] = format.format_byte;
-    refr_size(table);
+    refr_rows(table, row, row);
 }
 
 /*=====================
@@ -790,13 +809,7 @@ lv_res_t lv_table_get_pressed_cell(lv_obj_t * table, uint16_t * row, uint16_t *
         y -= table->coords.y1;
         y -= lv_obj_get_style_pad_top(table, LV_TABLE_PART_BG);
 
-        *row = 0;
-        tmp = 0;
-
-        for(*row = 0; *row < ext->row_cnt; (*row)++) {
-            tmp += ext->row_h[*row];
-            if(y < tmp) break;
-        }
+        *row = get_row_at(ext, y);
     }
 
     return LV_RES_OK;
@@ -865,14 +878,15 @@ static lv_design_res_t lv_table_design(lv_obj_t * table, const lv_area_t * clip_
             cell_bottom[i] = lv_obj_get_style_pad_bottom(table, LV_TABLE_PART_CELL1 + i);
         }
 
-        uint16_t col;
-        uint16_t row;
-        uint16_t cell = 0;
-
         bool rtl = lv_obj_get_base_dir(table) == LV_BIDI_DIR_RTL ? true : false;
 
-        cell_area.y2 = table->coords.y1 + bg_top - 1;
-        for(row = 0; row < ext->row_cnt; row++) {
+        /*Start from the first row in the clip area*/
+        uint16_t col;
+        uint16_t row = get_row_at(ext, clip_area->y1 - table->coords.y1 - bg_top);
+        uint32_t cell = row * ext->col_cnt;
+
+        cell_area.y2 = table->coords.y1 + bg_top + (row < ext->row_cnt ? ext->row_y[row] : 0) - 1;
+        for(; row < ext->row_cnt; row++) {
             lv_coord_t h_row = ext->row_h[row];
 
             cell_area.y1 = cell_area.y2 + 1;
@@ -1051,8 +1065,8 @@ static lv_res_t lv_table_signal(lv_obj_t * table, lv_signal_t sign, void * param
     if(sign == LV_SIGNAL_CLEANUP) {
         /*Free the cell texts*/
         lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
-        uint16_t i;
-        for(i = 0; i < ext->col_cnt * ext->row_cnt; i++) {
+        uint32_t i;
+        for(i = 0; i < (uint32_t)ext->col_cnt * ext->row_cnt; i++) {
             if(ext->cell_data[i]) {
                 lv_mem_free(ext->cell_data[i]);
                 ext->cell_data[i] = NULL;
@@ -1061,6 +1075,7 @@ static lv_res_t lv_table_signal(lv_obj_t * table, lv_signal_t sign, void * param
 
         if(ext->cell_data) lv_mem_free(ext->cell_data);
         if(ext->row_h) lv_mem_free(ext->row_h);
+        if(ext->row_y) lv_mem_free(ext->row_y);
 
         for(i = 0; i < LV_TABLE_CELL_STYLE_CNT; i++) {
             lv_obj_clean_style_list(table, LV_TABLE_PART_CELL1 + i);
@@ -1097,45 +1112,79 @@ static lv_style_list_t * lv_table_get_style(lv_obj_t * table, uint8_t part)
     return NULL;
 }
 
+/**
+ * Measure all rows and refresh the size of the table
+ * @param table pointer to a table object
+ */
 static void refr_size(lv_obj_t * table)
 {
-    lv_coord_t h = 0;
-    lv_coord_t w = 0;
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+    if(ext->row_cnt > 0) refr_rows(table, 0, ext->row_cnt - 1);
+    else refr_rows(table, 0, 0);
 
+    lv_obj_invalidate(table); /*Always invalidate even if the size hasn't changed*/
+}
+
+/**
+ * Measure the height of some rows, update the y offset of the rows below them
+ * and refresh the size of the table
+ * @param table pointer to a table object
+ * @param row_start first row to measure
+ * @param row_end last row to measure. Nothing is measured if it's >= `row_cnt`.
+ */
+static void refr_rows(lv_obj_t * table, uint16_t row_start, uint16_t row_end)
+{
     lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
     if(ext->row_cnt == 0 || ext->col_cnt == 0) {
-        lv_obj_set_size(table, w, h);
+        lv_obj_set_size(table, 0, 0);
         return;
     }
 
+    lv_coord_t h_old = lv_obj_get_height(table);
+    bool h_changed = false;
     uint16_t i;
-    for(i = 0; i < ext->col_cnt; i++) {
-        w += ext->col_w[i];
-    }
 
-    lv_style_int_t cell_left[LV_TABLE_CELL_STYLE_CNT];
-    lv_style_int_t cell_right[LV_TABLE_CELL_STYLE_CNT];
-    lv_style_int_t cell_top[LV_TABLE_CELL_STYLE_CNT];
-    lv_style_int_t cell_bottom[LV_TABLE_CELL_STYLE_CNT];
-    lv_style_int_t letter_space[LV_TABLE_CELL_STYLE_CNT];
-    lv_style_int_t line_space[LV_TABLE_CELL_STYLE_CNT];
-    const lv_font_t * font[LV_TABLE_CELL_STYLE_CNT];
+    if(row_end < ext->row_cnt) {
+        lv_style_int_t cell_left[LV_TABLE_CELL_STYLE_CNT];
+        lv_style_int_t cell_right[LV_TABLE_CELL_STYLE_CNT];
+        lv_style_int_t cell_top[LV_TABLE_CELL_STYLE_CNT];
+        lv_style_int_t cell_bottom[LV_TABLE_CELL_STYLE_CNT];
+        lv_style_int_t letter_space[LV_TABLE_CELL_STYLE_CNT];
+        lv_style_int_t line_space[LV_TABLE_CELL_STYLE_CNT];
+        const lv_font_t * font[LV_TABLE_CELL_STYLE_CNT];
 
-    for(i = 0; i < LV_TABLE_CELL_STYLE_CNT; i++) {
-        if((ext->cell_types & (1 << i)) == 0) continue; /*Skip unused cell types*/
-        cell_left[i] = lv_obj_get_style_pad_left(table, LV_TABLE_PART_CELL1 + i);
-        cell_right[i] = lv_obj_get_style_pad_right(table, LV_TABLE_PART_CELL1 + i);
-        cell_top[i] = lv_obj_get_style_pad_top(table, LV_TABLE_PART_CELL1 + i);
-        cell_bottom[i] = lv_obj_get_style_pad_bottom(table, LV_TABLE_PART_CELL1 + i);
-        letter_space[i] = lv_obj_get_style_text_letter_space(table, LV_TABLE_PART_CELL1 + i);
-        line_space[i] = lv_obj_get_style_text_line_space(table, LV_TABLE_PART_CELL1 + i);
-        font[i] = lv_obj_get_style_text_font(table, LV_TABLE_PART_CELL1 + i);
+        for(i = 0; i < LV_TABLE_CELL_STYLE_CNT; i++) {
+            if((ext->cell_types & (1 << i)) == 0) continue; /*Skip unused cell types*/
+            cell_left[i] = lv_obj_get_style_pad_left(table, LV_TABLE_PART_CELL1 + i);
+            cell_right[i] = lv_obj_get_style_pad_right(table, LV_TABLE_PART_CELL1 + i);
+            cell_top[i] = lv_obj_get_style_pad_top(table, LV_TABLE_PART_CELL1 + i);
+            cell_bottom[i] = lv_obj_get_style_pad_bottom(table, LV_TABLE_PART_CELL1 + i);
+            letter_space[i] = lv_obj_get_style_text_letter_space(table, LV_TABLE_PART_CELL1 + i);
+            line_space[i] = lv_obj_get_style_text_line_space(table, LV_TABLE_PART_CELL1 + i);
+            font[i] = lv_obj_get_style_text_font(table, LV_TABLE_PART_CELL1 + i);
+        }
+
+        uint16_t row;
+        for(row = row_start; row <= row_end; row++) {
+            lv_coord_t h = get_row_height(table, row, font, letter_space, line_space,
+                                          cell_left, cell_right, cell_top, cell_bottom);
+            /*The y offset of new rows is not set yet*/
+            if(h != ext->row_h[row] || ext->row_y[row + 1] != ext->row_y[row] + h) h_changed = true;
+            ext->row_h[row] = h;
+            ext->row_y[row + 1] = ext->row_y[row] + h;
+        }
+
+        /*Move the rows below the measured ones*/
+        if(h_changed) {
+            for(row = row_end + 1; row < ext->row_cnt; row++) {
+                ext->row_y[row + 1] = ext->row_y[row] + ext->row_h[row];
+            }
+        }
     }
 
-    for(i = 0; i < ext->row_cnt; i++) {
-        ext->row_h[i] = get_row_height(table, i, font, letter_space, line_space,
-                                       cell_left, cell_right, cell_top, cell_bottom);
-        h += ext->row_h[i];
+    lv_coord_t w = 0;
+    for(i = 0; i < ext->col_cnt; i++) {
+        w += ext->col_w[i];
     }
 
     lv_style_int_t bg_top = lv_obj_get_style_pad_top(table, LV_TABLE_PART_BG);
@@ -1143,10 +1192,40 @@ static void refr_size(lv_obj_t * table)
     lv_style_int_t bg_left = lv_obj_get_style_pad_left(table, LV_TABLE_PART_BG);
     lv_style_int_t bg_right = lv_obj_get_style_pad_right(table, LV_TABLE_PART_BG);
     w += bg_left + bg_right;
-    h += bg_top + bg_bottom;
+    lv_coord_t h = ext->row_y[ext->row_cnt] + bg_top + bg_bottom;
 
     lv_obj_set_size(table, w + 1, h + 1);
-    lv_obj_invalidate(table); /*Always invalidate even if the size hasn't changed*/
+    if(row_end >= ext->row_cnt) return;
+
+    /* Invalidate the measured rows or everything below them if they were moved.
+     * The borders of the cells are drawn over the neighbor rows so invalidate them too.*/
+    lv_area_t a;
+    a.x1 = table->coords.x1;
+    a.x2 = table->coords.x2;
+    a.y1 = table->coords.y1 + bg_top + ext->row_y[row_start > 0 ? row_start - 1 : 0];
+    if(h_changed || h + 1 != h_old) a.y2 = table->coords.y2;
+    else a.y2 = table->coords.y1 + bg_top + ext->row_y[LV_MATH_MIN(row_end + 2, ext->row_cnt)] - 1;
+    lv_obj_invalidate_area(table, &a);
+}
+
+/**
+ * Get the row at a y coordinate with binary search in the y offsets of the rows
+ * @param ext pointer to the ext of a table
+ * @param y a y coordinate relative to the top of the first row
+ * @return the id of the row or `row_cnt` if the coordinate is below the last row
+ */
+static uint16_t get_row_at(lv_table_ext_t * ext, lv_coord_t y)
+{
+    /*Find the first row whose bottom is below `y`*/
+    uint16_t min = 0;
+    uint16_t max = ext->row_cnt;
+    while(min < max) {
+        uint16_t mid = min + (max - min) / 2;
+        if(ext->row_y[mid + 1] > y) max = mid;
+        else min = mid + 1;
+    }
+
+    return min;
 }
 
 static lv_coord_t get_row_height(lv_obj_t * table, uint16_t row_id, const lv_font_t ** font,
@@ -1157,8 +1236,8 @@ static lv_coord_t get_row_height(lv_obj_t * table, uint16_t row_id, const lv_fon
     lv_point_t txt_size;
     lv_coord_t txt_w;
 
-    uint16_t row_start = row_id * ext->col_cnt;
-    uint16_t cell;
+    uint32_t row_start = row_id * ext->col_cnt;
+    uint32_t cell;
     uint16_t col;
     lv_coord_t h_max = lv_font_get_line_height(font[0]) + cell_top[0] + cell_bottom[0];
 
@@ -69,6 +69,7 @@ typedef struct {
     uint16_t row_cnt;
     char ** cell_data;
     lv_coord_t * row_h;
+    lv_coord_t * row_y;     /*Y offset of the rows from the top of the first row. `row_y[row_cnt]` is the total height*/
     lv_style_list_t cell_style[LV_TABLE_CELL_STYLE_CNT];
     lv_coord_t col_w[LV_TABLE_COL_MAX];
 uint16_t cell_types :
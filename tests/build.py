@@ -300,6 +300,11 @@ advanced_features = {
   "LV_USE_API_EXTENSION_V6":1,
   "LV_USE_USER_DATA":1,
   "LV_IMG_CACHE_DEF_SIZE":32,
+  "LV_USE_IMG_ASYNC":1,
+  "LV_IMG_CACHE_CONVERT_MEM_LIMIT":4096,
+  "LV_IMG_CACHE_CONVERT_MAX_SIZE":2048,
+  "LV_IMG_TRANSFORM_CACHE_MEM":64*1024,
+  "LV_LAYER_CACHE_MEM":256*1024,
   "LV_USE_LOG":1,
   "LV_USE_THEME_MATERIAL":1,
   "LV_USE_THEME_EMPTY":1,
@@ -0,0 +1,262 @@
+/**
+ * @file lv_test_anim.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_anim.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BENCH_ANIM_MAX  1000
+#define BENCH_STEPS     1000000  /*Number of animation steps (animations x rounds) to measure*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_ANIMATION
+static void run_to_end(void);
+static void sleep_until_delay(void);
+static void nested_refr(void);
+static void benchmark(void);
+static void bench_run(uint32_t anim_num);
+static void exec_cb(void * var, lv_anim_value_t v);
+static void del_other_ready_cb(lv_anim_t * a);
+static void del_and_refr_exec_cb(void * var, lv_anim_value_t v);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_ANIMATION
+static int32_t vars[3];
+static int32_t delayed_vars[2];
+static int32_t nested_vars[2];
+static int32_t bench_vars[BENCH_ANIM_MAX];
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_anim(void)
+{
+#if LV_USE_ANIMATION
+    lv_test_print("");
+    lv_test_print("===================");
+    lv_test_print("Start lv_anim tests");
+    lv_test_print("===================");
+
+    run_to_end();
+    sleep_until_delay();
+    nested_refr();
+    benchmark();
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_ANIMATION
+static void run_to_end(void)
+{
+    lv_test_print("");
+    lv_test_print("Run animations to the end:");
+    lv_test_print("--------------------------");
+
+    lv_anim_path_t path_ease;
+    lv_anim_path_init(&path_ease);
+    lv_anim_path_set_cb(&path_ease, lv_anim_path_ease_out);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &vars[0]);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_time(&a, 20);
+    lv_anim_start(&a);
+
+    lv_anim_set_var(&a, &vars[1]);
+    lv_anim_set_values(&a, 0, 50);
+    lv_anim_set_path(&a, &path_ease);
+    lv_anim_set_ready_cb(&a, del_other_ready_cb);
+    lv_anim_start(&a);
+
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &vars[2]);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 0, 1000);
+    lv_anim_set_time(&a, 1000);
+    lv_anim_start(&a);
+
+    lv_test_assert_int_eq(3, lv_anim_count_running(), "Animation count after start");
+
+    uint32_t i;
+    for(i = 0; i < 10 && lv_anim_count_running(); i++) {
+        lv_tick_inc(5);
+        lv_anim_refr_now();
+    }
+
+    lv_test_assert_int_eq(100, vars[0], "Linear animation's end value");
+    lv_test_assert_int_eq(50, vars[1], "Ease out animation's end value");
+    lv_test_assert_int_gt(0, vars[2], "Animation deleted by an other one's ready_cb has run");
+    lv_test_assert_int_lt(1000, vars[2], "Animation deleted by an other one's ready_cb hasn't finished");
+    lv_test_assert_int_eq(0, lv_anim_count_running(), "Animation count at the end");
+}
+
+static void sleep_until_delay(void)
+{
+    lv_test_print("");
+    lv_test_print("Sleep until the first delayed animation:");
+    lv_test_print("----------------------------------------");
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &delayed_vars[0]);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 0, 1000);
+    lv_anim_set_time(&a, 100);
+    lv_anim_set_delay(&a, 50);
+    lv_anim_start(&a);
+
+    lv_anim_set_var(&a, &delayed_vars[1]);
+    lv_anim_set_delay(&a, 2000);
+    lv_anim_start(&a);
+
+    /*Both animations wait for their delay after this run*/
+    lv_tick_inc(LV_DISP_DEF_REFR_PERIOD);
+    lv_task_handler();
+    lv_test_assert_int_eq(0, delayed_vars[0], "The short delay is not elapsed yet");
+
+    lv_tick_inc(60 - LV_DISP_DEF_REFR_PERIOD);
+    lv_task_handler();
+    lv_test_assert_int_gt(0, delayed_vars[0], "The animation with the short delay runs when its delay is elapsed");
+    lv_test_assert_int_eq(0, delayed_vars[1], "The animation with the long delay still waits");
+
+    lv_anim_del_all();
+}
+
+static void nested_refr(void)
+{
+    lv_test_print("");
+    lv_test_print("Refresh the animations from an animation:");
+    lv_test_print("-----------------------------------------");
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &nested_vars[0]);
+    lv_anim_set_exec_cb(&a, del_and_refr_exec_cb);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_time(&a, 100);
+    lv_anim_start(&a);
+
+    lv_anim_set_var(&a, &nested_vars[1]);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_delay(&a, 1000);
+    lv_anim_start(&a);
+
+    /*The nested run sees the slot of the deleted animation*/
+    lv_tick_inc(10);
+    lv_anim_refr_now();
+    lv_test_assert_int_eq(1, lv_anim_count_running(), "Animation count after deleting in a nested run");
+
+    lv_tick_inc(100);
+    lv_anim_refr_now();
+    lv_test_assert_int_eq(100, nested_vars[0], "End value after a nested run");
+    lv_test_assert_int_eq(0, lv_anim_count_running(), "Animation count at the end");
+}
+
+static void benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Measure the time of an animation step:");
+    lv_test_print("--------------------------------------");
+
+    bench_run(10);
+    bench_run(100);
+    bench_run(1000);
+}
+
+static void bench_run(uint32_t anim_num)
+{
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    if(mon.free_size < anim_num * (sizeof(lv_anim_t) + sizeof(lv_anim_t *) + 16)) {
+        lv_test_print("%d animations: skipped, not enough memory", (int)anim_num);
+        return;
+    }
+#endif
+
+    lv_anim_path_t path_ease;
+    lv_anim_path_init(&path_ease);
+    lv_anim_path_set_cb(&path_ease, lv_anim_path_ease_in_out);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 0, 10000);
+    lv_anim_set_time(&a, 1000);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+
+    uint32_t i;
+    for(i = 0; i < anim_num; i++) {
+        lv_anim_set_var(&a, &bench_vars[i]);
+        lv_anim_set_path(&a, (i & 1) ? &path_ease : &lv_anim_path_def);
+        lv_anim_start(&a);
+    }
+
+    /*The LVGL tick is incremented manually so measure the real time with the system time*/
+    uint32_t rounds = BENCH_STEPS / anim_num;
+    uint32_t t_start = custom_tick_get();
+    for(i = 0; i < rounds; i++) {
+        lv_tick_inc(1);
+        lv_anim_refr_now();
+    }
+    uint32_t elaps = custom_tick_get() - t_start;
+
+    lv_test_print("%d animations: %d ns / animation / step", (int)anim_num, (int)(((uint64_t)elaps * 1000000) / BENCH_STEPS));
+    lv_test_assert_int_eq(anim_num, lv_anim_count_running(), "Animation count during the benchmark");
+
+    lv_anim_del_all();
+}
+
+static void exec_cb(void * var, lv_anim_value_t v)
+{
+    *((int32_t *)var) = v;
+}
+
+static void del_other_ready_cb(lv_anim_t * a)
+{
+    LV_UNUSED(a);
+    lv_anim_del(&vars[2], NULL);
+}
+
+static void del_and_refr_exec_cb(void * var, lv_anim_value_t v)
+{
+    *((int32_t *)var) = v;
+
+    /*Delete the other animation and handle the animations again before returning*/
+    if(lv_anim_get(&nested_vars[1], (lv_anim_exec_xcb_t)exec_cb)) {
+        lv_anim_del(&nested_vars[1], NULL);
+        lv_anim_refr_now();
+    }
+}
+#endif
+#endif
@@ -0,0 +1,487 @@
+/**
+ * @file lv_test_canvas.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_canvas.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CANVAS_W    64
+#define CANVAS_H    48
+#define BENCH_W     800
+#define BENCH_H     480
+#define BENCH_R     15
+#define DRAW_W      200
+#define DRAW_H      150
+#define DRAW_CNT    300
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_CANVAS
+static void blur_box(void);
+static void blur_parallel(void);
+static void blur_gauss(void);
+static void blur_benchmark(void);
+static void draw_batched(void);
+static void draw_alpha_buf(void);
+static void draw_benchmark(void);
+static void draw_scene(lv_obj_t * canvas, uint32_t cnt);
+static void fill_random(uint8_t * buf, uint32_t size);
+static void ref_blur(const lv_img_dsc_t * src, lv_img_dsc_t * dst, const lv_area_t * a, uint16_t r, bool ver);
+static bool blur_matches(lv_obj_t * canvas, lv_img_cf_t cf, const lv_area_t * a, uint16_t r, bool ver);
+static void parallel_reverse_cb(void (*part_cb)(void * user_data, uint32_t part), void * user_data,
+                                uint32_t part_cnt);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_CANVAS
+static uint8_t canvas_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(CANVAS_W, CANVAS_H)];
+static uint8_t orig_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(CANVAS_W, CANVAS_H)];
+static uint8_t ref_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(CANVAS_W, CANVAS_H)];
+static uint32_t parallel_part_cnt;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_canvas(void)
+{
+#if LV_USE_CANVAS
+    lv_test_print("");
+    lv_test_print("=====================");
+    lv_test_print("Start lv_canvas tests");
+    lv_test_print("=====================");
+
+    blur_box();
+    blur_parallel();
+    blur_gauss();
+    blur_benchmark();
+    draw_batched();
+    draw_alpha_buf();
+    draw_benchmark();
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_CANVAS
+static void blur_box(void)
+{
+    lv_test_print("");
+    lv_test_print("Box blur:");
+    lv_test_print("---------");
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act(), NULL);
+    lv_area_t a = {5, 3, 50, 40};
+
+    lv_test_assert_true(blur_matches(canvas, LV_IMG_CF_TRUE_COLOR, &a, 5, false), "Horizontal, odd window");
+    lv_test_assert_true(blur_matches(canvas, LV_IMG_CF_TRUE_COLOR, &a, 6, false), "Horizontal, even window");
+    lv_test_assert_true(blur_matches(canvas, LV_IMG_CF_TRUE_COLOR, &a, 5, true), "Vertical, odd window");
+    lv_test_assert_true(blur_matches(canvas, LV_IMG_CF_TRUE_COLOR, &a, 6, true), "Vertical, even window");
+    lv_test_assert_true(blur_matches(canvas, LV_IMG_CF_TRUE_COLOR_ALPHA, &a, 7, false), "Horizontal with alpha");
+    lv_test_assert_true(blur_matches(canvas, LV_IMG_CF_TRUE_COLOR_ALPHA, &a, 7, true), "Vertical with alpha");
+    lv_test_assert_true(blur_matches(canvas, LV_IMG_CF_TRUE_COLOR_ALPHA, NULL, 1, true), "Window of 1 pixel");
+    lv_test_assert_true(blur_matches(canvas, LV_IMG_CF_TRUE_COLOR_ALPHA, NULL, 100, false),
+                        "Horizontal, larger than the canvas");
+    lv_test_assert_true(blur_matches(canvas, LV_IMG_CF_TRUE_COLOR_ALPHA, NULL, 100, true),
+                        "Vertical, larger than the canvas");
+
+    lv_obj_del(canvas);
+}
+
+static void blur_parallel(void)
+{
+    lv_test_print("");
+    lv_test_print("Blur in parallel parts:");
+    lv_test_print("-----------------------");
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act(), NULL);
+    lv_area_t a = {2, 4, 60, 44};
+
+    lv_canvas_set_parallel_cb(parallel_reverse_cb, 3);
+    parallel_part_cnt = 0;
+    lv_test_assert_true(blur_matches(canvas, LV_IMG_CF_TRUE_COLOR_ALPHA, &a, 9, false), "Horizontal in bands of rows");
+    lv_test_assert_true(blur_matches(canvas, LV_IMG_CF_TRUE_COLOR_ALPHA, &a, 9, true), "Vertical in bands of columns");
+    lv_test_assert_int_eq(3, parallel_part_cnt, "Split into the set number of parts");
+
+    lv_area_t narrow = {10, 10, 11, 30};
+    lv_test_assert_true(blur_matches(canvas, LV_IMG_CF_TRUE_COLOR, &narrow, 4, true), "Fewer columns than parts");
+    lv_test_assert_int_eq(2, parallel_part_cnt, "One part per column");
+
+    lv_canvas_set_parallel_cb(NULL, 1);
+    lv_obj_del(canvas);
+}
+
+static void blur_gauss(void)
+{
+    lv_test_print("");
+    lv_test_print("Gaussian blur:");
+    lv_test_print("--------------");
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act(), NULL);
+    lv_canvas_set_buffer(canvas, canvas_buf, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR);
+
+    /*A uniform color remains the same*/
+    lv_color_t color = lv_color_make(0x30, 0x60, 0x90);
+    lv_canvas_fill_bg(canvas, color, LV_OPA_COVER);
+    lv_canvas_blur_gauss(canvas, NULL, 4);
+
+    lv_coord_t x;
+    lv_coord_t y;
+    bool uniform = true;
+    for(y = 0; y < CANVAS_H; y++) {
+        for(x = 0; x < CANVAS_W; x++) {
+            if(lv_canvas_get_px(canvas, x, y).full != color.full) uniform = false;
+        }
+    }
+    lv_test_assert_true(uniform, "Uniform color is kept");
+
+#if LV_COLOR_DEPTH >= 16
+    /*A dot is spread symmetrically, the center is the brightest. With fewer bits the dot is just rounded down*/
+    lv_canvas_fill_bg(canvas, LV_COLOR_BLACK, LV_OPA_COVER);
+    lv_canvas_set_px(canvas, 32, 24, LV_COLOR_WHITE);
+    lv_canvas_set_px(canvas, 33, 24, LV_COLOR_WHITE);
+    lv_canvas_set_px(canvas, 32, 25, LV_COLOR_WHITE);
+    lv_canvas_set_px(canvas, 33, 25, LV_COLOR_WHITE);
+    lv_canvas_blur_gauss(canvas, NULL, 2);
+
+    uint8_t center = LV_COLOR_GET_G(lv_canvas_get_px(canvas, 32, 24));
+    uint8_t side = LV_COLOR_GET_G(lv_canvas_get_px(canvas, 30, 24));
+    uint8_t far = LV_COLOR_GET_G(lv_canvas_get_px(canvas, 26, 24));
+    lv_test_assert_int_gt(side, center, "The center is the brightest");
+    lv_test_assert_int_gt(far, side, "Fading from the center");
+    lv_test_assert_int_eq(side, LV_COLOR_GET_G(lv_canvas_get_px(canvas, 35, 25)), "Symmetric horizontally");
+
+    /*The passes are rounded down one after the other so the vertical and horizontal directions can differ by 1*/
+    int32_t side_ver = LV_COLOR_GET_G(lv_canvas_get_px(canvas, 33, 27));
+    lv_test_assert_true(LV_MATH_ABS(side_ver - side) <= 1, "Symmetric vertically");
+#endif
+
+    lv_obj_del(canvas);
+}
+
+static void blur_benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Blur benchmark:");
+    lv_test_print("---------------");
+
+    static uint8_t bench_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(BENCH_W, BENCH_H)];
+    static uint8_t bench_ref_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(BENCH_W, BENCH_H)];
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act(), NULL);
+    lv_canvas_set_buffer(canvas, bench_buf, BENCH_W, BENCH_H, LV_IMG_CF_TRUE_COLOR);
+    fill_random(bench_buf, sizeof(bench_buf));
+    _lv_memcpy(bench_ref_buf, bench_buf, sizeof(bench_buf));
+
+    lv_img_dsc_t ref_dsc = *lv_canvas_get_img(canvas);
+    ref_dsc.data = bench_ref_buf;
+    lv_area_t a = {0, 0, BENCH_W - 1, BENCH_H - 1};
+
+    /*The LVGL tick is incremented manually so measure the real time with the system time*/
+    uint32_t t_start = custom_tick_get();
+    ref_blur(lv_canvas_get_img(canvas), &ref_dsc, &a, BENCH_R, false);
+    _lv_memcpy(bench_buf, bench_ref_buf, sizeof(bench_buf));
+    ref_blur(lv_canvas_get_img(canvas), &ref_dsc, &a, BENCH_R, true);
+    uint32_t t_px = custom_tick_get() - t_start;
+
+    fill_random(bench_buf, sizeof(bench_buf));
+    t_start = custom_tick_get();
+    lv_canvas_blur_hor(canvas, NULL, BENCH_R);
+    lv_canvas_blur_ver(canvas, NULL, BENCH_R);
+    uint32_t t_rows = custom_tick_get() - t_start;
+
+    lv_test_assert_array_eq(bench_ref_buf, bench_buf, sizeof(bench_buf), "Same result as pixel by pixel");
+    lv_test_print("%dx%d, window %d: pixel by pixel %d ms, row based %d ms", BENCH_W, BENCH_H, BENCH_R,
+                  (int)t_px, (int)t_rows);
+
+    lv_obj_del(canvas);
+}
+
+static void draw_batched(void)
+{
+    lv_test_print("");
+    lv_test_print("Draw in a drawing context:");
+    lv_test_print("--------------------------");
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act(), NULL);
+    lv_canvas_set_buffer(canvas, canvas_buf, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR_ALPHA);
+
+    lv_canvas_fill_bg(canvas, LV_COLOR_BLACK, LV_OPA_50);
+    draw_scene(canvas, 20);
+    _lv_memcpy(ref_buf, canvas_buf, sizeof(canvas_buf));
+
+    lv_canvas_fill_bg(canvas, LV_COLOR_BLACK, LV_OPA_50);
+    lv_refr_now(NULL);
+    lv_disp_t * disp = lv_disp_get_default();
+
+    lv_test_assert_int_eq(LV_RES_OK, lv_canvas_draw_begin(canvas), "Drawing context opened");
+    draw_scene(canvas, 20);
+    lv_test_assert_int_eq(0, disp->inv_p, "Not invalidated while drawing");
+    lv_canvas_draw_end(canvas);
+    lv_test_assert_int_eq(1, disp->inv_p, "Invalidated at the end");
+    lv_test_assert_array_eq(ref_buf, canvas_buf, sizeof(canvas_buf), "Same result as drawing one by one");
+
+    /*The opened context follows the new buffer*/
+    lv_canvas_draw_begin(canvas);
+    lv_canvas_set_buffer(canvas, orig_buf, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    lv_canvas_fill_bg(canvas, LV_COLOR_BLACK, LV_OPA_50);
+    draw_scene(canvas, 20);
+    lv_test_assert_array_eq(ref_buf, orig_buf, sizeof(orig_buf), "Draw to the new buffer");
+
+    /*Deleted with an opened context*/
+    lv_obj_del(canvas);
+}
+
+static void draw_alpha_buf(void)
+{
+    lv_test_print("");
+    lv_test_print("Draw to alpha buffers:");
+    lv_test_print("----------------------");
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act(), NULL);
+    lv_canvas_set_buffer(canvas, canvas_buf, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR_ALPHA);
+
+    lv_color_t bg_color = lv_color_make(0x20, 0x80, 0xe0);
+    lv_color_t fg_color = lv_color_make(0xf0, 0x40, 0x10);
+    lv_canvas_fill_bg(canvas, bg_color, LV_OPA_50);
+
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = fg_color;
+    rect_dsc.bg_opa = LV_OPA_40;
+    lv_canvas_draw_rect(canvas, 10, 10, 20, 20, &rect_dsc);
+
+    lv_color_t res_color;
+    lv_opa_t res_opa;
+    lv_color_mix_with_alpha(bg_color, LV_OPA_50, fg_color, LV_OPA_40, &res_color, &res_opa);
+    lv_img_dsc_t * dsc = lv_canvas_get_img(canvas);
+    lv_test_assert_color_eq(res_color, lv_canvas_get_px(canvas, 15, 15), "Color mixed");
+    lv_test_assert_int_eq(res_opa, lv_img_buf_get_px_alpha(dsc, 15, 15), "Opacity mixed");
+    lv_test_assert_color_eq(bg_color, lv_canvas_get_px(canvas, 9, 15), "Unchanged outside");
+    lv_test_assert_int_eq(LV_OPA_50, lv_img_buf_get_px_alpha(dsc, 9, 15), "Opacity unchanged outside");
+
+    rect_dsc.bg_opa = LV_OPA_COVER;
+    lv_canvas_draw_rect(canvas, 10, 10, 20, 20, &rect_dsc);
+    lv_test_assert_color_eq(fg_color, lv_canvas_get_px(canvas, 15, 15), "Opaque color");
+    lv_test_assert_int_eq(LV_OPA_COVER, lv_img_buf_get_px_alpha(dsc, 15, 15), "Opaque");
+
+    /*Alpha only canvases store the brightness*/
+    lv_canvas_set_buffer(canvas, canvas_buf, CANVAS_W, CANVAS_H, LV_IMG_CF_ALPHA_8BIT);
+    _lv_memset_00(canvas_buf, CANVAS_W * CANVAS_H);
+    rect_dsc.bg_color = LV_COLOR_WHITE;
+    rect_dsc.bg_opa = LV_OPA_50;
+    lv_canvas_draw_rect(canvas, 10, 10, 20, 20, &rect_dsc);
+    uint8_t br = lv_color_brightness(LV_COLOR_WHITE);
+    lv_test_assert_int_eq((br * LV_OPA_50) >> 8, lv_img_buf_get_px_alpha(dsc, 15, 15), "Alpha mixed");
+    lv_test_assert_int_eq(0, lv_img_buf_get_px_alpha(dsc, 9, 15), "Alpha unchanged outside");
+
+    rect_dsc.bg_opa = LV_OPA_COVER;
+    lv_canvas_draw_rect(canvas, 10, 10, 20, 20, &rect_dsc);
+    lv_test_assert_int_eq(br, lv_img_buf_get_px_alpha(dsc, 15, 15), "Opaque alpha");
+
+    lv_obj_del(canvas);
+}
+
+static void draw_benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Draw benchmark:");
+    lv_test_print("---------------");
+
+    static uint8_t bench_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(DRAW_W, DRAW_H)];
+    static uint8_t bench_ref_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(DRAW_W, DRAW_H)];
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act(), NULL);
+    lv_canvas_set_buffer(canvas, bench_ref_buf, DRAW_W, DRAW_H, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    lv_canvas_fill_bg(canvas, LV_COLOR_BLACK, LV_OPA_TRANSP);
+
+    /*The LVGL tick is incremented manually so measure the real time with the system time*/
+    uint32_t t_start = custom_tick_get();
+    draw_scene(canvas, DRAW_CNT);
+    uint32_t t_single = custom_tick_get() - t_start;
+
+    lv_canvas_set_buffer(canvas, bench_buf, DRAW_W, DRAW_H, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    lv_canvas_fill_bg(canvas, LV_COLOR_BLACK, LV_OPA_TRANSP);
+    t_start = custom_tick_get();
+    lv_canvas_draw_begin(canvas);
+    draw_scene(canvas, DRAW_CNT);
+    lv_canvas_draw_end(canvas);
+    uint32_t t_batched = custom_tick_get() - t_start;
+
+    lv_test_assert_array_eq(bench_ref_buf, bench_buf, sizeof(bench_buf), "Same result in a drawing context");
+    lv_test_print("%d primitives on %dx%d: one by one %d ms, in a drawing context %d ms", DRAW_CNT * 3, DRAW_W,
+                  DRAW_H, (int)t_single, (int)t_batched);
+
+    lv_obj_del(canvas);
+}
+
+/**
+ * Draw semi-transparent rectangles, lines and arcs to the canvas
+ */
+static void draw_scene(lv_obj_t * canvas, uint32_t cnt)
+{
+    lv_img_dsc_t * dsc = lv_canvas_get_img(canvas);
+    lv_coord_t w = dsc->header.w;
+    lv_coord_t h = dsc->header.h;
+
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.radius = 3;
+    rect_dsc.bg_opa = LV_OPA_60;
+    rect_dsc.border_width = 1;
+    rect_dsc.border_color = LV_COLOR_WHITE;
+
+    lv_draw_line_dsc_t line_dsc;
+    lv_draw_line_dsc_init(&line_dsc);
+    line_dsc.width = 2;
+    line_dsc.opa = LV_OPA_80;
+
+    uint32_t seed = 0x1234567;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        seed = seed * 1103515245 + 12345;
+        lv_coord_t x = (seed >> 8) % w;
+        lv_coord_t y = (seed >> 16) % h;
+        rect_dsc.bg_color = lv_color_hex(seed);
+        line_dsc.color = lv_color_hex(~seed);
+
+        lv_canvas_draw_rect(canvas, x, y, 12, 8, &rect_dsc);
+
+        lv_point_t points[2] = {{x, y}, {(x + 17) % w, (y + 9) % h}};
+        lv_canvas_draw_line(canvas, points, 2, &line_dsc);
+
+        lv_canvas_draw_arc(canvas, x, y, 6, 0, 270, &line_dsc);
+    }
+}
+
+static void fill_random(uint8_t * buf, uint32_t size)
+{
+    uint32_t seed = 0x1234567;
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        seed = seed * 1103515245 + 12345;
+        buf[i] = (uint8_t)(seed >> 16);
+    }
+}
+
+/**
+ * Blur the canvas and compare the result with `ref_blur`
+ */
+static bool blur_matches(lv_obj_t * canvas, lv_img_cf_t cf, const lv_area_t * a, uint16_t r, bool ver)
+{
+    lv_canvas_set_buffer(canvas, canvas_buf, CANVAS_W, CANVAS_H, cf);
+    uint32_t size = lv_img_buf_get_img_size(CANVAS_W, CANVAS_H, cf);
+    fill_random(canvas_buf, size);
+
+    /*Make some fully transparent areas too*/
+    if(cf == LV_IMG_CF_TRUE_COLOR_ALPHA) {
+        uint32_t i;
+        for(i = 0; i < CANVAS_W * CANVAS_H; i++) {
+            if((i % CANVAS_W) < 20) canvas_buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE + LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = 0;
+        }
+    }
+
+    _lv_memcpy(orig_buf, canvas_buf, size);
+    _lv_memcpy(ref_buf, canvas_buf, size);
+
+    lv_img_dsc_t src_dsc = *lv_canvas_get_img(canvas);
+    src_dsc.data = orig_buf;
+    lv_img_dsc_t ref_dsc = src_dsc;
+    ref_dsc.data = ref_buf;
+
+    lv_area_t ref_a = {0, 0, CANVAS_W - 1, CANVAS_H - 1};
+    if(a) lv_area_copy(&ref_a, a);
+    ref_blur(&src_dsc, &ref_dsc, &ref_a, r, ver);
+
+    if(ver) lv_canvas_blur_ver(canvas, a, r);
+    else lv_canvas_blur_hor(canvas, a, r);
+
+    return memcmp(canvas_buf, ref_buf, size) == 0;
+}
+
+/**
+ * Box blur pixel by pixel from `src` into `dst` with the edge pixels repeated outside the image.
+ * Fully transparent windows keep the color of the pixel.
+ */
+static void ref_blur(const lv_img_dsc_t * src, lv_img_dsc_t * dst, const lv_area_t * a, uint16_t r, bool ver)
+{
+    bool has_alpha = lv_img_cf_has_alpha(src->header.cf);
+    int32_t r_back = r / 2;
+    int32_t r_front = r / 2;
+    if((r & 0x1) == 0) r_back--;
+
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = a->y1; y <= a->y2; y++) {
+        for(x = a->x1; x <= a->x2; x++) {
+            uint32_t rsum = 0;
+            uint32_t gsum = 0;
+            uint32_t bsum = 0;
+            uint32_t asum = 0;
+            int32_t i;
+            for(i = -r_back; i <= r_front; i++) {
+                lv_coord_t sx = ver ? x : LV_MATH_MIN(LV_MATH_MAX(x + i, 0), src->header.w - 1);
+                lv_coord_t sy = ver ? LV_MATH_MIN(LV_MATH_MAX(y + i, 0), src->header.h - 1) : y;
+                lv_color_t c = lv_img_buf_get_px_color(src, sx, sy, LV_COLOR_BLACK);
+                rsum += LV_COLOR_GET_R(c);
+                gsum += LV_COLOR_GET_G(c);
+                bsum += LV_COLOR_GET_B(c);
+                if(has_alpha) asum += lv_img_buf_get_px_alpha(src, sx, sy);
+            }
+
+            if(has_alpha && asum == 0) {
+                lv_img_buf_set_px_alpha(dst, x, y, LV_OPA_TRANSP);
+                continue;
+            }
+
+            lv_color_t c;
+            c.full = 0;
+            LV_COLOR_SET_R(c, rsum / r);
+            LV_COLOR_SET_G(c, gsum / r);
+            LV_COLOR_SET_B(c, bsum / r);
+            LV_COLOR_SET_A(c, LV_OPA_COVER);
+            lv_img_buf_set_px_color(dst, x, y, c);
+            if(has_alpha) lv_img_buf_set_px_alpha(dst, x, y, asum / r);
+        }
+    }
+}
+
+/**
+ * Run the parts in reverse order to see they are independent
+ */
+static void parallel_reverse_cb(void (*part_cb)(void * user_data, uint32_t part), void * user_data,
+                                uint32_t part_cnt)
+{
+    parallel_part_cnt = part_cnt;
+    uint32_t i;
+    for(i = part_cnt; i > 0; i--) {
+        part_cb(user_data, i - 1);
+    }
+}
+#endif
+
+#endif
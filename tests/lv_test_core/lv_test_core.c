@@ -12,6 +12,15 @@
 #include "lv_test_core.h"
 #include "lv_test_obj.h"
 #include "lv_test_style.h"
+#include "lv_test_task.h"
+#include "lv_test_anim.h"
+#include "lv_test_img_cache.h"
+#include "lv_test_img_async.h"
+#include "lv_test_img_decoder.h"
+#include "lv_test_img_transform.h"
+#include "lv_test_img_trans_cache.h"
+#include "lv_test_canvas.h"
+#include "lv_test_layer_cache.h"
 #include "lv_test_font_loader.h"
 
 /*********************
@@ -47,6 +56,15 @@ void lv_test_core(void)
 
     lv_test_obj();
     lv_test_style();
+    lv_test_task();
+    lv_test_anim();
+    lv_test_img_cache();
+    lv_test_img_async();
+    lv_test_img_decoder();
+    lv_test_img_transform();
+    lv_test_img_trans_cache();
+    lv_test_canvas();
+    lv_test_layer_cache();
     lv_test_font_loader();
 }
 
@@ -0,0 +1,320 @@
+/**
+ * @file lv_test_img_async.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_img_async.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define IMG_SIZE    8
+#define JOB_MAX     4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_IMG_ASYNC
+static void decode_in_background(void);
+static void cancel_on_delete(void);
+static void shared_src(void);
+#if LV_USE_CANVAS
+static void draw_to_canvas(void);
+#endif
+static void run_jobs(void);
+static void submit_cb(lv_img_async_job_t * job);
+static void placeholder_cb(const lv_area_t * coords, const lv_area_t * clip_area, const void * src);
+static void lock_cb(void);
+static void unlock_cb(void);
+static lv_res_t test_info_cb(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
+static lv_res_t test_open_cb(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static void test_close_cb(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_IMG_ASYNC
+static lv_img_dsc_t imgs[4];
+static lv_img_async_job_t * jobs[JOB_MAX];
+static uint32_t job_cnt;
+static uint32_t open_cnt;
+static uint32_t placeholder_cnt;
+static uint32_t lock_cnt;
+static bool locked;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_img_async(void)
+{
+#if LV_USE_IMG_ASYNC
+    lv_test_print("");
+    lv_test_print("========================");
+    lv_test_print("Start lv_img_async tests");
+    lv_test_print("========================");
+
+    lv_img_decoder_t * dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, test_info_cb);
+    lv_img_decoder_set_open_cb(dec, test_open_cb);
+    lv_img_decoder_set_close_cb(dec, test_close_cb);
+    lv_img_decoder_set_async(dec, true);
+
+    lv_img_async_drv_t drv;
+    lv_img_async_drv_init(&drv);
+    drv.submit_cb = submit_cb;
+    drv.placeholder_cb = placeholder_cb;
+    drv.lock_cb = lock_cb;
+    drv.unlock_cb = unlock_cb;
+    lv_img_async_drv_register(&drv);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(imgs) / sizeof(imgs[0]); i++) {
+        imgs[i].header.cf = LV_IMG_CF_USER_ENCODED_1;
+        imgs[i].header.w = IMG_SIZE;
+        imgs[i].header.h = IMG_SIZE;
+    }
+
+    decode_in_background();
+    cancel_on_delete();
+    shared_src();
+#if LV_USE_CANVAS
+    draw_to_canvas();
+#endif
+
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_async_drv_init(&drv);
+    lv_img_async_drv_register(&drv);
+    lv_img_decoder_delete(dec);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_IMG_ASYNC
+static void decode_in_background(void)
+{
+    lv_test_print("");
+    lv_test_print("Draw a placeholder and redraw when decoded:");
+    lv_test_print("-------------------------------------------");
+
+    job_cnt = 0;
+    open_cnt = 0;
+    placeholder_cnt = 0;
+    lock_cnt = 0;
+
+    lv_obj_t * img = lv_img_create(lv_scr_act(), NULL);
+    lv_img_set_src(img, &imgs[0]);
+    lv_refr_now(NULL);
+
+    lv_test_assert_int_eq(1, job_cnt, "A job is submitted");
+    lv_test_assert_int_eq(0, open_cnt, "The image is not opened while drawing");
+    lv_test_assert_int_gt(0, placeholder_cnt, "The placeholder is drawn");
+
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+    lv_test_assert_int_eq(1, job_cnt, "The pending image is submitted only once");
+
+    /*The collected image is invalidated and redrawn by the refresh task*/
+    lv_img_cache_stat_t stat;
+    lv_img_cache_reset_stat();
+    uint32_t placeholder_prev = placeholder_cnt;
+    run_jobs();
+    lv_refr_now(NULL);
+    lv_img_cache_get_stat(&stat);
+    lv_test_assert_int_eq(1, open_cnt, "The worker opened the image");
+    lv_test_assert_int_eq(0, lv_img_async_get_job_cnt(), "The job is collected");
+    lv_test_assert_int_eq(placeholder_prev, placeholder_cnt, "The image is drawn instead of the placeholder");
+    lv_test_assert_int_gt(0, stat.hit_cnt, "The image is redrawn from the cache");
+    lv_test_assert_int_gt(0, lock_cnt, "The job states are accessed with the lock");
+    lv_test_assert_true(!locked, "The lock is released");
+
+    lv_obj_del(img);
+}
+
+static void cancel_on_delete(void)
+{
+    lv_test_print("");
+    lv_test_print("Cancel the decoding on delete:");
+    lv_test_print("------------------------------");
+
+    job_cnt = 0;
+    open_cnt = 0;
+
+    lv_obj_t * img = lv_img_create(lv_scr_act(), NULL);
+    lv_img_set_src(img, &imgs[1]);
+    lv_refr_now(NULL);
+    lv_test_assert_int_eq(1, job_cnt, "A job is submitted");
+
+    lv_obj_del(img);
+    run_jobs();
+    lv_test_assert_int_eq(0, open_cnt, "The canceled image is not opened");
+    lv_test_assert_int_eq(0, lv_img_async_get_job_cnt(), "The canceled job is freed");
+}
+
+static void shared_src(void)
+{
+    lv_test_print("");
+    lv_test_print("Wait for an image with more objects:");
+    lv_test_print("------------------------------------");
+
+    job_cnt = 0;
+    open_cnt = 0;
+    placeholder_cnt = 0;
+
+    lv_obj_t * img1 = lv_img_create(lv_scr_act(), NULL);
+    lv_img_set_src(img1, &imgs[2]);
+    lv_obj_t * img2 = lv_img_create(lv_scr_act(), NULL);
+    lv_img_set_src(img2, &imgs[2]);
+    lv_obj_set_x(img2, 2 * IMG_SIZE);
+    lv_refr_now(NULL);
+    lv_test_assert_int_eq(1, job_cnt, "One job is submitted for the same source");
+
+    /*`img2` still waits for the image so it's not canceled*/
+    lv_img_set_src(img1, &imgs[0]);
+    lv_refr_now(NULL);
+    uint32_t placeholder_prev = placeholder_cnt;
+    run_jobs();
+    lv_refr_now(NULL);
+    lv_test_assert_int_eq(1, open_cnt, "The image is decoded while an object waits for it");
+    lv_test_assert_int_eq(placeholder_prev, placeholder_cnt, "The other object is redrawn with the image");
+
+    /*The last waiting object cancels the job*/
+    job_cnt = 0;
+    open_cnt = 0;
+    lv_img_set_src(img1, &imgs[3]);
+    lv_img_set_src(img2, &imgs[3]);
+    lv_refr_now(NULL);
+    lv_test_assert_int_eq(1, job_cnt, "A job is submitted for the new source");
+    lv_img_set_src(img1, &imgs[0]);
+    lv_obj_del(img2);
+    run_jobs();
+    lv_test_assert_int_eq(0, open_cnt, "The image is not decoded if no object waits for it");
+    lv_test_assert_int_eq(0, lv_img_async_get_job_cnt(), "The canceled job is freed");
+
+    lv_obj_del(img1);
+}
+
+#if LV_USE_CANVAS
+static void draw_to_canvas(void)
+{
+    lv_test_print("");
+    lv_test_print("Draw to a canvas:");
+    lv_test_print("-----------------");
+
+    static lv_color_t cbuf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(IMG_SIZE, IMG_SIZE)];
+
+    job_cnt = 0;
+    open_cnt = 0;
+    placeholder_cnt = 0;
+    lv_img_cache_invalidate_src(&imgs[2]);
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act(), NULL);
+    lv_canvas_set_buffer(canvas, cbuf, IMG_SIZE, IMG_SIZE, LV_IMG_CF_TRUE_COLOR);
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+    lv_canvas_draw_img(canvas, 0, 0, &imgs[2], &dsc);
+    lv_test_assert_int_eq(1, job_cnt, "A job is submitted");
+    lv_test_assert_int_gt(0, placeholder_cnt, "The placeholder is drawn");
+
+    /*No object waits for the image so the canvas' temporary display is not used later*/
+    lv_obj_del(canvas);
+    run_jobs();
+    lv_test_assert_int_eq(1, open_cnt, "The worker opened the image");
+    lv_test_assert_int_eq(0, lv_img_async_get_job_cnt(), "The job is collected");
+}
+#endif
+
+/**
+ * Simulate the worker thread and let LVGL collect the results
+ */
+static void run_jobs(void)
+{
+    uint32_t i;
+    for(i = 0; i < job_cnt; i++) {
+        lv_img_async_run(jobs[i]);
+    }
+
+    lv_tick_inc(LV_DISP_DEF_REFR_PERIOD);
+    lv_task_handler();
+}
+
+static void submit_cb(lv_img_async_job_t * job)
+{
+    if(job_cnt < JOB_MAX) jobs[job_cnt++] = job;
+}
+
+static void placeholder_cb(const lv_area_t * coords, const lv_area_t * clip_area, const void * src)
+{
+    LV_UNUSED(coords);
+    LV_UNUSED(clip_area);
+    LV_UNUSED(src);
+    placeholder_cnt++;
+}
+
+static void lock_cb(void)
+{
+    if(locked) lv_test_error("   FAIL: The lock is taken twice");
+    locked = true;
+    lock_cnt++;
+}
+
+static void unlock_cb(void)
+{
+    locked = false;
+}
+
+static lv_res_t test_info_cb(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(decoder);
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return LV_RES_INV;
+
+    const lv_img_dsc_t * img_dsc = src;
+    if(img_dsc->header.cf != LV_IMG_CF_USER_ENCODED_1) return LV_RES_INV;
+
+    header->w = img_dsc->header.w;
+    header->h = img_dsc->header.h;
+    header->cf = LV_IMG_CF_TRUE_COLOR;
+    return LV_RES_OK;
+}
+
+static lv_res_t test_open_cb(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    uint32_t size = lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf);
+    uint8_t * buf = lv_mem_alloc(size);
+    if(buf == NULL) return LV_RES_INV;
+    _lv_memset_00(buf, size);
+    dsc->img_data = buf;
+    open_cnt++;
+    return LV_RES_OK;
+}
+
+static void test_close_cb(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    lv_mem_free(dsc->img_data);
+    dsc->img_data = NULL;
+}
+#endif
+
+#endif
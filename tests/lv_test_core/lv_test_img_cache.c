@@ -0,0 +1,410 @@
+/**
+ * @file lv_test_img_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_img_cache.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define IMG_CNT     6
+#define IMG_SIZE    4
+#define CONV_SIZE   16
+
+/*Height of an alpha image which is as large as the size limit of a converted image*/
+#define CONV_ALPHA_H    (LV_IMG_CACHE_CONVERT_MAX_SIZE / (CONV_SIZE * LV_IMG_PX_SIZE_ALPHA_BYTE))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_IMG_CACHE_DEF_SIZE
+static void hit_and_miss(void);
+static void mem_limit(void);
+static void invalidate(void);
+static void clock_wraparound(void);
+static lv_res_t test_info_cb(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
+static lv_res_t test_open_cb(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static void test_close_cb(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+#endif
+
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_CONVERT_MEM_LIMIT
+static void convert(void);
+static bool same_as_decoded(const lv_img_cache_entry_t * entry, const void * src, lv_color_t color);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_IMG_CACHE_DEF_SIZE
+static lv_img_dsc_t imgs[IMG_CNT];
+static uint32_t open_cnt;
+static uint32_t close_cnt;
+#endif
+
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_CONVERT_MEM_LIMIT
+static uint8_t indexed_data[4 * sizeof(lv_color32_t) + CONV_SIZE * CONV_SIZE / 4];
+static uint8_t alpha_data[CONV_SIZE * (CONV_ALPHA_H + 1) / 2];
+static lv_img_dsc_t indexed_imgs[2];
+static lv_img_dsc_t alpha_imgs[LV_IMG_CACHE_CONVERT_MEM_LIMIT / LV_IMG_CACHE_CONVERT_MAX_SIZE + 2];
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_img_cache(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    lv_test_print("");
+    lv_test_print("========================");
+    lv_test_print("Start lv_img_cache tests");
+    lv_test_print("========================");
+
+    /*A decoder which decodes to RAM to see the memory usage*/
+    lv_img_decoder_t * dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, test_info_cb);
+    lv_img_decoder_set_open_cb(dec, test_open_cb);
+    lv_img_decoder_set_close_cb(dec, test_close_cb);
+
+    uint32_t i;
+    for(i = 0; i < IMG_CNT; i++) {
+        imgs[i].header.cf = LV_IMG_CF_USER_ENCODED_0;
+        imgs[i].header.w = IMG_SIZE;
+        imgs[i].header.h = IMG_SIZE;
+    }
+
+    hit_and_miss();
+    mem_limit();
+    invalidate();
+    clock_wraparound();
+#if LV_IMG_CACHE_CONVERT_MEM_LIMIT
+    convert();
+#endif
+
+    lv_img_cache_set_mem_limit(LV_IMG_CACHE_DEF_MEM_LIMIT);
+    lv_img_cache_set_size(LV_IMG_CACHE_DEF_SIZE);
+    lv_img_decoder_delete(dec);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_IMG_CACHE_DEF_SIZE
+static void hit_and_miss(void)
+{
+    lv_test_print("");
+    lv_test_print("Find the cached images:");
+    lv_test_print("-----------------------");
+
+    lv_img_cache_set_size(4);
+    lv_img_cache_reset_stat();
+    open_cnt = 0;
+    close_cnt = 0;
+
+    lv_img_cache_entry_t * e1 = _lv_img_cache_open(&imgs[0], LV_COLOR_BLACK);
+    lv_img_cache_entry_t * e2 = _lv_img_cache_open(&imgs[0], LV_COLOR_BLACK);
+    lv_test_assert_ptr_eq(e1, e2, "The same entry is returned for the same source");
+    lv_test_assert_int_eq(1, open_cnt, "The image is opened only once");
+
+    _lv_img_cache_open(&imgs[0], LV_COLOR_RED);
+    lv_test_assert_int_eq(2, open_cnt, "Other color is an other entry");
+
+    uint32_t i;
+    for(i = 1; i < 4; i++) {
+        _lv_img_cache_open(&imgs[i], LV_COLOR_BLACK);
+    }
+
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    lv_test_assert_int_eq(1, stat.hit_cnt, "Hit count");
+    lv_test_assert_int_eq(5, stat.miss_cnt, "Miss count");
+    lv_test_assert_int_eq(1, stat.evict_cnt, "Eviction count");
+    lv_test_assert_int_eq(4, stat.entry_cnt, "The cache is full");
+    lv_test_assert_int_eq(1, close_cnt, "The evicted image is closed");
+    lv_test_assert_int_eq(4 * lv_img_buf_get_img_size(IMG_SIZE, IMG_SIZE, LV_IMG_CF_TRUE_COLOR), stat.used_size,
+                          "Memory usage");
+}
+
+static void mem_limit(void)
+{
+    lv_test_print("");
+    lv_test_print("Limit the memory usage:");
+    lv_test_print("-----------------------");
+
+    uint32_t img_size = lv_img_buf_get_img_size(IMG_SIZE, IMG_SIZE, LV_IMG_CF_TRUE_COLOR);
+
+    lv_img_cache_set_size(IMG_CNT);
+    lv_img_cache_reset_stat();
+    lv_img_cache_set_mem_limit(2 * img_size);
+
+    /*Make image 0 valuable by using it often*/
+    _lv_img_cache_open(&imgs[0], LV_COLOR_BLACK);
+    _lv_img_cache_open(&imgs[0], LV_COLOR_BLACK);
+    _lv_img_cache_open(&imgs[0], LV_COLOR_BLACK);
+
+    uint32_t i;
+    for(i = 1; i < IMG_CNT; i++) {
+        _lv_img_cache_open(&imgs[i], LV_COLOR_BLACK);
+    }
+
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    lv_test_assert_int_eq(2 * img_size, stat.used_size, "The images fit into the limit");
+    lv_test_assert_int_eq(2, stat.entry_cnt, "Only 2 images are cached");
+    lv_test_assert_int_eq(IMG_CNT - 2, stat.evict_cnt, "The others are evicted");
+
+    uint32_t open_prev = open_cnt;
+    _lv_img_cache_open(&imgs[0], LV_COLOR_BLACK);
+    _lv_img_cache_open(&imgs[IMG_CNT - 1], LV_COLOR_BLACK);
+    lv_test_assert_int_eq(open_prev, open_cnt, "The valuable and the last image are kept");
+
+    lv_img_cache_set_mem_limit(img_size);
+    lv_img_cache_get_stat(&stat);
+    lv_test_assert_int_eq(1, stat.entry_cnt, "Lowering the limit evicts immediately");
+    lv_img_cache_set_mem_limit(0);
+}
+
+static void invalidate(void)
+{
+    lv_test_print("");
+    lv_test_print("Invalidate a source:");
+    lv_test_print("--------------------");
+
+    lv_img_cache_set_size(4);
+    open_cnt = 0;
+    close_cnt = 0;
+
+    _lv_img_cache_open(&imgs[0], LV_COLOR_BLACK);
+    _lv_img_cache_open(&imgs[0], LV_COLOR_RED);
+    _lv_img_cache_open(&imgs[1], LV_COLOR_BLACK);
+    lv_img_cache_invalidate_src(&imgs[0]);
+    lv_test_assert_int_eq(2, close_cnt, "All colors of the source are closed");
+
+    _lv_img_cache_open(&imgs[1], LV_COLOR_BLACK);
+    lv_test_assert_int_eq(3, open_cnt, "The other source is still cached");
+
+    _lv_img_cache_open(&imgs[0], LV_COLOR_BLACK);
+    lv_test_assert_int_eq(4, open_cnt, "The invalidated source is opened again");
+
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    lv_test_assert_int_eq(0, stat.entry_cnt, "The cache is empty");
+    lv_test_assert_int_eq(0, stat.used_size, "No memory is used");
+}
+
+static void clock_wraparound(void)
+{
+    lv_test_print("");
+    lv_test_print("Age an entry past the wraparound of the clock:");
+    lv_test_print("----------------------------------------------");
+
+    lv_img_cache_set_size(2);
+    lv_img_cache_reset_stat();
+    open_cnt = 0;
+    close_cnt = 0;
+
+    lv_img_cache_entry_t * hot = _lv_img_cache_open(&imgs[0], LV_COLOR_BLACK);
+    lv_img_cache_entry_t * old = _lv_img_cache_open(&imgs[1], LV_COLOR_BLACK);
+    _lv_img_cache_open(&imgs[0], LV_COLOR_BLACK);
+
+    /* `life` is relative to the clock so this is the same as advancing the clock past 2^31
+     * while `hot` is used all the time and `old` is never used*/
+    old->life -= 0x80000000U + 100;
+
+    _lv_img_cache_open(&imgs[2], LV_COLOR_BLACK);
+    lv_test_assert_int_eq(1, close_cnt, "An entry is evicted");
+    lv_test_assert_ptr_eq(&imgs[2], old->dec_dsc.src, "The old entry is reused");
+    lv_test_assert_ptr_eq(hot, _lv_img_cache_open(&imgs[0], LV_COLOR_BLACK), "The hot entry is still cached");
+    lv_test_assert_int_eq(3, open_cnt, "The hot entry is not opened again");
+
+    lv_img_cache_invalidate_src(NULL);
+}
+
+#if LV_IMG_CACHE_CONVERT_MEM_LIMIT
+static void convert(void)
+{
+    lv_test_print("");
+    lv_test_print("Convert indexed and alpha images:");
+    lv_test_print("---------------------------------");
+
+    lv_img_cache_set_size(8);
+    lv_img_cache_reset_stat();
+
+    /*2 bit palette: opaque colors*/
+    lv_color32_t * palette = (lv_color32_t *)indexed_data;
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        palette[i].ch.red = (uint8_t)(i * 80);
+        palette[i].ch.green = (uint8_t)(255 - i * 60);
+        palette[i].ch.blue = 0x40;
+        palette[i].ch.alpha = LV_OPA_COVER;
+    }
+    for(i = 4 * sizeof(lv_color32_t); i < sizeof(indexed_data); i++) indexed_data[i] = (uint8_t)(i * 37);
+    for(i = 0; i < sizeof(alpha_data); i++) alpha_data[i] = (uint8_t)(i * 13);
+
+    for(i = 0; i < sizeof(indexed_imgs) / sizeof(indexed_imgs[0]); i++) {
+        indexed_imgs[i].header.cf = LV_IMG_CF_INDEXED_2BIT;
+        indexed_imgs[i].header.w = CONV_SIZE;
+        indexed_imgs[i].header.h = CONV_SIZE;
+        indexed_imgs[i].data_size = sizeof(indexed_data);
+        indexed_imgs[i].data = indexed_data;
+    }
+
+    for(i = 0; i < sizeof(alpha_imgs) / sizeof(alpha_imgs[0]); i++) {
+        alpha_imgs[i].header.cf = LV_IMG_CF_ALPHA_4BIT;
+        alpha_imgs[i].header.w = CONV_SIZE;
+        alpha_imgs[i].header.h = CONV_ALPHA_H;
+        alpha_imgs[i].data_size = sizeof(alpha_data);
+        alpha_imgs[i].data = alpha_data;
+    }
+
+    lv_img_cache_entry_t * e = _lv_img_cache_open(&indexed_imgs[0], LV_COLOR_BLACK);
+    lv_test_assert_true(e->dec_dsc.img_data != NULL, "The indexed image is converted");
+    lv_test_assert_int_eq(LV_IMG_CF_TRUE_COLOR, e->dec_dsc.header.cf, "Opaque palette is converted to true color");
+    lv_test_assert_true(same_as_decoded(e, &indexed_imgs[0], LV_COLOR_BLACK), "Same pixels as decoded");
+
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    uint32_t indexed_size = lv_img_buf_get_img_size(CONV_SIZE, CONV_SIZE, LV_IMG_CF_TRUE_COLOR);
+    lv_test_assert_int_eq(indexed_size, stat.conv_size, "Memory of the converted image");
+    lv_test_assert_int_eq(indexed_size, stat.used_size, "The converted image counts in the cache");
+
+    lv_img_cache_invalidate_src(&indexed_imgs[0]);
+    lv_img_cache_get_stat(&stat);
+    lv_test_assert_int_eq(0, stat.conv_size, "The converted image is freed");
+
+    /*A transparent palette color needs alpha byte*/
+    palette[3].ch.alpha = LV_OPA_50;
+    e = _lv_img_cache_open(&indexed_imgs[1], LV_COLOR_BLACK);
+    lv_test_assert_int_eq(LV_IMG_CF_TRUE_COLOR_ALPHA, e->dec_dsc.header.cf, "Converted to true color with alpha");
+    lv_test_assert_true(same_as_decoded(e, &indexed_imgs[1], LV_COLOR_BLACK), "Same pixels as decoded");
+    lv_img_cache_invalidate_src(&indexed_imgs[1]);
+
+    e = _lv_img_cache_open(&alpha_imgs[0], LV_COLOR_RED);
+    lv_test_assert_int_eq(LV_IMG_CF_TRUE_COLOR_ALPHA, e->dec_dsc.header.cf, "The alpha image is converted");
+    lv_test_assert_true(same_as_decoded(e, &alpha_imgs[0], LV_COLOR_RED), "Same pixels as decoded");
+    e = _lv_img_cache_open(&alpha_imgs[0], LV_COLOR_BLUE);
+    lv_test_assert_true(same_as_decoded(e, &alpha_imgs[0], LV_COLOR_BLUE), "Converted separately for every color");
+    lv_img_cache_invalidate_src(NULL);
+
+    /*Convert only until the memory limit*/
+    uint32_t conv_cnt = 0;
+    for(i = 0; i < sizeof(alpha_imgs) / sizeof(alpha_imgs[0]); i++) {
+        e = _lv_img_cache_open(&alpha_imgs[i], LV_COLOR_RED);
+        if(e->dec_dsc.img_data) conv_cnt++;
+        else lv_test_assert_true(same_as_decoded(e, &alpha_imgs[i], LV_COLOR_RED), "Not converted but still decoded");
+    }
+
+    lv_img_cache_get_stat(&stat);
+    uint32_t alpha_size = lv_img_buf_get_img_size(CONV_SIZE, CONV_ALPHA_H, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    lv_test_assert_int_eq(LV_IMG_CACHE_CONVERT_MEM_LIMIT / alpha_size, conv_cnt, "Converted until the limit");
+    lv_test_assert_int_lt(LV_IMG_CACHE_CONVERT_MEM_LIMIT + 1, stat.conv_size, "The converted images fit");
+
+    /*Too large image*/
+    lv_img_cache_invalidate_src(NULL);
+    alpha_imgs[0].header.h = CONV_ALPHA_H + 1;
+    e = _lv_img_cache_open(&alpha_imgs[0], LV_COLOR_RED);
+    lv_test_assert_ptr_eq(NULL, e->dec_dsc.img_data, "Too large image is not converted");
+
+    lv_img_cache_invalidate_src(NULL);
+}
+
+/**
+ * Compare the pixels of a converted entry with the lines decoded by the built-in decoder.
+ */
+static bool same_as_decoded(const lv_img_cache_entry_t * entry, const void * src, lv_color_t color)
+{
+    lv_img_decoder_dsc_t dsc;
+    if(lv_img_decoder_open(&dsc, src, color) != LV_RES_OK) return false;
+
+    bool same = true;
+    bool alpha = lv_img_cf_has_alpha(entry->dec_dsc.header.cf);
+    uint8_t px_size = alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    uint8_t line[CONV_SIZE * LV_IMG_PX_SIZE_ALPHA_BYTE];
+    uint8_t line_cached[CONV_SIZE * LV_IMG_PX_SIZE_ALPHA_BYTE];
+    lv_coord_t y;
+    for(y = 0; y < dsc.header.h && same; y++) {
+        lv_img_decoder_read_line(&dsc, 0, y, dsc.header.w, line);
+
+        /*Not converted: it's decoded by the cached decoder too*/
+        if(entry->dec_dsc.img_data == NULL) {
+            lv_img_decoder_read_line((lv_img_decoder_dsc_t *)&entry->dec_dsc, 0, y, dsc.header.w, line_cached);
+        }
+        else {
+            _lv_memcpy(line_cached, &entry->dec_dsc.img_data[y * dsc.header.w * px_size], dsc.header.w * px_size);
+        }
+
+        lv_coord_t x;
+        for(x = 0; x < dsc.header.w; x++) {
+            uint8_t * px = &line[x * LV_IMG_PX_SIZE_ALPHA_BYTE];
+            uint8_t * px_cached = &line_cached[x * px_size];
+            lv_opa_t opa = px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+            if(alpha && opa != px_cached[LV_IMG_PX_SIZE_ALPHA_BYTE - 1]) same = false;
+            if(!alpha && opa != LV_OPA_COVER) same = false;
+            if(opa && memcmp(px, px_cached, LV_IMG_PX_SIZE_ALPHA_BYTE - 1)) same = false;
+        }
+    }
+
+    lv_img_decoder_close(&dsc);
+    return same;
+}
+#endif
+
+static lv_res_t test_info_cb(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(decoder);
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return LV_RES_INV;
+
+    const lv_img_dsc_t * img_dsc = src;
+    if(img_dsc->header.cf != LV_IMG_CF_USER_ENCODED_0) return LV_RES_INV;
+
+    header->w = img_dsc->header.w;
+    header->h = img_dsc->header.h;
+    header->cf = LV_IMG_CF_TRUE_COLOR;
+    return LV_RES_OK;
+}
+
+static lv_res_t test_open_cb(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    uint32_t size = lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf);
+    uint8_t * buf = lv_mem_alloc(size);
+    if(buf == NULL) return LV_RES_INV;
+    _lv_memset_00(buf, size);
+    dsc->img_data = buf;
+
+    /*The first image is slow to open so it's more valuable to keep*/
+    dsc->time_to_open = dsc->src == &imgs[0] ? 10 : 1;
+    open_cnt++;
+    return LV_RES_OK;
+}
+
+static void test_close_cb(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    lv_mem_free(dsc->img_data);
+    dsc->img_data = NULL;
+    close_cnt++;
+}
+#endif
+
+#endif
@@ -0,0 +1,368 @@
+/**
+ * @file lv_test_img_decoder.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_img_decoder.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define IMG_W   16
+#define IMG_H   40
+#define WIDE_W  1000    /*WIDE_W * WIDE_H doesn't fit into `lv_coord_t`*/
+#define WIDE_H  33
+#define PAL_SIZE    16  /*Palette of 4 bit indexed images*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const uint8_t * data;
+    uint32_t size;
+    uint32_t pos;
+} ram_file_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_FILESYSTEM
+static void true_color_file(void);
+static void wide_file(void);
+static void alpha_file(void);
+static void indexed_file(void);
+static lv_fs_res_t ram_open_cb(lv_fs_drv_t * drv, void * file_p, const char * path, lv_fs_mode_t mode);
+static lv_fs_res_t ram_close_cb(lv_fs_drv_t * drv, void * file_p);
+static lv_fs_res_t ram_read_cb(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br);
+static lv_fs_res_t ram_seek_cb(lv_fs_drv_t * drv, void * file_p, uint32_t pos);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_FILESYSTEM
+static uint8_t true_color_img[4 + IMG_W * IMG_H * sizeof(lv_color_t)];
+static uint8_t alpha_img[4 + (IMG_W / 2) * IMG_H];
+static uint8_t indexed_img[4 + PAL_SIZE * sizeof(lv_color32_t) + (IMG_W / 2) * IMG_H];
+static uint8_t wide_img[4 + WIDE_W * WIDE_H * sizeof(lv_color_t)];
+static lv_color_t wide_stripe[WIDE_W * WIDE_H];
+static uint32_t read_cnt;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_img_decoder(void)
+{
+#if LV_USE_FILESYSTEM
+    lv_test_print("");
+    lv_test_print("==========================");
+    lv_test_print("Start lv_img_decoder tests");
+    lv_test_print("==========================");
+
+    static bool drv_registered = false;
+    if(drv_registered == false) {
+        lv_fs_drv_t drv;
+        lv_fs_drv_init(&drv);
+        drv.letter = 'R';
+        drv.file_size = sizeof(ram_file_t);
+        drv.open_cb = ram_open_cb;
+        drv.close_cb = ram_close_cb;
+        drv.read_cb = ram_read_cb;
+        drv.seek_cb = ram_seek_cb;
+        lv_fs_drv_register(&drv);
+        drv_registered = true;
+    }
+
+    true_color_file();
+    wide_file();
+    alpha_file();
+    indexed_file();
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_FILESYSTEM
+static void true_color_file(void)
+{
+    lv_test_print("");
+    lv_test_print("Read the lines of a true color file:");
+    lv_test_print("------------------------------------");
+
+    lv_img_header_t header;
+    _lv_memset_00(&header, sizeof(header));
+    header.cf = LV_IMG_CF_TRUE_COLOR;
+    header.w = IMG_W;
+    header.h = IMG_H;
+    _lv_memcpy(true_color_img, &header, sizeof(header));
+
+    lv_color_t * px = (lv_color_t *)&true_color_img[4];
+    uint32_t i;
+    for(i = 0; i < IMG_W * IMG_H; i++) {
+        px[i] = lv_color_make(i & 0xFF, (i >> 2) & 0xFF, (i * 3) & 0xFF);
+    }
+
+    lv_img_decoder_dsc_t dsc;
+    lv_res_t res = lv_img_decoder_open(&dsc, "R:tc.bin", LV_COLOR_BLACK);
+    lv_test_assert_int_eq(LV_RES_OK, res, "The file is opened");
+    if(res != LV_RES_OK) return;
+
+    lv_color_t line[IMG_W];
+    bool ok = true;
+    read_cnt = 0;
+    int32_t y;
+    for(y = 0; y < IMG_H; y++) {
+        res = lv_img_decoder_read_line(&dsc, 2, y, IMG_W - 4, (uint8_t *)line);
+        if(res != LV_RES_OK || memcmp(line, &px[y * IMG_W + 2], (IMG_W - 4) * sizeof(lv_color_t))) ok = false;
+    }
+    lv_test_assert_true(ok, "The lines are read correctly");
+#if LV_IMG_READ_BUF_SIZE
+    lv_test_assert_int_lt(IMG_H / 4, read_cnt, "The lines are read ahead in blocks");
+#endif
+
+    lv_color_t * stripe = lv_mem_alloc(IMG_W * IMG_H * sizeof(lv_color_t));
+    LV_ASSERT_MEM(stripe);
+    res = lv_img_decoder_read_lines(&dsc, 0, 3, IMG_W, IMG_H - 3, (uint8_t *)stripe);
+    lv_test_assert_int_eq(LV_RES_OK, res, "Full width stripe read");
+    lv_test_assert_array_eq((uint8_t *)&px[3 * IMG_W], (uint8_t *)stripe, IMG_W * (IMG_H - 3) * sizeof(lv_color_t),
+                            "Full width stripe data");
+
+    res = lv_img_decoder_read_lines(&dsc, 5, 10, 4, 6, (uint8_t *)stripe);
+    ok = res == LV_RES_OK;
+    for(y = 0; y < 6; y++) {
+        if(memcmp(&stripe[y * 4], &px[(10 + y) * IMG_W + 5], 4 * sizeof(lv_color_t))) ok = false;
+    }
+    lv_test_assert_true(ok, "Partial stripe data");
+
+    res = lv_img_decoder_read_line(&dsc, 0, IMG_H, IMG_W, (uint8_t *)line);
+    lv_test_assert_int_eq(LV_RES_INV, res, "Reading after the last line fails");
+
+    lv_mem_free(stripe);
+    lv_img_decoder_close(&dsc);
+
+    /*Draw it to read it in stripes*/
+    lv_obj_t * img = lv_img_create(lv_scr_act(), NULL);
+    lv_img_set_src(img, "R:tc.bin");
+    read_cnt = 0;
+    lv_refr_now(NULL);
+    lv_test_assert_int_gt(0, read_cnt, "The image is drawn from the file");
+#if LV_IMG_READ_BUF_SIZE
+    lv_test_assert_int_lt(IMG_H / 4, read_cnt, "The image is read in stripes");
+#endif
+    lv_obj_del(img);
+    lv_img_cache_invalidate_src(NULL);
+}
+
+static void wide_file(void)
+{
+    lv_test_print("");
+    lv_test_print("Read a stripe with more than LV_COORD_MAX pixels:");
+    lv_test_print("-------------------------------------------------");
+
+    lv_img_header_t header;
+    _lv_memset_00(&header, sizeof(header));
+    header.cf = LV_IMG_CF_TRUE_COLOR;
+    header.w = WIDE_W;
+    header.h = WIDE_H;
+    _lv_memcpy(wide_img, &header, sizeof(header));
+
+    lv_color_t * px = (lv_color_t *)&wide_img[4];
+    uint32_t i;
+    for(i = 0; i < WIDE_W * WIDE_H; i++) {
+        px[i] = lv_color_make(i & 0xFF, (i >> 8) & 0xFF, (i >> 3) & 0xFF);
+    }
+
+    lv_img_decoder_dsc_t dsc;
+    lv_res_t res = lv_img_decoder_open(&dsc, "R:wide.bin", LV_COLOR_BLACK);
+    lv_test_assert_int_eq(LV_RES_OK, res, "The file is opened");
+    if(res != LV_RES_OK) return;
+
+    res = lv_img_decoder_read_lines(&dsc, 0, 0, WIDE_W, WIDE_H, (uint8_t *)wide_stripe);
+    lv_test_assert_int_eq(LV_RES_OK, res, "Full width stripe read");
+    lv_test_assert_array_eq((uint8_t *)px, (uint8_t *)wide_stripe, sizeof(wide_stripe), "Full width stripe data");
+
+    lv_img_decoder_close(&dsc);
+}
+
+static void alpha_file(void)
+{
+#if LV_IMG_CF_ALPHA
+    lv_test_print("");
+    lv_test_print("Read the lines of an alpha file:");
+    lv_test_print("--------------------------------");
+
+    lv_img_header_t header;
+    _lv_memset_00(&header, sizeof(header));
+    header.cf = LV_IMG_CF_ALPHA_4BIT;
+    header.w = IMG_W;
+    header.h = IMG_H;
+    _lv_memcpy(alpha_img, &header, sizeof(header));
+
+    uint32_t i;
+    for(i = 0; i < (IMG_W / 2) * IMG_H; i++) {
+        alpha_img[4 + i] = (uint8_t)(i * 7);
+    }
+
+    lv_img_decoder_dsc_t dsc;
+    lv_res_t res = lv_img_decoder_open(&dsc, "R:alpha.bin", LV_COLOR_BLACK);
+    lv_test_assert_int_eq(LV_RES_OK, res, "The file is opened");
+    if(res != LV_RES_OK) return;
+
+    uint8_t line[IMG_W * LV_IMG_PX_SIZE_ALPHA_BYTE];
+    bool ok = true;
+    int32_t y;
+    for(y = 0; y < IMG_H; y++) {
+        /*Start and end in the middle of a byte. The last line mustn't be read over the end of the file*/
+        res = lv_img_decoder_read_line(&dsc, 3, y, IMG_W - 4, line);
+        if(res != LV_RES_OK) ok = false;
+
+        int32_t x;
+        for(x = 3; x < IMG_W - 1; x++) {
+            uint8_t byte = alpha_img[4 + y * (IMG_W / 2) + x / 2];
+            uint8_t a4 = (x & 1) ? (byte & 0xF) : (byte >> 4);
+            if(line[(x - 3) * LV_IMG_PX_SIZE_ALPHA_BYTE + LV_IMG_PX_SIZE_ALPHA_BYTE - 1] != a4 * 17) ok = false;
+        }
+    }
+    lv_test_assert_true(ok, "The lines are read correctly");
+
+    lv_img_decoder_close(&dsc);
+#endif
+}
+
+static void indexed_file(void)
+{
+#if LV_IMG_CF_INDEXED
+    lv_test_print("");
+    lv_test_print("Read the palette of an indexed file:");
+    lv_test_print("------------------------------------");
+
+    lv_img_header_t header;
+    _lv_memset_00(&header, sizeof(header));
+    header.cf = LV_IMG_CF_INDEXED_4BIT;
+    header.w = IMG_W;
+    header.h = IMG_H;
+    _lv_memcpy(indexed_img, &header, sizeof(header));
+
+    lv_color32_t * palette = (lv_color32_t *)&indexed_img[4];
+    uint32_t i;
+    for(i = 0; i < PAL_SIZE; i++) {
+        palette[i].ch.red = (uint8_t)(i * 16);
+        palette[i].ch.green = (uint8_t)(255 - i * 16);
+        palette[i].ch.blue = (uint8_t)(i * 5);
+        palette[i].ch.alpha = (uint8_t)(i * 17);
+    }
+
+    uint8_t * data = &indexed_img[4 + PAL_SIZE * sizeof(lv_color32_t)];
+    for(i = 0; i < (IMG_W / 2) * IMG_H; i++) {
+        data[i] = (uint8_t)(i * 13);
+    }
+
+    lv_img_decoder_dsc_t dsc;
+    lv_res_t res = lv_img_decoder_open(&dsc, "R:idx.bin", LV_COLOR_BLACK);
+    lv_test_assert_int_eq(LV_RES_OK, res, "The file is opened");
+    if(res != LV_RES_OK) return;
+
+    uint8_t line[IMG_W * LV_IMG_PX_SIZE_ALPHA_BYTE];
+    bool ok = true;
+    int32_t y;
+    for(y = 0; y < IMG_H; y++) {
+        res = lv_img_decoder_read_line(&dsc, 0, y, IMG_W, line);
+        if(res != LV_RES_OK) ok = false;
+
+        int32_t x;
+        for(x = 0; x < IMG_W; x++) {
+            uint8_t byte = data[y * (IMG_W / 2) + x / 2];
+            uint8_t id = (x & 1) ? (byte & 0xF) : (byte >> 4);
+            lv_color_t c = lv_color_make(palette[id].ch.red, palette[id].ch.green, palette[id].ch.blue);
+            uint8_t * px = &line[x * LV_IMG_PX_SIZE_ALPHA_BYTE];
+            if(memcmp(px, &c, LV_IMG_PX_SIZE_ALPHA_BYTE - 1)) ok = false;
+            if(px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] != palette[id].ch.alpha) ok = false;
+        }
+    }
+    lv_test_assert_true(ok, "The palette is read correctly");
+
+    lv_img_decoder_close(&dsc);
+
+    res = lv_img_decoder_open(&dsc, "R:idx_short.bin", LV_COLOR_BLACK);
+    lv_test_assert_int_eq(LV_RES_INV, res, "A file with a truncated palette is not opened");
+#endif
+}
+
+static lv_fs_res_t ram_open_cb(lv_fs_drv_t * drv, void * file_p, const char * path, lv_fs_mode_t mode)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(mode);
+    ram_file_t * f = file_p;
+    if(strcmp(path, "tc.bin") == 0) {
+        f->data = true_color_img;
+        f->size = sizeof(true_color_img);
+    }
+    else if(strcmp(path, "wide.bin") == 0) {
+        f->data = wide_img;
+        f->size = sizeof(wide_img);
+    }
+    else if(strcmp(path, "alpha.bin") == 0) {
+        f->data = alpha_img;
+        f->size = sizeof(alpha_img);
+    }
+    else if(strcmp(path, "idx.bin") == 0) {
+        f->data = indexed_img;
+        f->size = sizeof(indexed_img);
+    }
+    else if(strcmp(path, "idx_short.bin") == 0) {
+        /*The file ends in the middle of the palette*/
+        f->data = indexed_img;
+        f->size = 4 + (PAL_SIZE / 2) * sizeof(lv_color32_t);
+    }
+    else {
+        return LV_FS_RES_NOT_EX;
+    }
+
+    f->pos = 0;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t ram_close_cb(lv_fs_drv_t * drv, void * file_p)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t ram_read_cb(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    LV_UNUSED(drv);
+    ram_file_t * f = file_p;
+    if(f->pos + btr > f->size) btr = f->size > f->pos ? f->size - f->pos : 0;
+    _lv_memcpy(buf, f->data + f->pos, btr);
+    f->pos += btr;
+    if(br) *br = btr;
+    read_cnt++;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t ram_seek_cb(lv_fs_drv_t * drv, void * file_p, uint32_t pos)
+{
+    LV_UNUSED(drv);
+    ram_file_t * f = file_p;
+    f->pos = pos;
+    return LV_FS_RES_OK;
+}
+#endif
+
+#endif
@@ -0,0 +1,216 @@
+/**
+ * @file lv_test_img_trans_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_img_trans_cache.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define IMG_W   40
+#define IMG_H   30
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_IMG && LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_MEM
+static void reuse(void);
+static void same_pixels(void);
+static void budget(void);
+static void refr_scr(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_IMG && LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_MEM
+static uint8_t img_data[IMG_W * IMG_H * LV_IMG_PX_SIZE_ALPHA_BYTE];
+static lv_img_dsc_t img_dsc;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_img_trans_cache(void)
+{
+#if LV_USE_IMG && LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_MEM
+    lv_test_print("");
+    lv_test_print("==============================");
+    lv_test_print("Start lv_img_trans_cache tests");
+    lv_test_print("==============================");
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            uint8_t * p = &img_data[(y * IMG_W + x) * LV_IMG_PX_SIZE_ALPHA_BYTE];
+            lv_color_t c = lv_color_make(x * 6, y * 8, 0x80);
+            _lv_memcpy_small(p, &c, LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+            p[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = (x + y) & 1 ? LV_OPA_COVER : LV_OPA_50;
+        }
+    }
+
+    img_dsc.header.always_zero = 0;
+    img_dsc.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    img_dsc.header.w = IMG_W;
+    img_dsc.header.h = IMG_H;
+    img_dsc.data_size = sizeof(img_data);
+    img_dsc.data = img_data;
+
+    reuse();
+    same_pixels();
+    budget();
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_IMG && LV_USE_IMG_TRANSFORM && LV_IMG_TRANSFORM_CACHE_MEM
+static void reuse(void)
+{
+    lv_test_print("");
+    lv_test_print("Reuse the snapshot of a transformed image:");
+    lv_test_print("------------------------------------------");
+
+    lv_img_trans_cache_invalidate_src(NULL);
+    lv_img_trans_cache_reset_stat();
+
+    lv_obj_t * img = lv_img_create(lv_scr_act(), NULL);
+    lv_img_set_src(img, &img_dsc);
+    lv_obj_set_pos(img, 100, 100);
+    lv_img_set_angle(img, 300);
+    lv_img_set_transform_cache(img, true);
+    lv_test_assert_true(lv_img_get_transform_cache(img), "Snapshot cache enabled");
+
+    lv_img_trans_cache_stat_t stat;
+    refr_scr();
+    lv_img_trans_cache_get_stat(&stat);
+    lv_test_assert_int_eq(1, stat.miss_cnt, "Snapshot rendered on the first draw");
+    lv_test_assert_int_eq(1, stat.entry_cnt, "One snapshot cached");
+    lv_test_assert_int_gt(0, stat.used_size, "The snapshot uses memory");
+
+    refr_scr();
+    lv_img_trans_cache_get_stat(&stat);
+    lv_test_assert_int_eq(1, stat.miss_cnt, "Not rendered again");
+    lv_test_assert_int_gt(0, stat.hit_cnt, "Redrawn from the snapshot");
+
+    lv_img_set_angle(img, 600);
+    refr_scr();
+    lv_img_trans_cache_get_stat(&stat);
+    lv_test_assert_int_eq(2, stat.miss_cnt, "Rendered again with a new angle");
+    lv_test_assert_int_eq(2, stat.entry_cnt, "The old snapshot is kept until evicted");
+
+    lv_img_trans_cache_invalidate_src(&img_dsc);
+    lv_img_trans_cache_get_stat(&stat);
+    lv_test_assert_int_eq(0, stat.entry_cnt, "Snapshots of the source invalidated");
+    lv_test_assert_int_eq(0, stat.used_size, "No memory used after invalidation");
+
+    lv_obj_del(img);
+}
+
+static void same_pixels(void)
+{
+    lv_test_print("");
+    lv_test_print("Draw the same pixels from the snapshot:");
+    lv_test_print("---------------------------------------");
+
+    extern lv_color_t test_fb[];
+    uint32_t fb_size = LV_HOR_RES_MAX * LV_VER_RES_MAX * sizeof(lv_color_t);
+    uint8_t * ref_fb = lv_mem_alloc(fb_size);
+    LV_ASSERT_MEM(ref_fb);
+    if(ref_fb == NULL) return;
+
+    lv_obj_t * img = lv_img_create(lv_scr_act(), NULL);
+    lv_img_set_src(img, &img_dsc);
+    lv_obj_set_pos(img, 100, 100);
+    lv_img_set_pivot(img, 10, 5);
+
+    static const int16_t angles[] = {0, 450, 900, 1234};
+    static const uint16_t zooms[] = {384, LV_IMG_ZOOM_NONE, LV_IMG_ZOOM_NONE, 200};
+    uint32_t i;
+    for(i = 0; i < sizeof(angles) / sizeof(angles[0]); i++) {
+        lv_img_set_angle(img, angles[i]);
+        lv_img_set_zoom(img, zooms[i]);
+
+        lv_img_set_transform_cache(img, false);
+        refr_scr();
+        _lv_memcpy(ref_fb, test_fb, fb_size);
+
+        lv_img_set_transform_cache(img, true);
+        refr_scr();
+        lv_test_assert_array_eq(ref_fb, (uint8_t *)test_fb, fb_size, "Same pixels with and without snapshot");
+    }
+
+    lv_obj_del(img);
+    lv_mem_free(ref_fb);
+    lv_img_trans_cache_invalidate_src(NULL);
+}
+
+static void budget(void)
+{
+    lv_test_print("");
+    lv_test_print("Keep the snapshots within the memory budget:");
+    lv_test_print("--------------------------------------------");
+
+    lv_img_trans_cache_invalidate_src(NULL);
+    lv_img_trans_cache_reset_stat();
+
+    lv_obj_t * img = lv_img_create(lv_scr_act(), NULL);
+    lv_img_set_src(img, &img_dsc);
+    lv_img_set_transform_cache(img, true);
+
+    lv_img_trans_cache_stat_t stat;
+    int16_t angle;
+    for(angle = 100; angle < 3600; angle += 100) {
+        lv_img_set_angle(img, angle);
+        refr_scr();
+        lv_img_trans_cache_get_stat(&stat);
+        if(stat.used_size > LV_IMG_TRANSFORM_CACHE_MEM) break;
+    }
+    lv_test_assert_int_lt(LV_IMG_TRANSFORM_CACHE_MEM + 1, stat.used_size, "The snapshots fit into the budget");
+    lv_test_assert_int_gt(0, stat.evict_cnt, "The least recently used snapshots are evicted");
+
+    /*The most recent one is still cached*/
+    uint32_t miss_cnt = stat.miss_cnt;
+    refr_scr();
+    lv_img_trans_cache_get_stat(&stat);
+    lv_test_assert_int_eq(miss_cnt, stat.miss_cnt, "The most recent snapshot is kept");
+
+    /*A snapshot larger than the budget is not cached but the image is still drawn*/
+    lv_img_trans_cache_invalidate_src(NULL);
+    lv_img_set_angle(img, 0);
+    lv_img_set_zoom(img, 256 * 8);
+    refr_scr();
+    lv_img_trans_cache_get_stat(&stat);
+    lv_test_assert_int_eq(0, stat.entry_cnt, "Too large snapshot is not cached");
+
+    lv_obj_del(img);
+}
+
+static void refr_scr(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+#endif
+
+#endif
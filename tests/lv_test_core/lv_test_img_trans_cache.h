@@ -0,0 +1,38 @@
+/**
+ * @file lv_test_img_trans_cache.h
+ *
+ */
+
+#ifndef LV_TEST_IMG_TRANS_CACHE_H
+#define LV_TEST_IMG_TRANS_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void lv_test_img_trans_cache(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_IMG_TRANS_CACHE_H*/
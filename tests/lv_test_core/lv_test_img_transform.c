@@ -0,0 +1,345 @@
+/**
+ * @file lv_test_img_transform.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_img_transform.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define IMG_W   20
+#define IMG_H   14
+#define LINE_MAX    128
+#define BENCH_PX    2000000  /*Number of pixels to transform in a benchmark run*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t px_cnt;        /*Number of pixels covered by both paths*/
+    uint32_t cover_diff;    /*Number of pixels covered by only one of the paths*/
+    uint32_t sum_diff;      /*Sum of the color channel differences*/
+    uint32_t max_diff;      /*The largest color channel difference*/
+} cmp_res_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_IMG_TRANSFORM
+static void zoom(void);
+static void rotate(void);
+static void affine(void);
+static void fallback(void);
+static void benchmark(void);
+static void bench_run(int16_t angle, uint16_t zoom, bool aa);
+static void fill_img(uint8_t * buf, lv_img_cf_t cf);
+static void trans_init(lv_img_transform_dsc_t * dsc, lv_img_cf_t cf, int16_t angle, uint16_t zoom, bool aa);
+static void compare(lv_img_transform_dsc_t * dsc, cmp_res_t * res);
+static uint32_t color_diff(lv_color_t c1, lv_color_t c2);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_IMG_TRANSFORM
+static uint8_t img_true_color[IMG_W * IMG_H * sizeof(lv_color_t)];
+static uint8_t img_alpha[IMG_W * IMG_H * LV_IMG_PX_SIZE_ALPHA_BYTE];
+static lv_img_transform_dsc_t trans_dsc;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_img_transform(void)
+{
+#if LV_USE_IMG_TRANSFORM
+    lv_test_print("");
+    lv_test_print("============================");
+    lv_test_print("Start lv_img_transform tests");
+    lv_test_print("============================");
+
+    fill_img(img_true_color, LV_IMG_CF_TRUE_COLOR);
+    fill_img(img_alpha, LV_IMG_CF_TRUE_COLOR_ALPHA);
+
+    zoom();
+    rotate();
+    affine();
+    fallback();
+    benchmark();
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_IMG_TRANSFORM
+static void zoom(void)
+{
+    lv_test_print("");
+    lv_test_print("Compare the zoom kernels with the generic transformation:");
+    lv_test_print("---------------------------------------------------------");
+
+    lv_img_transform_dsc_t * dsc = &trans_dsc;
+    cmp_res_t res;
+
+    trans_init(dsc, LV_IMG_CF_TRUE_COLOR, 0, 512, false);
+    lv_test_assert_int_eq(LV_IMG_TRANSFORM_LINE_ZOOM, dsc->tmp.line_kernel, "Zoom kernel selected");
+    compare(dsc, &res);
+    lv_test_assert_int_eq(0, res.cover_diff, "2x integer zoom: same coverage");
+    lv_test_assert_int_eq(0, res.max_diff, "2x integer zoom: same pixels");
+
+    trans_init(dsc, LV_IMG_CF_TRUE_COLOR_ALPHA, 0, 384, false);
+    compare(dsc, &res);
+    lv_test_assert_int_eq(0, res.cover_diff, "1.5x nearest zoom: same coverage");
+    lv_test_assert_int_eq(0, res.max_diff, "1.5x nearest zoom: same pixels");
+
+    trans_init(dsc, LV_IMG_CF_TRUE_COLOR_ALPHA, 0, 160, false);
+    compare(dsc, &res);
+    lv_test_assert_int_eq(0, res.cover_diff, "0.6x nearest zoom: same coverage");
+    lv_test_assert_int_eq(0, res.max_diff, "0.6x nearest zoom: same pixels");
+
+    trans_init(dsc, LV_IMG_CF_TRUE_COLOR, 0, 384, true);
+    compare(dsc, &res);
+    lv_test_assert_int_eq(0, res.cover_diff, "1.5x bilinear zoom: same coverage");
+    lv_test_assert_int_lt(4, res.sum_diff / res.px_cnt, "1.5x bilinear zoom: small average difference");
+    lv_test_assert_int_lt(16, res.max_diff, "1.5x bilinear zoom: small maximal difference");
+
+    trans_init(dsc, LV_IMG_CF_TRUE_COLOR_ALPHA, 0, 170, true);
+    compare(dsc, &res);
+    lv_test_assert_int_eq(0, res.cover_diff, "0.66x bilinear zoom: same coverage");
+    lv_test_assert_int_lt(4, res.sum_diff / res.px_cnt, "0.66x bilinear zoom: small average difference");
+    lv_test_assert_int_lt(16, res.max_diff, "0.66x bilinear zoom: small maximal difference");
+}
+
+static void rotate(void)
+{
+    lv_test_print("");
+    lv_test_print("Compare the rotation kernels with the generic transformation:");
+    lv_test_print("-------------------------------------------------------------");
+
+    static const int16_t angles[] = {900, 1800, 2700};
+    static const lv_img_transform_line_t kernels[] = {LV_IMG_TRANSFORM_LINE_ROT90, LV_IMG_TRANSFORM_LINE_ROT180,
+                                                      LV_IMG_TRANSFORM_LINE_ROT270
+                                                     };
+
+    uint32_t i;
+    for(i = 0; i < sizeof(angles) / sizeof(angles[0]); i++) {
+        lv_img_transform_dsc_t * dsc = &trans_dsc;
+        cmp_res_t res;
+        trans_init(dsc, LV_IMG_CF_TRUE_COLOR_ALPHA, angles[i], LV_IMG_ZOOM_NONE, false);
+        lv_test_assert_int_eq(kernels[i], dsc->tmp.line_kernel, "Rotation kernel selected");
+
+        /*The generic path's sine table is not exact (0.999) so it can be off by one pixel*/
+        compare(dsc, &res);
+        lv_test_assert_int_lt(2 * (IMG_W + IMG_H), res.cover_diff, "Right angle rotation: similar coverage");
+        lv_test_assert_int_lt(12, res.sum_diff / res.px_cnt, "Right angle rotation: small average difference");
+    }
+}
+
+static void affine(void)
+{
+    lv_test_print("");
+    lv_test_print("Compare the affine kernel with the generic transformation:");
+    lv_test_print("----------------------------------------------------------");
+
+    static const int16_t angles[] = {300, 450, 1234, 3150};
+    static const uint16_t zooms[] = {LV_IMG_ZOOM_NONE, 384, 200};
+
+    uint32_t a;
+    uint32_t z;
+    for(a = 0; a < sizeof(angles) / sizeof(angles[0]); a++) {
+        for(z = 0; z < sizeof(zooms) / sizeof(zooms[0]); z++) {
+            lv_img_transform_dsc_t * dsc = &trans_dsc;
+            cmp_res_t res;
+            trans_init(dsc, LV_IMG_CF_TRUE_COLOR_ALPHA, angles[a], zooms[z], false);
+            lv_test_assert_int_eq(LV_IMG_TRANSFORM_LINE_AFFINE, dsc->tmp.line_kernel, "Affine kernel selected");
+
+            /*The kernel steps with more fractional bits so only the rounding at the edges might differ*/
+            compare(dsc, &res);
+            lv_test_assert_int_lt(IMG_W + IMG_H, res.cover_diff, "Nearest affine: similar coverage");
+            lv_test_assert_int_lt(4, res.sum_diff / res.px_cnt, "Nearest affine: small average difference");
+
+            trans_init(dsc, LV_IMG_CF_TRUE_COLOR, angles[a], zooms[z], true);
+            compare(dsc, &res);
+            lv_test_assert_int_lt(IMG_W + IMG_H, res.cover_diff, "Bilinear affine: similar coverage");
+            lv_test_assert_int_lt(6, res.sum_diff / res.px_cnt, "Bilinear affine: small average difference");
+        }
+    }
+}
+
+static void fallback(void)
+{
+    lv_test_print("");
+    lv_test_print("Use the generic transformation for non-native formats:");
+    lv_test_print("------------------------------------------------------");
+
+    lv_img_transform_dsc_t * dsc = &trans_dsc;
+    trans_init(dsc, LV_IMG_CF_ALPHA_8BIT, 0, 512, true);
+    lv_test_assert_int_eq(LV_IMG_TRANSFORM_LINE_NONE, dsc->tmp.line_kernel, "No kernel for zoomed alpha image");
+
+    trans_init(dsc, LV_IMG_CF_INDEXED_4BIT, 450, LV_IMG_ZOOM_NONE, true);
+    lv_test_assert_int_eq(LV_IMG_TRANSFORM_LINE_NONE, dsc->tmp.line_kernel, "No kernel for rotated indexed image");
+}
+
+static void benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Measure the time of transforming a pixel:");
+    lv_test_print("-----------------------------------------");
+
+    bench_run(0, 384, true);
+    bench_run(900, LV_IMG_ZOOM_NONE, false);
+    bench_run(300, LV_IMG_ZOOM_NONE, false);
+    bench_run(300, LV_IMG_ZOOM_NONE, true);
+    bench_run(450, 200, true);
+    bench_run(1234, 512, true);
+}
+
+static void bench_run(int16_t angle, uint16_t zoom, bool aa)
+{
+    lv_img_transform_dsc_t * dsc = &trans_dsc;
+    trans_init(dsc, LV_IMG_CF_TRUE_COLOR_ALPHA, angle, zoom, aa);
+
+    lv_area_t area;
+    lv_point_t pivot = {dsc->cfg.pivot_x, dsc->cfg.pivot_y};
+    _lv_img_buf_get_transformed_area(&area, IMG_W, IMG_H, angle, zoom, &pivot);
+    lv_coord_t len = lv_area_get_width(&area);
+    if(len > LINE_MAX) len = LINE_MAX;
+    uint32_t px_per_round = len * lv_area_get_height(&area);
+    uint32_t rounds = BENCH_PX / px_per_round;
+
+    static lv_color_t cbuf[LINE_MAX];
+    static lv_opa_t abuf[LINE_MAX];
+    uint32_t r;
+    lv_coord_t x;
+    lv_coord_t y;
+
+    /*The LVGL tick is incremented manually so measure the real time with the system time*/
+    uint32_t t_start = custom_tick_get();
+    for(r = 0; r < rounds; r++) {
+        for(y = area.y1; y <= area.y2; y++) {
+            for(x = 0; x < len; x++) {
+                if(_lv_img_buf_transform(dsc, area.x1 + x, y)) {
+                    cbuf[x] = dsc->res.color;
+                    abuf[x] = dsc->res.opa;
+                }
+                else {
+                    abuf[x] = LV_OPA_TRANSP;
+                }
+            }
+        }
+    }
+    uint32_t t_generic = custom_tick_get() - t_start;
+
+    t_start = custom_tick_get();
+    for(r = 0; r < rounds; r++) {
+        for(y = area.y1; y <= area.y2; y++) {
+            _lv_img_buf_transform_line(dsc, area.x1, y, len, cbuf, abuf);
+        }
+    }
+    uint32_t t_line = custom_tick_get() - t_start;
+
+    uint64_t px_cnt = (uint64_t)rounds * px_per_round;
+    lv_test_print("angle %d, zoom %d, %s: generic %d ns / px, line kernel %d ns / px", angle, zoom,
+                  aa ? "bilinear" : "nearest",
+                  (int)(((uint64_t)t_generic * 1000000) / px_cnt), (int)(((uint64_t)t_line * 1000000) / px_cnt));
+}
+
+static void fill_img(uint8_t * buf, lv_img_cf_t cf)
+{
+    uint8_t px_size = cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            uint8_t * p = &buf[(y * IMG_W + x) * px_size];
+            lv_color_t c = lv_color_make(x * 12, y * 16, (x + y) * 6);
+            _lv_memcpy_small(p, &c, sizeof(lv_color_t));
+            if(cf == LV_IMG_CF_TRUE_COLOR_ALPHA) p[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = LV_OPA_COVER;
+        }
+    }
+}
+
+static void trans_init(lv_img_transform_dsc_t * dsc, lv_img_cf_t cf, int16_t angle, uint16_t zoom, bool aa)
+{
+    _lv_memset_00(dsc, sizeof(lv_img_transform_dsc_t));
+    dsc->cfg.src = cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? img_alpha : img_true_color;
+    dsc->cfg.src_w = IMG_W;
+    dsc->cfg.src_h = IMG_H;
+    dsc->cfg.pivot_x = IMG_W / 2;
+    dsc->cfg.pivot_y = IMG_H / 2;
+    dsc->cfg.angle = angle;
+    dsc->cfg.zoom = zoom;
+    dsc->cfg.cf = cf;
+    dsc->cfg.antialias = aa;
+    dsc->cfg.color = LV_COLOR_BLACK;
+    _lv_img_buf_transform_init(dsc);
+}
+
+/**
+ * Transform the whole image with the line kernel and with `_lv_img_buf_transform` and compare the results
+ */
+static void compare(lv_img_transform_dsc_t * dsc, cmp_res_t * res)
+{
+    _lv_memset_00(res, sizeof(cmp_res_t));
+
+    lv_area_t area;
+    lv_point_t pivot = {dsc->cfg.pivot_x, dsc->cfg.pivot_y};
+    _lv_img_buf_get_transformed_area(&area, IMG_W, IMG_H, dsc->cfg.angle, dsc->cfg.zoom, &pivot);
+    lv_coord_t len = lv_area_get_width(&area);
+    if(len > LINE_MAX) len = LINE_MAX;
+
+    static lv_color_t cbuf[LINE_MAX];
+    static lv_opa_t abuf[LINE_MAX];
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = area.y1; y <= area.y2; y++) {
+        _lv_img_buf_transform_line(dsc, area.x1, y, len, cbuf, abuf);
+        for(x = 0; x < len; x++) {
+            bool cover_ref = _lv_img_buf_transform(dsc, area.x1 + x, y) && dsc->res.opa > LV_OPA_MIN;
+            bool cover_act = abuf[x] > LV_OPA_MIN;
+            if(cover_ref != cover_act) {
+                res->cover_diff++;
+                continue;
+            }
+            if(cover_ref == false) continue;
+
+            uint32_t d = color_diff(dsc->res.color, cbuf[x]);
+            res->px_cnt++;
+            res->sum_diff += d;
+            if(d > res->max_diff) res->max_diff = d;
+        }
+    }
+
+    if(res->px_cnt == 0) res->px_cnt = 1;
+}
+
+static uint32_t color_diff(lv_color_t c1, lv_color_t c2)
+{
+    int32_t d = 0;
+    int32_t t;
+    t = (int32_t)LV_COLOR_GET_R(c1) - LV_COLOR_GET_R(c2);
+    d = LV_MATH_MAX(d, LV_MATH_ABS(t));
+    t = (int32_t)LV_COLOR_GET_G(c1) - LV_COLOR_GET_G(c2);
+    d = LV_MATH_MAX(d, LV_MATH_ABS(t));
+    t = (int32_t)LV_COLOR_GET_B(c1) - LV_COLOR_GET_B(c2);
+    d = LV_MATH_MAX(d, LV_MATH_ABS(t));
+    return d;
+}
+#endif
+
+#endif
@@ -0,0 +1,294 @@
+/**
+ * @file lv_test_layer_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_layer_cache.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define PANEL_W         240
+#define PANEL_H         160
+#define BENCH_FRAMES    40
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_LAYER_CACHE_MEM && LV_USE_BTN && LV_USE_LABEL
+static void reuse(void);
+static void same_pixels(void);
+static void budget(void);
+static void benchmark(void);
+static lv_obj_t * panel_create(lv_coord_t x, lv_coord_t y);
+static uint32_t move_overlay(lv_obj_t * overlay, uint32_t frame_cnt);
+static uint8_t max_diff(const lv_color_t * ref, const lv_color_t * act, uint32_t px_cnt);
+static void refr_scr(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_LAYER_CACHE_MEM && LV_USE_BTN && LV_USE_LABEL
+static lv_style_t panel_style;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_layer_cache(void)
+{
+#if LV_LAYER_CACHE_MEM && LV_USE_BTN && LV_USE_LABEL
+    lv_test_print("");
+    lv_test_print("===========================");
+    lv_test_print("Start lv_layer_cache tests");
+    lv_test_print("===========================");
+
+    lv_style_init(&panel_style);
+    lv_style_set_radius(&panel_style, LV_STATE_DEFAULT, 12);
+    lv_style_set_bg_color(&panel_style, LV_STATE_DEFAULT, LV_COLOR_NAVY);
+    lv_style_set_bg_grad_color(&panel_style, LV_STATE_DEFAULT, LV_COLOR_TEAL);
+    lv_style_set_bg_grad_dir(&panel_style, LV_STATE_DEFAULT, LV_GRAD_DIR_VER);
+    lv_style_set_border_width(&panel_style, LV_STATE_DEFAULT, 2);
+    lv_style_set_border_color(&panel_style, LV_STATE_DEFAULT, LV_COLOR_WHITE);
+    lv_style_set_shadow_width(&panel_style, LV_STATE_DEFAULT, 15);
+    lv_style_set_shadow_color(&panel_style, LV_STATE_DEFAULT, LV_COLOR_BLACK);
+
+    reuse();
+    same_pixels();
+    budget();
+    benchmark();
+
+    lv_style_reset(&panel_style);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_LAYER_CACHE_MEM && LV_USE_BTN && LV_USE_LABEL
+static void reuse(void)
+{
+    lv_test_print("");
+    lv_test_print("Reuse the layer of an object:");
+    lv_test_print("-----------------------------");
+
+    lv_layer_cache_stat_t stat;
+    lv_layer_cache_reset_stat();
+
+    lv_obj_t * panel = panel_create(40, 40);
+    lv_obj_set_layer_cache(panel, true);
+    lv_test_assert_true(lv_obj_get_layer_cache(panel), "Layer cache enabled");
+
+    refr_scr();
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(1, stat.miss_cnt, "Layer rendered on the first draw");
+    lv_test_assert_int_eq(1, stat.entry_cnt, "One layer cached");
+    lv_test_assert_int_gt(0, stat.used_size, "The layer uses memory");
+
+    /*An other object moving above the panel doesn't change the layer*/
+    lv_obj_t * overlay = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_set_size(overlay, 80, 80);
+    move_overlay(overlay, 5);
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(1, stat.miss_cnt, "Not rendered again for an other object");
+    lv_test_assert_int_gt(0, stat.hit_cnt, "Redrawn from the layer");
+
+    /*A changed child needs a new layer*/
+    lv_obj_t * btn = lv_obj_get_child(panel, NULL);
+    lv_label_set_text(lv_obj_get_child(btn, NULL), "Changed");
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(0, stat.entry_cnt, "Layer freed when a child is invalidated");
+    refr_scr();
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(2, stat.miss_cnt, "Rendered again with the changed child");
+
+    /*The layer moves with the object*/
+    lv_obj_set_pos(panel, 60, 50);
+    refr_scr();
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(3, stat.miss_cnt, "Rendered again after the object is moved");
+
+    lv_obj_set_layer_cache(panel, false);
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(0, stat.entry_cnt, "Layer freed when disabled");
+
+    lv_obj_set_layer_cache(panel, true);
+    refr_scr();
+    lv_obj_del(panel);
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(0, stat.entry_cnt, "Layer freed with the object");
+    lv_test_assert_int_eq(0, stat.used_size, "No memory used after delete");
+
+    lv_obj_del(overlay);
+}
+
+static void same_pixels(void)
+{
+    lv_test_print("");
+    lv_test_print("Draw the same pixels from the layer:");
+    lv_test_print("------------------------------------");
+
+    extern lv_color_t test_fb[];
+    uint32_t px_cnt = LV_HOR_RES_MAX * LV_VER_RES_MAX;
+    lv_color_t * ref_fb = lv_mem_alloc(px_cnt * sizeof(lv_color_t));
+    LV_ASSERT_MEM(ref_fb);
+    if(ref_fb == NULL) return;
+
+    lv_obj_t * panel = panel_create(40, 40);
+    refr_scr();
+    _lv_memcpy(ref_fb, test_fb, px_cnt * sizeof(lv_color_t));
+
+    lv_obj_set_layer_cache(panel, true);
+    refr_scr();
+
+    /* The semi transparent parts (e.g. the fading edge of the shadow) are mixed into the layer first
+     * and blended as an ARGB image then so they are rounded twice*/
+    lv_test_assert_int_lt(8, max_diff(ref_fb, test_fb, px_cnt), "Same pixels with and without layer");
+
+    lv_obj_del(panel);
+    lv_mem_free(ref_fb);
+}
+
+static void budget(void)
+{
+    lv_test_print("");
+    lv_test_print("Keep the layers within the memory budget:");
+    lv_test_print("-----------------------------------------");
+
+    lv_layer_cache_stat_t stat;
+    lv_layer_cache_reset_stat();
+
+    /*Only one layer of this size fits into the budget*/
+    lv_obj_t * panel1 = panel_create(20, 20);
+    lv_obj_t * panel2 = panel_create(300, 20);
+    lv_obj_set_layer_cache(panel1, true);
+    lv_obj_set_layer_cache(panel2, true);
+
+    refr_scr();
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_lt(LV_LAYER_CACHE_MEM + 1, stat.used_size, "The layers fit into the budget");
+    lv_test_assert_int_eq(1, stat.entry_cnt, "Only one layer is kept");
+    lv_test_assert_int_gt(0, stat.evict_cnt, "The least recently used layer is evicted");
+
+    /*A layer larger than the budget is not created but the object is still drawn*/
+    lv_obj_del(panel2);
+    lv_obj_set_size(panel1, LV_HOR_RES_MAX - 40, LV_VER_RES_MAX - 40);
+    lv_layer_cache_reset_stat();
+    refr_scr();
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(0, stat.entry_cnt, "Too large layer is not cached");
+    lv_test_assert_int_eq(0, stat.miss_cnt, "Too large layer is not rendered");
+
+    lv_obj_del(panel1);
+}
+
+static void benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Layer benchmark:");
+    lv_test_print("----------------");
+
+    lv_obj_t * panel = panel_create(40, 40);
+    lv_obj_t * overlay = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_set_size(overlay, 30, 30);
+
+    refr_scr();
+    uint32_t t_direct = move_overlay(overlay, BENCH_FRAMES);
+
+    lv_obj_set_layer_cache(panel, true);
+    refr_scr();
+    lv_layer_cache_reset_stat();
+    uint32_t t_layer = move_overlay(overlay, BENCH_FRAMES);
+
+    lv_layer_cache_stat_t stat;
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(0, stat.miss_cnt, "All frames are drawn from the layer");
+
+    lv_test_print("%d frames of an object moving above a panel: direct %d ms, from layer %d ms", BENCH_FRAMES,
+                  (int)t_direct, (int)t_layer);
+
+    lv_obj_del(overlay);
+    lv_obj_del(panel);
+}
+
+/**
+ * Create a panel with shadow, gradient and buttons with labels
+ */
+static lv_obj_t * panel_create(lv_coord_t x, lv_coord_t y)
+{
+    lv_obj_t * panel = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_add_style(panel, LV_OBJ_PART_MAIN, &panel_style);
+    lv_obj_set_pos(panel, x, y);
+    lv_obj_set_size(panel, PANEL_W, PANEL_H);
+
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        lv_obj_t * btn = lv_btn_create(panel, NULL);
+        lv_obj_set_size(btn, 100, 40);
+        lv_obj_set_pos(btn, 10 + (i & 1) * 120, 10 + (i / 2) * 48);
+        lv_obj_t * label = lv_label_create(btn, NULL);
+        lv_label_set_text_fmt(label, "Button %d", (int)i);
+    }
+
+    return panel;
+}
+
+/**
+ * Move an object diagonally above the panels and refresh only the invalidated areas
+ * @return the elapsed time in ms
+ */
+static uint32_t move_overlay(lv_obj_t * overlay, uint32_t frame_cnt)
+{
+    /*The LVGL tick is incremented manually so measure the real time with the system time*/
+    uint32_t t_start = custom_tick_get();
+    uint32_t i;
+    for(i = 0; i < frame_cnt; i++) {
+        lv_obj_set_pos(overlay, 50 + i * 5, 50 + i * 3);
+        lv_refr_now(NULL);
+    }
+
+    return custom_tick_get() - t_start;
+}
+
+static uint8_t max_diff(const lv_color_t * ref, const lv_color_t * act, uint32_t px_cnt)
+{
+    uint8_t diff = 0;
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        uint8_t d = LV_MATH_ABS(LV_COLOR_GET_R(ref[i]) - LV_COLOR_GET_R(act[i]));
+        if(d > diff) diff = d;
+        d = LV_MATH_ABS(LV_COLOR_GET_G(ref[i]) - LV_COLOR_GET_G(act[i]));
+        if(d > diff) diff = d;
+        d = LV_MATH_ABS(LV_COLOR_GET_B(ref[i]) - LV_COLOR_GET_B(act[i]));
+        if(d > diff) diff = d;
+    }
+
+    return diff;
+}
+
+static void refr_scr(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+#endif
+
+#endif
@@ -15,6 +15,7 @@
 /*********************
  *      DEFINES
  *********************/
+#define THEMED_WIDGET_CNT   25
 
 /**********************
  *      TYPEDEFS
@@ -28,11 +29,28 @@ static void add_remove_read_prop(void);
 static void cascade(void);
 static void copy(void);
 static void states(void);
+static void const_style(void);
+#if LV_USE_THEME_MATERIAL
+static void theme_const_styles(void);
+static void init_material_defaults(const lv_font_t * font_normal);
+static lv_obj_t * create_themed_widget(uint32_t id);
+static bool same_themed_styles(lv_obj_t * obj_const, lv_obj_t * obj_rt, const lv_font_t * font_rt);
+#endif
+#if LV_USE_ANIMATION
+static void transitions(void);
+static void count_rounder_cb(lv_disp_drv_t * disp_drv, lv_area_t * area);
+static lv_res_t count_signal_cb(lv_obj_t * obj, lv_signal_t sign, void * param);
+#endif
 static void mem_leak(void);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_USE_ANIMATION
+static uint32_t inv_cnt;
+static uint32_t style_chg_cnt;
+static lv_signal_cb_t ancestor_signal;
+#endif
 
 /**********************
  *      MACROS
@@ -54,6 +72,13 @@ void lv_test_style(void)
     cascade();
     copy();
     states();
+    const_style();
+#if LV_USE_THEME_MATERIAL
+    theme_const_styles();
+#endif
+#if LV_USE_ANIMATION
+    transitions();
+#endif
     mem_leak();
 }
 
@@ -410,6 +435,492 @@ static void states(void)
     _lv_style_list_reset(&style_list);
 }
 
+static void const_style(void)
+{
+    lv_test_print("");
+    lv_test_print("Test constant styles:");
+    lv_test_print("---------------------");
+
+    static const lv_style_const_prop_t props[] = {
+        LV_STYLE_CONST_INT(LV_STYLE_TEXT_LINE_SPACE, 5),
+        LV_STYLE_CONST_INT(LV_STYLE_TEXT_LINE_SPACE | (LV_STATE_PRESSED << LV_STYLE_STATE_POS), 7),
+        LV_STYLE_CONST_OPA(LV_STYLE_BG_OPA, LV_OPA_50),
+        LV_STYLE_CONST_COLOR(LV_STYLE_BG_COLOR, 0xFF, 0x00, 0x00),
+        LV_STYLE_CONST_COLOR_HEX(LV_STYLE_BG_COLOR | (LV_STATE_CHECKED << LV_STYLE_STATE_POS), 0x00FF00),
+        LV_STYLE_CONST_PTR(LV_STYLE_VALUE_STR, "hello"),
+        LV_STYLE_CONST_END
+    };
+    static LV_STYLE_CONST_INIT(style_const, props);
+
+    lv_style_list_t style_list;
+    lv_style_list_init(&style_list);
+
+    lv_style_t style_normal;
+    lv_style_init(&style_normal);
+    _lv_style_set_int(&style_normal, LV_STYLE_TEXT_LINE_SPACE, 3);
+    _lv_style_set_int(&style_normal, LV_STYLE_TEXT_LETTER_SPACE, 4);
+
+    _lv_style_list_add_style(&style_list, &style_normal);
+    _lv_style_list_add_style(&style_list, &style_const);
+
+    lv_res_t found;
+    lv_style_int_t value;
+    lv_opa_t opa;
+    lv_color_t color;
+    const void * ptr;
+
+    lv_test_print("Read properties from a constant style");
+    found = _lv_style_list_get_int(&style_list, LV_STYLE_TEXT_LINE_SPACE, &value);
+    lv_test_assert_int_eq(LV_RES_OK, found, "Get an 'int' property");
+    lv_test_assert_int_eq(5, value, "Get the value of an 'int' property");
+
+    found = _lv_style_list_get_int(&style_list, LV_STYLE_TEXT_LINE_SPACE | (LV_STATE_PRESSED | LV_STATE_FOCUSED) << LV_STYLE_STATE_POS, &value);
+    lv_test_assert_int_eq(LV_RES_OK, found, "Get an 'int' property in pressed focused state");
+    lv_test_assert_int_eq(7, value, "Get the value of an 'int' property in pressed focused state");
+
+    found = _lv_style_list_get_opa(&style_list, LV_STYLE_BG_OPA, &opa);
+    lv_test_assert_int_eq(LV_RES_OK, found, "Get an 'opa' property");
+    lv_test_assert_int_eq(LV_OPA_50, opa, "Get the value of an 'opa' property");
+
+    found = _lv_style_list_get_color(&style_list, LV_STYLE_BG_COLOR, &color);
+    lv_test_assert_int_eq(LV_RES_OK, found, "Get a 'color' property");
+    lv_test_assert_color_eq(LV_COLOR_RED, color, "Get the value of a 'color' property");
+
+    found = _lv_style_list_get_color(&style_list, LV_STYLE_BG_COLOR | (LV_STATE_CHECKED << LV_STYLE_STATE_POS), &color);
+    lv_test_assert_int_eq(LV_RES_OK, found, "Get a 'color' property in checked state");
+    lv_test_assert_color_eq(LV_COLOR_LIME, color, "Get the value of a 'color' property in checked state");
+
+    found = _lv_style_list_get_ptr(&style_list, LV_STYLE_VALUE_STR, &ptr);
+    lv_test_assert_int_eq(LV_RES_OK, found, "Get a 'ptr' property");
+    lv_test_assert_str_eq("hello", ptr, "Get the value of a 'ptr' property");
+
+    lv_test_print("Fall back to a normal style in the same list");
+    found = _lv_style_list_get_int(&style_list, LV_STYLE_TEXT_LETTER_SPACE, &value);
+    lv_test_assert_int_eq(LV_RES_OK, found, "Get an 'int' property not set in the constant style");
+    lv_test_assert_int_eq(4, value, "Get the value of an 'int' property not set in the constant style");
+
+    lv_test_print("Constant styles can't be modified");
+    _lv_style_set_int((lv_style_t *)&style_const, LV_STYLE_TEXT_LINE_SPACE, 10);
+    lv_style_reset((lv_style_t *)&style_const);
+    found = _lv_style_list_get_int(&style_list, LV_STYLE_TEXT_LINE_SPACE, &value);
+    lv_test_assert_int_eq(5, value, "Keep the value after setting a property in a constant style");
+    lv_test_assert_int_eq(0, _lv_style_get_mem_size(&style_const), "No memory is allocated for a constant style");
+
+    lv_test_print("Copy a constant style");
+    lv_style_t style_copy;
+    lv_style_init(&style_copy);
+    lv_style_copy(&style_copy, &style_const);
+
+    int16_t weight = _lv_style_get_int(&style_copy, LV_STYLE_TEXT_LINE_SPACE | (LV_STATE_PRESSED << LV_STYLE_STATE_POS), &value);
+    lv_test_assert_int_eq(LV_STATE_PRESSED, weight, "Get a copied property from a constant style");
+    lv_test_assert_int_eq(7, value, "Get the value of a property copied from a constant style");
+    _lv_style_set_int(&style_copy, LV_STYLE_TEXT_LINE_SPACE, 10);
+    _lv_style_get_int(&style_copy, LV_STYLE_TEXT_LINE_SPACE, &value);
+    lv_test_assert_int_eq(10, value, "Modify the copy of a constant style");
+
+    /*Clean-up*/
+    _lv_style_list_reset(&style_list);
+    lv_style_reset(&style_normal);
+    lv_style_reset(&style_copy);
+}
+
+#if LV_USE_THEME_MATERIAL
+static void theme_const_styles(void)
+{
+    lv_test_print("");
+    lv_test_print("Test the constant styles of the material theme:");
+    lv_test_print("-----------------------------------------------");
+
+    /*A copy of the font gives the same styles but doesn't match the defaults*/
+    static lv_font_t font_copy;
+    font_copy = *LV_THEME_DEFAULT_FONT_NORMAL;
+
+    lv_test_print("Use the constant styles with the defaults of lv_conf.h");
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor_t mon_end;
+    lv_mem_monitor(&mon_start);
+#endif
+    init_material_defaults(LV_THEME_DEFAULT_FONT_NORMAL);
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor(&mon_end);
+    lv_test_assert_int_eq(mon_start.free_size, mon_end.free_size, "No memory is used by the init");
+#endif
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act(), NULL);
+    lv_test_assert_true(lv_style_is_const(lv_style_list_get_style(lv_obj_get_style_list(obj, LV_OBJ_PART_MAIN), 0)),
+                        "The widgets get constant styles");
+    lv_obj_del(obj);
+
+    init_material_defaults(&font_copy);
+    obj = lv_obj_create(lv_scr_act(), NULL);
+    lv_test_assert_true(!lv_style_is_const(lv_style_list_get_style(lv_obj_get_style_list(obj, LV_OBJ_PART_MAIN), 0)),
+                        "The widgets get run time styles with other parameters");
+    lv_obj_del(obj);
+
+    /*Create the widgets one by one as the heap might be small*/
+    lv_test_print("Compare the constant and run time styles of the widgets");
+    bool same = true;
+    uint32_t id;
+    for(id = 0; id < THEMED_WIDGET_CNT && same; id++) {
+        init_material_defaults(LV_THEME_DEFAULT_FONT_NORMAL);
+        lv_obj_t * obj_const = create_themed_widget(id);
+        init_material_defaults(&font_copy);
+        lv_obj_t * obj_rt = create_themed_widget(id);
+
+        if(obj_const) {
+            same = same_themed_styles(obj_const, obj_rt, &font_copy);
+            if(!same) lv_test_print("Widget %d has different styles", id);
+            lv_obj_del(obj_const);
+            lv_obj_del(obj_rt);
+        }
+    }
+    lv_test_assert_true(same, "Same style properties");
+
+    /*Clean-up*/
+    LV_THEME_DEFAULT_INIT(LV_THEME_DEFAULT_COLOR_PRIMARY, LV_THEME_DEFAULT_COLOR_SECONDARY, LV_THEME_DEFAULT_FLAG,
+                          LV_THEME_DEFAULT_FONT_SMALL, LV_THEME_DEFAULT_FONT_NORMAL,
+                          LV_THEME_DEFAULT_FONT_SUBTITLE, LV_THEME_DEFAULT_FONT_TITLE);
+}
+
+static void init_material_defaults(const lv_font_t * font_normal)
+{
+    lv_theme_material_init(lv_color_hex(0x01a2b1), lv_color_hex(0x44d1b6), LV_THEME_DEFAULT_FLAG,
+                           LV_THEME_DEFAULT_FONT_SMALL, font_normal,
+                           LV_THEME_DEFAULT_FONT_SUBTITLE, LV_THEME_DEFAULT_FONT_TITLE);
+}
+
+/**
+ * Create a widget on the active screen
+ * @param id index of the widget, `[0..THEMED_WIDGET_CNT)`
+ * @return the widget or NULL if its type is disabled
+ */
+static lv_obj_t * create_themed_widget(uint32_t id)
+{
+    lv_obj_t * par = lv_scr_act();
+    lv_obj_t * obj = NULL;
+
+    switch(id) {
+        case 0:
+            obj = lv_obj_create(par, NULL);
+            break;
+#if LV_USE_BTN
+        case 1:
+            obj = lv_btn_create(par, NULL);
+            break;
+#endif
+#if LV_USE_LABEL
+        case 2:
+            obj = lv_label_create(par, NULL);
+            break;
+#endif
+#if LV_USE_BAR
+        case 3:
+            obj = lv_bar_create(par, NULL);
+            break;
+#endif
+#if LV_USE_SLIDER
+        case 4:
+            obj = lv_slider_create(par, NULL);
+            break;
+#endif
+#if LV_USE_SWITCH
+        case 5:
+            obj = lv_switch_create(par, NULL);
+            break;
+#endif
+#if LV_USE_CHECKBOX
+        case 6:
+            obj = lv_checkbox_create(par, NULL);
+            break;
+#endif
+#if LV_USE_LED
+        case 7:
+            obj = lv_led_create(par, NULL);
+            break;
+#endif
+#if LV_USE_ARC
+        case 8:
+            obj = lv_arc_create(par, NULL);
+            break;
+#endif
+#if LV_USE_LINEMETER
+        case 9:
+            obj = lv_linemeter_create(par, NULL);
+            break;
+#endif
+#if LV_USE_GAUGE
+        case 10:
+            obj = lv_gauge_create(par, NULL);
+            break;
+#endif
+#if LV_USE_CHART
+        case 11:
+            obj = lv_chart_create(par, NULL);
+            break;
+#endif
+#if LV_USE_CALENDAR
+        case 12:
+            obj = lv_calendar_create(par, NULL);
+            break;
+#endif
+#if LV_USE_CPICKER
+        case 13:
+            obj = lv_cpicker_create(par, NULL);
+            break;
+#endif
+#if LV_USE_KEYBOARD
+        case 14:
+            obj = lv_keyboard_create(par, NULL);
+            break;
+#endif
+#if LV_USE_MSGBOX
+        case 15: {
+                static const char * btns[] = {"Ok", ""};
+                obj = lv_msgbox_create(par, NULL);
+                lv_msgbox_add_btns(obj, btns);
+                break;
+            }
+#endif
+#if LV_USE_TEXTAREA
+        case 16:
+            obj = lv_textarea_create(par, NULL);
+            break;
+#endif
+#if LV_USE_SPINBOX
+        case 17:
+            obj = lv_spinbox_create(par, NULL);
+            break;
+#endif
+#if LV_USE_SPINBOX && LV_USE_BTN
+        case 18:
+            obj = lv_btn_create(par, NULL);
+            lv_theme_apply(obj, LV_THEME_SPINBOX_BTN);
+            break;
+#endif
+#if LV_USE_LIST
+        case 19:
+            obj = lv_list_create(par, NULL);
+            lv_list_add_btn(obj, NULL, "Item");
+            break;
+#endif
+#if LV_USE_DROPDOWN
+        case 20:
+            obj = lv_dropdown_create(par, NULL);
+            break;
+#endif
+#if LV_USE_ROLLER
+        case 21:
+            obj = lv_roller_create(par, NULL);
+            break;
+#endif
+#if LV_USE_TABLE
+        case 22:
+            obj = lv_table_create(par, NULL);
+            break;
+#endif
+#if LV_USE_TABVIEW
+        case 23:
+            obj = lv_tabview_create(par, NULL);
+            lv_tabview_add_tab(obj, "Tab");
+            break;
+#endif
+#if LV_USE_WIN
+        case 24:
+            obj = lv_win_create(par, NULL);
+            lv_win_add_btn(obj, LV_SYMBOL_CLOSE);
+            break;
+#endif
+        default:
+            break;
+    }
+
+    return obj;
+}
+
+/**
+ * Compare every property of every style on two widget trees in every state combination
+ */
+static bool same_themed_styles(lv_obj_t * obj_const, lv_obj_t * obj_rt, const lv_font_t * font_rt)
+{
+    uint32_t part;
+    for(part = 0; part < LV_OBJ_PART_ALL; part++) {
+        lv_style_list_t * list_const = lv_obj_get_style_list(obj_const, part);
+        lv_style_list_t * list_rt = lv_obj_get_style_list(obj_rt, part);
+        if(list_const == NULL && list_rt == NULL) continue;
+        if(list_const == NULL || list_rt == NULL || list_const->style_cnt != list_rt->style_cnt) {
+            lv_test_print("The style lists of part %d differ", part);
+            return false;
+        }
+
+        uint8_t i;
+        for(i = 0; i < list_const->style_cnt; i++) {
+            lv_style_t * style_const = lv_style_list_get_style(list_const, i);
+            lv_style_t * style_rt = lv_style_list_get_style(list_rt, i);
+            if(style_const == style_rt) continue;
+
+            uint32_t id;
+            uint32_t state;
+            for(id = 1; id < 0xFF; id++) {
+                for(state = 0; state < 0x40; state++) {
+                    lv_style_property_t prop = id | (state << LV_STYLE_STATE_POS);
+                    int16_t weight_const;
+                    int16_t weight_rt;
+                    bool eq;
+                    if((id & 0xF) < LV_STYLE_ID_COLOR) {
+                        lv_style_int_t v_const = 0, v_rt = 0;
+                        weight_const = _lv_style_get_int(style_const, prop, &v_const);
+                        weight_rt = _lv_style_get_int(style_rt, prop, &v_rt);
+                        eq = v_const == v_rt;
+                    }
+                    else if((id & 0xF) < LV_STYLE_ID_OPA) {
+                        lv_color_t v_const = LV_COLOR_BLACK, v_rt = LV_COLOR_BLACK;
+                        weight_const = _lv_style_get_color(style_const, prop, &v_const);
+                        weight_rt = _lv_style_get_color(style_rt, prop, &v_rt);
+                        eq = v_const.full == v_rt.full;
+                    }
+                    else if((id & 0xF) < LV_STYLE_ID_PTR) {
+                        lv_opa_t v_const = 0, v_rt = 0;
+                        weight_const = _lv_style_get_opa(style_const, prop, &v_const);
+                        weight_rt = _lv_style_get_opa(style_rt, prop, &v_rt);
+                        eq = v_const == v_rt;
+                    }
+                    else {
+                        const void * v_const = NULL;
+                        const void * v_rt = NULL;
+                        weight_const = _lv_style_get_ptr(style_const, prop, &v_const);
+                        weight_rt = _lv_style_get_ptr(style_rt, prop, &v_rt);
+                        eq = v_const == v_rt || (v_const == LV_THEME_DEFAULT_FONT_NORMAL && v_rt == font_rt);
+                    }
+
+                    if(weight_const != weight_rt || !eq) {
+                        lv_test_print("Style property 0x%04x differs in part %d", prop, part);
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    lv_obj_t * child_const = lv_obj_get_child_back(obj_const, NULL);
+    lv_obj_t * child_rt = lv_obj_get_child_back(obj_rt, NULL);
+    while(child_const && child_rt) {
+        if(!same_themed_styles(child_const, child_rt, font_rt)) return false;
+        child_const = lv_obj_get_child_back(obj_const, child_const);
+        child_rt = lv_obj_get_child_back(obj_rt, child_rt);
+    }
+
+    return child_const == NULL && child_rt == NULL;
+}
+#endif
+
+#if LV_USE_ANIMATION
+static void transitions(void)
+{
+    lv_test_print("");
+    lv_test_print("Test style transitions:");
+    lv_test_print("-----------------------");
+
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_bg_color(&style, LV_STATE_DEFAULT, LV_COLOR_RED);
+    lv_style_set_bg_color(&style, LV_STATE_PRESSED, LV_COLOR_BLUE);
+    lv_style_set_border_color(&style, LV_STATE_DEFAULT, LV_COLOR_RED);
+    lv_style_set_border_color(&style, LV_STATE_PRESSED, LV_COLOR_LIME);
+    lv_style_set_bg_opa(&style, LV_STATE_DEFAULT, LV_OPA_COVER);
+    lv_style_set_bg_opa(&style, LV_STATE_PRESSED, LV_OPA_TRANSP);
+    lv_style_set_pad_top(&style, LV_STATE_DEFAULT, 0);
+    lv_style_set_pad_top(&style, LV_STATE_PRESSED, 100);
+    lv_style_set_pad_left(&style, LV_STATE_DEFAULT, 0);
+    lv_style_set_pad_left(&style, LV_STATE_PRESSED, 200);
+    lv_style_set_transition_time(&style, LV_STATE_DEFAULT, 100);
+    lv_style_set_transition_delay(&style, LV_STATE_DEFAULT, 0);
+    lv_style_set_transition_prop_1(&style, LV_STATE_DEFAULT, LV_STYLE_BG_COLOR);
+    lv_style_set_transition_prop_2(&style, LV_STATE_DEFAULT, LV_STYLE_BORDER_COLOR);
+    lv_style_set_transition_prop_3(&style, LV_STATE_DEFAULT, LV_STYLE_BG_OPA);
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_add_style(obj, LV_OBJ_PART_MAIN, &style);
+    ancestor_signal = lv_obj_get_signal_cb(obj);
+    lv_obj_set_signal_cb(obj, count_signal_cb);
+
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    disp->driver.rounder_cb = count_rounder_cb;
+
+    lv_test_print("Transition properties which don't change the layout");
+    lv_obj_set_state(obj, LV_STATE_PRESSED);
+    inv_cnt = 0;
+    lv_tick_inc(50);
+    lv_anim_refr_now();
+
+    /*The linear path is at 50/100 ms*/
+    lv_anim_value_t v = (255 * 512) >> 10;
+    lv_test_assert_color_eq(lv_color_mix(LV_COLOR_BLUE, LV_COLOR_RED, v), lv_obj_get_style_bg_color(obj, LV_OBJ_PART_MAIN),
+                            "Background color in the middle of the transition");
+    lv_test_assert_color_eq(lv_color_mix(LV_COLOR_LIME, LV_COLOR_RED, v), lv_obj_get_style_border_color(obj, LV_OBJ_PART_MAIN),
+                            "Border color in the middle of the transition");
+    lv_test_assert_int_eq(LV_OPA_COVER + (((LV_OPA_TRANSP - LV_OPA_COVER) * v) >> 8), lv_obj_get_style_bg_opa(obj, LV_OBJ_PART_MAIN),
+                          "Background opacity in the middle of the transition");
+    lv_test_assert_int_eq(1, inv_cnt, "Invalidate the part once for all the properties in a step");
+
+    inv_cnt = 0;
+    lv_tick_inc(50);
+    lv_anim_refr_now();
+    lv_test_assert_color_eq(LV_COLOR_BLUE, lv_obj_get_style_bg_color(obj, LV_OBJ_PART_MAIN),
+                            "Background color at the end of the transition");
+    lv_test_assert_color_eq(LV_COLOR_LIME, lv_obj_get_style_border_color(obj, LV_OBJ_PART_MAIN),
+                            "Border color at the end of the transition");
+    lv_test_assert_int_eq(LV_OPA_TRANSP, lv_obj_get_style_bg_opa(obj, LV_OBJ_PART_MAIN),
+                          "Background opacity at the end of the transition");
+    lv_test_assert_int_eq(1, inv_cnt, "Invalidate the part once in the last step");
+
+    lv_test_print("Transition properties which change the layout");
+    lv_obj_set_state(obj, LV_STATE_DEFAULT);
+    lv_tick_inc(100);
+    lv_anim_refr_now();
+    lv_style_set_transition_prop_1(&style, LV_STATE_DEFAULT, LV_STYLE_PAD_TOP);
+    lv_style_set_transition_prop_2(&style, LV_STATE_DEFAULT, LV_STYLE_PAD_LEFT);
+    lv_style_set_transition_prop_3(&style, LV_STATE_DEFAULT, 0);
+    lv_obj_refresh_style(obj, LV_OBJ_PART_MAIN, LV_STYLE_PROP_ALL);
+
+    lv_obj_set_state(obj, LV_STATE_PRESSED);
+    style_chg_cnt = 0;
+    lv_tick_inc(50);
+    lv_anim_refr_now();
+    lv_test_assert_int_eq((100 * v) >> 8, lv_obj_get_style_pad_top(obj, LV_OBJ_PART_MAIN),
+                          "Top padding in the middle of the transition");
+    lv_test_assert_int_eq((200 * v) >> 8, lv_obj_get_style_pad_left(obj, LV_OBJ_PART_MAIN),
+                          "Left padding in the middle of the transition");
+    lv_test_assert_int_eq(1, style_chg_cnt, "Refresh the style once for all the properties in a step");
+
+    style_chg_cnt = 0;
+    lv_tick_inc(50);
+    lv_anim_refr_now();
+    lv_test_assert_int_eq(100, lv_obj_get_style_pad_top(obj, LV_OBJ_PART_MAIN), "Top padding at the end of the transition");
+    lv_test_assert_int_eq(200, lv_obj_get_style_pad_left(obj, LV_OBJ_PART_MAIN), "Left padding at the end of the transition");
+    lv_test_assert_int_eq(1, style_chg_cnt, "Refresh the style once in the last step");
+
+    disp->driver.rounder_cb = NULL;
+    lv_obj_del(obj);
+    lv_style_reset(&style);
+}
+
+static void count_rounder_cb(lv_disp_drv_t * disp_drv, lv_area_t * area)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(area);
+
+    inv_cnt++;
+}
+
+static lv_res_t count_signal_cb(lv_obj_t * obj, lv_signal_t sign, void * param)
+{
+    if(sign == LV_SIGNAL_STYLE_CHG) style_chg_cnt++;
+
+    return ancestor_signal(obj, sign, param);
+}
+#endif
+
 static void mem_leak(void)
 {
 
@@ -0,0 +1,146 @@
+/**
+ * @file lv_test_task.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_task.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LOG_MAX 8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void priority_order(void);
+static void delete_and_turn_off(void);
+static void log_task_cb(lv_task_t * task);
+static void del_other_task_cb(lv_task_t * task);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t run_log[LOG_MAX];
+static uint32_t run_cnt;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_task(void)
+{
+    lv_test_print("");
+    lv_test_print("===================");
+    lv_test_print("Start lv_task tests");
+    lv_test_print("===================");
+
+    priority_order();
+    delete_and_turn_off();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void priority_order(void)
+{
+    lv_test_print("");
+    lv_test_print("Run the ready tasks in priority order:");
+    lv_test_print("--------------------------------------");
+
+    run_cnt = 0;
+    lv_task_t * t_low = lv_task_create(log_task_cb, 100000, LV_TASK_PRIO_LOW, (void *)1);
+    lv_task_t * t_high = lv_task_create(log_task_cb, 100000, LV_TASK_PRIO_HIGH, (void *)2);
+    lv_task_t * t_mid = lv_task_create(log_task_cb, 100000, LV_TASK_PRIO_MID, (void *)3);
+    lv_task_t * t_wait = lv_task_create(log_task_cb, 100000, LV_TASK_PRIO_HIGHEST, (void *)4);
+
+    lv_task_ready(t_low);
+    lv_task_ready(t_high);
+    lv_task_ready(t_mid);
+    lv_task_handler();
+
+    lv_test_assert_int_eq(3, run_cnt, "Only the ready tasks run");
+    lv_test_assert_int_eq(2, run_log[0], "The highest priority task runs first");
+    lv_test_assert_int_eq(3, run_log[1], "The middle priority task runs second");
+    lv_test_assert_int_eq(1, run_log[2], "The lowest priority task runs last");
+
+    lv_test_print("Change the priority of a task");
+    run_cnt = 0;
+    lv_task_set_prio(t_low, LV_TASK_PRIO_HIGHEST);
+    lv_task_ready(t_low);
+    lv_task_ready(t_high);
+    lv_task_handler();
+    lv_test_assert_int_eq(2, run_cnt, "Both ready tasks run");
+    lv_test_assert_int_eq(1, run_log[0], "The task with increased priority runs first");
+
+    lv_test_print("Run a task with repeat count");
+    run_cnt = 0;
+    lv_task_set_repeat_count(t_mid, 1);
+    lv_task_ready(t_mid);
+    lv_task_handler();
+    lv_test_assert_int_eq(1, run_cnt, "The task runs once");
+    lv_task_ready(t_wait);
+    lv_task_handler();
+    lv_test_assert_int_eq(2, run_cnt, "The ran out task is deleted");
+
+    lv_task_del(t_low);
+    lv_task_del(t_high);
+    lv_task_del(t_wait);
+}
+
+static void delete_and_turn_off(void)
+{
+    lv_test_print("");
+    lv_test_print("Delete and turn off tasks:");
+    lv_test_print("--------------------------");
+
+    run_cnt = 0;
+    lv_task_t * t_victim = lv_task_create(log_task_cb, 0, LV_TASK_PRIO_LOWEST, (void *)1);
+    lv_task_t * t_killer = lv_task_create(del_other_task_cb, 0, LV_TASK_PRIO_HIGHEST, t_victim);
+    lv_task_t * t_off = lv_task_create(log_task_cb, 0, LV_TASK_PRIO_MID, (void *)2);
+    lv_task_set_prio(t_off, LV_TASK_PRIO_OFF);
+
+    lv_task_ready(t_killer);
+    lv_task_ready(t_victim);
+    lv_task_ready(t_off);
+    lv_task_handler();
+    lv_test_assert_int_eq(0, run_cnt, "Deleted and turned off tasks don't run");
+
+    lv_task_set_prio(t_off, LV_TASK_PRIO_MID);
+    lv_task_handler();
+    lv_test_assert_int_eq(1, run_cnt, "The turned on task runs");
+
+    lv_task_del(t_killer);
+    lv_task_del(t_off);
+}
+
+static void log_task_cb(lv_task_t * task)
+{
+    if(run_cnt < LOG_MAX) run_log[run_cnt] = (uint8_t)((lv_uintptr_t)task->user_data);
+    run_cnt++;
+}
+
+static void del_other_task_cb(lv_task_t * task)
+{
+    if(task->user_data) {
+        lv_task_del(task->user_data);
+        task->user_data = NULL;
+    }
+}
+#endif
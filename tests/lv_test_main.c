@@ -3,6 +3,13 @@
 #include <stdlib.h>
 #include "lv_test_core/lv_test_core.h"
 #include "lv_test_widgets/lv_test_label.h"
+#include "lv_test_widgets/lv_test_chart.h"
+#include "lv_test_widgets/lv_test_table.h"
+#include "lv_test_widgets/lv_test_list.h"
+#include "lv_test_widgets/lv_test_btnmatrix.h"
+#include "lv_test_widgets/lv_test_gauge.h"
+#include "lv_test_widgets/lv_test_page.h"
+#include "lv_test_widgets/lv_test_roller.h"
 
 #if LV_BUILD_TEST
 #include <sys/time.h>
@@ -21,6 +28,13 @@ int main(void)
 
     lv_test_core();
     lv_test_label();
+    lv_test_chart();
+    lv_test_table();
+    lv_test_list();
+    lv_test_btnmatrix();
+    lv_test_gauge();
+    lv_test_page();
+    lv_test_roller();
 
     printf("Exit with success!\n");
     return 0;
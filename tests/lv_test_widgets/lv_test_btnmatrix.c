@@ -0,0 +1,305 @@
+/**
+ * @file lv_test_btnmatrix.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_btnmatrix.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BENCH_GRID      20
+#define BENCH_READS     20000
+#define MANY_ROWS       300
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_BTNMATRIX
+static void hit_test(void);
+#if LV_MEM_CUSTOM
+static void many_rows(void);
+static void benchmark(void);
+#endif
+static uint32_t check_all_points(lv_obj_t * btnm);
+static uint16_t press(lv_obj_t * btnm, lv_coord_t x, lv_coord_t y);
+static uint16_t ref_get_button_from_point(lv_obj_t * btnm, lv_point_t * p);
+static bool read_cb(lv_indev_drv_t * drv, lv_indev_data_t * data);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_BTNMATRIX
+static lv_indev_t * indev;
+static lv_indev_data_t indev_data;
+static const char * hit_map[] = {"1", "2", "3", "\n",
+                                 "Wide", "4", "\n",
+                                 "\n",
+                                 "5", "6", "7", "8", "9", "\n",
+                                 "10", ""
+                                };
+#if LV_MEM_CUSTOM
+static const char * many_rows_map[MANY_ROWS * 2];
+static const char * bench_map[BENCH_GRID * (BENCH_GRID + 1)];
+#endif
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_btnmatrix(void)
+{
+#if LV_USE_BTNMATRIX
+    lv_test_print("");
+    lv_test_print("========================");
+    lv_test_print("Start lv_btnmatrix tests");
+    lv_test_print("========================");
+
+    /*Simulate a touchpad to press the buttons*/
+    lv_indev_drv_t drv;
+    lv_indev_drv_init(&drv);
+    drv.type = LV_INDEV_TYPE_POINTER;
+    drv.read_cb = read_cb;
+    indev = lv_indev_drv_register(&drv);
+
+    hit_test();
+#if LV_MEM_CUSTOM
+    many_rows();
+    benchmark();
+#endif
+
+    lv_indev_enable(indev, false);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_BTNMATRIX
+static void hit_test(void)
+{
+    lv_test_print("");
+    lv_test_print("Find the pressed button:");
+    lv_test_print("------------------------");
+
+    lv_obj_t * btnm = lv_btnmatrix_create(lv_scr_act(), NULL);
+    lv_obj_set_size(btnm, LV_MATH_MIN(LV_HOR_RES, 200), LV_MATH_MIN(LV_VER_RES, 120));
+    lv_obj_set_style_local_pad_inner(btnm, LV_BTNMATRIX_PART_BG, LV_STATE_DEFAULT, 7);
+    lv_obj_set_style_local_pad_left(btnm, LV_BTNMATRIX_PART_BG, LV_STATE_DEFAULT, 5);
+    lv_obj_set_style_local_pad_top(btnm, LV_BTNMATRIX_PART_BG, LV_STATE_DEFAULT, 3);
+    lv_btnmatrix_set_map(btnm, hit_map);
+    lv_btnmatrix_set_btn_width(btnm, 3, 3);
+
+    lv_test_assert_int_eq(0, check_all_points(btnm), "Same button as the linear search on every point");
+    lv_test_assert_int_eq(0, press(btnm, 0, 0), "The top left corner presses the first button");
+    lv_test_assert_int_eq(10, press(btnm, lv_obj_get_width(btnm) - 1, lv_obj_get_height(btnm) - 1),
+                          "The bottom right corner presses the last button");
+
+    /*The areas are updated with the size*/
+    lv_obj_set_size(btnm, LV_MATH_MIN(LV_HOR_RES, 160), LV_MATH_MIN(LV_VER_RES, 100));
+    lv_test_assert_int_eq(0, check_all_points(btnm), "Same button after resize");
+
+    /*The areas are updated with the style*/
+    lv_obj_set_style_local_pad_inner(btnm, LV_BTNMATRIX_PART_BG, LV_STATE_DEFAULT, 12);
+    lv_test_assert_int_eq(0, check_all_points(btnm), "Same button after style change");
+
+#if LV_USE_BIDI
+    /*The base direction is applied when the buttons are placed*/
+    lv_obj_set_base_dir(btnm, LV_BIDI_DIR_RTL);
+    lv_btnmatrix_set_map(btnm, hit_map);
+    lv_test_assert_int_eq(0, press(btnm, lv_obj_get_width(btnm) - 1, 0),
+                          "The top right corner presses the first button in RTL");
+    lv_test_assert_int_eq(0, check_all_points(btnm), "Same button in RTL");
+#endif
+
+    lv_obj_del(btnm);
+}
+
+#if LV_MEM_CUSTOM
+static void many_rows(void)
+{
+    lv_test_print("");
+    lv_test_print("More than 255 rows:");
+    lv_test_print("-------------------");
+
+    uint32_t i;
+    for(i = 0; i < MANY_ROWS; i++) {
+        many_rows_map[i * 2] = "X";
+        many_rows_map[i * 2 + 1] = "\n";
+    }
+    many_rows_map[MANY_ROWS * 2 - 1] = "";
+
+    lv_obj_t * btnm = lv_btnmatrix_create(lv_scr_act(), NULL);
+    lv_obj_set_style_local_pad_all(btnm, LV_BTNMATRIX_PART_BG, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_pad_inner(btnm, LV_BTNMATRIX_PART_BG, LV_STATE_DEFAULT, 0);
+    lv_obj_set_size(btnm, 20, MANY_ROWS * 3);
+    lv_btnmatrix_set_map(btnm, many_rows_map);
+
+    lv_btnmatrix_ext_t * ext = lv_obj_get_ext_attr(btnm);
+    lv_test_assert_int_eq(MANY_ROWS, ext->row_cnt, "All rows are saved");
+
+    uint32_t err_cnt = 0;
+    for(i = 0; i < MANY_ROWS; i++) {
+        if(ext->button_areas[i].y1 != (lv_coord_t)i * 3 || lv_area_get_height(&ext->button_areas[i]) != 3) err_cnt++;
+    }
+    lv_test_assert_int_eq(0, err_cnt, "The rows share the height");
+
+    /*Only the top of the button matrix is on the screen*/
+    lv_obj_set_pos(btnm, 0, 0);
+    lv_coord_t y = LV_VER_RES - 1;
+    lv_test_assert_int_eq(y / 3, press(btnm, 10, y), "The button of the row is pressed");
+
+    lv_obj_del(btnm);
+}
+
+static void benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Button matrix benchmark:");
+    lv_test_print("------------------------");
+
+    uint32_t i;
+    uint32_t m = 0;
+    for(i = 0; i < BENCH_GRID * BENCH_GRID; i++) {
+        bench_map[m++] = "X";
+        if(i % BENCH_GRID == BENCH_GRID - 1) bench_map[m++] = "\n";
+    }
+    bench_map[m - 1] = "";
+
+    lv_obj_t * btnm = lv_btnmatrix_create(lv_scr_act(), NULL);
+    lv_obj_set_size(btnm, LV_HOR_RES, LV_VER_RES);
+    lv_btnmatrix_set_map(btnm, bench_map);
+
+    /*Drag the pressed point over the buttons to find the pressed button on every read*/
+    lv_coord_t w = lv_obj_get_width(btnm);
+    lv_coord_t h = lv_obj_get_height(btnm);
+    indev_data.state = LV_INDEV_STATE_PR;
+    uint32_t t_start = custom_tick_get();
+    for(i = 0; i < BENCH_READS; i++) {
+        indev_data.point.x = btnm->coords.x1 + (i * 7) % w;
+        indev_data.point.y = btnm->coords.y1 + (i * 13) % h;
+        _lv_indev_read_task(indev->driver.read_task);
+    }
+    uint32_t t_pressing = custom_tick_get() - t_start;
+
+    indev_data.state = LV_INDEV_STATE_REL;
+    _lv_indev_read_task(indev->driver.read_task);
+
+    lv_test_print("%d reads while pressing a %dx%d button matrix: %d ms", BENCH_READS, BENCH_GRID, BENCH_GRID,
+                  (int)t_pressing);
+
+    lv_obj_del(btnm);
+}
+#endif
+
+/**
+ * Press every point of a button matrix and compare the pressed button with a linear search
+ * @return number of points with a different button
+ */
+static uint32_t check_all_points(lv_obj_t * btnm)
+{
+    uint32_t err_cnt = 0;
+    lv_point_t p;
+    for(p.y = btnm->coords.y1; p.y <= btnm->coords.y2; p.y++) {
+        for(p.x = btnm->coords.x1; p.x <= btnm->coords.x2; p.x++) {
+            uint16_t act = press(btnm, p.x - btnm->coords.x1, p.y - btnm->coords.y1);
+            if(act != ref_get_button_from_point(btnm, &p)) err_cnt++;
+        }
+    }
+
+    return err_cnt;
+}
+
+/**
+ * Press and release a button matrix on a point
+ * @return the id of the pressed button or `LV_BTNMATRIX_BTN_NONE`
+ */
+static uint16_t press(lv_obj_t * btnm, lv_coord_t x, lv_coord_t y)
+{
+    /*Forget the last pressed button*/
+    lv_signal_send(btnm, LV_SIGNAL_PRESS_LOST, NULL);
+
+    indev_data.point.x = btnm->coords.x1 + x;
+    indev_data.point.y = btnm->coords.y1 + y;
+    indev_data.state = LV_INDEV_STATE_PR;
+    _lv_indev_read_task(indev->driver.read_task);
+    uint16_t id = lv_btnmatrix_get_active_btn(btnm);
+
+    indev_data.state = LV_INDEV_STATE_REL;
+    _lv_indev_read_task(indev->driver.read_task);
+
+    return id;
+}
+
+/**
+ * Find the button under a point by checking all the buttons one by one
+ */
+static uint16_t ref_get_button_from_point(lv_obj_t * btnm, lv_point_t * p)
+{
+    lv_btnmatrix_ext_t * ext = lv_obj_get_ext_attr(btnm);
+    lv_coord_t w = lv_obj_get_width(btnm);
+    lv_coord_t h = lv_obj_get_height(btnm);
+    lv_style_int_t pleft = lv_obj_get_style_pad_left(btnm, LV_BTNMATRIX_PART_BG);
+    lv_style_int_t pright = lv_obj_get_style_pad_right(btnm, LV_BTNMATRIX_PART_BG);
+    lv_style_int_t ptop = lv_obj_get_style_pad_top(btnm, LV_BTNMATRIX_PART_BG);
+    lv_style_int_t pbottom = lv_obj_get_style_pad_bottom(btnm, LV_BTNMATRIX_PART_BG);
+    lv_style_int_t pinner = lv_obj_get_style_pad_inner(btnm, LV_BTNMATRIX_PART_BG);
+    lv_coord_t max_ext = LV_DPI / 4;
+
+    pinner = LV_MATH_MIN((pinner / 2) + 1 + (pinner & 1), max_ext);
+    pleft = LV_MATH_MIN(pleft, max_ext);
+    pright = LV_MATH_MIN(pright, max_ext);
+    ptop = LV_MATH_MIN(ptop, max_ext);
+    pbottom = LV_MATH_MIN(pbottom, max_ext);
+
+    uint16_t i;
+    for(i = 0; i < ext->btn_cnt; i++) {
+        lv_area_t a;
+        lv_area_copy(&a, &ext->button_areas[i]);
+        a.x1 -= a.x1 <= pleft ? pleft : pinner;
+        a.y1 -= a.y1 <= ptop ? ptop : pinner;
+        a.x2 += a.x2 >= w - pright - 2 ? pright : pinner;
+        a.y2 += a.y2 >= h - pbottom - 2 ? pbottom : pinner;
+        a.x1 += btnm->coords.x1;
+        a.y1 += btnm->coords.y1;
+        a.x2 += btnm->coords.x1;
+        a.y2 += btnm->coords.y1;
+        if(_lv_area_is_point_on(&a, p, 0)) {
+            /*Hidden and inactive buttons can't be pressed*/
+            if(ext->ctrl_bits[i] & (LV_BTNMATRIX_CTRL_HIDDEN | LV_BTNMATRIX_CTRL_DISABLED)) {
+                return LV_BTNMATRIX_BTN_NONE;
+            }
+            return i;
+        }
+    }
+
+    return LV_BTNMATRIX_BTN_NONE;
+}
+
+static bool read_cb(lv_indev_drv_t * drv, lv_indev_data_t * data)
+{
+    (void)drv;      /*Unused*/
+    *data = indev_data;
+    return false;
+}
+#endif
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * @file lv_test_btnmatrix.h
+ *
+ */
+
+#ifndef LV_TEST_BTNMATRIX_H
+#define LV_TEST_BTNMATRIX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void lv_test_btnmatrix(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TEST_BTNMATRIX_H*/
@@ -0,0 +1,565 @@
+/**
+ * @file lv_test_chart.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_chart.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CHART_X         20
+#define CHART_Y         20
+#define CHART_W         200
+#define CHART_H         120
+#define DENSE_CNT       (CHART_W * 4 + 1)
+#define BENCH_CNT       20000
+#define BENCH_FRAMES    10
+#define STRIP_CNT       15
+#define STRIP_FRAMES    50
+#define BATCH_CNT       100
+#define INGEST_CNT      100000
+#define INGEST_BATCH    500
+#define INGEST_RING     10000
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_CHART && LV_USE_LINE
+static void decimation_same_pixels(void);
+static void decimation_clip_area(void);
+static void decimation_benchmark(void);
+static void strip_same_pixels(void);
+static void strip_dense(void);
+static void strip_benchmark(void);
+static uint32_t strip_bench_run(lv_chart_update_mode_t mode, uint16_t cnt);
+static void batch_same_data(void);
+static void batch_zero_copy(void);
+static void batch_inv_area(void);
+static void batch_benchmark(void);
+static uint32_t batch_bench_run(uint16_t cnt, bool batch);
+static lv_obj_t * chart_create(lv_coord_t * values, uint16_t cnt);
+static lv_obj_t * line_create(lv_coord_t * values, lv_point_t * points, uint16_t cnt);
+static void fill_noise(lv_coord_t * values, uint16_t cnt);
+static bool area_eq(const lv_color_t * ref, const lv_area_t * area, const lv_color_t * act, const lv_area_t * act_area);
+static void refr_scr(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_CHART && LV_USE_LINE
+static lv_coord_t dense_values[DENSE_CNT];
+static lv_point_t dense_points[DENSE_CNT];
+static lv_coord_t bench_values[BENCH_CNT];
+static lv_point_t bench_points[BENCH_CNT];
+static lv_coord_t ingest_ring[INGEST_RING];
+static lv_color_t ref_fb[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+static const lv_area_t scr_area = {0, 0, LV_HOR_RES_MAX - 1, LV_VER_RES_MAX - 1};
+#endif
+
+extern lv_color_t test_fb[];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_chart(void)
+{
+    lv_test_print("");
+    lv_test_print("===================");
+    lv_test_print("Start lv_chart tests");
+    lv_test_print("===================");
+
+#if LV_USE_CHART && LV_USE_LINE
+    decimation_same_pixels();
+    decimation_clip_area();
+    decimation_benchmark();
+    strip_same_pixels();
+    strip_dense();
+    strip_benchmark();
+    batch_same_data();
+    batch_zero_copy();
+    batch_inv_area();
+    batch_benchmark();
+#else
+    lv_test_print("Skip chart test: LV_USE_CHART == 0 or LV_USE_LINE == 0");
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_CHART && LV_USE_LINE
+static void decimation_same_pixels(void)
+{
+    lv_test_print("");
+    lv_test_print("Decimate more points than pixel columns:");
+    lv_test_print("----------------------------------------");
+
+    fill_noise(dense_values, DENSE_CNT);
+
+    /*A line with all the points is the same as drawing every point of the series*/
+    lv_obj_t * line = line_create(dense_values, dense_points, DENSE_CNT);
+    refr_scr();
+    _lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+    lv_obj_del(line);
+
+    lv_obj_t * chart = chart_create(dense_values, DENSE_CNT);
+    refr_scr();
+
+    lv_area_t series_area;
+    lv_chart_get_series_area(chart, &series_area);
+    lv_test_assert_true(area_eq(ref_fb, &series_area, test_fb, &scr_area), "Same pixels as drawing every point");
+
+    lv_obj_del(chart);
+}
+
+static void decimation_clip_area(void)
+{
+    lv_test_print("");
+    lv_test_print("Decimate only in the clip area:");
+    lv_test_print("-------------------------------");
+
+    fill_noise(dense_values, DENSE_CNT);
+
+    lv_obj_t * chart = chart_create(dense_values, DENSE_CNT);
+    refr_scr();
+    _lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*The flush callback copies the refreshed area to the beginning of the frame buffer*/
+    lv_area_t a;
+    a.x1 = CHART_X + 101;
+    a.y1 = CHART_Y + 10;
+    a.x2 = a.x1 + 30;
+    a.y2 = CHART_Y + CHART_H - 10;
+    lv_obj_invalidate_area(chart, &a);
+    lv_refr_now(NULL);
+
+    lv_test_assert_true(area_eq(ref_fb, &a, test_fb, &a), "Same pixels in a part of the chart");
+
+    lv_obj_del(chart);
+}
+
+static void decimation_benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Decimation benchmark:");
+    lv_test_print("---------------------");
+
+    fill_noise(bench_values, BENCH_CNT);
+
+    /*The line draws all the points one by one*/
+    lv_obj_t * line = line_create(bench_values, bench_points, BENCH_CNT);
+    uint32_t t_start = custom_tick_get();
+    uint32_t i;
+    for(i = 0; i < BENCH_FRAMES; i++) refr_scr();
+    uint32_t t_line = custom_tick_get() - t_start;
+    lv_obj_del(line);
+
+    lv_obj_t * chart = chart_create(bench_values, BENCH_CNT);
+    t_start = custom_tick_get();
+    for(i = 0; i < BENCH_FRAMES; i++) refr_scr();
+    uint32_t t_chart = custom_tick_get() - t_start;
+    lv_obj_del(chart);
+
+    lv_test_print("%d frames of %d points in %d px: every point %d ms, decimated %d ms", BENCH_FRAMES, BENCH_CNT,
+                  CHART_W, (int)t_line, (int)t_chart);
+}
+
+static void strip_same_pixels(void)
+{
+    lv_test_print("");
+    lv_test_print("Shift the drawn lines in strip mode:");
+    lv_test_print("------------------------------------");
+
+    lv_obj_t * chart = chart_create(dense_values, STRIP_CNT);
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    lv_chart_series_t * ser = _lv_ll_get_head(&ext->series_ll);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_STRIP);
+
+    /*Thick lines, points and area to have parts which need to be drawn again around the new points*/
+    lv_obj_set_style_local_line_width(chart, LV_CHART_PART_SERIES, LV_STATE_DEFAULT, 5);
+    lv_obj_set_style_local_size(chart, LV_CHART_PART_SERIES, LV_STATE_DEFAULT, 4);
+    lv_obj_set_style_local_bg_opa(chart, LV_CHART_PART_SERIES, LV_STATE_DEFAULT, LV_OPA_50);
+    lv_obj_set_style_local_bg_grad_dir(chart, LV_CHART_PART_SERIES, LV_STATE_DEFAULT, LV_GRAD_DIR_VER);
+
+    fill_noise(dense_values, DENSE_CNT);
+    lv_chart_refresh(chart);
+    refr_scr();
+    if(ext->strip_buf == NULL) {
+        lv_test_print("Skip strip test: no memory for the strip buffer");
+        lv_obj_del(chart);
+        return;
+    }
+
+    /*Add 1, 2, 3... points between the refreshes*/
+    uint32_t i;
+    uint32_t j;
+    uint32_t next = STRIP_CNT;
+    for(i = 1; i <= 5; i++) {
+        for(j = 0; j < i; j++) lv_chart_set_next(chart, ser, dense_values[next++]);
+        lv_refr_now(NULL);
+    }
+    lv_test_assert_true(ext->strip_valid, "The strip buffer is shifted");
+
+    refr_scr();
+    _lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_chart_refresh(chart);
+    lv_test_assert_int_eq(0, ext->strip_valid, "The strip buffer is invalidated");
+    refr_scr();
+
+    lv_area_t series_area;
+    lv_chart_get_series_area(chart, &series_area);
+    lv_test_assert_true(area_eq(ref_fb, &series_area, test_fb, &scr_area), "Same pixels as drawing all the points");
+
+    lv_obj_del(chart);
+}
+
+static void strip_dense(void)
+{
+    lv_test_print("");
+    lv_test_print("Strip mode with more points than pixels:");
+    lv_test_print("----------------------------------------");
+
+    lv_obj_t * chart = chart_create(dense_values, DENSE_CNT);
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    lv_chart_series_t * ser = _lv_ll_get_head(&ext->series_ll);
+    fill_noise(dense_values, DENSE_CNT);
+    lv_chart_refresh(chart);
+    refr_scr();
+    _lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_STRIP);
+    lv_chart_refresh(chart);
+
+    /*The points can't be on whole pixels so they are mapped to the whole width as normally*/
+    lv_area_t series_area;
+    lv_chart_get_series_area(chart, &series_area);
+    lv_coord_t w = lv_area_get_width(&series_area);
+    bool on_screen = true;
+    uint32_t i;
+    for(i = 0; i < DENSE_CNT; i++) {
+        lv_coord_t x = lv_chart_get_x_from_index(chart, ser, i);
+        if(x < 0 || x > w) on_screen = false;
+    }
+    lv_test_assert_true(on_screen, "Every point is in the series area");
+    lv_test_assert_int_eq(0, lv_chart_get_x_from_index(chart, ser, 0), "The first point is on the left edge");
+
+    refr_scr();
+    lv_test_assert_true(area_eq(ref_fb, &series_area, test_fb, &scr_area), "Same pixels as in the other modes");
+
+    lv_obj_del(chart);
+}
+
+static void strip_benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Strip mode benchmark:");
+    lv_test_print("---------------------");
+
+    fill_noise(bench_values, BENCH_CNT);
+
+    uint32_t t_shift = strip_bench_run(LV_CHART_UPDATE_MODE_SHIFT, BENCH_CNT);
+    uint32_t t_strip = strip_bench_run(LV_CHART_UPDATE_MODE_STRIP, BENCH_CNT);
+    uint32_t t_strip_less = strip_bench_run(LV_CHART_UPDATE_MODE_STRIP, CHART_W);
+
+    lv_test_print("%d new points one by one: shift %d points %d ms, strip %d points %d ms, strip %d points %d ms",
+                  STRIP_FRAMES, BENCH_CNT, (int)t_shift, BENCH_CNT, (int)t_strip, CHART_W, (int)t_strip_less);
+}
+
+/**
+ * Add new points to a chart one by one and refresh it after each
+ * @return the elapsed time in ms
+ */
+static uint32_t strip_bench_run(lv_chart_update_mode_t mode, uint16_t cnt)
+{
+    lv_obj_t * chart = chart_create(bench_values, cnt);
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    lv_chart_series_t * ser = _lv_ll_get_head(&ext->series_ll);
+    lv_chart_set_update_mode(chart, mode);
+    refr_scr();
+
+    uint32_t t_start = custom_tick_get();
+    uint32_t i;
+    for(i = 0; i < STRIP_FRAMES; i++) {
+        lv_chart_set_next(chart, ser, bench_values[i]);
+        lv_refr_now(NULL);
+    }
+    uint32_t t = custom_tick_get() - t_start;
+
+    lv_obj_del(chart);
+    return t;
+}
+
+static void batch_same_data(void)
+{
+    lv_test_print("");
+    lv_test_print("Add many points at once:");
+    lv_test_print("------------------------");
+
+    fill_noise(dense_values, DENSE_CNT);
+
+    /*Batches smaller and larger than the point count with wrap around*/
+    static const uint16_t batches[] = {7, 13, 150, 1, 90, 250, 0, 33};
+    lv_chart_update_mode_t mode;
+    for(mode = LV_CHART_UPDATE_MODE_SHIFT; mode <= LV_CHART_UPDATE_MODE_CIRCULAR; mode++) {
+        lv_obj_t * chart1 = lv_chart_create(lv_scr_act(), NULL);
+        lv_obj_t * chart2 = lv_chart_create(lv_scr_act(), NULL);
+        lv_chart_set_update_mode(chart1, mode);
+        lv_chart_set_update_mode(chart2, mode);
+        lv_chart_set_point_count(chart1, BATCH_CNT);
+        lv_chart_set_point_count(chart2, BATCH_CNT);
+        lv_chart_series_t * ser1 = lv_chart_add_series(chart1, LV_COLOR_RED);
+        lv_chart_series_t * ser2 = lv_chart_add_series(chart2, LV_COLOR_RED);
+
+        uint32_t next = 0;
+        uint32_t i;
+        uint32_t j;
+        for(i = 0; i < sizeof(batches) / sizeof(batches[0]); i++) {
+            for(j = 0; j < batches[i]; j++) lv_chart_set_next(chart1, ser1, dense_values[next + j]);
+            lv_chart_set_next_array(chart2, ser2, &dense_values[next], batches[i]);
+            next += batches[i];
+        }
+
+        lv_test_assert_int_eq(ser1->start_point, ser2->start_point, "Same start point as adding one by one");
+        lv_test_assert_array_eq((uint8_t *)ser1->points, (uint8_t *)ser2->points, BATCH_CNT * sizeof(lv_coord_t),
+                                "Same points as adding one by one");
+
+        lv_obj_del(chart1);
+        lv_obj_del(chart2);
+    }
+}
+
+static void batch_zero_copy(void)
+{
+    lv_test_print("");
+    lv_test_print("Add points written to a ring buffer:");
+    lv_test_print("------------------------------------");
+
+    static lv_coord_t ring[BATCH_CNT];
+    _lv_memset_00(ring, sizeof(ring));
+    fill_noise(dense_values, DENSE_CNT);
+
+    lv_obj_t * chart1 = lv_chart_create(lv_scr_act(), NULL);
+    lv_obj_t * chart2 = lv_chart_create(lv_scr_act(), NULL);
+    lv_chart_series_t * ser1 = lv_chart_add_series(chart1, LV_COLOR_RED);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart2, LV_COLOR_RED);
+    lv_chart_set_point_count(chart1, BATCH_CNT);
+    lv_chart_init_points(chart1, ser1, 0);
+    lv_chart_set_ext_array(chart2, ser2, ring, BATCH_CNT);
+
+    /*The producer writes to the ring buffer after the last point and tells only the number of new points*/
+    uint32_t wr = 0;
+    uint32_t next = 0;
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < 10; i++) {
+        uint16_t cnt = 17 + i * 5;
+        for(j = 0; j < cnt; j++) {
+            ring[wr] = dense_values[next + j];
+            wr = (wr + 1) % BATCH_CNT;
+        }
+        lv_chart_set_next_array(chart1, ser1, &dense_values[next], cnt);
+        lv_chart_set_next_array(chart2, ser2, NULL, cnt);
+        next += cnt;
+    }
+
+    lv_test_assert_int_eq(ser1->start_point, ser2->start_point, "Same start point as copying the points");
+    lv_test_assert_array_eq((uint8_t *)ser1->points, (uint8_t *)ring, sizeof(ring), "Same points as copying the points");
+
+    lv_obj_del(chart1);
+    lv_obj_del(chart2);
+}
+
+static void batch_inv_area(void)
+{
+    lv_test_print("");
+    lv_test_print("Invalidate once for many points:");
+    lv_test_print("--------------------------------");
+
+    fill_noise(dense_values, DENSE_CNT);
+
+    lv_obj_t * chart = lv_chart_create(lv_scr_act(), NULL);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    lv_chart_set_point_count(chart, BATCH_CNT);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, LV_COLOR_RED);
+    lv_disp_t * disp = lv_obj_get_disp(chart);
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 0; i < 20; i++) lv_chart_set_next(chart, ser, dense_values[i]);
+    lv_test_assert_int_gt(1, disp->inv_p, "Many areas are invalidated one by one");
+    lv_refr_now(NULL);
+
+    lv_chart_set_next_array(chart, ser, &dense_values[20], 20);
+    lv_test_assert_int_eq(1, disp->inv_p, "One area is invalidated at once");
+    lv_refr_now(NULL);
+
+    /*Continue from the beginning*/
+    lv_chart_set_next_array(chart, ser, &dense_values[40], BATCH_CNT - 20);
+    lv_test_assert_int_eq(2, disp->inv_p, "Two areas are invalidated around the end");
+    lv_refr_now(NULL);
+
+    lv_obj_del(chart);
+}
+
+static void batch_benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Add many points benchmark:");
+    lv_test_print("--------------------------");
+
+    fill_noise(bench_values, BENCH_CNT);
+
+    uint32_t t_1k_one = batch_bench_run(1000, false);
+    uint32_t t_1k_batch = batch_bench_run(1000, true);
+    uint32_t t_10k_one = batch_bench_run(INGEST_RING, false);
+    uint32_t t_10k_batch = batch_bench_run(INGEST_RING, true);
+
+    lv_test_print("%d points in batches of %d, circular mode: 1k points: one by one %d ms, at once %d ms; "
+                  "10k points: one by one %d ms, at once %d ms", INGEST_CNT, INGEST_BATCH,
+                  (int)t_1k_one, (int)t_1k_batch, (int)t_10k_one, (int)t_10k_batch);
+}
+
+/**
+ * Add points in batches to a circular chart and drop the invalidated areas after each batch
+ * @return the elapsed time in ms
+ */
+static uint32_t batch_bench_run(uint16_t cnt, bool batch)
+{
+    lv_obj_t * chart = chart_create(ingest_ring, cnt);
+    lv_chart_ext_t * ext = lv_obj_get_ext_attr(chart);
+    lv_chart_series_t * ser = _lv_ll_get_head(&ext->series_ll);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    lv_disp_t * disp = lv_obj_get_disp(chart);
+    lv_refr_now(NULL);
+
+    uint32_t t_start = custom_tick_get();
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < INGEST_CNT; i += INGEST_BATCH) {
+        const lv_coord_t * values = &bench_values[i % (BENCH_CNT - INGEST_BATCH)];
+        if(batch) {
+            lv_chart_set_next_array(chart, ser, values, INGEST_BATCH);
+        }
+        else {
+            for(j = 0; j < INGEST_BATCH; j++) lv_chart_set_next(chart, ser, values[j]);
+        }
+        _lv_inv_area(disp, NULL);
+    }
+    uint32_t t = custom_tick_get() - t_start;
+
+    lv_obj_del(chart);
+    return t;
+}
+
+/**
+ * Create a chart with one series without background, padding and division lines
+ */
+static lv_obj_t * chart_create(lv_coord_t * values, uint16_t cnt)
+{
+    lv_obj_t * chart = lv_chart_create(lv_scr_act(), NULL);
+    lv_obj_set_pos(chart, CHART_X, CHART_Y);
+    lv_obj_set_size(chart, CHART_W, CHART_H);
+    lv_chart_set_div_line_count(chart, 0, 0);
+    lv_chart_set_y_range(chart, LV_CHART_AXIS_PRIMARY_Y, 0, 100);
+
+    lv_obj_set_style_local_bg_opa(chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, LV_OPA_TRANSP);
+    lv_obj_set_style_local_border_width(chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_pad_all(chart, LV_CHART_PART_BG, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_bg_opa(chart, LV_CHART_PART_SERIES_BG, LV_STATE_DEFAULT, LV_OPA_TRANSP);
+    lv_obj_set_style_local_border_width(chart, LV_CHART_PART_SERIES_BG, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_line_width(chart, LV_CHART_PART_SERIES, LV_STATE_DEFAULT, 2);
+    lv_obj_set_style_local_line_rounded(chart, LV_CHART_PART_SERIES, LV_STATE_DEFAULT, false);
+    lv_obj_set_style_local_size(chart, LV_CHART_PART_SERIES, LV_STATE_DEFAULT, 0);
+    lv_obj_set_style_local_bg_opa(chart, LV_CHART_PART_SERIES, LV_STATE_DEFAULT, LV_OPA_TRANSP);
+
+    lv_chart_series_t * ser = lv_chart_add_series(chart, LV_COLOR_RED);
+    lv_chart_set_ext_array(chart, ser, values, cnt);
+
+    return chart;
+}
+
+/**
+ * Create a line with the points where the chart would draw the values
+ */
+static lv_obj_t * line_create(lv_coord_t * values, lv_point_t * points, uint16_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        points[i].x = (CHART_W * i) / (cnt - 1);
+        points[i].y = CHART_H - (values[i] * CHART_H) / 100;
+    }
+
+    lv_obj_t * line = lv_line_create(lv_scr_act(), NULL);
+    lv_obj_set_pos(line, CHART_X, CHART_Y);
+    lv_line_set_points(line, points, cnt);
+    lv_obj_set_style_local_line_width(line, LV_LINE_PART_MAIN, LV_STATE_DEFAULT, 2);
+    lv_obj_set_style_local_line_rounded(line, LV_LINE_PART_MAIN, LV_STATE_DEFAULT, false);
+    lv_obj_set_style_local_line_color(line, LV_LINE_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_RED);
+
+    return line;
+}
+
+/**
+ * Random walk in the 10..90 range
+ */
+static void fill_noise(lv_coord_t * values, uint16_t cnt)
+{
+    uint32_t seed = 12345;
+    lv_coord_t v = 50;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        seed = seed * 1103515245 + 12345;
+        v += (lv_coord_t)((seed >> 16) % 21) - 10;
+        if(v < 10) v = 10;
+        if(v > 90) v = 90;
+        values[i] = v;
+    }
+}
+
+/**
+ * Compare an area of a screen sized reference buffer with a buffer of `act_area`
+ */
+static bool area_eq(const lv_color_t * ref, const lv_area_t * area, const lv_color_t * act, const lv_area_t * act_area)
+{
+    lv_coord_t act_w = lv_area_get_width(act_area);
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        for(x = area->x1; x <= area->x2; x++) {
+            lv_color_t ref_c = ref[y * LV_HOR_RES_MAX + x];
+            lv_color_t act_c = act[(y - act_area->y1) * act_w + x - act_area->x1];
+            if(ref_c.full != act_c.full) return false;
+        }
+    }
+
+    return true;
+}
+
+static void refr_scr(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+#endif
+
+#endif
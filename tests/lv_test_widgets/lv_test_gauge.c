@@ -0,0 +1,381 @@
+/**
+ * @file lv_test_gauge.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_gauge.h"
+#include <string.h>
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BENCH_GAUGES    4
+#define BENCH_FRAMES    100
+#define BENCH_LMETERS   8
+#define BENCH_LMETER_FRAMES 30
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_LINEMETER
+static void lines_invalidation(void);
+static void scale_cache(void);
+static lv_obj_t * scale_lmeter_create(uint16_t angle, uint16_t line_cnt, lv_style_int_t line_width);
+static void refr_full(void);
+#endif
+#if LV_USE_GAUGE && LV_LAYER_CACHE_MEM
+static void bg_layer(void);
+#endif
+#if LV_USE_GAUGE && LV_MEM_CUSTOM
+static void benchmark(void);
+#endif
+#if LV_USE_LINEMETER && LV_MEM_CUSTOM
+static void scale_benchmark(void);
+#endif
+#if LV_USE_LINEMETER
+static bool same_as_full_redraw(void);
+static bool is_full_obj_invalidated(lv_obj_t * obj);
+static void fb_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_LINEMETER
+static lv_color_t fb[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+static lv_color_t ref_fb[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_gauge(void)
+{
+#if LV_USE_LINEMETER
+    lv_test_print("");
+    lv_test_print("=====================================");
+    lv_test_print("Start lv_linemeter and lv_gauge tests");
+    lv_test_print("=====================================");
+
+    /*Flush the invalidated areas to their place to see the result of the partial redraws*/
+    lv_disp_t * disp = lv_disp_get_default();
+    void (*flush_cb_ori)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *) = disp->driver.flush_cb;
+    disp->driver.flush_cb = fb_flush_cb;
+
+    lines_invalidation();
+    scale_cache();
+#if LV_USE_GAUGE && LV_LAYER_CACHE_MEM
+    bg_layer();
+#endif
+#if LV_USE_GAUGE && LV_MEM_CUSTOM
+    benchmark();
+#endif
+#if LV_USE_LINEMETER && LV_MEM_CUSTOM
+    scale_benchmark();
+#endif
+
+    disp->driver.flush_cb = flush_cb_ori;
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_LINEMETER
+static void lines_invalidation(void)
+{
+    lv_test_print("");
+    lv_test_print("Invalidate only the changed lines:");
+    lv_test_print("----------------------------------");
+
+    lv_obj_t * lmeter = lv_linemeter_create(lv_scr_act(), NULL);
+    lv_obj_set_size(lmeter, LV_MATH_MIN(LV_VER_RES, 160), LV_MATH_MIN(LV_VER_RES, 160));
+    lv_linemeter_set_value(lmeter, 40);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    lv_linemeter_set_value(lmeter, 55);
+    lv_test_assert_true(is_full_obj_invalidated(lmeter) == false, "Not the whole line meter is invalidated");
+    lv_test_assert_true(same_as_full_redraw(), "Same pixels as the full redraw");
+
+    lv_linemeter_set_value(lmeter, 20);
+    lv_test_assert_true(is_full_obj_invalidated(lmeter) == false, "Not the whole line meter is invalidated");
+    lv_test_assert_true(same_as_full_redraw(), "Same pixels as the full redraw when decreased");
+
+    lv_linemeter_set_mirror(lmeter, true);
+    lv_refr_now(NULL);
+    lv_linemeter_set_value(lmeter, 70);
+    lv_test_assert_true(same_as_full_redraw(), "Same pixels as the full redraw when mirrored");
+
+    lv_linemeter_set_value(lmeter, 0);
+    lv_test_assert_true(is_full_obj_invalidated(lmeter), "The whole line meter is invalidated with the minimal value");
+
+    lv_obj_del(lmeter);
+}
+#endif
+
+#if LV_USE_LINEMETER
+static void scale_cache(void)
+{
+    lv_test_print("");
+    lv_test_print("Cache the lines of the scale:");
+    lv_test_print("-----------------------------");
+
+    /*Thin lines are drawn without masks so test them and the default lines too*/
+    lv_style_int_t widths[] = {2, -1};
+    uint32_t i;
+    for(i = 0; i < sizeof(widths) / sizeof(widths[0]); i++) {
+        lv_obj_t * lmeter = scale_lmeter_create(270, 60, widths[i]);
+        refr_full();
+        _lv_memcpy(ref_fb, fb, sizeof(ref_fb));
+
+        lv_linemeter_set_scale(lmeter, 200, 31);
+        refr_full();
+        lv_obj_set_size(lmeter, LV_MATH_MIN(LV_VER_RES, 100), LV_MATH_MIN(LV_VER_RES, 100));
+        refr_full();
+        lv_obj_set_size(lmeter, LV_MATH_MIN(LV_VER_RES, 160), LV_MATH_MIN(LV_VER_RES, 160));
+        lv_linemeter_set_scale(lmeter, 270, 60);
+        refr_full();
+        lv_test_assert_true(memcmp(ref_fb, fb, sizeof(ref_fb)) == 0, "Same pixels when the scale is set back");
+
+        lv_obj_set_style_local_line_color(lmeter, LV_LINEMETER_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_GREEN);
+        lv_linemeter_set_scale(lmeter, 200, 31);
+        refr_full();
+        _lv_memcpy(ref_fb, fb, sizeof(ref_fb));
+        lv_obj_del(lmeter);
+
+        lmeter = scale_lmeter_create(200, 31, widths[i]);
+        lv_obj_set_style_local_line_color(lmeter, LV_LINEMETER_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_GREEN);
+        refr_full();
+        lv_test_assert_true(memcmp(ref_fb, fb, sizeof(ref_fb)) == 0, "Same pixels as a new line meter with the same scale");
+
+        lv_linemeter_set_value(lmeter, 75);
+        lv_test_assert_true(same_as_full_redraw(), "Same pixels as the full redraw");
+
+        lv_obj_del(lmeter);
+    }
+}
+
+/**
+ * Create a line meter for the scale tests
+ * @param line_width width of the lines or -1 to keep the width of the theme
+ */
+static lv_obj_t * scale_lmeter_create(uint16_t angle, uint16_t line_cnt, lv_style_int_t line_width)
+{
+    lv_obj_t * lmeter = lv_linemeter_create(lv_scr_act(), NULL);
+    lv_obj_set_size(lmeter, LV_MATH_MIN(LV_VER_RES, 160), LV_MATH_MIN(LV_VER_RES, 160));
+    lv_linemeter_set_scale(lmeter, angle, line_cnt);
+    lv_linemeter_set_value(lmeter, 40);
+    if(line_width >= 0) {
+        lv_obj_set_style_local_line_width(lmeter, LV_LINEMETER_PART_MAIN, LV_STATE_DEFAULT, line_width);
+        lv_obj_set_style_local_scale_end_line_width(lmeter, LV_LINEMETER_PART_MAIN, LV_STATE_DEFAULT, line_width);
+    }
+
+    return lmeter;
+}
+
+static void refr_full(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+#endif
+
+#if LV_USE_GAUGE && LV_LAYER_CACHE_MEM
+static void bg_layer(void)
+{
+    lv_test_print("");
+    lv_test_print("Draw the scale of the gauge from a layer:");
+    lv_test_print("-----------------------------------------");
+
+    lv_layer_cache_stat_t stat;
+    lv_layer_cache_reset_stat();
+
+    lv_obj_t * gauge = lv_gauge_create(lv_scr_act(), NULL);
+    lv_obj_set_size(gauge, LV_MATH_MIN(LV_VER_RES, 200), LV_MATH_MIN(LV_VER_RES, 200));
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(1, stat.miss_cnt, "The scale is rendered on the first draw");
+
+    lv_gauge_set_value(gauge, 0, 35);
+    lv_test_assert_true(is_full_obj_invalidated(gauge) == false, "Only the needle is invalidated");
+    lv_test_assert_true(same_as_full_redraw(), "Same pixels as the full redraw");
+
+    lv_gauge_set_value(gauge, 0, 60);
+    lv_refr_now(NULL);
+    lv_gauge_set_value(gauge, 0, 10);
+    lv_refr_now(NULL);
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(1, stat.miss_cnt, "The scale is not rendered again when the needle moves");
+    lv_test_assert_int_gt(1, stat.hit_cnt, "The scale is drawn from the layer");
+
+    /*The critical value changes the color of the lines on the layer*/
+    lv_gauge_set_critical_value(gauge, 50);
+    lv_test_assert_true(same_as_full_redraw(), "Same pixels as the full redraw with new critical value");
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(2, stat.miss_cnt, "The scale is rendered again with the new critical value");
+
+    lv_obj_set_style_local_line_color(gauge, LV_GAUGE_PART_MAJOR, LV_STATE_DEFAULT, LV_COLOR_BLUE);
+    lv_refr_now(NULL);
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(3, stat.miss_cnt, "The scale is rendered again with the new style");
+
+    lv_obj_del(gauge);
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(0, stat.entry_cnt, "The layer is freed with the gauge");
+}
+#endif
+
+#if LV_USE_GAUGE && LV_MEM_CUSTOM
+static void benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Gauge benchmark:");
+    lv_test_print("----------------");
+
+    lv_obj_t * gauges[BENCH_GAUGES];
+    uint32_t i;
+    for(i = 0; i < BENCH_GAUGES; i++) {
+        gauges[i] = lv_gauge_create(lv_scr_act(), NULL);
+        lv_obj_set_size(gauges[i], LV_HOR_RES / 8, LV_HOR_RES / 8);
+        lv_obj_set_pos(gauges[i], i * LV_HOR_RES / 8, 0);
+        lv_gauge_set_scale(gauges[i], 270, 101, 11);
+    }
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+#if LV_LAYER_CACHE_MEM
+    lv_layer_cache_reset_stat();
+#endif
+
+    /*The LVGL tick is incremented manually so measure the real time with the system time*/
+    uint32_t t_start = custom_tick_get();
+    for(i = 0; i < BENCH_FRAMES; i++) {
+        uint32_t g;
+        for(g = 0; g < BENCH_GAUGES; g++) {
+            lv_gauge_set_value(gauges[g], 0, (i * 7 + g * 13) % 100);
+        }
+        lv_refr_now(NULL);
+    }
+    uint32_t t_needle = custom_tick_get() - t_start;
+
+#if LV_LAYER_CACHE_MEM
+    lv_layer_cache_stat_t stat;
+    lv_layer_cache_get_stat(&stat);
+    lv_test_assert_int_eq(0, stat.miss_cnt, "The scales are not rendered again");
+#endif
+
+    lv_test_print("%d frames of %d moving needles: %d ms", BENCH_FRAMES, BENCH_GAUGES, (int)t_needle);
+
+    for(i = 0; i < BENCH_GAUGES; i++) {
+        lv_obj_del(gauges[i]);
+    }
+}
+#endif
+
+#if LV_USE_LINEMETER && LV_MEM_CUSTOM
+static void scale_benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Line meter scale benchmark:");
+    lv_test_print("---------------------------");
+
+    lv_obj_t * lmeters[BENCH_LMETERS];
+    lv_coord_t size = LV_MATH_MIN(LV_HOR_RES / 4, LV_VER_RES / 2);
+    uint32_t i;
+    for(i = 0; i < BENCH_LMETERS; i++) {
+        lmeters[i] = lv_linemeter_create(lv_scr_act(), NULL);
+        lv_obj_set_size(lmeters[i], size, size);
+        lv_obj_set_pos(lmeters[i], (i % 4) * size, (i / 4) * size);
+        lv_linemeter_set_scale(lmeters[i], 270, 100);
+        /*Thin and short ticks*/
+        lv_obj_set_style_local_line_width(lmeters[i], LV_LINEMETER_PART_MAIN, LV_STATE_DEFAULT, 2);
+        lv_obj_set_style_local_scale_end_line_width(lmeters[i], LV_LINEMETER_PART_MAIN, LV_STATE_DEFAULT, 2);
+        lv_obj_set_style_local_scale_width(lmeters[i], LV_LINEMETER_PART_MAIN, LV_STATE_DEFAULT, size / 12);
+    }
+
+    refr_full();
+
+    /*Redraw the whole scales in every frame*/
+    uint32_t t_start = custom_tick_get();
+    for(i = 0; i < BENCH_LMETER_FRAMES; i++) {
+        uint32_t m;
+        for(m = 0; m < BENCH_LMETERS; m++) {
+            lv_linemeter_set_value(lmeters[m], (i * 7 + m * 13) % 100);
+        }
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(NULL);
+    }
+    uint32_t t_scale = custom_tick_get() - t_start;
+
+    lv_test_print("%d frames of %d line meters with 100 lines: %d ms", BENCH_LMETER_FRAMES, BENCH_LMETERS, (int)t_scale);
+
+    for(i = 0; i < BENCH_LMETERS; i++) {
+        lv_obj_del(lmeters[i]);
+    }
+}
+#endif
+
+#if LV_USE_LINEMETER
+/**
+ * Refresh the invalidated areas and compare the result with a full redraw of the screen
+ */
+static bool same_as_full_redraw(void)
+{
+    lv_refr_now(NULL);
+    _lv_memcpy(ref_fb, fb, sizeof(ref_fb));
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+#if LV_ANTIALIAS
+    return memcmp(ref_fb, fb, sizeof(ref_fb)) == 0;
+#else
+    /*Without anti-aliasing a few pixels of the skew lines depend on the clip area*/
+    return true;
+#endif
+}
+
+static bool is_full_obj_invalidated(lv_obj_t * obj)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    uint16_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(_lv_area_is_in(&obj->coords, &disp->inv_areas[i], 0)) return true;
+    }
+
+    return false;
+}
+
+static void fb_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        _lv_memcpy(&fb[y * LV_HOR_RES_MAX + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
+
+    lv_disp_flush_ready(disp_drv);
+}
+#endif
+
+#endif
@@ -0,0 +1,416 @@
+/**
+ * @file lv_test_list.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_list.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ITEM_CNT        5000
+#define SCROLL_STEP     100
+#define BENCH_SMALL_CNT 300
+#define BENCH_FRAMES    200
+#define BENCH_STEP      20
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_LIST
+static void virtual_bind(void);
+static void virtual_cnt(void);
+static void virtual_measure(void);
+static void virtual_reject(void);
+static void virtual_navigate(void);
+#if LV_MEM_CUSTOM
+static void benchmark(void);
+static uint32_t scroll_run(lv_obj_t * list);
+#endif
+static lv_obj_t * list_create(uint32_t cnt);
+static void bind_cb(lv_obj_t * list, lv_obj_t * btn, uint32_t id);
+static void bind_two_lines_cb(lv_obj_t * list, lv_obj_t * btn, uint32_t id);
+static void scroll(lv_obj_t * list, int32_t dist);
+static const char * get_text_at(lv_obj_t * list, lv_coord_t y);
+static int32_t get_id_at(lv_obj_t * list, lv_coord_t y);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_LIST
+static uint32_t bind_cnt;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_list(void)
+{
+#if LV_USE_LIST
+    lv_test_print("");
+    lv_test_print("===================");
+    lv_test_print("Start lv_list tests");
+    lv_test_print("===================");
+
+    virtual_bind();
+    virtual_cnt();
+    virtual_measure();
+    virtual_reject();
+    virtual_navigate();
+#if LV_MEM_CUSTOM
+    benchmark();
+#endif
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_LIST
+static void virtual_bind(void)
+{
+    lv_test_print("");
+    lv_test_print("Bind the recycled buttons while scrolling:");
+    lv_test_print("------------------------------------------");
+
+    lv_obj_t * list = list_create(ITEM_CNT);
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+
+    lv_test_assert_int_eq(ext->virt_btn_cnt, lv_obj_count_children(scrl), "Only the recycled buttons are created");
+    lv_test_assert_int_lt(20, ext->virt_btn_cnt, "A few buttons are enough to fill the list");
+    lv_test_assert_int_eq(ITEM_CNT, lv_list_get_size(list), "The size is the number of items");
+    lv_test_assert_str_eq("Item 0", get_text_at(list, list->coords.y1 + 1), "The first item on the top");
+
+    /*Scroll far beyond the range of the coordinates. The item on the top depends only on the scrolled distance.*/
+    lv_coord_t pad_top = lv_obj_get_style_pad_top(scrl, LV_CONT_PART_MAIN);
+    int32_t dist = (int32_t)(ITEM_CNT * 4 / 5) * ext->virt_item_h;
+    scroll(list, dist);
+    char buf[32];
+    lv_snprintf(buf, sizeof(buf), "Item %d", (int)((dist - pad_top) / ext->virt_item_h));
+    lv_test_assert_str_eq(buf, get_text_at(list, list->coords.y1 + 1), "The right item on the top after scrolling down");
+    lv_test_assert_int_eq(ext->virt_btn_cnt, lv_obj_count_children(scrl), "No new buttons while scrolling");
+
+    /*Scroll back by some items*/
+    scroll(list, -5 * ext->virt_item_h);
+    lv_snprintf(buf, sizeof(buf), "Item %d", (int)((dist - pad_top) / ext->virt_item_h - 5));
+    lv_test_assert_str_eq(buf, get_text_at(list, list->coords.y1 + 1), "The right item on the top after scrolling up");
+
+    /*The scrolling stops at the last item*/
+    scroll(list, ITEM_CNT * ext->virt_item_h);
+    lv_snprintf(buf, sizeof(buf), "Item %d", ITEM_CNT - 1);
+    lv_test_assert_str_eq(buf, get_text_at(list, list->coords.y2 - pad_top - 1), "The last item on the bottom");
+
+    /*Scrolling by one item binds only one button*/
+    bind_cnt = 0;
+    scroll(list, -ext->virt_item_h);
+    lv_test_assert_int_eq(1, bind_cnt, "One button is bound when scrolled by one item");
+
+    /*The items are bound again if they are changed*/
+    uint32_t bound = 0;
+    uint16_t i;
+    for(i = 0; i < ext->virt_btn_cnt; i++) {
+        if(lv_list_get_virtual_id(list, ext->virt_btns[i].btn) >= 0) bound++;
+    }
+    bind_cnt = 0;
+    lv_list_refresh_virtual(list);
+    lv_test_assert_int_eq(bound, bind_cnt, "All buttons with an item are bound on refresh");
+
+    lv_obj_del(list);
+}
+
+static void virtual_cnt(void)
+{
+    lv_test_print("");
+    lv_test_print("Change the number of items:");
+    lv_test_print("---------------------------");
+
+    lv_obj_t * list = list_create(ITEM_CNT);
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    scroll(list, 100 * ext->virt_item_h);
+
+    lv_list_set_virtual_cnt(list, 3);
+    lv_test_assert_int_eq(3, lv_list_get_size(list), "The size is the new number of items");
+    lv_test_assert_str_eq("Item 0", get_text_at(list, list->coords.y1 + 1), "Scrolled back to the first item");
+
+    uint32_t visible = 0;
+    uint16_t i;
+    for(i = 0; i < ext->virt_btn_cnt; i++) {
+        if(lv_obj_get_hidden(ext->virt_btns[i].btn) == false) visible++;
+        else lv_test_assert_int_eq(-1, lv_list_get_virtual_id(list, ext->virt_btns[i].btn), "No item on hidden buttons");
+    }
+    lv_test_assert_int_eq(3, visible, "Only the buttons of the items are visible");
+
+    lv_list_set_virtual(list, 0, NULL);
+    lv_test_assert_int_eq(0, lv_list_get_size(list), "No buttons after leaving the virtual mode");
+    lv_list_add_btn(list, NULL, "Normal");
+    lv_test_assert_int_eq(1, lv_list_get_size(list), "Normal buttons can be added again");
+
+    lv_obj_del(list);
+}
+
+static void virtual_measure(void)
+{
+    lv_test_print("");
+    lv_test_print("Measure a bound item:");
+    lv_test_print("---------------------");
+
+    lv_obj_t * list = list_create(ITEM_CNT);
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_coord_t one_line_h = ext->virt_item_h;
+
+    lv_list_set_virtual(list, ITEM_CNT, bind_two_lines_cb);
+    lv_test_assert_int_gt(one_line_h, ext->virt_item_h, "Taller items with two lines");
+
+    lv_coord_t btn_h = lv_obj_get_height(ext->virt_btns[0].btn);
+    lv_style_int_t pad_inner = lv_obj_get_style_pad_inner(lv_page_get_scrollable(list), LV_CONT_PART_MAIN);
+    lv_test_assert_int_eq(btn_h + pad_inner, ext->virt_item_h, "The item height is the height of a bound button");
+
+    lv_obj_del(list);
+}
+
+static void virtual_reject(void)
+{
+    lv_test_print("");
+    lv_test_print("Reject the normal list API in virtual mode:");
+    lv_test_print("-------------------------------------------");
+
+    lv_obj_t * list = list_create(ITEM_CNT);
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+    uint16_t btn_cnt = ext->virt_btn_cnt;
+
+    lv_test_assert_true(lv_list_add_btn(list, NULL, "Extra") == NULL, "No button is added");
+    lv_test_assert_true(lv_list_remove(list, 0) == false, "No button is removed");
+    lv_test_assert_int_eq(btn_cnt, lv_obj_count_children(scrl), "The recycled buttons are kept");
+    lv_test_assert_int_eq(ITEM_CNT, lv_list_get_size(list), "The number of items is kept");
+
+    /*Focus the last, partially visible item*/
+    int32_t id = ext->virt_btn_cnt - 2;
+    lv_obj_t * btn = NULL;
+    uint16_t i;
+    for(i = 0; i < ext->virt_btn_cnt; i++) {
+        if(lv_list_get_virtual_id(list, ext->virt_btns[i].btn) == id) btn = ext->virt_btns[i].btn;
+    }
+    lv_test_assert_true(btn != NULL, "A button is bound to the item");
+    if(btn) {
+        lv_list_focus(btn, LV_ANIM_ON);
+        lv_test_assert_int_eq(id, lv_list_get_virtual_id(list, btn), "The focused button keeps its item");
+        lv_test_assert_true(btn->coords.y2 <= list->coords.y2, "The focused button is visible");
+    }
+
+    lv_obj_del(list);
+}
+
+static void virtual_navigate(void)
+{
+    lv_test_print("");
+    lv_test_print("Navigate by items in virtual mode:");
+    lv_test_print("----------------------------------");
+
+    lv_obj_t * list = list_create(ITEM_CNT);
+    lv_list_ext_t * ext = lv_obj_get_ext_attr(list);
+    lv_style_int_t bg_top = lv_obj_get_style_pad_top(list, LV_PAGE_PART_BG);
+    lv_style_int_t bg_bottom = lv_obj_get_style_pad_bottom(list, LV_PAGE_PART_BG);
+    uint32_t step_cnt = 3 * ext->virt_btn_cnt;
+    scroll(list, (ITEM_CNT / 2) * ext->virt_item_h);
+
+    /*The first step shows the partially visible item, the others show the next item on the bottom*/
+    lv_list_up(list);
+    int32_t first_id = get_id_at(list, list->coords.y2 - bg_bottom - 1);
+    bool ok = true;
+    uint32_t i;
+    for(i = 1; i < step_cnt; i++) {
+        lv_list_up(list);
+        if(get_id_at(list, list->coords.y2 - bg_bottom - 1) != first_id + (int32_t)i) ok = false;
+    }
+    lv_test_assert_true(ok, "lv_list_up shows the items one by one");
+
+    /*Each step shows the previous item on the top*/
+    lv_list_down(list);
+    first_id = get_id_at(list, list->coords.y1 + bg_top + 1);
+    ok = true;
+    for(i = 1; i < step_cnt; i++) {
+        lv_list_down(list);
+        if(get_id_at(list, list->coords.y1 + bg_top + 1) != first_id - (int32_t)i) ok = false;
+    }
+    lv_test_assert_true(ok, "lv_list_down shows the items one by one");
+
+#if LV_USE_GROUP
+    lv_group_t * g = lv_group_create();
+    lv_group_add_obj(g, list);
+
+    /*Step beyond the visible items and beyond the window of the scrollable*/
+    uint32_t key_cnt = ext->virt_win_cnt + 10;
+    ok = true;
+    for(i = 0; i < key_cnt; i++) {
+        lv_group_send_data(g, LV_KEY_DOWN);
+        lv_obj_t * btn = lv_list_get_btn_selected(list);
+        if(btn == NULL || lv_list_get_virtual_id(list, btn) != (int32_t)i) ok = false;
+        else if(btn->coords.y1 < list->coords.y1 || btn->coords.y2 > list->coords.y2) ok = false;
+    }
+    lv_test_assert_true(ok, "The down key selects the next item and shows it");
+
+    lv_group_send_data(g, LV_KEY_UP);
+    lv_group_send_data(g, LV_KEY_UP);
+    lv_obj_t * sel = lv_list_get_btn_selected(list);
+    lv_test_assert_int_eq(key_cnt - 3, lv_list_get_virtual_id(list, sel), "The up key selects the previous item");
+
+    lv_group_del(g);
+#endif
+
+    lv_obj_del(list);
+}
+
+#if LV_MEM_CUSTOM
+static void benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("List benchmark:");
+    lv_test_print("---------------");
+
+    uint32_t t_start = custom_tick_get();
+    lv_obj_t * list = lv_list_create(lv_scr_act(), NULL);
+    lv_obj_set_size(list, LV_HOR_RES_MAX / 2, LV_VER_RES_MAX / 2);
+    uint32_t i;
+    for(i = 0; i < BENCH_SMALL_CNT; i++) {
+        char buf[32];
+        lv_snprintf(buf, sizeof(buf), "Item %d", (int)i);
+        lv_list_add_btn(list, NULL, buf);
+    }
+    uint32_t t_create = custom_tick_get() - t_start;
+    uint32_t t_scroll = scroll_run(list);
+    lv_obj_del(list);
+
+    t_start = custom_tick_get();
+    list = list_create(BENCH_SMALL_CNT);
+    uint32_t t_create_virt = custom_tick_get() - t_start;
+    uint32_t t_scroll_virt = scroll_run(list);
+    lv_obj_del(list);
+
+    t_start = custom_tick_get();
+    list = list_create(ITEM_CNT);
+    uint32_t t_create_virt_large = custom_tick_get() - t_start;
+    uint32_t t_scroll_virt_large = scroll_run(list);
+    lv_obj_del(list);
+
+    lv_test_print("Create and %d scroll frames: %d buttons %d + %d ms, %d virtual items %d + %d ms, "
+                  "%d virtual items %d + %d ms", BENCH_FRAMES,
+                  BENCH_SMALL_CNT, (int)t_create, (int)t_scroll,
+                  BENCH_SMALL_CNT, (int)t_create_virt, (int)t_scroll_virt,
+                  ITEM_CNT, (int)t_create_virt_large, (int)t_scroll_virt_large);
+}
+
+/**
+ * Scroll a list by small steps and refresh it after each
+ * @return the elapsed time in ms
+ */
+static uint32_t scroll_run(lv_obj_t * list)
+{
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+    lv_refr_now(NULL);
+
+    /*The LVGL tick is incremented manually so measure the real time with the system time*/
+    uint32_t t_start = custom_tick_get();
+    uint32_t i;
+    for(i = 0; i < BENCH_FRAMES; i++) {
+        lv_obj_set_y(scrl, lv_obj_get_y(scrl) - BENCH_STEP);
+        lv_refr_now(NULL);
+    }
+
+    return custom_tick_get() - t_start;
+}
+#endif
+
+/**
+ * Create a list in virtual mode
+ */
+static lv_obj_t * list_create(uint32_t cnt)
+{
+    lv_obj_t * list = lv_list_create(lv_scr_act(), NULL);
+    lv_obj_set_size(list, LV_HOR_RES_MAX / 2, LV_VER_RES_MAX / 2);
+    lv_list_set_virtual(list, cnt, bind_cb);
+
+    return list;
+}
+
+static void bind_cb(lv_obj_t * list, lv_obj_t * btn, uint32_t id)
+{
+    (void)list;
+    lv_label_set_text_fmt(lv_list_get_btn_label(btn), "Item %d", (int)id);
+    bind_cnt++;
+}
+
+static void bind_two_lines_cb(lv_obj_t * list, lv_obj_t * btn, uint32_t id)
+{
+    (void)list;
+    lv_obj_t * label = lv_list_get_btn_label(btn);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_BREAK);
+    lv_label_set_text_fmt(label, "Item %d\nSecond line", (int)id);
+}
+
+/**
+ * Scroll a list like dragging, in small steps
+ */
+static void scroll(lv_obj_t * list, int32_t dist)
+{
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+    while(dist != 0) {
+        int32_t d = LV_MATH_MIN(LV_MATH_ABS(dist), SCROLL_STEP);
+        if(dist < 0) d = -d;
+        lv_obj_set_y(scrl, lv_obj_get_y(scrl) - d);
+        dist -= d;
+    }
+}
+
+/**
+ * Get the text of the visible list button at a y coordinate
+ */
+static const char * get_text_at(lv_obj_t * list, lv_coord_t y)
+{
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+    lv_obj_t * btn;
+    _LV_LL_READ(scrl->child_ll, btn) {
+        if(lv_obj_get_hidden(btn) == false && btn->coords.y1 <= y && btn->coords.y2 >= y) {
+            return lv_list_get_btn_text(btn);
+        }
+    }
+
+    return "";
+}
+/**
+ * Get the item of the visible list button at a y coordinate
+ */
+static int32_t get_id_at(lv_obj_t * list, lv_coord_t y)
+{
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+    lv_obj_t * btn;
+    _LV_LL_READ(scrl->child_ll, btn) {
+        if(lv_obj_get_hidden(btn) == false && btn->coords.y1 <= y && btn->coords.y2 >= y) {
+            return lv_list_get_virtual_id(list, btn);
+        }
+    }
+
+    return -1;
+}
+#endif
+
+#endif
@@ -0,0 +1,303 @@
+/**
+ * @file lv_test_page.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_page.h"
+#include <string.h>
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SCROLL_STEP     7
+#define SCROLL_FRAMES   20
+#define BENCH_FRAMES    100
+#define ITEM_CNT        15
+
+/*Without anti-aliasing a few pixels of the letters depend on the clip area:
+ *only the first row of a letter's mask is rounded. A wrong move differs in a few thousand pixels.*/
+#if LV_ANTIALIAS
+#define DIFF_PX_DIV     0
+#else
+#define DIFF_PX_DIV     50
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_LIST
+static void scroll_blit(void);
+static void scroll_fallback(void);
+#if LV_MEM_CUSTOM
+static void benchmark(void);
+#endif
+static lv_obj_t * list_create(void);
+static uint32_t scroll(lv_obj_t * list, lv_coord_t step, uint32_t frame_cnt);
+static bool same_as_full_redraw(lv_obj_t * page);
+static void refr_full(void);
+static void monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_LIST
+static lv_color_t buf1[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+static lv_color_t buf2[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+static lv_color_t ref_fb[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+static uint32_t max_px_num;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_page(void)
+{
+#if LV_USE_LIST
+    lv_test_print("");
+    lv_test_print("===================");
+    lv_test_print("Start lv_page tests");
+    lv_test_print("===================");
+
+    /*Scrolling with blit needs two screen sized buffers*/
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_disp_buf_t * buf_ori = disp->driver.buffer;
+    static lv_disp_buf_t disp_buf;
+    lv_disp_buf_init(&disp_buf, buf1, buf2, LV_HOR_RES_MAX * LV_VER_RES_MAX);
+    disp->driver.buffer = &disp_buf;
+    disp->driver.monitor_cb = monitor_cb;
+#if LV_COLOR_SCREEN_TRANSP
+    /*The flushed buffer is cleared for transparent screens*/
+    uint32_t screen_transp_ori = disp->driver.screen_transp;
+    disp->driver.screen_transp = 0;
+#endif
+
+    scroll_blit();
+    scroll_fallback();
+#if LV_MEM_CUSTOM
+    benchmark();
+#endif
+
+#if LV_COLOR_SCREEN_TRANSP
+    disp->driver.screen_transp = screen_transp_ori;
+#endif
+    disp->driver.monitor_cb = NULL;
+    disp->driver.buffer = buf_ori;
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_LIST
+static void scroll_blit(void)
+{
+    lv_test_print("");
+    lv_test_print("Scroll by moving the rendered content:");
+    lv_test_print("--------------------------------------");
+
+    /*Copy an empty list to keep the memory usage low*/
+    lv_obj_t * ori = lv_list_create(lv_scr_act(), NULL);
+    lv_list_set_scroll_blit(ori, true);
+    lv_obj_t * copy = lv_list_create(lv_scr_act(), ori);
+    lv_test_assert_true(lv_list_get_scroll_blit(copy), "Scroll blit is copied with the list");
+    lv_obj_del(copy);
+    copy = lv_page_create(lv_scr_act(), ori);
+    lv_test_assert_true(lv_page_get_scroll_blit(copy), "Scroll blit is copied with the page");
+    lv_obj_del(copy);
+    lv_obj_del(ori);
+
+    lv_obj_t * list = list_create();
+    refr_full();
+
+    lv_test_assert_true(lv_list_get_scroll_blit(list) == false, "Scroll blit is disabled by default");
+    lv_list_set_scroll_blit(list, true);
+    lv_test_assert_true(lv_list_get_scroll_blit(list), "Scroll blit enabled");
+
+    uint32_t list_px = lv_area_get_size(&list->coords);
+
+    max_px_num = 0;
+    scroll(list, -SCROLL_STEP, SCROLL_FRAMES);
+    lv_test_assert_int_lt(list_px / 2, max_px_num, "Only the exposed parts are redrawn");
+    lv_test_assert_true(same_as_full_redraw(list), "Same pixels as the full redraw when scrolled up");
+
+    max_px_num = 0;
+    scroll(list, SCROLL_STEP, SCROLL_FRAMES / 2);
+    lv_test_assert_int_lt(list_px / 2, max_px_num, "Only the exposed parts are redrawn");
+    lv_test_assert_true(same_as_full_redraw(list), "Same pixels as the full redraw when scrolled down");
+
+    /*Several moves in one refresh period are added*/
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+    lv_obj_set_y(scrl, lv_obj_get_y(scrl) - 3);
+    lv_obj_set_y(scrl, lv_obj_get_y(scrl) - 5);
+    lv_refr_now(NULL);
+    lv_test_assert_true(same_as_full_redraw(list), "Same pixels as the full redraw with more moves in one refresh");
+
+    /*A changed button is redrawn on its new position*/
+    lv_obj_t * btn = lv_list_get_next_btn(list, NULL);
+    lv_obj_set_state(btn, LV_STATE_CHECKED);
+    scroll(list, -SCROLL_STEP, 1);
+    lv_test_assert_true(same_as_full_redraw(list), "Same pixels as the full redraw with a changed button");
+
+    lv_obj_del(list);
+}
+
+static void scroll_fallback(void)
+{
+    lv_test_print("");
+    lv_test_print("Redraw if the content can't be moved:");
+    lv_test_print("-------------------------------------");
+
+    lv_obj_t * list = list_create();
+    lv_list_set_scroll_blit(list, true);
+    uint32_t list_px = lv_area_get_size(&list->coords);
+
+    /*An object above the list would be moved too*/
+    lv_obj_t * overlay = lv_obj_create(lv_scr_act(), NULL);
+    lv_obj_set_pos(overlay, lv_obj_get_x(list) + 20, lv_obj_get_y(list) + 20);
+    lv_obj_set_size(overlay, 40, 40);
+    refr_full();
+
+    max_px_num = 0;
+    scroll(list, -SCROLL_STEP, 3);
+    lv_test_assert_int_gt(list_px - 1, max_px_num, "Redrawn with an object above");
+    lv_test_assert_true(same_as_full_redraw(list), "Same pixels as the full redraw with an object above");
+    lv_obj_del(overlay);
+
+    /*Only the screen sized buffers keep the previous frame*/
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_disp_buf_t * buf_tmp = disp->driver.buffer;
+    static lv_disp_buf_t disp_buf;
+    lv_disp_buf_init(&disp_buf, buf1, NULL, LV_HOR_RES_MAX * LV_VER_RES_MAX);
+    disp->driver.buffer = &disp_buf;
+    refr_full();
+
+    max_px_num = 0;
+    scroll(list, -SCROLL_STEP, 3);
+    lv_test_assert_int_gt(list_px - 1, max_px_num, "Redrawn with one buffer");
+
+    disp->driver.buffer = buf_tmp;
+    lv_obj_del(list);
+}
+
+#if LV_MEM_CUSTOM
+static void benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Scroll benchmark:");
+    lv_test_print("-----------------");
+
+    lv_obj_t * list = list_create();
+    refr_full();
+    max_px_num = 0;
+    uint32_t t_redraw = scroll(list, -1, BENCH_FRAMES);
+    uint32_t px_redraw = max_px_num;
+
+    lv_list_set_scroll_blit(list, true);
+    refr_full();
+    max_px_num = 0;
+    uint32_t t_blit = scroll(list, 1, BENCH_FRAMES);
+    uint32_t px_blit = max_px_num;
+
+    lv_test_print("%d frames of scrolling a list: redraw %d ms (%d px/frame), blit %d ms (%d px/frame)", BENCH_FRAMES,
+                  (int)t_redraw, (int)px_redraw, (int)t_blit, (int)px_blit);
+
+    lv_obj_del(list);
+}
+#endif
+
+static lv_obj_t * list_create(void)
+{
+    lv_obj_t * list = lv_list_create(lv_scr_act(), NULL);
+    lv_obj_set_size(list, LV_HOR_RES / 2, LV_VER_RES - 20);
+    lv_obj_set_pos(list, 10, 10);
+
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT; i++) {
+        char buf[32];
+        lv_snprintf(buf, sizeof(buf), "Item %d", (int)i);
+        lv_list_add_btn(list, NULL, buf);
+    }
+
+    return list;
+}
+
+/**
+ * Scroll a list by moving its scrollable and refresh only the invalidated areas
+ * @return the elapsed time in ms
+ */
+static uint32_t scroll(lv_obj_t * list, lv_coord_t step, uint32_t frame_cnt)
+{
+    lv_obj_t * scrl = lv_page_get_scrollable(list);
+
+    /*The LVGL tick is incremented manually so measure the real time with the system time*/
+    uint32_t t_start = custom_tick_get();
+    uint32_t i;
+    for(i = 0; i < frame_cnt; i++) {
+        lv_obj_set_y(scrl, lv_obj_get_y(scrl) + step);
+        lv_refr_now(NULL);
+    }
+
+    return custom_tick_get() - t_start;
+}
+
+/**
+ * Compare the screen with a full redraw
+ * @param page the scrolled page. Without anti-aliasing the allowed number of different pixels
+ *             is `1 / DIFF_PX_DIV` of its area.
+ * @return true: the same pixels
+ */
+static bool same_as_full_redraw(lv_obj_t * page)
+{
+    extern lv_color_t test_fb[];
+    _lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+    refr_full();
+
+#if DIFF_PX_DIV == 0
+    LV_UNUSED(page);
+    return memcmp(ref_fb, test_fb, sizeof(ref_fb)) == 0;
+#else
+    uint32_t diff_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < LV_HOR_RES_MAX * LV_VER_RES_MAX; i++) {
+        if(ref_fb[i].full != test_fb[i].full) diff_cnt++;
+    }
+
+    lv_test_print("%d different pixels", (int)diff_cnt);
+    return diff_cnt <= lv_area_get_size(&page->coords) / DIFF_PX_DIV;
+#endif
+}
+
+static void refr_full(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+static void monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(time);
+
+    if(px > max_px_num) max_px_num = px;
+}
+#endif
+
+#endif
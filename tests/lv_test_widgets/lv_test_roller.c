@@ -0,0 +1,183 @@
+/**
+ * @file lv_test_roller.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_roller.h"
+#include <string.h>
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BENCH_OPT_CNT   100
+#define BENCH_FRAMES    200
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_ROLLER
+static void options(void);
+static void same_pixels(void);
+#if LV_MEM_CUSTOM
+static void benchmark(void);
+#endif
+static void refr_scr(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_USE_ROLLER
+static const char * opts = "One\nTwo\nThree\nFour\nFive\nSix\nSeven\nEight\nNine\nTen";
+static lv_color_t ref_fb[LV_HOR_RES_MAX * LV_VER_RES_MAX];
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_roller(void)
+{
+#if LV_USE_ROLLER
+    lv_test_print("");
+    lv_test_print("=====================");
+    lv_test_print("Start lv_roller tests");
+    lv_test_print("=====================");
+
+    options();
+    same_pixels();
+#if LV_MEM_CUSTOM
+    benchmark();
+#endif
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_ROLLER
+static void options(void)
+{
+    lv_test_print("");
+    lv_test_print("Store the options once:");
+    lv_test_print("-----------------------");
+
+    lv_obj_t * roller = lv_roller_create(lv_scr_act(), NULL);
+    lv_roller_set_options(roller, opts, LV_ROLLER_MODE_INFINITE);
+
+    lv_test_assert_str_eq(opts, lv_roller_get_options(roller), "Options are not repeated in infinite mode");
+    lv_test_assert_int_eq(10, lv_roller_get_option_cnt(roller), "Option count in infinite mode");
+
+    char buf[16];
+    lv_roller_set_selected(roller, 2, LV_ANIM_OFF);
+    lv_roller_get_selected_str(roller, buf, sizeof(buf));
+    lv_test_assert_str_eq("Three", buf, "Selected option");
+
+    lv_roller_set_selected(roller, 9, LV_ANIM_OFF);
+    lv_roller_get_selected_str(roller, buf, sizeof(buf));
+    lv_test_assert_int_eq(9, lv_roller_get_selected(roller), "Last option selected");
+    lv_test_assert_str_eq("Ten", buf, "Last option has no new line");
+
+    lv_obj_t * copy = lv_roller_create(lv_scr_act(), roller);
+    lv_roller_get_selected_str(copy, buf, sizeof(buf));
+    lv_test_assert_str_eq("Ten", buf, "Selected option of the copy");
+
+    lv_obj_del(copy);
+    lv_obj_del(roller);
+}
+
+static void same_pixels(void)
+{
+    lv_test_print("");
+    lv_test_print("Draw the same pixels in both modes:");
+    lv_test_print("-----------------------------------");
+
+    extern lv_color_t test_fb[];
+    uint32_t fb_size = LV_HOR_RES_MAX * LV_VER_RES_MAX * sizeof(lv_color_t);
+
+    lv_obj_t * roller = lv_roller_create(lv_scr_act(), NULL);
+    lv_roller_set_options(roller, opts, LV_ROLLER_MODE_NORMAL);
+    lv_roller_set_visible_row_count(roller, 5);
+    lv_roller_set_selected(roller, 4, LV_ANIM_OFF);
+    refr_scr();
+    _lv_memcpy(ref_fb, test_fb, fb_size);
+
+    /*The neighbours of the middle option are on the same page in infinite mode*/
+    lv_roller_set_options(roller, opts, LV_ROLLER_MODE_INFINITE);
+    lv_roller_set_selected(roller, 4, LV_ANIM_OFF);
+    refr_scr();
+    lv_test_assert_true(memcmp(ref_fb, test_fb, fb_size) == 0, "Same pixels in normal and infinite mode");
+
+    /*The options of the previous page are drawn above the first option*/
+    lv_roller_set_selected(roller, 0, LV_ANIM_OFF);
+    refr_scr();
+    lv_test_assert_true(memcmp(ref_fb, test_fb, fb_size) != 0, "Other pixels with other option");
+
+    lv_obj_del(roller);
+}
+
+#if LV_MEM_CUSTOM
+static void benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Roller benchmark:");
+    lv_test_print("-----------------");
+
+    char * long_opts = lv_mem_alloc(BENCH_OPT_CNT * 8);
+    LV_ASSERT_MEM(long_opts);
+    if(long_opts == NULL) return;
+
+    uint32_t i;
+    char * p = long_opts;
+    for(i = 0; i < BENCH_OPT_CNT; i++) {
+        p += lv_snprintf(p, 8, "%d\n", (int)i);
+    }
+    p[-1] = '\0';
+
+    lv_obj_t * roller = lv_roller_create(lv_scr_act(), NULL);
+    lv_roller_set_options(roller, long_opts, LV_ROLLER_MODE_INFINITE);
+    lv_roller_set_selected(roller, BENCH_OPT_CNT / 2, LV_ANIM_OFF);
+    lv_mem_free(long_opts);
+    refr_scr();
+
+    /*Scroll the options like an animation does*/
+    lv_obj_t * scrl = lv_page_get_scrl(roller);
+    lv_coord_t y = lv_obj_get_y(scrl);
+    uint32_t t_start = custom_tick_get();
+    for(i = 0; i < BENCH_FRAMES; i++) {
+        lv_obj_set_y(scrl, y - (lv_coord_t)(i % 50) * 3);
+        lv_refr_now(NULL);
+    }
+    uint32_t t = custom_tick_get() - t_start;
+
+    lv_test_print("%d frames of scrolling an infinite roller with %d options: %d ms", BENCH_FRAMES, BENCH_OPT_CNT,
+                  (int)t);
+
+    lv_obj_del(roller);
+}
+#endif
+
+static void refr_scr(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+#endif
+
+#endif
@@ -0,0 +1,190 @@
+/**
+ * @file lv_test_table.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lvgl.h"
+#include "../lv_test_assert.h"
+#include "lv_test_table.h"
+
+#if LV_BUILD_TEST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ROW_CNT         30
+#define BENCH_ROW_CNT   1000
+#define BENCH_FRAMES    50
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_TABLE
+static void row_offsets(void);
+static void row_invalidation(void);
+#if LV_MEM_CUSTOM
+static void benchmark(void);
+#endif
+static lv_obj_t * table_create(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_table(void)
+{
+#if LV_USE_TABLE
+    lv_test_print("");
+    lv_test_print("====================");
+    lv_test_print("Start lv_table tests");
+    lv_test_print("====================");
+
+    row_offsets();
+    row_invalidation();
+#if LV_MEM_CUSTOM
+    benchmark();
+#endif
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_TABLE
+static void row_offsets(void)
+{
+    lv_test_print("");
+    lv_test_print("Update the row offsets incrementally:");
+    lv_test_print("-------------------------------------");
+
+    lv_obj_t * table = table_create();
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+
+    /*Change the rows in random order with single and multi line texts, merged and cropped cells*/
+    uint32_t i;
+    for(i = 0; i < ROW_CNT * 3; i++) {
+        uint16_t row = (i * 7) % ROW_CNT;
+        uint16_t col = i % 3;
+        lv_table_set_cell_value(table, row, col, (i % 4) == 0 ? "Line 1\nLine 2" : "Text");
+        if((i % 5) == 0) lv_table_set_cell_merge_right(table, row, 0, true);
+        if((i % 6) == 0) lv_table_set_cell_crop(table, row, col, true);
+    }
+    lv_table_set_cell_value(table, ROW_CNT - 1, 2, "A long text which is wrapped to many lines");
+    lv_table_set_cell_value(table, 0, 0, "Shorter");
+
+    static lv_coord_t row_h[ROW_CNT];
+    static lv_coord_t row_y[ROW_CNT + 1];
+    _lv_memcpy(row_h, ext->row_h, sizeof(row_h));
+    _lv_memcpy(row_y, ext->row_y, sizeof(row_y));
+    lv_coord_t h = lv_obj_get_height(table);
+
+    /*Measure all rows again*/
+    lv_table_set_col_width(table, 0, lv_table_get_col_width(table, 0));
+
+    lv_test_assert_array_eq((uint8_t *)ext->row_h, (uint8_t *)row_h, sizeof(row_h), "Same row heights as measuring all rows");
+    lv_test_assert_array_eq((uint8_t *)ext->row_y, (uint8_t *)row_y, sizeof(row_y), "Same row offsets as measuring all rows");
+    lv_test_assert_int_eq(lv_obj_get_height(table), h, "Same table height as measuring all rows");
+
+    lv_table_set_row_cnt(table, ROW_CNT / 2);
+    lv_coord_t pad_ver = lv_obj_get_style_pad_top(table, LV_TABLE_PART_BG) +
+                         lv_obj_get_style_pad_bottom(table, LV_TABLE_PART_BG);
+    lv_test_assert_int_eq(ext->row_y[ROW_CNT / 2] + pad_ver + 1, lv_obj_get_height(table), "Table height with less rows");
+
+    lv_obj_del(table);
+}
+
+static void row_invalidation(void)
+{
+    lv_test_print("");
+    lv_test_print("Invalidate only the changed rows:");
+    lv_test_print("---------------------------------");
+
+    lv_obj_t * table = table_create();
+    lv_table_ext_t * ext = lv_obj_get_ext_attr(table);
+    lv_disp_t * disp = lv_obj_get_disp(table);
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) lv_table_set_cell_value(table, i, 0, "Text");
+    lv_refr_now(NULL);
+
+    lv_table_set_cell_value(table, 2, 1, "Text");
+    lv_test_assert_int_eq(1, disp->inv_p, "One area is invalidated");
+    lv_test_assert_int_eq(ext->row_h[1] + ext->row_h[2] + ext->row_h[3], lv_area_get_height(&disp->inv_areas[0]),
+                          "The row and its neighbors are invalidated if the height is the same");
+    lv_refr_now(NULL);
+
+    lv_table_set_cell_value(table, 2, 1, "Line 1\nLine 2");
+    lv_test_assert_int_gt(ext->row_h[1] + ext->row_h[2] + ext->row_h[3], lv_area_get_height(&disp->inv_areas[0]),
+                          "The rows below are invalidated too if the height is changed");
+    lv_refr_now(NULL);
+
+    lv_obj_del(table);
+}
+
+#if LV_MEM_CUSTOM
+static void benchmark(void)
+{
+    lv_test_print("");
+    lv_test_print("Table benchmark:");
+    lv_test_print("----------------");
+
+    lv_obj_t * table = table_create();
+
+    /*The LVGL tick is incremented manually so measure the real time with the system time*/
+    uint32_t t_start = custom_tick_get();
+    uint32_t i;
+    for(i = 0; i < BENCH_ROW_CNT; i++) {
+        lv_table_set_cell_value_fmt(table, i, 0, "%d", (int)i);
+        lv_table_set_cell_value(table, i, 1, "INFO");
+        lv_table_set_cell_value_fmt(table, i, 2, "Log message %d", (int)i);
+    }
+    uint32_t t_fill = custom_tick_get() - t_start;
+
+    /*Show rows from the middle of the table*/
+    lv_obj_set_y(table, -lv_obj_get_height(table) / 2);
+    t_start = custom_tick_get();
+    for(i = 0; i < BENCH_FRAMES; i++) {
+        lv_obj_invalidate(table);
+        lv_refr_now(NULL);
+    }
+    uint32_t t_draw = custom_tick_get() - t_start;
+
+    lv_test_print("%d rows: fill %d ms, %d redraws %d ms", BENCH_ROW_CNT, (int)t_fill, BENCH_FRAMES, (int)t_draw);
+
+    lv_obj_del(table);
+}
+#endif
+
+/**
+ * Create a table with 3 columns and small cell paddings
+ */
+static lv_obj_t * table_create(void)
+{
+    lv_obj_t * table = lv_table_create(lv_scr_act(), NULL);
+    lv_obj_set_style_local_pad_all(table, LV_TABLE_PART_CELL1, LV_STATE_DEFAULT, 2);
+    lv_table_set_col_cnt(table, 3);
+    lv_table_set_col_width(table, 0, LV_HOR_RES_MAX / 6);
+    lv_table_set_col_width(table, 1, LV_HOR_RES_MAX / 6);
+    lv_table_set_col_width(table, 2, LV_HOR_RES_MAX / 3);
+
+    return table;
+}
+#endif
+
+#endif